@@ -35,19 +35,17 @@ template <typename T, size_t max_size> class DelayLineReverse {
   public:
     DelayLineReverse() {}
     ~DelayLineReverse() {}
-    /** initializes the delay line by clearing the values within, and setting delay to min time.
+    /** initializes the delay line as silent, and sets delay to min time.
      */
     void Init() { Reset(); }
-    /** clears buffer, sets write ptr to 0, and delay to 1 sample.
+    /** forgets the contents of the buffer (in constant time, see At), sets write ptr to 0, and delay to 1 sample.
      */
     void Reset() {
 
         delay1_ = 2400;  // min Reverse delay time
         fadetime = 2300; // in samples
 
-        for (size_t i = 0; i < max_size; i++) {
-            line_[i] = T(0);
-        }
+        written_ = 0;
         write_ptr_ = 0;
         read_ptr1_ = 0;
         read_ptr2_ = 0;
@@ -80,6 +78,7 @@ template <typename T, size_t max_size> class DelayLineReverse {
      */
     inline void Write(const T sample) {
         line_[write_ptr_] = sample;
+        written_ = written_ < max_size ? written_ + 1 : max_size;
         // advance write ptr in forward direction
         write_ptr_ = (write_ptr_ + 1 + max_size) % max_size; // increment forwards
 
@@ -141,8 +140,8 @@ template <typename T, size_t max_size> class DelayLineReverse {
     /** returns the next sample of type T in the delay line, interpolated if necessary.
      */
     inline const T ReadRev() const {
-        T a1 = line_[read_ptr1_];
-        T a2 = line_[(read_ptr2_)];
+        T a1 = At(read_ptr1_);
+        T a2 = At(read_ptr2_);
 
         // T a1 = line_[read_ptr1_];
         // T a2 = line_[(read_ptr2_)];
@@ -169,18 +168,24 @@ template <typename T, size_t max_size> class DelayLineReverse {
      */
     inline const T ReadFwd() const // read forward as feedback signal
     {
-        T a = line_[(write_ptr_ * indexMultiplier_ + delay1_) % max_size];
-        T b = line_[(write_ptr_ * indexMultiplier_ + delay1_ + 1) % max_size];
+        T a = At((write_ptr_ * indexMultiplier_ + delay1_) % max_size);
+        T b = At((write_ptr_ * indexMultiplier_ + delay1_ + 1) % max_size);
         return a + (b - a) * frac1_;
     }
 
   private:
+    /** returns the sample at an index of the buffer, silence if it hasn't been written since the last Reset. The line
+        is written upwards from index 0, so the written span is the bottom written_ indices.
+    */
+    inline const T At(size_t index) const { return written_ >= max_size || index < written_ ? line_[index] : T(0); }
+
     float frac1_;
     size_t write_ptr_;
     size_t read_ptr1_;
     size_t read_ptr2_;
     size_t delay1_;
     size_t headDiff_;
+    size_t written_; // Samples written since the last Reset, the whole line is valid once it reaches max_size
     T line_[max_size];
     size_t fadetime;
     bool playinghead_;
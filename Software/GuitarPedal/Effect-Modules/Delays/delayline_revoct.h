@@ -20,15 +20,13 @@ template <typename T, size_t max_size> class DelayLineRevOct {
   public:
     DelayLineRevOct() {}
     ~DelayLineRevOct() {}
-    /** initializes the delay line by clearing the values within, and setting delay to 1 sample.
+    /** initializes the delay line as silent, and sets delay to 1 sample.
      */
     void Init() { Reset(); }
-    /** clears buffer, sets write ptr to 0, and delay to 1 sample.
+    /** forgets the contents of the buffer (in constant time, see At), sets write ptr to 0, and delay to 1 sample.
      */
     void Reset() {
-        for (size_t i = 0; i < max_size; i++) {
-            line_[i] = T(0);
-        }
+        written_ = 0;
         write_ptr_ = 0;
         delay_ = 1;
         speed = 1;
@@ -84,22 +82,23 @@ template <typename T, size_t max_size> class DelayLineRevOct {
      */
     inline void Write(const T sample) {
         line_[write_ptr_] = sample;
+        written_ = written_ < max_size ? written_ + 1 : max_size;
         write_ptr_ = (write_ptr_ - 1 + max_size) % max_size;
     }
 
     /** returns the next sample of type T in the delay line, interpolated if necessary.
      */
     inline const T Read() const {
-        T a = line_[(write_ptr_ * speed + delay_) % max_size];
-        T b = line_[(write_ptr_ * speed + delay_ + 1) % max_size];
+        T a = At((write_ptr_ * speed + delay_) % max_size);
+        T b = At((write_ptr_ * speed + delay_ + 1) % max_size);
         return a + (b - a) * frac_;
     }
 
     inline const T ReadSecondTap() const {
 
-        T c = line_[(write_ptr_ * speed + delay_ + delay_secondTap) %
-                    max_size]; // TODO IS pointer correct? was  "write_ptr_ * speed + delay_secondTap"
-        T d = line_[(write_ptr_ * speed + delay_ + delay_secondTap + 1) % max_size];
+        T c = At((write_ptr_ * speed + delay_ + delay_secondTap) %
+                 max_size); // TODO IS pointer correct? was  "write_ptr_ * speed + delay_secondTap"
+        T d = At((write_ptr_ * speed + delay_ + delay_secondTap + 1) % max_size);
         return c + (d - c) * frac_secondTap;
     }
 
@@ -107,8 +106,8 @@ template <typename T, size_t max_size> class DelayLineRevOct {
     inline const T Read(float delay) const {
         int32_t delay_integral = static_cast<int32_t>(delay);
         float delay_fractional = delay - static_cast<float>(delay_integral);
-        const T a = line_[(write_ptr_ + delay_integral) % max_size];
-        const T b = line_[(write_ptr_ + delay_integral + 1) % max_size];
+        const T a = At((write_ptr_ + delay_integral) % max_size);
+        const T b = At((write_ptr_ + delay_integral + 1) % max_size);
         return a + (b - a) * delay_fractional;
     }
 
@@ -117,10 +116,10 @@ template <typename T, size_t max_size> class DelayLineRevOct {
         float delay_fractional = delay - static_cast<float>(delay_integral);
 
         int32_t t = (write_ptr_ + delay_integral + max_size);
-        const T xm1 = line_[(t - 1) % max_size];
-        const T x0 = line_[(t) % max_size];
-        const T x1 = line_[(t + 1) % max_size];
-        const T x2 = line_[(t + 2) % max_size];
+        const T xm1 = At((t - 1) % max_size);
+        const T x0 = At((t) % max_size);
+        const T x1 = At((t + 1) % max_size);
+        const T x2 = At((t + 2) % max_size);
         const float c = (x1 - xm1) * 0.5f;
         const float v = x0 - x1;
         const float w = c + v;
@@ -131,16 +130,28 @@ template <typename T, size_t max_size> class DelayLineRevOct {
     }
 
     inline const T Allpass(const T sample, size_t delay, const T coefficient) {
-        T read = line_[(write_ptr_ + delay) % max_size];
+        T read = At((write_ptr_ + delay) % max_size);
         T write = sample + coefficient * read;
         Write(write);
         return -write * coefficient + read;
     }
 
   private:
+    /** returns the sample at an index of the buffer, silence if it hasn't been written since the last Reset. The line
+        is written downwards from index 0, so the written span is index 0 and the top written_ - 1 indices.
+    */
+    inline const T At(size_t index) const {
+        if (written_ >= max_size || (written_ > 0 && (index == 0 || index > max_size - written_))) {
+            return line_[index];
+        }
+
+        return T(0);
+    }
+
     float frac_;
     size_t write_ptr_;
     size_t delay_;
+    size_t written_; // Samples written since the last Reset, the whole line is valid once it reaches max_size
     T line_[max_size];
     int speed; // Either 1 or 2
 
@@ -0,0 +1,120 @@
+#pragma once
+#ifndef DELAYLINE_WATERMARK_H
+#define DELAYLINE_WATERMARK_H
+#include <stdint.h>
+#include <stdlib.h>
+// namespace daisysp
+//{
+/** Delay line with a constant time Reset, otherwise the same as the daisysp DelayLine.
+
+Instead of clearing the buffer, Reset only forgets how much of it has been written. The line is written downwards from
+index 0, so until it has wrapped once everything outside of the written span reads back as silence. This keeps a long
+line in SDRAM from stalling the caller (ex. the audio callback resetting a delay when it is switched on).
+
+declaration example: (1 second of floats)
+
+DelayLineWatermark<float, SAMPLE_RATE> del;
+*/
+template <typename T, size_t max_size> class DelayLineWatermark {
+  public:
+    DelayLineWatermark() {}
+    ~DelayLineWatermark() {}
+    /** initializes the delay line as silent, and sets delay to 1 sample.
+     */
+    void Init() { Reset(); }
+    /** forgets the contents of the buffer, sets write ptr to 0, and delay to 1 sample.
+     */
+    void Reset() {
+        written_ = 0;
+        write_ptr_ = 0;
+        delay_ = 1;
+        frac_ = 0.0f;
+    }
+
+    /** sets the delay time in samples
+        If a float is passed in, a fractional component will be calculated for interpolating the delay line.
+    */
+    inline void SetDelay(size_t delay) {
+        frac_ = 0.0f;
+        delay_ = delay < max_size ? delay : max_size - 1;
+    }
+
+    /** sets the delay time in samples
+        If a float is passed in, a fractional component will be calculated for interpolating the delay line.
+    */
+    inline void SetDelay(float delay) {
+        int32_t int_delay = static_cast<int32_t>(delay);
+        frac_ = delay - static_cast<float>(int_delay);
+        delay_ = static_cast<size_t>(int_delay) < max_size ? int_delay : max_size - 1;
+    }
+
+    /** writes the sample of type T to the delay line, and advances the write ptr
+     */
+    inline void Write(const T sample) {
+        line_[write_ptr_] = sample;
+        written_ = written_ < max_size ? written_ + 1 : max_size;
+        write_ptr_ = (write_ptr_ - 1 + max_size) % max_size;
+    }
+
+    /** returns the next sample of type T in the delay line, interpolated if necessary.
+     */
+    inline const T Read() const {
+        T a = At((write_ptr_ + delay_) % max_size);
+        T b = At((write_ptr_ + delay_ + 1) % max_size);
+        return a + (b - a) * frac_;
+    }
+
+    /** Read from a set location */
+    inline const T Read(float delay) const {
+        int32_t delay_integral = static_cast<int32_t>(delay);
+        float delay_fractional = delay - static_cast<float>(delay_integral);
+        const T a = At((write_ptr_ + delay_integral) % max_size);
+        const T b = At((write_ptr_ + delay_integral + 1) % max_size);
+        return a + (b - a) * delay_fractional;
+    }
+
+    inline const T ReadHermite(float delay) const {
+        int32_t delay_integral = static_cast<int32_t>(delay);
+        float delay_fractional = delay - static_cast<float>(delay_integral);
+
+        int32_t t = (write_ptr_ + delay_integral + max_size);
+        const T xm1 = At((t - 1) % max_size);
+        const T x0 = At((t) % max_size);
+        const T x1 = At((t + 1) % max_size);
+        const T x2 = At((t + 2) % max_size);
+        const float c = (x1 - xm1) * 0.5f;
+        const float v = x0 - x1;
+        const float w = c + v;
+        const float a = w + v + (x2 - x0) * 0.5f;
+        const float b_neg = w + a;
+        const float f = delay_fractional;
+        return (((a * f) - b_neg) * f + c) * f + x0;
+    }
+
+    inline const T Allpass(const T sample, size_t delay, const T coefficient) {
+        T read = At((write_ptr_ + delay) % max_size);
+        T write = sample + coefficient * read;
+        Write(write);
+        return -write * coefficient + read;
+    }
+
+  private:
+    /** returns the sample at an index of the buffer, silence if it hasn't been written since the last Reset.
+        The written span is index 0 and the top written_ - 1 indices.
+    */
+    inline const T At(size_t index) const {
+        if (written_ >= max_size || (written_ > 0 && (index == 0 || index > max_size - written_))) {
+            return line_[index];
+        }
+
+        return T(0);
+    }
+
+    float frac_;
+    size_t write_ptr_;
+    size_t delay_;
+    size_t written_; // Samples written since the last Reset, the whole line is valid once it reaches max_size
+    T line_[max_size];
+};
+//} // namespace daisysp
+#endif
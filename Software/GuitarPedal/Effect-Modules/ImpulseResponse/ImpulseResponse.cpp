@@ -17,34 +17,41 @@ ImpulseResponse::~ImpulseResponse() {
     // No Code Needed
 }
 
-void ImpulseResponse::Init(std::vector<float> irData) {
-    mRawAudio = irData;
-    _SetWeights();
-}
+void ImpulseResponse::Init(std::span<const float> irData) { _SetWeights(irData); }
 
 float ImpulseResponse::Process(float inputs) {
 
     _UpdateHistory(inputs);
 
-    int j = mHistoryIndex - mHistoryRequired;
-    auto input = Eigen::Map<const Eigen::VectorXf>(&mHistory[j], mHistoryRequired + 1);
+    // The weights are stored reversed, so a shortened IR is the tail of the weights against the most recent history
+    int j = mHistoryIndex - (mActiveLength - 1);
+    auto input = Eigen::Map<const Eigen::VectorXf>(&mHistory[j], mActiveLength);
 
     _AdvanceHistoryIndex(1); // KAB MOD - for Daisy implementation numFrames is always 1
 
-    return (float)mWeight.dot(input);
+    return (float)mWeight.tail(mActiveLength).dot(input);
 }
 
-void ImpulseResponse::_SetWeights() {
+void ImpulseResponse::SetLengthLimit(size_t maxLength) {
+    mLengthLimit = maxLength;
+    mActiveLength = mWeight.size();
+
+    if (mLengthLimit > 0 && mLengthLimit < mActiveLength) {
+        mActiveLength = mLengthLimit;
+    }
+}
 
-    const size_t irLength = std::min(mRawAudio.size(), mMaxLength);
+void ImpulseResponse::_SetWeights(std::span<const float> irData) {
+
+    const size_t irLength = std::min(irData.size(), mMaxLength);
     mWeight.resize(irLength);
     // Gain reduction.
     // https://github.com/sdatkinson/NeuralAmpModelerPlugin/issues/100#issuecomment-1455273839
     // Add sample rate-dependence
     // const float gain = pow(10, -18 * 0.05) * 48000 / mSampleRate;  //KAB NOTE: This made a very bad/loud sound on Daisy Seed
     for (size_t i = 0, j = irLength - 1; i < irLength; i++, j--)
-        // mWeight[j] = gain * mRawAudio[i];
-        mWeight[j] = mRawAudio[i];
+        // mWeight[j] = gain * irData[i];
+        mWeight[j] = irData[i];
     mHistoryRequired = irLength - 1;
 
     // Moved from HISTORY::EnsureHistorySize since only doing once for this module (assuming same size IR's)
@@ -55,4 +62,6 @@ void ImpulseResponse::_SetWeights() {
     mHistory.resize(requiredHistoryArraySize);
     std::fill(mHistory.begin(), mHistory.end(), 0.0f);
     mHistoryIndex = mHistoryRequired;
+
+    SetLengthLimit(mLengthLimit);
 }
@@ -14,27 +14,33 @@
 
 #include "dsp.h"
 #include <Eigen/Dense>
+#include <span>
 
 class ImpulseResponse : public History {
   public:
     ImpulseResponse();
     ~ImpulseResponse();
 
-    void Init(std::vector<float> irData);
+    // Loads an IR, the data is only read during the call so it can stay in flash
+    void Init(std::span<const float> irData);
     float Process(float inputs);
 
+    // Limits how many samples of the loaded IR are used, trading the length of the tail for processing time.
+    // This doesn't reallocate anything so it is safe to call from the audio callback. 0 uses the whole IR.
+    void SetLengthLimit(size_t maxLength);
+
   private:
     // Set the weights, given that the plugin is running at the provided sample
     // rate.
-    void _SetWeights();
+    void _SetWeights(std::span<const float> irData);
 
     // State of audio
-    // Keep a copy of the raw audio that was loaded so that it can be resampled
-    std::vector<float> mRawAudio;
     float mRawAudioSampleRate;
     float mSampleRate;
 
     const size_t mMaxLength = 8192;
+    size_t mLengthLimit = 0;  // Limit set with SetLengthLimit, 0 is no limit
+    size_t mActiveLength = 0; // Number of IR samples used by Process
     // The weights
     Eigen::VectorXf mWeight;
 };
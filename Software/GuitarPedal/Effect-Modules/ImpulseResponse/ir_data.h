@@ -1,8 +1,9 @@
+#include <span>
 
 // IR Test Data, 400 length, 8.3ms (seems to be about the max size working with GRU9, 500 is too much)
 
 // Marshall
-std::vector<float> ir_data1 = {
+constexpr float ir_data1[] = {
     0.19024348,    0.4953071,    0.85037684,    0.9999999,     0.83256125,    0.48705566,   0.1561923,    -0.119377255, -0.35273468,
     -0.4868704,    -0.4183421,   -0.156546,     0.12618601,    0.25293493,    0.21147907,   0.111607194,  0.044607997,  0.019092917,
     0.02890706,    0.072800875,  0.12707841,    0.13928795,    0.0783515,     -0.04704535,  -0.1883508,   -0.2810943,   -0.27005255,
@@ -47,7 +48,7 @@ std::vector<float> ir_data1 = {
 };
 
 // Proteus
-std::vector<float> ir_data2 = {
+constexpr float ir_data2[] = {
     0.09165135,    0.34494776,    0.642427,      0.8733099,     0.9765655,     0.90381545,    0.64580977,    0.26979384,
     -0.09133818,   -0.33001012,   -0.38087615,   -0.27518257,   -0.09180161,   0.07009281,    0.13477188,    0.1134176,
     0.05394234,    0.0002800684,  -0.01746423,   0.0023448383,  0.037010457,   0.07013612,    0.08224031,    0.0646829,
@@ -97,7 +98,7 @@ std::vector<float> ir_data2 = {
 };
 
 // US Deluxe
-std::vector<float> ir_data3 = {
+constexpr float ir_data3[] = {
     0.0034908056,   0.3523475,    0.60503685,     0.95999277,    0.9286411,    0.9942601,     0.5302459,     0.29374087,
     -0.16792,       -0.1814208,   -0.3856635,     -0.28140163,   -0.24453771,  -0.03430164,   -0.014578223,  0.028817415,
     0.053222418,    0.05444622,   0.016842604,    0.032137156,   0.066504955,  0.082255125,   0.04495418,    0.086707234,
@@ -147,7 +148,7 @@ std::vector<float> ir_data3 = {
 };
 
 // Vox Bright
-std::vector<float> ir_data4 = {
+constexpr float ir_data4[] = {
     0.52926904,     0.9913671,      0.7762714,      0.30122554,     0.02760484,     -0.09334413,   -0.17949381,    -0.28187993,
     -0.40910017,    -0.47256044,    -0.37820905,    -0.050660703,   0.25327346,     0.28935027,    0.27218527,     0.2686282,
     0.15352686,     0.07436823,     0.086013064,    0.03662069,     -0.03765196,    -0.025271958,  0.055809543,    0.08330272,
@@ -196,4 +197,4 @@ std::vector<float> ir_data4 = {
     // 0.014446774,0.009726275,0.008847436,0.0059528626,0.0067875218,0.007500149,0.009873512,0.012122091,0.013608628,0.016368914,0.016112251,0.018498972,0.018424312,0.022197433,0.02220375,0.024142576,0.02267084,0.022745766,0.02174164,0.020829141,0.020211931,0.018440062,0.019169701,0.017672582,0.01892792,0.016710838,0.018604191,0.018346699,0.021145618,0.02162157,0.023625748,0.025533015,0.026963178,0.028700838,0.027634833,0.028351722,0.02585701,0.026522428,0.023505192,0.023094479,0.019726042,0.019039115,0.017455809
 };
 
-std::vector<std::vector<float>> ir_collection = {ir_data1, ir_data2, ir_data3, ir_data4};
\ No newline at end of file
+constexpr std::span<const float> ir_collection[] = {ir_data1, ir_data2, ir_data3, ir_data4};
\ No newline at end of file
@@ -1,11 +1,11 @@
-
+#include <span>
 
 // Note: IR code max set: const size_t mMaxLength = 8192;
 
 // IR Test Data, 1024 length, about 21ms
 
 // Rhythm
-std::vector<float> ir_data1_large = {
+constexpr float ir_data1_large[] = {
     0.046251201,  0.179200132,  0.497612301,  0.809093382,  0.968473614,  0.895575125,  0.629770357,  0.290781504,  -0.073328552,
     -0.397698802, -0.531823376, -0.436336748, -0.281665051, -0.091344639, -0.007976450, 0.046298642,  0.002432580,  -0.052711460,
     -0.084476010, -0.028989992, 0.008781866,  0.049625083,  0.053600315,  0.046957565,  0.009418857,  -0.032622770, -0.022539150,
@@ -122,7 +122,7 @@ std::vector<float> ir_data1_large = {
     0.000004605,  0.000009869,  -0.000003927, 0.000019653,  0.000018205,  -0.000008692, -0.000001764};
 
 // Lead
-std::vector<float> ir_data2_large = {
+constexpr float ir_data2_large[] = {
     0.003587602,  0.195320623,  0.504640059,  0.815561508,  0.977169419,  0.905245370,  0.618791326,  0.254091004,  -0.123887666,
     -0.423920554, -0.500789626, -0.381779755, -0.172809246, 0.042449282,  0.119236942,  0.091206608,  0.008857199,  -0.056010367,
     -0.078892805, -0.024160234, 0.044996053,  0.119120844,  0.171389605,  0.164845908,  0.121074012,  0.060450588,  0.017518199,
@@ -238,4 +238,4 @@ std::vector<float> ir_data2_large = {
     0.000205992,  0.000267318,  0.000360519,  0.000447359,  0.000478429,  0.000439439,  0.000368010,  0.000297738,  0.000259030,
     0.000241812,  0.000246588,  0.000252889,  0.000234823,  0.000187192,  0.000115354,  0.000045310};
 
-std::vector<std::vector<float>> ir_collection_large = {ir_data1_large, ir_data2_large};
\ No newline at end of file
+constexpr std::span<const float> ir_collection_large[] = {ir_data1_large, ir_data2_large};
\ No newline at end of file
@@ -1,1026 +1,1011 @@
+#include <span>
+
+// Model weights for the NAM module, stored as constant tables so they stay in flash instead of being copied to the heap
+// at startup.
 struct modelDataNam {
-    std::vector<float> weights;
+    std::span<const float> weights;
     float levelAdjust = 1.0f;
 };
 
-// ADD YOUR MODEL IDENTIFIER HERE ////////////////////////////////// < -------------------
-modelDataNam NamModel1;
-modelDataNam NamModel2;
-modelDataNam NamModel3;
-modelDataNam NamModel4;
-modelDataNam NamModel5;
-modelDataNam NamModel6;
-modelDataNam NamModel7;
-modelDataNam NamModel8;
-modelDataNam NamModel9;
-modelDataNam NamModel10;
-
-/////////////////////////////////////////////////////////////////
-
-std::vector<modelDataNam> model_collection_nam;
-
 /*========================================================================*/
 
-void setupWeightsNam() {
-
-    // COPY AND PASTE YOUR MODEL WEIGHTS BELOW (After converting .json to .h file) ////////////////////////////////// <
-    // -------------------
-    //   ADD AND REMOVE MODELS AS DESIRED (CAN HOLD AROUND 15-16 MODELS IN FLASH MEMORY)
+// COPY AND PASTE YOUR MODEL WEIGHTS BELOW (After converting .json to .h file) ////////////////////////////////// <
+// -------------------
+//   ADD AND REMOVE MODELS AS DESIRED (CAN HOLD AROUND 15-16 MODELS IN FLASH MEMORY)
 
-    //========================================================================
-    // NAM Pico Models
-    /*
+//========================================================================
+// NAM Pico Models
+/*
+    {
+    "version": "0.5.4",
+    "metadata": {
+        "date": {
+        "year": 2024,
+        "month": 12,
+        "day": 28,
+        "hour": 10,
+        "minute": 21,
+        "second": 12
+        },
+        "loudness": -12.713208198547363,
+        "gain": 0.6453793642123751
+    },
+    "architecture": "WaveNet",
+    "config": {
+        "layers": [
         {
-        "version": "0.5.4",
-        "metadata": {
-            "date": {
-            "year": 2024,
-            "month": 12,
-            "day": 28,
-            "hour": 10,
-            "minute": 21,
-            "second": 12
-            },
-            "loudness": -12.713208198547363,
-            "gain": 0.6453793642123751
+            "input_size": 1,
+            "condition_size": 1,
+            "head_size": 2,
+            "channels": 2,
+            "kernel_size": 3,
+            "dilations": [1, 2, 4, 8, 16, 32, 64],
+            "activation": "Tanh",
+            "gated": false,
+            "head_bias": false
         },
-        "architecture": "WaveNet",
-        "config": {
-            "layers": [
-            {
-                "input_size": 1,
-                "condition_size": 1,
-                "head_size": 2,
-                "channels": 2,
-                "kernel_size": 3,
-                "dilations": [1, 2, 4, 8, 16, 32, 64],
-                "activation": "Tanh",
-                "gated": false,
-                "head_bias": false
-            },
-            {
-                "input_size": 2,
-                "condition_size": 1,
-                "head_size": 1,
-                "channels": 2,
-                "kernel_size": 3,
-                "dilations": [128, 256, 512, 1, 2, 4, 8, 16, 32, 64, 128, 256, 512],
-                "activation": "Tanh",
-                "gated": false,
-                "head_bias": true
-            }
-            ],
-            "head": null,
-            "head_scale": 0.02
-        }
+        {
+            "input_size": 2,
+            "condition_size": 1,
+            "head_size": 1,
+            "channels": 2,
+            "kernel_size": 3,
+            "dilations": [128, 256, 512, 1, 2, 4, 8, 16, 32, 64, 128, 256, 512],
+            "activation": "Tanh",
+            "gated": false,
+            "head_bias": true
         }
-    */
+        ],
+        "head": null,
+        "head_scale": 0.02
+    }
+    }
+*/
 
-    // Mesa loss= 0.027  Epochs=100
-    NamModel1.weights = {
-        -0.11427420377731323,  0.826178252696991,     -0.5320816040039062,    -0.8092689514160156,    0.393259197473526,
-        0.3702533543109894,    0.5633194446563721,    -0.1629154235124588,    -0.32463863492012024,   -0.811623215675354,
-        0.05005663260817528,   0.24308079481124878,   0.5883798599243164,     -0.3921714425086975,    -0.1934376358985901,
-        -0.004406209569424391, -0.03721064329147339,  0.5161855816841125,     -0.5718151330947876,    0.26174795627593994,
-        0.5104661583900452,    0.8602162003517151,    0.021549051627516747,   0.5056447982788086,     0.1933514028787613,
-        0.30143043398857117,   0.39685046672821045,   -0.44719111919403076,   -0.29186466336250305,   0.07451090961694717,
-        0.02712182328104973,   0.6330955624580383,    -0.2494029998779297,    -0.3307357728481293,    -0.4963495135307312,
-        -0.4266848564147949,   -0.24034863710403442,  0.3874838650226593,     0.4222726821899414,     0.6515410542488098,
-        -0.013823670335114002, -0.15700462460517883,  -0.14641016721725464,   -1.154114842414856,     -0.3000502586364746,
-        -0.35417985916137695,  0.017977211624383926,  -0.09248150140047073,   -0.01071122009307146,   0.18497854471206665,
-        0.2875567078590393,    0.0019224741263315082, 0.3270227313041687,     0.02915635146200657,    -0.2520900368690491,
-        -0.581314206123352,    -0.3628731966018677,   0.37564122676849365,    -0.20953433215618134,   -0.03383974730968475,
-        -0.6013180017471313,   1.8852592706680298,    -0.9810625910758972,    1.0026507377624512,     0.40312066674232483,
-        1.0567052364349365,    0.20658746361732483,   0.1427953988313675,     0.8517405986785889,     0.655931293964386,
-        -0.48673561215400696,  -0.5930642485618591,   0.472767174243927,      0.5203737616539001,     0.019803382456302643,
-        0.48916712403297424,   -0.11674150079488754,  -0.16893808543682098,   0.44269126653671265,    -0.4044519066810608,
-        -0.08652488142251968,  0.45345214009284973,   0.07144574820995331,    -1.5960006713867188,    -1.107171893119812,
-        -0.32603925466537476,  0.8710664510726929,    -0.20750877261161804,   0.20479051768779755,    -0.37586215138435364,
-        -0.09094162285327911,  0.3984895646572113,    -0.2805357277393341,    0.14264239370822906,    -0.6503556966781616,
-        0.08015718311071396,   0.3100350499153137,    0.49314436316490173,    -1.0050667524337769,    -0.567993700504303,
-        -0.09361535310745239,  0.5952048301696777,    -0.2816409468650818,    -0.052182722836732864,  -0.23815006017684937,
-        0.2784854471683502,    -0.6614152193069458,   -1.2473341226577759,    -0.03960256651043892,   0.3781462609767914,
-        -0.2672872543334961,   0.2931673526763916,    -0.21844324469566345,   -0.2623678743839264,    0.6284499168395996,
-        -0.3660649359226227,   -0.8942755460739136,   0.34564921259880066,    0.1073056012392044,     -0.39031437039375305,
-        -1.1225250959396362,   0.23221077024936676,   -0.8988170623779297,    0.6637008786201477,     -0.26539215445518494,
-        0.047065142542123795,  -0.23198747634887695,  -0.18570934236049652,   -0.30028149485588074,   -1.238021969795227,
-        -0.3494695723056793,   0.6775344610214233,    -0.49851611256599426,   0.03150191903114319,    0.31753695011138916,
-        0.16190113127231598,   -0.4156181812286377,   0.17573727667331696,    0.2744847536087036,     0.05781077221035957,
-        0.20512056350708008,   0.4152093231678009,    -0.0843513235449791,    0.3277585208415985,     0.7316074967384338,
-        0.5987998843193054,    -0.015514926053583622, -0.24955448508262634,   -1.0949143171310425,    0.6807681322097778,
-        -0.6906806230545044,   -0.4925156235694885,   -0.059807226061820984,  0.5238251686096191,     0.6058830618858337,
-        -0.4304755926132202,   0.28010889887809753,   -0.17875759303569794,   -0.3076866567134857,    0.1174893006682396,
-        -0.3262575566768646,   -0.14755529165267944,  -0.7883907556533813,    -0.4219420552253723,    -0.1895754337310791,
-        -0.5854007601737976,   -0.31775450706481934,  -0.08090239018201828,   -1.1070327758789062,    -0.27630966901779175,
-        -0.06862765550613403,  -1.2911425828933716,   0.408505380153656,      -0.32463544607162476,   -1.5122642517089844,
-        0.2440817505121231,    0.06411004811525345,   0.012101596221327782,   0.7034508585929871,     -0.9251810908317566,
-        -0.4361167848110199,   -0.871217668056488,    0.5892648696899414,     -0.49419525265693665,   0.33946850895881653,
-        0.14403221011161804,   -0.029867688193917274, -0.028161432594060898,  -0.2921698987483978,    -0.00923173688352108,
-        0.008248035795986652,  0.7604693174362183,    0.009299620985984802,   -0.03210410103201866,   -0.5539824366569519,
-        0.012346168980002403,  0.030456308275461197,  -0.1638132482767105,    -0.11021782457828522,   0.04135385900735855,
-        0.4782027304172516,    0.7166757583618164,    -1.2079050540924072,    -0.44874680042266846,   -1.3342463970184326,
-        0.8593003749847412,    -0.19599410891532898,  0.44880929589271545,    -0.0023241655435413122, -0.0008517442038282752,
-        0.259504497051239,     0.008676662109792233,  -0.023878198117017746,  -0.20177771151065826,   -0.002160280477255583,
-        -0.005353017244488001, 0.37806832790374756,   -0.0026606328319758177, 0.04942715913057327,    -0.4229588210582733,
-        -0.02746594324707985,  0.4159964621067047,    0.2952251434326172,     -0.09772969037294388,   -0.35920846462249756,
-        0.3463224172592163,    -0.09636904299259186,  0.2358364313840866,     -0.1828523725271225,    -0.2367638200521469,
-        -0.05465826392173767,  0.11441021412611008,   0.2804199457168579,     0.08182870596647263,    -0.08824166655540466,
-        -0.49056071043014526,  -0.4234905242919922,   -1.4444537162780762,    -0.8896801471710205,    0.35484784841537476,
-        0.5895277857780457,    0.438547819852829,     -0.17754128575325012,   0.06599922478199005,    0.2160029411315918,
-        -0.4570828080177307,   0.05158812180161476,   -1.4520460367202759,    1.2113168239593506,     0.42401641607284546,
-        -0.22505822777748108,  -0.0674336850643158,   0.9362135529518127,     0.07562945038080215,    -0.18633180856704712,
-        -0.14097921550273895,  -0.25260302424430847,  -0.28685492277145386,   -0.23160149157047272,   -0.9779238104820251,
-        -0.4751671254634857,   0.8255456686019897,    0.82293301820755,       0.18995817005634308,    0.025591956451535225,
-        -0.014225036837160587, 0.3217238485813141,    0.37202465534210205,    0.07792191952466965,    0.8605426549911499,
-        -0.5645263195037842,   0.9582826495170593,    -0.41552385687828064,   -0.12571558356285095,   0.3214597702026367,
-        -1.0001140832901,      -0.48841822147369385,  -0.5071556568145752,    0.8705095648765564,     0.689736008644104,
-        1.0457333326339722,    -1.6549246311187744,   -0.3546528220176697,    0.18341466784477234,    0.20762594044208527,
-        0.43820497393608093,   -0.44633421301841736,  -0.3529587686061859,    -0.6375374794006348,    0.4539531171321869,
-        -0.6672407984733582,   0.3977415859699249,    0.23423634469509125,    0.27713578939437866,    -0.04192354902625084,
-        -0.28078094124794006,  -0.03467510640621185,  0.06956670433282852,    0.24105778336524963,    -0.02790440246462822,
-        -0.22090251743793488,  0.23905913531780243,   -0.005677872337400913,  -0.45705246925354004,   -0.6258443593978882,
-        0.02709159068763256,   -0.016819264739751816, 0.5337814092636108,     0.08914144337177277,    -0.17998060584068298,
-        -0.16501577198505402,  -0.8131586313247681,   -0.7654082775115967,    0.33022943139076233,    -2.8215301036834717,
-        0.3713296353816986,    -0.3166956305503845,   0.2846989035606384,     0.04434157535433769,    0.0018536207498982549,
-        0.21625249087810516,   0.013663328252732754,  0.09399788081645966,    0.025906525552272797,   -0.0475570484995842,
-        0.07856152951717377,   0.17198526859283447,   0.04728316888213158,    0.08088735491037369,    -0.041241418570280075,
-        0.20851635932922363,   0.19976671040058136,   -0.07122955471277237,   -0.026592722162604332,  -3.0314481258392334,
-        -1.6051080226898193,   2.2860426902770996,    3.1893551349639893,     0.84077388048172,       0.19979573786258698,
-        -0.02108752354979515,  -0.07719770818948746,  0.2576853334903717,     -0.0027457585092633963, 0.03741811215877533,
-        0.07389660179615021,   0.1767115443944931,    0.08566281944513321,    -0.0815737172961235,    -0.15634530782699585,
-        0.03679169341921806,   -0.01984809897840023,  -0.027029629796743393,  0.036898769438266754,   -0.06473980844020844,
-        0.16763056814670563,   -2.8771779537200928,   0.41860949993133545,    -2.0065555572509766,    -0.5537798404693604,
-        -0.16909600794315338,  -0.8119687438011169,   0.059697963297367096,   0.7165385484695435,     0.16468358039855957,
-        0.02831745147705078,   0.24736851453781128,   0.055723320692777634,   0.1132044717669487,     0.31667736172676086,
-        -0.2684890627861023,   0.018746450543403625,  0.011695051565766335,   -0.08376741409301758,   0.343576580286026,
-        0.026276519522070885,  -0.4092138707637787,   -0.500522255897522,     0.1267840564250946,     0.98677659034729,
-        1.2680617570877075,    0.1190696507692337,    -0.057258155196905136,  0.5045081973075867,     0.050757694989442825,
-        0.3513992130756378,    -0.00679100351408124,  0.027219492942094803,   0.12145624309778214,    0.006468314211815596,
-        0.03144938126206398,   0.15587663650512695,   -0.09023912996053696,   -0.011766647920012474,  -0.09500199556350708,
-        -0.026588700711727142, 0.08468575775623322,   0.029205836355686188,   0.2444435954093933,     0.21345734596252441,
-        1.8443583250045776,    0.9288386702537537,    1.589221715927124,      0.9358434081077576,     0.056752339005470276,
-        -0.267156183719635,    -0.09805402159690857,  -0.1704576313495636,    0.45998069643974304,    -0.020008619874715805,
-        -0.027012232691049576, 0.13886506855487823,   -0.16548776626586914,   -0.2796541750431061,    0.1932142823934555,
-        -0.06673064082860947,  -0.0871637687087059,   0.09348978847265244,    0.07298564910888672,    -0.02715056762099266,
-        -0.04107731953263283,  -0.4585607051849365,   -1.5990867614746094,    0.48708051443099976,    -1.4392131567001343,
-        -1.523710012435913,    -0.43519410490989685,  -0.24094033241271973,   0.0404861755669117,     -0.257587730884552,
-        0.3353545367717743,    0.013374964706599712,  -0.04422662407159805,   0.14095795154571533,    0.05385664477944374,
-        -0.1567307412624359,   0.40321773290634155,   0.011586652137339115,   -0.038187868893146515,  0.21519626677036285,
-        0.3463872969150543,    0.19245551526546478,   -1.3679388761520386,    1.374416470527649,      -0.6692616939544678,
-        0.5877380967140198,    -0.28285887837409973,  0.20710033178329468,    0.03224611282348633,    -0.6376116871833801,
-        2.6524410247802734,    2.2793185710906982,    0.37358999252319336,    0.019999999552965164};
+// Mesa loss= 0.027  Epochs=100
+constexpr float NamModel1[] = {
+    -0.11427420377731323,  0.826178252696991,     -0.5320816040039062,    -0.8092689514160156,    0.393259197473526,
+    0.3702533543109894,    0.5633194446563721,    -0.1629154235124588,    -0.32463863492012024,   -0.811623215675354,
+    0.05005663260817528,   0.24308079481124878,   0.5883798599243164,     -0.3921714425086975,    -0.1934376358985901,
+    -0.004406209569424391, -0.03721064329147339,  0.5161855816841125,     -0.5718151330947876,    0.26174795627593994,
+    0.5104661583900452,    0.8602162003517151,    0.021549051627516747,   0.5056447982788086,     0.1933514028787613,
+    0.30143043398857117,   0.39685046672821045,   -0.44719111919403076,   -0.29186466336250305,   0.07451090961694717,
+    0.02712182328104973,   0.6330955624580383,    -0.2494029998779297,    -0.3307357728481293,    -0.4963495135307312,
+    -0.4266848564147949,   -0.24034863710403442,  0.3874838650226593,     0.4222726821899414,     0.6515410542488098,
+    -0.013823670335114002, -0.15700462460517883,  -0.14641016721725464,   -1.154114842414856,     -0.3000502586364746,
+    -0.35417985916137695,  0.017977211624383926,  -0.09248150140047073,   -0.01071122009307146,   0.18497854471206665,
+    0.2875567078590393,    0.0019224741263315082, 0.3270227313041687,     0.02915635146200657,    -0.2520900368690491,
+    -0.581314206123352,    -0.3628731966018677,   0.37564122676849365,    -0.20953433215618134,   -0.03383974730968475,
+    -0.6013180017471313,   1.8852592706680298,    -0.9810625910758972,    1.0026507377624512,     0.40312066674232483,
+    1.0567052364349365,    0.20658746361732483,   0.1427953988313675,     0.8517405986785889,     0.655931293964386,
+    -0.48673561215400696,  -0.5930642485618591,   0.472767174243927,      0.5203737616539001,     0.019803382456302643,
+    0.48916712403297424,   -0.11674150079488754,  -0.16893808543682098,   0.44269126653671265,    -0.4044519066810608,
+    -0.08652488142251968,  0.45345214009284973,   0.07144574820995331,    -1.5960006713867188,    -1.107171893119812,
+    -0.32603925466537476,  0.8710664510726929,    -0.20750877261161804,   0.20479051768779755,    -0.37586215138435364,
+    -0.09094162285327911,  0.3984895646572113,    -0.2805357277393341,    0.14264239370822906,    -0.6503556966781616,
+    0.08015718311071396,   0.3100350499153137,    0.49314436316490173,    -1.0050667524337769,    -0.567993700504303,
+    -0.09361535310745239,  0.5952048301696777,    -0.2816409468650818,    -0.052182722836732864,  -0.23815006017684937,
+    0.2784854471683502,    -0.6614152193069458,   -1.2473341226577759,    -0.03960256651043892,   0.3781462609767914,
+    -0.2672872543334961,   0.2931673526763916,    -0.21844324469566345,   -0.2623678743839264,    0.6284499168395996,
+    -0.3660649359226227,   -0.8942755460739136,   0.34564921259880066,    0.1073056012392044,     -0.39031437039375305,
+    -1.1225250959396362,   0.23221077024936676,   -0.8988170623779297,    0.6637008786201477,     -0.26539215445518494,
+    0.047065142542123795,  -0.23198747634887695,  -0.18570934236049652,   -0.30028149485588074,   -1.238021969795227,
+    -0.3494695723056793,   0.6775344610214233,    -0.49851611256599426,   0.03150191903114319,    0.31753695011138916,
+    0.16190113127231598,   -0.4156181812286377,   0.17573727667331696,    0.2744847536087036,     0.05781077221035957,
+    0.20512056350708008,   0.4152093231678009,    -0.0843513235449791,    0.3277585208415985,     0.7316074967384338,
+    0.5987998843193054,    -0.015514926053583622, -0.24955448508262634,   -1.0949143171310425,    0.6807681322097778,
+    -0.6906806230545044,   -0.4925156235694885,   -0.059807226061820984,  0.5238251686096191,     0.6058830618858337,
+    -0.4304755926132202,   0.28010889887809753,   -0.17875759303569794,   -0.3076866567134857,    0.1174893006682396,
+    -0.3262575566768646,   -0.14755529165267944,  -0.7883907556533813,    -0.4219420552253723,    -0.1895754337310791,
+    -0.5854007601737976,   -0.31775450706481934,  -0.08090239018201828,   -1.1070327758789062,    -0.27630966901779175,
+    -0.06862765550613403,  -1.2911425828933716,   0.408505380153656,      -0.32463544607162476,   -1.5122642517089844,
+    0.2440817505121231,    0.06411004811525345,   0.012101596221327782,   0.7034508585929871,     -0.9251810908317566,
+    -0.4361167848110199,   -0.871217668056488,    0.5892648696899414,     -0.49419525265693665,   0.33946850895881653,
+    0.14403221011161804,   -0.029867688193917274, -0.028161432594060898,  -0.2921698987483978,    -0.00923173688352108,
+    0.008248035795986652,  0.7604693174362183,    0.009299620985984802,   -0.03210410103201866,   -0.5539824366569519,
+    0.012346168980002403,  0.030456308275461197,  -0.1638132482767105,    -0.11021782457828522,   0.04135385900735855,
+    0.4782027304172516,    0.7166757583618164,    -1.2079050540924072,    -0.44874680042266846,   -1.3342463970184326,
+    0.8593003749847412,    -0.19599410891532898,  0.44880929589271545,    -0.0023241655435413122, -0.0008517442038282752,
+    0.259504497051239,     0.008676662109792233,  -0.023878198117017746,  -0.20177771151065826,   -0.002160280477255583,
+    -0.005353017244488001, 0.37806832790374756,   -0.0026606328319758177, 0.04942715913057327,    -0.4229588210582733,
+    -0.02746594324707985,  0.4159964621067047,    0.2952251434326172,     -0.09772969037294388,   -0.35920846462249756,
+    0.3463224172592163,    -0.09636904299259186,  0.2358364313840866,     -0.1828523725271225,    -0.2367638200521469,
+    -0.05465826392173767,  0.11441021412611008,   0.2804199457168579,     0.08182870596647263,    -0.08824166655540466,
+    -0.49056071043014526,  -0.4234905242919922,   -1.4444537162780762,    -0.8896801471710205,    0.35484784841537476,
+    0.5895277857780457,    0.438547819852829,     -0.17754128575325012,   0.06599922478199005,    0.2160029411315918,
+    -0.4570828080177307,   0.05158812180161476,   -1.4520460367202759,    1.2113168239593506,     0.42401641607284546,
+    -0.22505822777748108,  -0.0674336850643158,   0.9362135529518127,     0.07562945038080215,    -0.18633180856704712,
+    -0.14097921550273895,  -0.25260302424430847,  -0.28685492277145386,   -0.23160149157047272,   -0.9779238104820251,
+    -0.4751671254634857,   0.8255456686019897,    0.82293301820755,       0.18995817005634308,    0.025591956451535225,
+    -0.014225036837160587, 0.3217238485813141,    0.37202465534210205,    0.07792191952466965,    0.8605426549911499,
+    -0.5645263195037842,   0.9582826495170593,    -0.41552385687828064,   -0.12571558356285095,   0.3214597702026367,
+    -1.0001140832901,      -0.48841822147369385,  -0.5071556568145752,    0.8705095648765564,     0.689736008644104,
+    1.0457333326339722,    -1.6549246311187744,   -0.3546528220176697,    0.18341466784477234,    0.20762594044208527,
+    0.43820497393608093,   -0.44633421301841736,  -0.3529587686061859,    -0.6375374794006348,    0.4539531171321869,
+    -0.6672407984733582,   0.3977415859699249,    0.23423634469509125,    0.27713578939437866,    -0.04192354902625084,
+    -0.28078094124794006,  -0.03467510640621185,  0.06956670433282852,    0.24105778336524963,    -0.02790440246462822,
+    -0.22090251743793488,  0.23905913531780243,   -0.005677872337400913,  -0.45705246925354004,   -0.6258443593978882,
+    0.02709159068763256,   -0.016819264739751816, 0.5337814092636108,     0.08914144337177277,    -0.17998060584068298,
+    -0.16501577198505402,  -0.8131586313247681,   -0.7654082775115967,    0.33022943139076233,    -2.8215301036834717,
+    0.3713296353816986,    -0.3166956305503845,   0.2846989035606384,     0.04434157535433769,    0.0018536207498982549,
+    0.21625249087810516,   0.013663328252732754,  0.09399788081645966,    0.025906525552272797,   -0.0475570484995842,
+    0.07856152951717377,   0.17198526859283447,   0.04728316888213158,    0.08088735491037369,    -0.041241418570280075,
+    0.20851635932922363,   0.19976671040058136,   -0.07122955471277237,   -0.026592722162604332,  -3.0314481258392334,
+    -1.6051080226898193,   2.2860426902770996,    3.1893551349639893,     0.84077388048172,       0.19979573786258698,
+    -0.02108752354979515,  -0.07719770818948746,  0.2576853334903717,     -0.0027457585092633963, 0.03741811215877533,
+    0.07389660179615021,   0.1767115443944931,    0.08566281944513321,    -0.0815737172961235,    -0.15634530782699585,
+    0.03679169341921806,   -0.01984809897840023,  -0.027029629796743393,  0.036898769438266754,   -0.06473980844020844,
+    0.16763056814670563,   -2.8771779537200928,   0.41860949993133545,    -2.0065555572509766,    -0.5537798404693604,
+    -0.16909600794315338,  -0.8119687438011169,   0.059697963297367096,   0.7165385484695435,     0.16468358039855957,
+    0.02831745147705078,   0.24736851453781128,   0.055723320692777634,   0.1132044717669487,     0.31667736172676086,
+    -0.2684890627861023,   0.018746450543403625,  0.011695051565766335,   -0.08376741409301758,   0.343576580286026,
+    0.026276519522070885,  -0.4092138707637787,   -0.500522255897522,     0.1267840564250946,     0.98677659034729,
+    1.2680617570877075,    0.1190696507692337,    -0.057258155196905136,  0.5045081973075867,     0.050757694989442825,
+    0.3513992130756378,    -0.00679100351408124,  0.027219492942094803,   0.12145624309778214,    0.006468314211815596,
+    0.03144938126206398,   0.15587663650512695,   -0.09023912996053696,   -0.011766647920012474,  -0.09500199556350708,
+    -0.026588700711727142, 0.08468575775623322,   0.029205836355686188,   0.2444435954093933,     0.21345734596252441,
+    1.8443583250045776,    0.9288386702537537,    1.589221715927124,      0.9358434081077576,     0.056752339005470276,
+    -0.267156183719635,    -0.09805402159690857,  -0.1704576313495636,    0.45998069643974304,    -0.020008619874715805,
+    -0.027012232691049576, 0.13886506855487823,   -0.16548776626586914,   -0.2796541750431061,    0.1932142823934555,
+    -0.06673064082860947,  -0.0871637687087059,   0.09348978847265244,    0.07298564910888672,    -0.02715056762099266,
+    -0.04107731953263283,  -0.4585607051849365,   -1.5990867614746094,    0.48708051443099976,    -1.4392131567001343,
+    -1.523710012435913,    -0.43519410490989685,  -0.24094033241271973,   0.0404861755669117,     -0.257587730884552,
+    0.3353545367717743,    0.013374964706599712,  -0.04422662407159805,   0.14095795154571533,    0.05385664477944374,
+    -0.1567307412624359,   0.40321773290634155,   0.011586652137339115,   -0.038187868893146515,  0.21519626677036285,
+    0.3463872969150543,    0.19245551526546478,   -1.3679388761520386,    1.374416470527649,      -0.6692616939544678,
+    0.5877380967140198,    -0.28285887837409973,  0.20710033178329468,    0.03224611282348633,    -0.6376116871833801,
+    2.6524410247802734,    2.2793185710906982,    0.37358999252319336,    0.019999999552965164};
 
-    // Matchless loss= 0.012  Epochs=300
-    NamModel2.weights = {
-        -0.816728949546814,    0.640913724899292,     0.14022797346115112,   -1.1266518831253052,   -0.08751022815704346,
-        -0.2448553889989853,   0.6108949184417725,    0.46908071637153625,   -0.05520779639482498,  -0.6612072587013245,
-        -0.0721270963549614,   -0.017504004761576653, 0.17192448675632477,   -0.08522257953882217,  0.1306496560573578,
-        0.07243184000253677,   0.565699577331543,     0.8114126920700073,    -1.170413851737976,    -1.2084898948669434,
-        0.6890367865562439,    0.9716875553131104,    0.08331628143787384,   0.4924079179763794,    0.28201115131378174,
-        0.2189989537000656,    -0.1833599954843521,   -0.2456754744052887,   -0.10670379549264908,  0.5862599611282349,
-        -1.0298292636871338,   0.48383986949920654,   0.5034818053245544,    0.34058234095573425,   -0.31093132495880127,
-        -0.7238288521766663,   0.06264188140630722,   0.5873398184776306,    0.7574343681335449,    0.4121531844139099,
-        -0.8092008829116821,   -0.14007502794265747,  -0.5761244893074036,   -0.8198979496955872,   -0.2973208427429199,
-        -0.23067398369312286,  0.4697321951389313,    0.7207452058792114,    -0.9920092225074768,   -0.5235843658447266,
-        -0.09219761192798615,  1.6055089235305786,    0.34736141562461853,   -0.5919817686080933,   -0.014573364518582821,
-        -0.09771787375211716,  0.5692687034606934,    -0.2740134298801422,   -0.1339672952890396,   -0.14954201877117157,
-        1.510402798652649,     0.41269925236701965,   -0.8505533933639526,   0.35282137989997864,   0.43617329001426697,
-        -0.5206502676010132,   0.14834095537662506,   0.39555272459983826,   0.12457235157489777,   -0.38530877232551575,
-        -0.046305786818265915, 0.46811574697494507,   -0.19088518619537354,  -0.03532397001981735,  0.24153082072734833,
-        0.7496050000190735,    -0.0621473491191864,   -0.5224955081939697,   0.9002312421798706,    0.13624398410320282,
-        -0.23132358491420746,  0.07464239001274109,   -0.14456158876419067,  0.18213699758052826,   0.6731261610984802,
-        -0.0494583323597908,   0.046556081622838974,  -0.6187125444412231,   0.6632405519485474,    -0.42830801010131836,
-        -0.05718417465686798,  -0.2726185619831085,   0.6434093117713928,    -0.025253968313336372, -0.11406435072422028,
-        0.03466763719916344,   -0.2234487384557724,   0.22859445214271545,   0.15714474022388458,   -0.5142564177513123,
-        0.27445080876350403,   0.4242534041404724,    -0.11865267157554626,  0.08344218879938126,   -1.0944503545761108,
-        -0.7332770824432373,   -0.6234872341156006,   -0.8797007203102112,   -0.7520081400871277,   -0.17287595570087433,
-        -0.027804994955658913, 0.1183849647641182,    -0.0386812649667263,   -0.27162063121795654,  0.4891146421432495,
-        -0.25125569105148315,  -0.03532636538147926,  0.28351926803588867,   0.8058226108551025,    0.40109536051750183,
-        0.03614875301718712,   0.7459983825683594,    -0.7655819058418274,   0.12682467699050903,   -0.16644388437271118,
-        -0.15825584530830383,  -0.06651197373867035,  -0.7322629690170288,   -0.7444958090782166,   -0.4666514992713928,
-        0.01873803697526455,   0.04025048762559891,   -0.23315325379371643,  0.06638459116220474,   -0.36421701312065125,
-        -0.5782254338264465,   -0.03217470645904541,  -0.24412314593791962,  -0.04053588956594467,  0.06695655733346939,
-        0.8035387396812439,    0.9083728194236755,    -0.10134884715080261,  0.580856442451477,     -0.39154210686683655,
-        0.030684364959597588,  -0.030641548335552216, 0.04488494619727135,   -1.01302170753479,     -0.7144106030464172,
-        -0.9805818796157837,   -0.5400681495666504,   -0.1291513293981552,   -0.05380750074982643,  0.46302980184555054,
-        -0.5166309475898743,   -0.557148277759552,    -0.3928050100803375,   -1.2200350761413574,   -0.038863372057676315,
-        0.004997415002435446,  -0.23469892144203186,  -0.679160475730896,    -0.28962942957878113,  0.0753190666437149,
-        0.2647518813610077,    -0.2383699119091034,   0.31467366218566895,   -0.2623683214187622,   -0.0047197830863296986,
-        -0.19377374649047852,  -0.726780354976654,    -0.08653445541858673,  -0.0821520984172821,   -0.32969436049461365,
-        0.7896286845207214,    0.06019389629364014,   0.0533672533929348,    0.5615957975387573,    -1.073058009147644,
-        -0.06900335848331451,  0.04005265235900879,   0.7481744885444641,    0.5929533243179321,    0.34676918387413025,
-        0.20277132093906403,   0.2494238317012787,    -0.016953688114881516, -0.18527524173259735,  0.011035679839551449,
-        0.21416491270065308,   0.24300836026668549,   -0.0823434591293335,   0.06647182255983353,   -0.182808980345726,
-        0.041988298296928406,  -0.3488544821739197,   0.23610837757587433,   -0.09287332743406296,  0.06366341561079025,
-        -0.5438804626464844,   -0.2314717024564743,   -0.34810754656791687,  -0.2610490918159485,   -0.28447479009628296,
-        0.1289278119802475,    -0.11885590851306915,  0.4982030987739563,    0.0008039992535486817, -0.0822419822216034,
-        -0.6632303595542908,   -0.001471939729526639, -0.02822187915444374,  0.40625572204589844,   0.04420854523777962,
-        0.09683408588171005,   -0.1369173526763916,   0.034105125814676285,  0.059692155569791794,  0.2282908707857132,
-        0.005600005853921175,  0.0831512063741684,    0.7344544529914856,    0.9184833765029907,    -0.5474745035171509,
-        0.17113414406776428,   -1.062245488166809,    0.003962018992751837,  -0.1219346821308136,   -0.20420759916305542,
-        0.18261896073818207,   0.31306836009025574,   -0.17618107795715332,  0.5746090412139893,    0.5966029763221741,
-        -0.4151947796344757,   -0.41818466782569885,  -0.5377653241157532,   -0.03424999862909317,  0.14284899830818176,
-        0.3042220175266266,    0.053678177297115326,  -0.2879513204097748,   0.1615709662437439,    1.0633289813995361,
-        -0.9951322674751282,   0.005951686762273312,  -0.7653868794441223,   1.0301547050476074,    -0.1278434842824936,
-        -0.09799766540527344,  -0.03933180123567581,  0.3333270847797394,    -0.36346134543418884,  -0.06087929755449295,
-        -0.18778374791145325,  -0.22351786494255066,  0.341593861579895,     -0.10702977329492569,  -0.19138604402542114,
-        0.2198142409324646,    0.5555373430252075,    0.17944788932800293,   -0.25580865144729614,  0.11132766306400299,
-        -0.04274112731218338,  0.21128565073013306,   0.3497539460659027,    0.5966490507125854,    -0.3750445544719696,
-        -1.3152449131011963,   -0.1666506826877594,   -0.46087339520454407,  0.023604873567819595,  -0.764664351940155,
-        -0.01927816867828369,  0.25774237513542175,   0.2519788444042206,    -0.03912343829870224,  -0.1336650848388672,
-        0.03700028359889984,   -1.2252296209335327,   -0.28387972712516785,  0.4538232088088989,    -0.46708062291145325,
-        0.37740620970726013,   -0.23084771633148193,  -0.5154166221618652,   -0.17744411528110504,  -0.403827041387558,
-        -0.7599346041679382,   0.29916343092918396,   0.3068315088748932,    -0.2873938977718353,   0.04642490670084953,
-        -0.2842433452606201,   -0.13825878500938416,  -0.06075500696897507,  0.12485457956790924,   0.28462037444114685,
-        0.22523891925811768,   -0.16499759256839752,  -0.4995443522930145,   -0.2872397005558014,   0.20112836360931396,
-        -0.15212756395339966,  0.6267700791358948,    -0.36202308535575867,  -0.019753199070692062, -0.1069127544760704,
-        -1.7864320278167725,   -0.37027886509895325,  0.3490080237388611,    -1.345146894454956,    0.7847938537597656,
-        0.6828436851501465,    -0.16551412642002106,  0.2214297652244568,    0.011648695915937424,  -0.7975162267684937,
-        -0.02284269593656063,  0.43721839785575867,   -0.7356336712837219,   0.1347900927066803,    -0.10049286484718323,
-        0.033914126455783844,  -0.34215137362480164,  0.09232623875141144,   0.40929362177848816,   -0.3886246085166931,
-        -0.3798733353614807,   -0.18183614313602448,  0.30758562684059143,   -0.6594212055206299,   -1.2489123344421387,
-        2.3558812141418457,    1.3266096115112305,    0.7582473158836365,    0.5460497140884399,    0.478423148393631,
-        -0.4354279041290283,   -0.4835488498210907,   0.35403916239738464,   -0.2386334240436554,   -0.7542760968208313,
-        1.0410500764846802,    0.39106982946395874,   -0.33270010352134705,  -0.15707892179489136,  -0.8100389838218689,
-        -0.5488188862800598,   0.9018237590789795,    0.1463090032339096,    0.2709485590457916,    0.6825831532478333,
-        1.4789973497390747,    -0.05518924817442894,  0.3004698157310486,    -0.5478758215904236,   -0.2650642693042755,
-        -0.5091060400009155,   -0.498453825712204,    -0.04439292848110199,  0.1543867141008377,    -0.8747442364692688,
-        0.29397979378700256,   0.23609337210655212,   0.45201119780540466,   0.15274697542190552,   -0.13781824707984924,
-        -0.192060187458992,    0.24538753926753998,   -0.15118913352489471,  0.2593905031681061,    -0.25297290086746216,
-        0.03411773964762688,   4.204725742340088,     0.2284027636051178,    -0.14012105762958527,  0.7193062901496887,
-        0.2792465090751648,    0.6857842803001404,    0.18091899156570435,   0.7010433077812195,    0.12348262965679169,
-        0.004731568042188883,  0.01740850880742073,   0.14232489466667175,   -0.3855608105659485,   0.036290157586336136,
-        0.3277924358844757,    -0.7967148423194885,   -0.04664124920964241,  0.3066774308681488,    -0.24470321834087372,
-        0.10395496338605881,   0.15230552852153778,   -0.174297034740448,    -0.0960993766784668,   -0.1887694150209427,
-        -1.4175556898117065,   -1.0758236646652222,   0.1659371554851532,    0.21053434908390045,   0.08056849986314774,
-        -0.41402244567871094,  -0.010590888559818268, 0.18286718428134918,   -0.025911178439855576, 0.0007497810875065625,
-        0.28961339592933655,   0.3736001253128052,    -0.028003234416246414, 0.10028575360774994,   -0.9384022355079651,
-        0.01677035167813301,   0.4002298414707184,    -0.17245259881019592,  -0.023904485628008842, -0.03755472972989082,
-        -1.1449834108352661,   -0.08905462175607681,  0.299746036529541,     0.9106025099754333,    -1.1242833137512207,
-        -0.6397426724433899,   -0.30954208970069885,  -0.29987451434135437,  0.022143784910440445,  0.21520589292049408,
-        -0.7456017732620239,   0.010864314623177052,  -0.06704878062009811,  -0.050403349101543427, -0.09107541292905807,
-        -0.22785325348377228,  -0.6726369261741638,   -0.03998852148652077,  0.22269004583358765,   0.04788350686430931,
-        -0.21267156302928925,  -0.2652517259120941,   -1.059337854385376,    -0.02806372381746769,  -0.6692616939544678,
-        0.5877380967140198,    -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
-        2.843688726425171,     2.455843448638916,     0.03450493887066841,   0.019999999552965164};
+// Matchless loss= 0.012  Epochs=300
+constexpr float NamModel2[] = {
+    -0.816728949546814,    0.640913724899292,     0.14022797346115112,   -1.1266518831253052,   -0.08751022815704346,
+    -0.2448553889989853,   0.6108949184417725,    0.46908071637153625,   -0.05520779639482498,  -0.6612072587013245,
+    -0.0721270963549614,   -0.017504004761576653, 0.17192448675632477,   -0.08522257953882217,  0.1306496560573578,
+    0.07243184000253677,   0.565699577331543,     0.8114126920700073,    -1.170413851737976,    -1.2084898948669434,
+    0.6890367865562439,    0.9716875553131104,    0.08331628143787384,   0.4924079179763794,    0.28201115131378174,
+    0.2189989537000656,    -0.1833599954843521,   -0.2456754744052887,   -0.10670379549264908,  0.5862599611282349,
+    -1.0298292636871338,   0.48383986949920654,   0.5034818053245544,    0.34058234095573425,   -0.31093132495880127,
+    -0.7238288521766663,   0.06264188140630722,   0.5873398184776306,    0.7574343681335449,    0.4121531844139099,
+    -0.8092008829116821,   -0.14007502794265747,  -0.5761244893074036,   -0.8198979496955872,   -0.2973208427429199,
+    -0.23067398369312286,  0.4697321951389313,    0.7207452058792114,    -0.9920092225074768,   -0.5235843658447266,
+    -0.09219761192798615,  1.6055089235305786,    0.34736141562461853,   -0.5919817686080933,   -0.014573364518582821,
+    -0.09771787375211716,  0.5692687034606934,    -0.2740134298801422,   -0.1339672952890396,   -0.14954201877117157,
+    1.510402798652649,     0.41269925236701965,   -0.8505533933639526,   0.35282137989997864,   0.43617329001426697,
+    -0.5206502676010132,   0.14834095537662506,   0.39555272459983826,   0.12457235157489777,   -0.38530877232551575,
+    -0.046305786818265915, 0.46811574697494507,   -0.19088518619537354,  -0.03532397001981735,  0.24153082072734833,
+    0.7496050000190735,    -0.0621473491191864,   -0.5224955081939697,   0.9002312421798706,    0.13624398410320282,
+    -0.23132358491420746,  0.07464239001274109,   -0.14456158876419067,  0.18213699758052826,   0.6731261610984802,
+    -0.0494583323597908,   0.046556081622838974,  -0.6187125444412231,   0.6632405519485474,    -0.42830801010131836,
+    -0.05718417465686798,  -0.2726185619831085,   0.6434093117713928,    -0.025253968313336372, -0.11406435072422028,
+    0.03466763719916344,   -0.2234487384557724,   0.22859445214271545,   0.15714474022388458,   -0.5142564177513123,
+    0.27445080876350403,   0.4242534041404724,    -0.11865267157554626,  0.08344218879938126,   -1.0944503545761108,
+    -0.7332770824432373,   -0.6234872341156006,   -0.8797007203102112,   -0.7520081400871277,   -0.17287595570087433,
+    -0.027804994955658913, 0.1183849647641182,    -0.0386812649667263,   -0.27162063121795654,  0.4891146421432495,
+    -0.25125569105148315,  -0.03532636538147926,  0.28351926803588867,   0.8058226108551025,    0.40109536051750183,
+    0.03614875301718712,   0.7459983825683594,    -0.7655819058418274,   0.12682467699050903,   -0.16644388437271118,
+    -0.15825584530830383,  -0.06651197373867035,  -0.7322629690170288,   -0.7444958090782166,   -0.4666514992713928,
+    0.01873803697526455,   0.04025048762559891,   -0.23315325379371643,  0.06638459116220474,   -0.36421701312065125,
+    -0.5782254338264465,   -0.03217470645904541,  -0.24412314593791962,  -0.04053588956594467,  0.06695655733346939,
+    0.8035387396812439,    0.9083728194236755,    -0.10134884715080261,  0.580856442451477,     -0.39154210686683655,
+    0.030684364959597588,  -0.030641548335552216, 0.04488494619727135,   -1.01302170753479,     -0.7144106030464172,
+    -0.9805818796157837,   -0.5400681495666504,   -0.1291513293981552,   -0.05380750074982643,  0.46302980184555054,
+    -0.5166309475898743,   -0.557148277759552,    -0.3928050100803375,   -1.2200350761413574,   -0.038863372057676315,
+    0.004997415002435446,  -0.23469892144203186,  -0.679160475730896,    -0.28962942957878113,  0.0753190666437149,
+    0.2647518813610077,    -0.2383699119091034,   0.31467366218566895,   -0.2623683214187622,   -0.0047197830863296986,
+    -0.19377374649047852,  -0.726780354976654,    -0.08653445541858673,  -0.0821520984172821,   -0.32969436049461365,
+    0.7896286845207214,    0.06019389629364014,   0.0533672533929348,    0.5615957975387573,    -1.073058009147644,
+    -0.06900335848331451,  0.04005265235900879,   0.7481744885444641,    0.5929533243179321,    0.34676918387413025,
+    0.20277132093906403,   0.2494238317012787,    -0.016953688114881516, -0.18527524173259735,  0.011035679839551449,
+    0.21416491270065308,   0.24300836026668549,   -0.0823434591293335,   0.06647182255983353,   -0.182808980345726,
+    0.041988298296928406,  -0.3488544821739197,   0.23610837757587433,   -0.09287332743406296,  0.06366341561079025,
+    -0.5438804626464844,   -0.2314717024564743,   -0.34810754656791687,  -0.2610490918159485,   -0.28447479009628296,
+    0.1289278119802475,    -0.11885590851306915,  0.4982030987739563,    0.0008039992535486817, -0.0822419822216034,
+    -0.6632303595542908,   -0.001471939729526639, -0.02822187915444374,  0.40625572204589844,   0.04420854523777962,
+    0.09683408588171005,   -0.1369173526763916,   0.034105125814676285,  0.059692155569791794,  0.2282908707857132,
+    0.005600005853921175,  0.0831512063741684,    0.7344544529914856,    0.9184833765029907,    -0.5474745035171509,
+    0.17113414406776428,   -1.062245488166809,    0.003962018992751837,  -0.1219346821308136,   -0.20420759916305542,
+    0.18261896073818207,   0.31306836009025574,   -0.17618107795715332,  0.5746090412139893,    0.5966029763221741,
+    -0.4151947796344757,   -0.41818466782569885,  -0.5377653241157532,   -0.03424999862909317,  0.14284899830818176,
+    0.3042220175266266,    0.053678177297115326,  -0.2879513204097748,   0.1615709662437439,    1.0633289813995361,
+    -0.9951322674751282,   0.005951686762273312,  -0.7653868794441223,   1.0301547050476074,    -0.1278434842824936,
+    -0.09799766540527344,  -0.03933180123567581,  0.3333270847797394,    -0.36346134543418884,  -0.06087929755449295,
+    -0.18778374791145325,  -0.22351786494255066,  0.341593861579895,     -0.10702977329492569,  -0.19138604402542114,
+    0.2198142409324646,    0.5555373430252075,    0.17944788932800293,   -0.25580865144729614,  0.11132766306400299,
+    -0.04274112731218338,  0.21128565073013306,   0.3497539460659027,    0.5966490507125854,    -0.3750445544719696,
+    -1.3152449131011963,   -0.1666506826877594,   -0.46087339520454407,  0.023604873567819595,  -0.764664351940155,
+    -0.01927816867828369,  0.25774237513542175,   0.2519788444042206,    -0.03912343829870224,  -0.1336650848388672,
+    0.03700028359889984,   -1.2252296209335327,   -0.28387972712516785,  0.4538232088088989,    -0.46708062291145325,
+    0.37740620970726013,   -0.23084771633148193,  -0.5154166221618652,   -0.17744411528110504,  -0.403827041387558,
+    -0.7599346041679382,   0.29916343092918396,   0.3068315088748932,    -0.2873938977718353,   0.04642490670084953,
+    -0.2842433452606201,   -0.13825878500938416,  -0.06075500696897507,  0.12485457956790924,   0.28462037444114685,
+    0.22523891925811768,   -0.16499759256839752,  -0.4995443522930145,   -0.2872397005558014,   0.20112836360931396,
+    -0.15212756395339966,  0.6267700791358948,    -0.36202308535575867,  -0.019753199070692062, -0.1069127544760704,
+    -1.7864320278167725,   -0.37027886509895325,  0.3490080237388611,    -1.345146894454956,    0.7847938537597656,
+    0.6828436851501465,    -0.16551412642002106,  0.2214297652244568,    0.011648695915937424,  -0.7975162267684937,
+    -0.02284269593656063,  0.43721839785575867,   -0.7356336712837219,   0.1347900927066803,    -0.10049286484718323,
+    0.033914126455783844,  -0.34215137362480164,  0.09232623875141144,   0.40929362177848816,   -0.3886246085166931,
+    -0.3798733353614807,   -0.18183614313602448,  0.30758562684059143,   -0.6594212055206299,   -1.2489123344421387,
+    2.3558812141418457,    1.3266096115112305,    0.7582473158836365,    0.5460497140884399,    0.478423148393631,
+    -0.4354279041290283,   -0.4835488498210907,   0.35403916239738464,   -0.2386334240436554,   -0.7542760968208313,
+    1.0410500764846802,    0.39106982946395874,   -0.33270010352134705,  -0.15707892179489136,  -0.8100389838218689,
+    -0.5488188862800598,   0.9018237590789795,    0.1463090032339096,    0.2709485590457916,    0.6825831532478333,
+    1.4789973497390747,    -0.05518924817442894,  0.3004698157310486,    -0.5478758215904236,   -0.2650642693042755,
+    -0.5091060400009155,   -0.498453825712204,    -0.04439292848110199,  0.1543867141008377,    -0.8747442364692688,
+    0.29397979378700256,   0.23609337210655212,   0.45201119780540466,   0.15274697542190552,   -0.13781824707984924,
+    -0.192060187458992,    0.24538753926753998,   -0.15118913352489471,  0.2593905031681061,    -0.25297290086746216,
+    0.03411773964762688,   4.204725742340088,     0.2284027636051178,    -0.14012105762958527,  0.7193062901496887,
+    0.2792465090751648,    0.6857842803001404,    0.18091899156570435,   0.7010433077812195,    0.12348262965679169,
+    0.004731568042188883,  0.01740850880742073,   0.14232489466667175,   -0.3855608105659485,   0.036290157586336136,
+    0.3277924358844757,    -0.7967148423194885,   -0.04664124920964241,  0.3066774308681488,    -0.24470321834087372,
+    0.10395496338605881,   0.15230552852153778,   -0.174297034740448,    -0.0960993766784668,   -0.1887694150209427,
+    -1.4175556898117065,   -1.0758236646652222,   0.1659371554851532,    0.21053434908390045,   0.08056849986314774,
+    -0.41402244567871094,  -0.010590888559818268, 0.18286718428134918,   -0.025911178439855576, 0.0007497810875065625,
+    0.28961339592933655,   0.3736001253128052,    -0.028003234416246414, 0.10028575360774994,   -0.9384022355079651,
+    0.01677035167813301,   0.4002298414707184,    -0.17245259881019592,  -0.023904485628008842, -0.03755472972989082,
+    -1.1449834108352661,   -0.08905462175607681,  0.299746036529541,     0.9106025099754333,    -1.1242833137512207,
+    -0.6397426724433899,   -0.30954208970069885,  -0.29987451434135437,  0.022143784910440445,  0.21520589292049408,
+    -0.7456017732620239,   0.010864314623177052,  -0.06704878062009811,  -0.050403349101543427, -0.09107541292905807,
+    -0.22785325348377228,  -0.6726369261741638,   -0.03998852148652077,  0.22269004583358765,   0.04788350686430931,
+    -0.21267156302928925,  -0.2652517259120941,   -1.059337854385376,    -0.02806372381746769,  -0.6692616939544678,
+    0.5877380967140198,    -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
+    2.843688726425171,     2.455843448638916,     0.03450493887066841,   0.019999999552965164};
 
-    // Dum high g 0.061 Epochs=300
-    NamModel3.weights = {
-        -0.6769029498100281,    0.6602473258972168,    -0.5796496272087097,    -1.142741084098816,    0.21598036587238312,
-        0.35398679971694946,    0.7549470663070679,    0.039477646350860596,   -0.24745023250579834,  -0.9132247567176819,
-        -0.007729288190603256,  0.11480402946472168,   0.4978431165218353,     -0.33044248819351196,  -0.2658558785915375,
-        -0.1038040816783905,    0.13981787860393524,   0.5687652230262756,     -0.9140944480895996,   -0.7761039733886719,
-        0.4616684019565582,     0.718984842300415,     -0.015351603738963604,  0.5137616395950317,    -0.7178272604942322,
-        0.17940577864646912,    0.40874800086021423,   0.6447089910507202,     0.205467090010643,     0.3938930034637451,
-        0.2039058953523636,     0.8569315671920776,    0.08799949288368225,    -0.24445800483226776,  -0.3795508146286011,
-        -0.423810213804245,     0.1825140416622162,    0.47028520703315735,    0.3174600303173065,    -0.2525789737701416,
-        0.2300155907869339,     -0.3600919246673584,   0.2475096881389618,     -0.9636282324790955,   -0.42557045817375183,
-        -0.25510865449905396,   -0.08881562203168869,  -0.33571937680244446,   -0.32591694593429565,  -1.1837259531021118,
-        0.6148584485054016,     0.8463069796562195,    0.7587720155715942,     -0.37679657340049744,  -0.07729806005954742,
-        -0.0050791241228580475, -0.3090479373931885,   0.047944068908691406,   -0.17505231499671936,  0.26548391580581665,
-        1.3570529222488403,     0.24964118003845215,   -0.5064348578453064,    1.362426519393921,     0.5106933116912842,
-        0.09470630437135696,    -0.11468131095170975,  0.28673335909843445,    -0.42304298281669617,  0.24214008450508118,
-        0.4792342185974121,     0.34394994378089905,   0.4782758057117462,     -0.16345663368701935,  1.5920655727386475,
-        0.5135330557823181,     -0.45916807651519775,  -1.970070481300354,     0.33813223242759705,   -0.1403094381093979,
-        -0.2387097179889679,    0.0700695589184761,    0.7393310070037842,     -2.7987308502197266,   -0.31762832403182983,
-        -0.6002845168113708,    0.9195849299430847,    -0.29845982789993286,   0.24807409942150116,   -0.2799651324748993,
-        -0.1422102153301239,    1.1138254404067993,    -0.5352693200111389,    0.6990038752555847,    -0.8945221900939941,
-        -0.47695058584213257,   -0.17088131606578827,  0.7544339895248413,     -0.24067331850528717,  0.5377756953239441,
-        0.431759774684906,      -0.10561998188495636,  -0.08660419285297394,   0.036302562803030014,  0.3654203414916992,
-        2.5694620609283447,     -0.8637101054191589,   -0.4198220372200012,    0.12109514325857162,   1.068908452987671,
-        -0.29876986145973206,   0.5812512636184692,    0.13398438692092896,    0.1491488516330719,    0.40750357508659363,
-        0.3429611623287201,     0.0203320924192667,    -0.5420306324958801,    0.3015601634979248,    0.07806447148323059,
-        -0.1525309830904007,    0.04086008295416832,   0.4915582239627838,     -0.22393815219402313,  -0.687716007232666,
-        -0.12298983335494995,   -1.0956876277923584,   0.8415812253952026,     -0.3494316637516022,   -0.7048468589782715,
-        0.8995926976203918,     0.4355396628379822,    -0.4598672389984131,    0.00955875776708126,   0.06744617968797684,
-        -0.03729358687996864,   -0.22567696869373322,  0.18799284100532532,    0.2199118435382843,    0.13322921097278595,
-        0.32105350494384766,    0.7034862041473389,    2.170924186706543,      0.010056979954242706,  -0.7637267708778381,
-        -0.3859962821006775,    -0.22877167165279388,  -0.2673760652542114,    -1.1210782527923584,   0.6308124661445618,
-        -1.0015695095062256,    -0.228221595287323,    -0.2570177912712097,    1.0015209913253784,    0.6359553337097168,
-        -0.416197806596756,     0.3965815305709839,    -0.14474520087242126,   -0.17956814169883728,  0.17178252339363098,
-        -0.19186775386333466,   -0.15919823944568634,  -0.7764678597450256,    -0.5025101900100708,   -0.0018483791500329971,
-        -0.5083453059196472,    -0.2619108259677887,   -0.0053082057274878025, 0.14724282920360565,   -0.3091423511505127,
-        0.27445659041404724,    -1.9556788206100464,   0.5218331813812256,     -0.26317447423934937,  -3.5430824756622314,
-        -0.15909913182258606,   0.12418676167726517,   -0.05585821345448494,   0.3848002552986145,    0.4308006167411804,
-        -0.2615695595741272,    -0.24642235040664673,  0.7210997939109802,     0.09440425038337708,   0.34975284337997437,
-        0.0615927055478096,     -0.27102386951446533,  0.45639804005622864,    0.22196261584758759,   0.122841976583004,
-        -0.15628409385681152,   0.5470033884048462,    0.28742873668670654,    -0.08696866035461426,  -0.27888911962509155,
-        -0.1130259782075882,    -0.055281151086091995, -0.11690052598714828,   -0.09918388724327087,  -0.04742269217967987,
-        -0.36256149411201477,   -0.0943872407078743,   -0.8297582864761353,    -0.06164613366127014,  -1.2088348865509033,
-        0.856268048286438,      -0.1721135526895523,   0.3133206069469452,     -0.024895304813981056, 0.018068520352244377,
-        0.6314529180526733,     -0.019890975207090378, -0.0001318732392974198, 0.09853632003068924,   -0.07230021059513092,
-        0.10577412694692612,    -0.20973119139671326,  -0.037896838039159775,  -0.032821036875247955, -0.45645013451576233,
-        0.07590236514806747,    0.6504011154174805,    0.5338518023490906,     -0.6865733861923218,   -0.42958277463912964,
-        0.7347825169563293,     -2.1007485389709473,   1.3916711807250977,     -0.16600053012371063,  -0.15445393323898315,
-        0.5251907110214233,     0.0629759132862091,    0.2916717231273651,     0.15876799821853638,   -0.2320084273815155,
-        -0.11673396825790405,   -0.08898436278104782,  -1.2568786144256592,    0.051702871918678284,  0.541200578212738,
-        -0.0158249419182539,    0.20217961072921753,   -0.11707478761672974,   0.03497016802430153,   -0.04420706629753113,
-        -1.346960425376892,     -0.6042386293411255,   -0.5973080396652222,    -0.4901060461997986,   -0.21880321204662323,
-        -0.1388302594423294,    0.04590976610779762,   -0.019543856382369995,  -0.08132804930210114,  0.2744017243385315,
-        -0.37433719635009766,   0.17726236581802368,   0.11098449677228928,    -1.8912924528121948,   -0.6207332611083984,
-        0.008874258026480675,   -0.07238878309726715,  -0.15937837958335876,   0.41954168677330017,   0.16717374324798584,
-        0.025682514533400536,   -0.3451758921146393,   1.848156452178955,      0.5244119167327881,    -0.2186271846294403,
-        -0.5582791566848755,    -0.533944308757782,    -0.3888051211833954,    0.5153398513793945,    -0.10217016935348511,
-        -1.3278822898864746,    -0.10232920199632645,  0.4844115674495697,     -0.3640969693660736,   -0.5247126221656799,
-        0.9246591925621033,     -0.5307027697563171,   0.31604358553886414,    0.2383572906255722,    0.05482090637087822,
-        -0.26913949847221375,   -0.5426355004310608,   0.17786726355552673,    -0.9826139211654663,   0.8705827593803406,
-        -0.42161861062049866,   0.8952623009681702,    -0.1459306925535202,    -0.4766400158405304,   -0.1195647269487381,
-        -0.3984401226043701,    0.21651314198970795,   0.07264020293951035,    -0.2366284281015396,   0.021560359746217728,
-        0.18324574828147888,    -0.5920048356056213,   -0.3206005096435547,    0.21037673950195312,   0.8533831834793091,
-        0.09609415382146835,    0.09586144983768463,   -0.6900227069854736,    0.009697099216282368,  -0.4684286117553711,
-        0.02043369598686695,    -0.7125506401062012,   -0.10655244439840317,   -0.4403235912322998,   1.8189839124679565,
-        0.43995359539985657,    -0.3797566890716553,   0.02275899052619934,    0.5076084733009338,    0.7797986268997192,
-        -0.11499059945344925,   -0.1495504230260849,   0.3720855414867401,     -0.9827927947044373,   0.1987764537334442,
-        0.012312803417444229,   -0.10878057777881622,  0.37301790714263916,    0.07968480885028839,   -0.37832555174827576,
-        -0.04750276729464531,   -0.025289613753557205, -0.9720318913459778,    -0.4358881413936615,   -0.00833168439567089,
-        0.6133887767791748,     0.14675414562225342,   1.1672120094299316,     0.4127982258796692,    0.6079938411712646,
-        0.16992834210395813,    -0.003543263068422675, 0.254406213760376,      0.31815969944000244,   -0.02978666126728058,
-        0.43757444620132446,    0.33877506852149963,   0.06153248995542526,    -1.0313007831573486,   0.40971097350120544,
-        0.1237669512629509,     1.4244515895843506,    -0.6648765206336975,    0.4060664772987366,    -0.058354172855615616,
-        1.157210350036621,      -1.9144351482391357,   0.33797699213027954,    -0.25451576709747314,  -0.23126338422298431,
-        -0.521163284778595,     -0.2897718548774719,   0.09692589193582535,    0.1421317607164383,    -0.11576057970523834,
-        0.169725239276886,      0.2613389790058136,    -0.24097663164138794,   0.2501189112663269,    0.48711368441581726,
-        1.0995855331420898,     0.3025473356246948,    0.8118847012519836,     0.9326151013374329,    -0.13486690819263458,
-        -1.006386160850525,     0.09644370526075363,   -0.5726542472839355,    2.0044026374816895,    0.7508656978607178,
-        2.098738670349121,      0.07803081721067429,   0.651964008808136,      0.560111939907074,     -0.11474188417196274,
-        -0.07857426255941391,   0.013799303211271763,  -0.49022796750068665,   -0.28923937678337097,  -0.2202281355857849,
-        -0.25942105054855347,   0.2752782106399536,    0.09983915835618973,    -0.35874930024147034,  0.7101683020591736,
-        -0.31742075085639954,   0.08550919592380524,   -0.09894556552171707,   0.47453877329826355,   1.1759105920791626,
-        0.9221142530441284,     -0.6043053269386292,   -1.8850220441818237,    0.6426469087600708,    0.8023408055305481,
-        -0.8632621765136719,    -0.05220484733581543,  -0.1121130883693695,    -0.008329365402460098, 0.2554653286933899,
-        -0.5778998732566833,    -0.1233365386724472,   0.12440893799066544,    -0.33562394976615906,  0.15267041325569153,
-        0.44632086157798767,    -0.5663943886756897,   0.629599928855896,      0.13916300237178802,   0.1492478847503662,
-        -0.0723295658826828,    -0.10407141596078873,  1.8793108463287354,     -0.149763286113739,    0.9284605979919434,
-        -0.12744338810443878,   0.4440706670284271,    -0.4033127725124359,    0.06633744388818741,   0.332746297121048,
-        -0.0640496239066124,    -0.03837119787931442,  0.9488198757171631,     0.07915345579385757,   -0.004549246281385422,
-        -0.03337665647268295,   0.6338216662406921,    0.01439643930643797,    0.11625343561172485,   -0.8266898989677429,
-        -0.06654249131679535,   0.4162447154521942,    -1.8871657848358154,    -0.1184280663728714,   -0.6692616939544678,
-        0.5877380967140198,     -0.28285887837409973,  0.20710033178329468,    0.03224611282348633,   -0.6376116871833801,
-        3.472496271133423,      3.374540090560913,     0.6998860836029053,     0.019999999552965164};
+// Dum high g 0.061 Epochs=300
+constexpr float NamModel3[] = {
+    -0.6769029498100281,    0.6602473258972168,    -0.5796496272087097,    -1.142741084098816,    0.21598036587238312,
+    0.35398679971694946,    0.7549470663070679,    0.039477646350860596,   -0.24745023250579834,  -0.9132247567176819,
+    -0.007729288190603256,  0.11480402946472168,   0.4978431165218353,     -0.33044248819351196,  -0.2658558785915375,
+    -0.1038040816783905,    0.13981787860393524,   0.5687652230262756,     -0.9140944480895996,   -0.7761039733886719,
+    0.4616684019565582,     0.718984842300415,     -0.015351603738963604,  0.5137616395950317,    -0.7178272604942322,
+    0.17940577864646912,    0.40874800086021423,   0.6447089910507202,     0.205467090010643,     0.3938930034637451,
+    0.2039058953523636,     0.8569315671920776,    0.08799949288368225,    -0.24445800483226776,  -0.3795508146286011,
+    -0.423810213804245,     0.1825140416622162,    0.47028520703315735,    0.3174600303173065,    -0.2525789737701416,
+    0.2300155907869339,     -0.3600919246673584,   0.2475096881389618,     -0.9636282324790955,   -0.42557045817375183,
+    -0.25510865449905396,   -0.08881562203168869,  -0.33571937680244446,   -0.32591694593429565,  -1.1837259531021118,
+    0.6148584485054016,     0.8463069796562195,    0.7587720155715942,     -0.37679657340049744,  -0.07729806005954742,
+    -0.0050791241228580475, -0.3090479373931885,   0.047944068908691406,   -0.17505231499671936,  0.26548391580581665,
+    1.3570529222488403,     0.24964118003845215,   -0.5064348578453064,    1.362426519393921,     0.5106933116912842,
+    0.09470630437135696,    -0.11468131095170975,  0.28673335909843445,    -0.42304298281669617,  0.24214008450508118,
+    0.4792342185974121,     0.34394994378089905,   0.4782758057117462,     -0.16345663368701935,  1.5920655727386475,
+    0.5135330557823181,     -0.45916807651519775,  -1.970070481300354,     0.33813223242759705,   -0.1403094381093979,
+    -0.2387097179889679,    0.0700695589184761,    0.7393310070037842,     -2.7987308502197266,   -0.31762832403182983,
+    -0.6002845168113708,    0.9195849299430847,    -0.29845982789993286,   0.24807409942150116,   -0.2799651324748993,
+    -0.1422102153301239,    1.1138254404067993,    -0.5352693200111389,    0.6990038752555847,    -0.8945221900939941,
+    -0.47695058584213257,   -0.17088131606578827,  0.7544339895248413,     -0.24067331850528717,  0.5377756953239441,
+    0.431759774684906,      -0.10561998188495636,  -0.08660419285297394,   0.036302562803030014,  0.3654203414916992,
+    2.5694620609283447,     -0.8637101054191589,   -0.4198220372200012,    0.12109514325857162,   1.068908452987671,
+    -0.29876986145973206,   0.5812512636184692,    0.13398438692092896,    0.1491488516330719,    0.40750357508659363,
+    0.3429611623287201,     0.0203320924192667,    -0.5420306324958801,    0.3015601634979248,    0.07806447148323059,
+    -0.1525309830904007,    0.04086008295416832,   0.4915582239627838,     -0.22393815219402313,  -0.687716007232666,
+    -0.12298983335494995,   -1.0956876277923584,   0.8415812253952026,     -0.3494316637516022,   -0.7048468589782715,
+    0.8995926976203918,     0.4355396628379822,    -0.4598672389984131,    0.00955875776708126,   0.06744617968797684,
+    -0.03729358687996864,   -0.22567696869373322,  0.18799284100532532,    0.2199118435382843,    0.13322921097278595,
+    0.32105350494384766,    0.7034862041473389,    2.170924186706543,      0.010056979954242706,  -0.7637267708778381,
+    -0.3859962821006775,    -0.22877167165279388,  -0.2673760652542114,    -1.1210782527923584,   0.6308124661445618,
+    -1.0015695095062256,    -0.228221595287323,    -0.2570177912712097,    1.0015209913253784,    0.6359553337097168,
+    -0.416197806596756,     0.3965815305709839,    -0.14474520087242126,   -0.17956814169883728,  0.17178252339363098,
+    -0.19186775386333466,   -0.15919823944568634,  -0.7764678597450256,    -0.5025101900100708,   -0.0018483791500329971,
+    -0.5083453059196472,    -0.2619108259677887,   -0.0053082057274878025, 0.14724282920360565,   -0.3091423511505127,
+    0.27445659041404724,    -1.9556788206100464,   0.5218331813812256,     -0.26317447423934937,  -3.5430824756622314,
+    -0.15909913182258606,   0.12418676167726517,   -0.05585821345448494,   0.3848002552986145,    0.4308006167411804,
+    -0.2615695595741272,    -0.24642235040664673,  0.7210997939109802,     0.09440425038337708,   0.34975284337997437,
+    0.0615927055478096,     -0.27102386951446533,  0.45639804005622864,    0.22196261584758759,   0.122841976583004,
+    -0.15628409385681152,   0.5470033884048462,    0.28742873668670654,    -0.08696866035461426,  -0.27888911962509155,
+    -0.1130259782075882,    -0.055281151086091995, -0.11690052598714828,   -0.09918388724327087,  -0.04742269217967987,
+    -0.36256149411201477,   -0.0943872407078743,   -0.8297582864761353,    -0.06164613366127014,  -1.2088348865509033,
+    0.856268048286438,      -0.1721135526895523,   0.3133206069469452,     -0.024895304813981056, 0.018068520352244377,
+    0.6314529180526733,     -0.019890975207090378, -0.0001318732392974198, 0.09853632003068924,   -0.07230021059513092,
+    0.10577412694692612,    -0.20973119139671326,  -0.037896838039159775,  -0.032821036875247955, -0.45645013451576233,
+    0.07590236514806747,    0.6504011154174805,    0.5338518023490906,     -0.6865733861923218,   -0.42958277463912964,
+    0.7347825169563293,     -2.1007485389709473,   1.3916711807250977,     -0.16600053012371063,  -0.15445393323898315,
+    0.5251907110214233,     0.0629759132862091,    0.2916717231273651,     0.15876799821853638,   -0.2320084273815155,
+    -0.11673396825790405,   -0.08898436278104782,  -1.2568786144256592,    0.051702871918678284,  0.541200578212738,
+    -0.0158249419182539,    0.20217961072921753,   -0.11707478761672974,   0.03497016802430153,   -0.04420706629753113,
+    -1.346960425376892,     -0.6042386293411255,   -0.5973080396652222,    -0.4901060461997986,   -0.21880321204662323,
+    -0.1388302594423294,    0.04590976610779762,   -0.019543856382369995,  -0.08132804930210114,  0.2744017243385315,
+    -0.37433719635009766,   0.17726236581802368,   0.11098449677228928,    -1.8912924528121948,   -0.6207332611083984,
+    0.008874258026480675,   -0.07238878309726715,  -0.15937837958335876,   0.41954168677330017,   0.16717374324798584,
+    0.025682514533400536,   -0.3451758921146393,   1.848156452178955,      0.5244119167327881,    -0.2186271846294403,
+    -0.5582791566848755,    -0.533944308757782,    -0.3888051211833954,    0.5153398513793945,    -0.10217016935348511,
+    -1.3278822898864746,    -0.10232920199632645,  0.4844115674495697,     -0.3640969693660736,   -0.5247126221656799,
+    0.9246591925621033,     -0.5307027697563171,   0.31604358553886414,    0.2383572906255722,    0.05482090637087822,
+    -0.26913949847221375,   -0.5426355004310608,   0.17786726355552673,    -0.9826139211654663,   0.8705827593803406,
+    -0.42161861062049866,   0.8952623009681702,    -0.1459306925535202,    -0.4766400158405304,   -0.1195647269487381,
+    -0.3984401226043701,    0.21651314198970795,   0.07264020293951035,    -0.2366284281015396,   0.021560359746217728,
+    0.18324574828147888,    -0.5920048356056213,   -0.3206005096435547,    0.21037673950195312,   0.8533831834793091,
+    0.09609415382146835,    0.09586144983768463,   -0.6900227069854736,    0.009697099216282368,  -0.4684286117553711,
+    0.02043369598686695,    -0.7125506401062012,   -0.10655244439840317,   -0.4403235912322998,   1.8189839124679565,
+    0.43995359539985657,    -0.3797566890716553,   0.02275899052619934,    0.5076084733009338,    0.7797986268997192,
+    -0.11499059945344925,   -0.1495504230260849,   0.3720855414867401,     -0.9827927947044373,   0.1987764537334442,
+    0.012312803417444229,   -0.10878057777881622,  0.37301790714263916,    0.07968480885028839,   -0.37832555174827576,
+    -0.04750276729464531,   -0.025289613753557205, -0.9720318913459778,    -0.4358881413936615,   -0.00833168439567089,
+    0.6133887767791748,     0.14675414562225342,   1.1672120094299316,     0.4127982258796692,    0.6079938411712646,
+    0.16992834210395813,    -0.003543263068422675, 0.254406213760376,      0.31815969944000244,   -0.02978666126728058,
+    0.43757444620132446,    0.33877506852149963,   0.06153248995542526,    -1.0313007831573486,   0.40971097350120544,
+    0.1237669512629509,     1.4244515895843506,    -0.6648765206336975,    0.4060664772987366,    -0.058354172855615616,
+    1.157210350036621,      -1.9144351482391357,   0.33797699213027954,    -0.25451576709747314,  -0.23126338422298431,
+    -0.521163284778595,     -0.2897718548774719,   0.09692589193582535,    0.1421317607164383,    -0.11576057970523834,
+    0.169725239276886,      0.2613389790058136,    -0.24097663164138794,   0.2501189112663269,    0.48711368441581726,
+    1.0995855331420898,     0.3025473356246948,    0.8118847012519836,     0.9326151013374329,    -0.13486690819263458,
+    -1.006386160850525,     0.09644370526075363,   -0.5726542472839355,    2.0044026374816895,    0.7508656978607178,
+    2.098738670349121,      0.07803081721067429,   0.651964008808136,      0.560111939907074,     -0.11474188417196274,
+    -0.07857426255941391,   0.013799303211271763,  -0.49022796750068665,   -0.28923937678337097,  -0.2202281355857849,
+    -0.25942105054855347,   0.2752782106399536,    0.09983915835618973,    -0.35874930024147034,  0.7101683020591736,
+    -0.31742075085639954,   0.08550919592380524,   -0.09894556552171707,   0.47453877329826355,   1.1759105920791626,
+    0.9221142530441284,     -0.6043053269386292,   -1.8850220441818237,    0.6426469087600708,    0.8023408055305481,
+    -0.8632621765136719,    -0.05220484733581543,  -0.1121130883693695,    -0.008329365402460098, 0.2554653286933899,
+    -0.5778998732566833,    -0.1233365386724472,   0.12440893799066544,    -0.33562394976615906,  0.15267041325569153,
+    0.44632086157798767,    -0.5663943886756897,   0.629599928855896,      0.13916300237178802,   0.1492478847503662,
+    -0.0723295658826828,    -0.10407141596078873,  1.8793108463287354,     -0.149763286113739,    0.9284605979919434,
+    -0.12744338810443878,   0.4440706670284271,    -0.4033127725124359,    0.06633744388818741,   0.332746297121048,
+    -0.0640496239066124,    -0.03837119787931442,  0.9488198757171631,     0.07915345579385757,   -0.004549246281385422,
+    -0.03337665647268295,   0.6338216662406921,    0.01439643930643797,    0.11625343561172485,   -0.8266898989677429,
+    -0.06654249131679535,   0.4162447154521942,    -1.8871657848358154,    -0.1184280663728714,   -0.6692616939544678,
+    0.5877380967140198,     -0.28285887837409973,  0.20710033178329468,    0.03224611282348633,   -0.6376116871833801,
+    3.472496271133423,      3.374540090560913,     0.6998860836029053,     0.019999999552965164};
 
-    // Dum lowg 0.03 Epochs=300
-    NamModel4.weights = {
-        -0.21672961115837097,   0.6680753827095032,   -0.8541843295097351,   -1.4216548204421997,   0.5007015466690063,
-        0.6861110925674438,     1.129280686378479,    -0.25371479988098145,  -0.17103390395641327,  -0.43029189109802246,
-        -0.07381530851125717,   0.12931965291500092,  0.16701047122478485,   -0.2698405385017395,   0.0018584387144073844,
-        0.03392714262008667,    -0.15406523644924164, 0.6269673705101013,    -0.6526519060134888,   0.31865960359573364,
-        0.19387002289295197,    0.4347992241382599,   0.02157755009829998,   0.5095287561416626,    1.0697909593582153,
-        1.6803390979766846,     -1.0866271257400513,  -1.3011014461517334,   0.44281166791915894,   0.4128124713897705,
-        0.5864476561546326,     0.7376850247383118,   -0.4493808448314667,   -0.08798795193433762,  -0.5099354386329651,
-        -0.44908928871154785,   0.11903826147317886,  0.2924829125404358,    -1.5628515481948853,   0.3983801007270813,
-        0.33976688981056213,    0.3450927138328552,   0.2876558303833008,    -0.670974850654602,    -0.296568363904953,
-        -0.3997034728527069,    -0.31013888120651245, 0.202720507979393,     0.2998778223991394,    0.4780450761318207,
-        -0.025771938264369965,  0.058450885117053986, 0.022991744801402092,  -0.16484741866588593,  0.37744811177253723,
-        -0.9356744289398193,    0.40246570110321045,  -0.4516937732696533,   -0.058167628943920135, -0.05583447217941284,
-        -0.0051286546513438225, -0.42897480726242065, -0.24965597689151764,  -0.9056965708732605,   0.4807685911655426,
-        -0.6251549124717712,    0.053486015647649765, 0.006812951993197203,  0.260667622089386,     0.8343628644943237,
-        -0.4845716655254364,    -0.5645931959152222,  -0.23245024681091309,  0.7337635159492493,    1.2323509454727173,
-        1.2183339595794678,     0.4974342882633209,   -1.232147455215454,    0.3671962022781372,    0.2620197534561157,
-        0.2901793420314789,     0.37666186690330505,  0.8212873935699463,    -1.9023405313491821,   -0.8893784880638123,
-        -0.31839385628700256,   -0.28325217962265015, -0.45091816782951355,  0.32612985372543335,   -0.557057797908783,
-        0.24397316575050354,    1.233117938041687,    -0.9180221557617188,   0.9173181056976318,    -0.372914582490921,
-        -0.2826370596885681,    -0.6063545942306519,  -2.53222393989563,     0.912785530090332,     -1.132514238357544,
-        0.4897824227809906,     0.4849191904067993,   -0.1844179332256317,   0.5141417384147644,    -1.8955127000808716,
-        0.5586462020874023,     0.17730990052223206,  -1.5565948486328125,   -1.2398602962493896,   0.41595545411109924,
-        0.005400347523391247,   0.37228378653526306,  0.1334926337003708,    -0.09388837218284607,  0.667602002620697,
-        0.04504779353737831,    -0.35122615098953247, 0.5999744534492493,    -0.5698007345199585,   -0.4252203106880188,
-        0.2430635392665863,     -0.11806514114141464, 0.13920482993125916,   0.018072551116347313,  -0.06005144864320755,
-        -0.0409969687461853,    -0.23207640647888184, -0.08716718852519989,  0.2700636684894562,    -1.1945334672927856,
-        -1.2748466730117798,    0.2042272537946701,   -0.21176308393478394,  -0.0753021314740181,   -0.024384573101997375,
-        -0.12467490136623383,   0.39543819427490234,  -0.1402868926525116,   -0.012328716926276684, 0.3915475010871887,
-        0.3380435109138489,     -0.1513059139251709,  0.1353762447834015,    0.17046478390693665,   -0.34296947717666626,
-        1.1091021299362183,     0.12332043796777725,  0.054084885865449905,  -0.2905316650867462,   -3.2276995182037354,
-        -1.347021460533142,     -1.0033018589019775,  0.6078070402145386,    1.0571120977401733,    0.5225768089294434,
-        -0.5481863617897034,    0.8715481758117676,   0.05666496977210045,   0.2967052459716797,    0.3342730700969696,
-        -0.2762812077999115,    -0.23915636539459229, -0.3096584677696228,   -0.4204099774360657,   -0.7844758033752441,
-        -0.14252889156341553,   -0.5166653990745544,  0.18550516664981842,   -0.0967140942811966,   -0.7898126244544983,
-        0.21335245668888092,    0.628408670425415,    0.9148246645927429,    -0.021260371431708336, -0.49058228731155396,
-        -0.2292129397392273,    0.2148902863264084,   -0.1274072527885437,   -0.01893208920955658,  -0.7373600006103516,
-        0.2969057261943817,     -0.9831510782241821,  1.1034948825836182,    0.6464563012123108,    0.2917388379573822,
-        0.26717740297317505,    -0.06781621277332306, 0.4361128807067871,    -0.2673192024230957,   -0.06082604080438614,
-        0.2846423387527466,     0.2596549689769745,   0.04995875060558319,   -0.3442218005657196,   -0.3523794114589691,
-        0.043712861835956573,   -0.16426371037960052, -0.03709053993225098,  -0.04698151722550392,  0.12660138309001923,
-        0.8979313969612122,     0.8709422945976257,   -1.0600593090057373,   -1.08076012134552,     -0.9618424773216248,
-        0.12410673499107361,    -0.21810850501060486, 0.5625948905944824,    0.004450046457350254,  0.16159281134605408,
-        0.26898089051246643,    -0.01500022690743208, 0.13050298392772675,   -0.15022054314613342,  -0.10213010013103485,
-        0.20126724243164062,    -0.8129749894142151,  -0.12054132670164108,  0.21557435393333435,   -0.40578097105026245,
-        -0.01459859125316143,   0.328594446182251,    -0.32029449939727783,  1.7683401107788086,    -0.1699880212545395,
-        0.12277601659297943,    -0.766191840171814,   0.3444822430610657,    -0.19993284344673157,  -0.1419731229543686,
-        0.25952374935150146,    0.3283884525299072,   0.14877022802829742,   0.15639126300811768,   0.061331406235694885,
-        -0.37677523493766785,   -0.8792782425880432,  -0.27287888526916504,  0.31394168734550476,   -0.02528548613190651,
-        -0.00546693941578269,   -0.17591293156147003, -0.3101772665977478,   0.1672751009464264,    1.089199185371399,
-        -0.7354046702384949,    0.6659253835678101,   -0.7332332134246826,   -0.048978909850120544, 0.29135969281196594,
-        -0.12533684074878693,   0.03603127971291542,  0.614931583404541,     -0.20101575553417206,  0.20021255314350128,
-        -0.5700886249542236,    -0.07096870988607407, 0.22131383419036865,   -0.17029118537902832,  0.8371438980102539,
-        -0.14128243923187256,   0.9285588264465332,   -0.10139285027980804,  0.18749317526817322,   0.0715315192937851,
-        0.2858094871044159,     -0.49791625142097473, -1.4580698013305664,   1.1127854585647583,    0.49991366267204285,
-        -0.6665695309638977,    0.18071337044239044,  -0.36363768577575684,  -0.06314156204462051,  0.11740581691265106,
-        -0.13331149518489838,   0.13477662205696106,  -0.5498265027999878,   -0.01735677570104599,  0.4255603551864624,
-        0.9808893203735352,     -0.1032782793045044,  -0.30096831917762756,  0.26432812213897705,   0.08574212342500687,
-        0.1379496306180954,     -0.01550977025181055, -0.1392151415348053,   0.15430080890655518,   -0.35632526874542236,
-        -0.4337750971317291,    0.4172336459159851,   -0.6601648926734924,   0.3898148536682129,    0.20696498453617096,
-        -0.6381161212921143,    0.4283961057662964,   0.0021155844442546368, -0.35071295499801636,  0.2923429012298584,
-        -0.10237617790699005,   -0.07837877422571182, -0.07807933539152145,  0.25557053089141846,   0.4422510266304016,
-        -0.150653675198555,     -0.9849938154220581,  0.1191900297999382,    0.19738155603408813,   0.5470101237297058,
-        -0.1118772029876709,    -0.3148869574069977,  1.099938154220581,     -0.08999565243721008,  0.43682196736335754,
-        -0.027433503419160843,  -0.20026348531246185, -0.04388294368982315,  0.7169035077095032,    0.06593845039606094,
-        -0.7833508849143982,    0.24472925066947937,  -0.48364385962486267,  1.3252742290496826,    0.2888536751270294,
-        -0.08079714328050613,   0.3222424387931824,   0.018246246501803398,  0.39286190271377563,   -0.20008811354637146,
-        -0.09487343579530716,   0.05658404901623726,  0.9181646108627319,    0.019943660125136375,  -0.28578537702560425,
-        0.43305182456970215,    0.680837094783783,    1.3867042064666748,    0.6234840154647827,    0.3333570063114166,
-        0.19110210239887238,    -0.2669704854488373,  0.2734399735927582,    0.03452782332897186,   -0.5049874186515808,
-        0.29177558422088623,    0.45422759652137756,  0.37297603487968445,   -0.5938202738761902,   0.2283141165971756,
-        -0.032772935926914215,  0.30715247988700867,  -0.1425723284482956,   0.14653842151165009,   -0.14808079600334167,
-        -0.5582252144813538,    -1.2885887622833252,  -0.41010457277297974,  -0.13411350548267365,  0.6020497679710388,
-        -0.6750118136405945,    -0.7021925449371338,  -0.19728022813796997,  0.4276880919933319,    0.2705737054347992,
-        -0.0451866090297699,    0.4054216146469116,   0.3597560524940491,    -0.32656893134117126,  -0.24750910699367523,
-        0.254129558801651,      -0.22542265057563782, -0.2504306733608246,   0.3252708315849304,    -0.04371681064367294,
-        -0.25782275199890137,   0.887008786201477,    0.08070731908082962,   0.6742802262306213,    -0.756773054599762,
-        0.7836094498634338,     -1.4530524015426636,  0.15189985930919647,   0.6601839065551758,    -0.28992021083831787,
-        -0.37563520669937134,   -0.19505561888217926, -0.18285363912582397,  -0.3887031376361847,   -0.2567006051540375,
-        0.058231811970472336,   -0.3807430863380432,  0.23850278556346893,   0.16029784083366394,   -0.42489802837371826,
-        0.33354616165161133,    0.4384022653102875,   -0.058506131172180176, -0.5607519745826721,   0.14193114638328552,
-        0.5978283286094666,     -1.0242719650268555,  1.0032451152801514,    -0.1476944088935852,   0.11585786938667297,
-        -0.33355432748794556,   -0.01241644099354744, -0.2787948548793793,   -0.2653841972351074,   0.03969858959317207,
-        -0.6291735172271729,    -0.11119858175516129, -0.2360922396183014,   -0.6818587183952332,   -0.5699873566627502,
-        -0.15092729032039642,   -1.002638816833496,   0.5848798751831055,    0.052234549075365067,  1.0994702577590942,
-        -0.013327227905392647,  -0.16795127093791962, -0.32656821608543396,  0.8417034149169922,    0.6766648888587952,
-        -0.5619852542877197,    -0.12301889061927795, -0.20444005727767944,  0.14319516718387604,   0.420043021440506,
-        -0.0872097834944725,    0.13083437085151672,  -0.012262645177543163, 0.610609233379364,     0.00332872592844069,
-        -0.08119989931583405,   -0.8624597787857056,  -0.02358975261449814,  0.4075406789779663,    0.14557136595249176,
-        -0.246132493019104,     -0.1439208984375,     -0.29232946038246155,  -0.055911704897880554, -0.6692616939544678,
-        0.5877380967140198,     -0.28285887837409973, 0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
-        3.28192138671875,       3.247725486755371,    0.8663038611412048,    0.019999999552965164};
+// Dum lowg 0.03 Epochs=300
+constexpr float NamModel4[] = {
+    -0.21672961115837097,   0.6680753827095032,   -0.8541843295097351,   -1.4216548204421997,   0.5007015466690063,
+    0.6861110925674438,     1.129280686378479,    -0.25371479988098145,  -0.17103390395641327,  -0.43029189109802246,
+    -0.07381530851125717,   0.12931965291500092,  0.16701047122478485,   -0.2698405385017395,   0.0018584387144073844,
+    0.03392714262008667,    -0.15406523644924164, 0.6269673705101013,    -0.6526519060134888,   0.31865960359573364,
+    0.19387002289295197,    0.4347992241382599,   0.02157755009829998,   0.5095287561416626,    1.0697909593582153,
+    1.6803390979766846,     -1.0866271257400513,  -1.3011014461517334,   0.44281166791915894,   0.4128124713897705,
+    0.5864476561546326,     0.7376850247383118,   -0.4493808448314667,   -0.08798795193433762,  -0.5099354386329651,
+    -0.44908928871154785,   0.11903826147317886,  0.2924829125404358,    -1.5628515481948853,   0.3983801007270813,
+    0.33976688981056213,    0.3450927138328552,   0.2876558303833008,    -0.670974850654602,    -0.296568363904953,
+    -0.3997034728527069,    -0.31013888120651245, 0.202720507979393,     0.2998778223991394,    0.4780450761318207,
+    -0.025771938264369965,  0.058450885117053986, 0.022991744801402092,  -0.16484741866588593,  0.37744811177253723,
+    -0.9356744289398193,    0.40246570110321045,  -0.4516937732696533,   -0.058167628943920135, -0.05583447217941284,
+    -0.0051286546513438225, -0.42897480726242065, -0.24965597689151764,  -0.9056965708732605,   0.4807685911655426,
+    -0.6251549124717712,    0.053486015647649765, 0.006812951993197203,  0.260667622089386,     0.8343628644943237,
+    -0.4845716655254364,    -0.5645931959152222,  -0.23245024681091309,  0.7337635159492493,    1.2323509454727173,
+    1.2183339595794678,     0.4974342882633209,   -1.232147455215454,    0.3671962022781372,    0.2620197534561157,
+    0.2901793420314789,     0.37666186690330505,  0.8212873935699463,    -1.9023405313491821,   -0.8893784880638123,
+    -0.31839385628700256,   -0.28325217962265015, -0.45091816782951355,  0.32612985372543335,   -0.557057797908783,
+    0.24397316575050354,    1.233117938041687,    -0.9180221557617188,   0.9173181056976318,    -0.372914582490921,
+    -0.2826370596885681,    -0.6063545942306519,  -2.53222393989563,     0.912785530090332,     -1.132514238357544,
+    0.4897824227809906,     0.4849191904067993,   -0.1844179332256317,   0.5141417384147644,    -1.8955127000808716,
+    0.5586462020874023,     0.17730990052223206,  -1.5565948486328125,   -1.2398602962493896,   0.41595545411109924,
+    0.005400347523391247,   0.37228378653526306,  0.1334926337003708,    -0.09388837218284607,  0.667602002620697,
+    0.04504779353737831,    -0.35122615098953247, 0.5999744534492493,    -0.5698007345199585,   -0.4252203106880188,
+    0.2430635392665863,     -0.11806514114141464, 0.13920482993125916,   0.018072551116347313,  -0.06005144864320755,
+    -0.0409969687461853,    -0.23207640647888184, -0.08716718852519989,  0.2700636684894562,    -1.1945334672927856,
+    -1.2748466730117798,    0.2042272537946701,   -0.21176308393478394,  -0.0753021314740181,   -0.024384573101997375,
+    -0.12467490136623383,   0.39543819427490234,  -0.1402868926525116,   -0.012328716926276684, 0.3915475010871887,
+    0.3380435109138489,     -0.1513059139251709,  0.1353762447834015,    0.17046478390693665,   -0.34296947717666626,
+    1.1091021299362183,     0.12332043796777725,  0.054084885865449905,  -0.2905316650867462,   -3.2276995182037354,
+    -1.347021460533142,     -1.0033018589019775,  0.6078070402145386,    1.0571120977401733,    0.5225768089294434,
+    -0.5481863617897034,    0.8715481758117676,   0.05666496977210045,   0.2967052459716797,    0.3342730700969696,
+    -0.2762812077999115,    -0.23915636539459229, -0.3096584677696228,   -0.4204099774360657,   -0.7844758033752441,
+    -0.14252889156341553,   -0.5166653990745544,  0.18550516664981842,   -0.0967140942811966,   -0.7898126244544983,
+    0.21335245668888092,    0.628408670425415,    0.9148246645927429,    -0.021260371431708336, -0.49058228731155396,
+    -0.2292129397392273,    0.2148902863264084,   -0.1274072527885437,   -0.01893208920955658,  -0.7373600006103516,
+    0.2969057261943817,     -0.9831510782241821,  1.1034948825836182,    0.6464563012123108,    0.2917388379573822,
+    0.26717740297317505,    -0.06781621277332306, 0.4361128807067871,    -0.2673192024230957,   -0.06082604080438614,
+    0.2846423387527466,     0.2596549689769745,   0.04995875060558319,   -0.3442218005657196,   -0.3523794114589691,
+    0.043712861835956573,   -0.16426371037960052, -0.03709053993225098,  -0.04698151722550392,  0.12660138309001923,
+    0.8979313969612122,     0.8709422945976257,   -1.0600593090057373,   -1.08076012134552,     -0.9618424773216248,
+    0.12410673499107361,    -0.21810850501060486, 0.5625948905944824,    0.004450046457350254,  0.16159281134605408,
+    0.26898089051246643,    -0.01500022690743208, 0.13050298392772675,   -0.15022054314613342,  -0.10213010013103485,
+    0.20126724243164062,    -0.8129749894142151,  -0.12054132670164108,  0.21557435393333435,   -0.40578097105026245,
+    -0.01459859125316143,   0.328594446182251,    -0.32029449939727783,  1.7683401107788086,    -0.1699880212545395,
+    0.12277601659297943,    -0.766191840171814,   0.3444822430610657,    -0.19993284344673157,  -0.1419731229543686,
+    0.25952374935150146,    0.3283884525299072,   0.14877022802829742,   0.15639126300811768,   0.061331406235694885,
+    -0.37677523493766785,   -0.8792782425880432,  -0.27287888526916504,  0.31394168734550476,   -0.02528548613190651,
+    -0.00546693941578269,   -0.17591293156147003, -0.3101772665977478,   0.1672751009464264,    1.089199185371399,
+    -0.7354046702384949,    0.6659253835678101,   -0.7332332134246826,   -0.048978909850120544, 0.29135969281196594,
+    -0.12533684074878693,   0.03603127971291542,  0.614931583404541,     -0.20101575553417206,  0.20021255314350128,
+    -0.5700886249542236,    -0.07096870988607407, 0.22131383419036865,   -0.17029118537902832,  0.8371438980102539,
+    -0.14128243923187256,   0.9285588264465332,   -0.10139285027980804,  0.18749317526817322,   0.0715315192937851,
+    0.2858094871044159,     -0.49791625142097473, -1.4580698013305664,   1.1127854585647583,    0.49991366267204285,
+    -0.6665695309638977,    0.18071337044239044,  -0.36363768577575684,  -0.06314156204462051,  0.11740581691265106,
+    -0.13331149518489838,   0.13477662205696106,  -0.5498265027999878,   -0.01735677570104599,  0.4255603551864624,
+    0.9808893203735352,     -0.1032782793045044,  -0.30096831917762756,  0.26432812213897705,   0.08574212342500687,
+    0.1379496306180954,     -0.01550977025181055, -0.1392151415348053,   0.15430080890655518,   -0.35632526874542236,
+    -0.4337750971317291,    0.4172336459159851,   -0.6601648926734924,   0.3898148536682129,    0.20696498453617096,
+    -0.6381161212921143,    0.4283961057662964,   0.0021155844442546368, -0.35071295499801636,  0.2923429012298584,
+    -0.10237617790699005,   -0.07837877422571182, -0.07807933539152145,  0.25557053089141846,   0.4422510266304016,
+    -0.150653675198555,     -0.9849938154220581,  0.1191900297999382,    0.19738155603408813,   0.5470101237297058,
+    -0.1118772029876709,    -0.3148869574069977,  1.099938154220581,     -0.08999565243721008,  0.43682196736335754,
+    -0.027433503419160843,  -0.20026348531246185, -0.04388294368982315,  0.7169035077095032,    0.06593845039606094,
+    -0.7833508849143982,    0.24472925066947937,  -0.48364385962486267,  1.3252742290496826,    0.2888536751270294,
+    -0.08079714328050613,   0.3222424387931824,   0.018246246501803398,  0.39286190271377563,   -0.20008811354637146,
+    -0.09487343579530716,   0.05658404901623726,  0.9181646108627319,    0.019943660125136375,  -0.28578537702560425,
+    0.43305182456970215,    0.680837094783783,    1.3867042064666748,    0.6234840154647827,    0.3333570063114166,
+    0.19110210239887238,    -0.2669704854488373,  0.2734399735927582,    0.03452782332897186,   -0.5049874186515808,
+    0.29177558422088623,    0.45422759652137756,  0.37297603487968445,   -0.5938202738761902,   0.2283141165971756,
+    -0.032772935926914215,  0.30715247988700867,  -0.1425723284482956,   0.14653842151165009,   -0.14808079600334167,
+    -0.5582252144813538,    -1.2885887622833252,  -0.41010457277297974,  -0.13411350548267365,  0.6020497679710388,
+    -0.6750118136405945,    -0.7021925449371338,  -0.19728022813796997,  0.4276880919933319,    0.2705737054347992,
+    -0.0451866090297699,    0.4054216146469116,   0.3597560524940491,    -0.32656893134117126,  -0.24750910699367523,
+    0.254129558801651,      -0.22542265057563782, -0.2504306733608246,   0.3252708315849304,    -0.04371681064367294,
+    -0.25782275199890137,   0.887008786201477,    0.08070731908082962,   0.6742802262306213,    -0.756773054599762,
+    0.7836094498634338,     -1.4530524015426636,  0.15189985930919647,   0.6601839065551758,    -0.28992021083831787,
+    -0.37563520669937134,   -0.19505561888217926, -0.18285363912582397,  -0.3887031376361847,   -0.2567006051540375,
+    0.058231811970472336,   -0.3807430863380432,  0.23850278556346893,   0.16029784083366394,   -0.42489802837371826,
+    0.33354616165161133,    0.4384022653102875,   -0.058506131172180176, -0.5607519745826721,   0.14193114638328552,
+    0.5978283286094666,     -1.0242719650268555,  1.0032451152801514,    -0.1476944088935852,   0.11585786938667297,
+    -0.33355432748794556,   -0.01241644099354744, -0.2787948548793793,   -0.2653841972351074,   0.03969858959317207,
+    -0.6291735172271729,    -0.11119858175516129, -0.2360922396183014,   -0.6818587183952332,   -0.5699873566627502,
+    -0.15092729032039642,   -1.002638816833496,   0.5848798751831055,    0.052234549075365067,  1.0994702577590942,
+    -0.013327227905392647,  -0.16795127093791962, -0.32656821608543396,  0.8417034149169922,    0.6766648888587952,
+    -0.5619852542877197,    -0.12301889061927795, -0.20444005727767944,  0.14319516718387604,   0.420043021440506,
+    -0.0872097834944725,    0.13083437085151672,  -0.012262645177543163, 0.610609233379364,     0.00332872592844069,
+    -0.08119989931583405,   -0.8624597787857056,  -0.02358975261449814,  0.4075406789779663,    0.14557136595249176,
+    -0.246132493019104,     -0.1439208984375,     -0.29232946038246155,  -0.055911704897880554, -0.6692616939544678,
+    0.5877380967140198,     -0.28285887837409973, 0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
+    3.28192138671875,       3.247725486755371,    0.8663038611412048,    0.019999999552965164};
 
-    // Ethos lead 0.01 300ep
-    NamModel5.weights = {
-        -0.5626684427261353,   0.678281843662262,     0.36572331190109253,   -1.1176912784576416,   -0.3970261216163635,
-        -0.5200895667076111,   0.782767653465271,     0.5908762812614441,    0.21028028428554535,   -1.131827712059021,
-        -0.5716264247894287,   -0.30213895440101624,  0.767038881778717,     0.18643710017204285,   -0.06862162798643112,
-        0.008779987692832947,  0.6906735897064209,    1.0840016603469849,    -0.8219112753868103,   -0.6049669981002808,
-        0.35273516178131104,   0.5698657631874084,    0.11683160066604614,   0.3968951404094696,    0.2891211211681366,
-        0.9101442098617554,    1.8993715047836304,    -0.40482091903686523,  -0.5502263903617859,   -0.7945934534072876,
-        -0.21471528708934784,  0.854327917098999,     0.1986142098903656,    -0.21878431737422943,  -0.9183107614517212,
-        -0.9497261047363281,   0.11940550059080124,   0.2903599739074707,    -0.9343850016593933,   0.18453188240528107,
-        0.08870196342468262,   -0.5472750663757324,   0.3220636248588562,    -0.6277589201927185,   -0.4203540086746216,
-        -0.41333937644958496,  -0.6662454009056091,   0.5732288360595703,    0.4367324411869049,    0.296187162399292,
-        0.3492242991924286,    -0.0920800268650055,   0.2625066041946411,    0.1764359474182129,    -0.2671044170856476,
-        -0.26089584827423096,  -0.5219800472259521,   0.2632256746292114,    -0.19404670596122742,  0.00824440736323595,
-        0.1595487743616104,    1.0384509563446045,    -1.1997731924057007,   1.2603785991668701,    0.7959058284759521,
-        1.140015721321106,     -0.004615454934537411, 0.22176136076450348,   0.3664814233779907,    1.2248566150665283,
-        -0.5004108548164368,   -0.8327504396438599,   0.5276821255683899,    0.5966095924377441,    0.3014509081840515,
-        1.0721666812896729,    -0.15374009311199188,  -0.15392498672008514,  0.37398338317871094,   0.0200339388102293,
-        0.11795484274625778,   0.19475820660591125,   1.274043083190918,     -0.2898309528827667,   -0.5765076875686646,
-        -0.40602657198905945,  -0.006087386980652809, -0.731796145439148,    0.40924257040023804,   -0.4644234776496887,
-        -0.26271501183509827,  0.37246835231781006,   -0.14909812808036804,  0.54935222864151,      -0.575748860836029,
-        -0.2394915223121643,   -0.07662180811166763,  -0.12462013959884644,  -0.9783700704574585,   0.01013496145606041,
-        0.20947028696537018,   0.2823309004306793,    -0.2680564820766449,   0.23501445353031158,   -1.243833303451538,
-        0.47040027379989624,   -0.4254577159881592,   -0.743941605091095,    -0.18236328661441803,  0.46043357253074646,
-        -0.12685683369636536,  0.2585914134979248,    -0.29762282967567444,  0.1735217124223709,    -0.40003615617752075,
-        -0.6325829029083252,   -0.30626729130744934,  0.014123844914138317,  0.32095468044281006,   0.014198738150298595,
-        -0.28488123416900635,  0.01906263455748558,   -0.3771534860134125,   0.04975975304841995,   -0.030183998867869377,
-        -0.08404911309480667,  -0.02944859489798546,  -0.4673001170158386,   -0.5962972640991211,   -0.9708330631256104,
-        -0.059134505689144135, 1.044547200202942,     -0.38983309268951416,  0.19209402799606323,   -0.18625280261039734,
-        -0.2558386027812958,   -1.327681064605713,    -0.07789081335067749,  0.2062460482120514,    0.11929241567850113,
-        0.629635214805603,     1.4696294069290161,    -0.017898857593536377, 0.7343769669532776,    -0.7856243252754211,
-        0.06617363542318344,   -0.09090235084295273,  0.07049507647752762,   -0.8684057593345642,   1.2644405364990234,
-        -1.2846211194992065,   -0.24968042969703674,  0.6166265606880188,    -1.3555803298950195,   0.3939058184623718,
-        -0.17208126187324524,  0.3182894289493561,    -0.11724181473255157,  -0.3511843979358673,   0.21490755677223206,
-        0.19395597279071808,   -0.06531400233507156,  -0.2682259976863861,   -0.06114273518323898,  -0.3600750267505646,
-        0.1588061898946762,    -0.21380668878555298,  -0.2715378999710083,   -0.47254711389541626,  -0.33104705810546875,
-        -0.17316371202468872,  -0.7062410712242126,   0.8774145245552063,    -0.13657569885253906,  -0.3476131558418274,
-        -0.58085697889328,     0.03506176173686981,   -0.12995462119579315,  0.8130850791931152,    -0.8825948238372803,
-        0.02127767726778984,   0.5666224360466003,    0.31122735142707825,   0.34503450989723206,   0.1508454829454422,
-        0.1633654087781906,    -0.026032697409391403, 0.04675948992371559,   0.4758658707141876,    -0.03518065810203552,
-        0.06740925461053848,   -0.5464067459106445,   -0.008229643106460571, -0.06885138154029846,  -1.2287235260009766,
-        0.018437666818499565,  -0.12833574414253235,  0.7180194854736328,    0.100511334836483,     0.29788875579833984,
-        -0.5615938901901245,   1.9281375408172607,    -1.043237328529358,    -0.5092522501945496,   -0.25250154733657837,
-        0.940858006477356,     -0.057608723640441895, 0.442787230014801,     -0.03823001682758331,  0.03932753950357437,
-        -0.7973816990852356,   -0.021572740748524666, -0.012097428552806377, 0.44603192806243896,   0.037036895751953125,
-        0.026253171265125275,  0.551152765750885,     0.022793058305978775,  0.02520737797021866,   -0.33890119194984436,
-        -0.14037153124809265,  -0.4849434196949005,   0.9762877225875854,    -0.744393527507782,    -0.6528925895690918,
-        -0.6763091683387756,   -0.18434648215770721,  0.17977438867092133,   -0.017578111961483955, -0.21397998929023743,
-        0.12830503284931183,   0.3734155297279358,    0.21790733933448792,   0.5424362421035767,    0.4686468243598938,
-        -0.1341385692358017,   -0.1958342343568802,   -0.6408882141113281,   0.12545514106750488,   0.5423735976219177,
-        0.27142134308815,      0.11601391434669495,   -0.25757360458374023,  -0.04624907672405243,  0.9374172687530518,
-        -2.4949848651885986,   0.7407810091972351,    -0.8952135443687439,   -0.033138930797576904, 0.5639156103134155,
-        -0.10856513679027557,  0.009162399917840958,  -0.07924200594425201,  -0.14303070306777954,  -0.7779583930969238,
-        0.2935827672481537,    -0.7717241048812866,   0.20550239086151123,   0.23372405767440796,   -0.5634819865226746,
-        0.2795296907424927,    0.5664341449737549,    0.700677216053009,     0.002052687108516693,  0.304521769285202,
-        -0.30129653215408325,  0.2573336362838745,    0.8365859985351562,    0.6364859342575073,    0.058908626437187195,
-        -0.5006195902824402,   -0.4826153814792633,   -0.26027387380599976,  0.11722339689731598,   -0.30926603078842163,
-        -0.8560924530029297,   0.25558382272720337,   0.5563136339187622,    -0.1883685290813446,   0.35683444142341614,
-        0.10122935473918915,   -0.7427250742912292,   -0.8062950968742371,   0.15189823508262634,   0.45204728841781616,
-        -0.42303141951560974,  -0.2962362468242645,   -0.11202385276556015,  -0.3372858464717865,   -0.8008692264556885,
-        -0.6695346236228943,   -0.06476247310638428,  -0.15567071735858917,  0.06840354949235916,   0.003641062881797552,
-        -0.3393755853176117,   0.27873820066452026,   0.18959446251392365,   -0.2498520165681839,   0.35613900423049927,
-        0.24419744312763214,   -0.2964526414871216,   0.14351780712604523,   -0.3444494307041168,   0.06961924582719803,
-        0.010357962921261787,  -0.3296665549278259,   0.22121059894561768,   0.03596833348274231,   0.009499289095401764,
-        -0.7802249193191528,   -0.036683663725852966, 0.7256211638450623,    -0.4699629545211792,   1.3016541004180908,
-        -0.84502112865448,     -0.043152570724487305, 0.08239782601594925,   0.21008910238742828,   0.20315340161323547,
-        0.7723149657249451,    0.23336079716682434,   0.1385372132062912,    0.33408302068710327,   0.10469836741685867,
-        0.18789362907409668,   -0.10157827287912369,  0.1408623903989792,    0.160676971077919,     -0.32752910256385803,
-        -0.012717506848275661, 0.033551570028066635,  0.4346486032009125,    0.25436651706695557,   -0.32317009568214417,
-        0.31261199712753296,   -0.2501973807811737,   2.403465986251831,     0.590274453163147,     0.4444092810153961,
-        -0.009050624445080757, 0.3243369460105896,    -0.01549922302365303,  -0.03059108555316925,  0.3885512948036194,
-        -0.21132613718509674,  0.13766509294509888,   0.051389388740062714,  -0.6044873595237732,   0.3330996334552765,
-        0.12515920400619507,   0.20886816084384918,   -0.3079402446746826,   -0.19307374954223633,  0.5697855353355408,
-        -0.5841793417930603,   0.6734687685966492,    0.9823606014251709,    0.5162457823753357,    0.5998895168304443,
-        -0.38259661197662354,  -0.6676728129386902,   -0.603671133518219,    0.3018419146537781,    0.598136305809021,
-        -0.1314849704504013,   0.5577806830406189,    -0.011851133778691292, -0.5447454452514648,   0.586499035358429,
-        0.38861367106437683,   -0.2762081027030945,   -0.5648051500320435,   0.32108572125434875,   -0.1008700281381607,
-        -0.11956580728292465,  0.7292641997337341,    -0.41959211230278015,  0.48749953508377075,   0.3753940463066101,
-        -0.6346176266670227,   -0.4186594784259796,   0.34982264041900635,   0.5916197896003723,    -0.12363552302122116,
-        -0.21661697328090668,  0.20584210753440857,   -0.12853845953941345,  -0.12476467341184616,  0.13394981622695923,
-        -0.2935285270214081,   -0.35086944699287415,  0.23805022239685059,   -0.04458734765648842,  0.05321737751364708,
-        0.4235750138759613,    0.16053804755210876,   -0.10624103248119354,  0.7020957469940186,    -1.7619984149932861,
-        -1.4251433610916138,   -1.2368415594100952,   -0.30646198987960815,  1.0674651861190796,    0.08638152480125427,
-        -0.4385163187980652,   0.16808277368545532,   -0.37288057804107666,  0.016250401735305786,  0.21207530796527863,
-        -0.29834845662117004,  0.11136513948440552,   0.5229735374450684,    -0.32975468039512634,  0.016786325722932816,
-        0.2812652289867401,    0.16931429505348206,   0.5901670455932617,    0.21386395394802094,   -0.37480899691581726,
-        0.8218953609466553,    0.49571624398231506,   -0.3265692889690399,   -0.4551981985569,      0.3080160915851593,
-        -0.6817617416381836,   -0.09413449466228485,  -0.2439633309841156,   0.021159272640943527,  0.1951492875814438,
-        0.10309156775474548,   0.029220160096883774,  0.13197769224643707,   0.5269254446029663,    -0.027531582862138748,
-        0.0026720964815467596, 0.6690681576728821,    -0.04409429058432579,  -0.018823284655809402, 0.4215637147426605,
-        -0.13890676200389862,  -0.20174568891525269,  -1.0791664123535156,   1.1737149953842163,    -0.6692616939544678,
-        0.5877380967140198,    -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
-        2.6741459369659424,    2.401388168334961,     0.10374880582094193,   0.019999999552965164};
+// Ethos lead 0.01 300ep
+constexpr float NamModel5[] = {
+    -0.5626684427261353,   0.678281843662262,     0.36572331190109253,   -1.1176912784576416,   -0.3970261216163635,
+    -0.5200895667076111,   0.782767653465271,     0.5908762812614441,    0.21028028428554535,   -1.131827712059021,
+    -0.5716264247894287,   -0.30213895440101624,  0.767038881778717,     0.18643710017204285,   -0.06862162798643112,
+    0.008779987692832947,  0.6906735897064209,    1.0840016603469849,    -0.8219112753868103,   -0.6049669981002808,
+    0.35273516178131104,   0.5698657631874084,    0.11683160066604614,   0.3968951404094696,    0.2891211211681366,
+    0.9101442098617554,    1.8993715047836304,    -0.40482091903686523,  -0.5502263903617859,   -0.7945934534072876,
+    -0.21471528708934784,  0.854327917098999,     0.1986142098903656,    -0.21878431737422943,  -0.9183107614517212,
+    -0.9497261047363281,   0.11940550059080124,   0.2903599739074707,    -0.9343850016593933,   0.18453188240528107,
+    0.08870196342468262,   -0.5472750663757324,   0.3220636248588562,    -0.6277589201927185,   -0.4203540086746216,
+    -0.41333937644958496,  -0.6662454009056091,   0.5732288360595703,    0.4367324411869049,    0.296187162399292,
+    0.3492242991924286,    -0.0920800268650055,   0.2625066041946411,    0.1764359474182129,    -0.2671044170856476,
+    -0.26089584827423096,  -0.5219800472259521,   0.2632256746292114,    -0.19404670596122742,  0.00824440736323595,
+    0.1595487743616104,    1.0384509563446045,    -1.1997731924057007,   1.2603785991668701,    0.7959058284759521,
+    1.140015721321106,     -0.004615454934537411, 0.22176136076450348,   0.3664814233779907,    1.2248566150665283,
+    -0.5004108548164368,   -0.8327504396438599,   0.5276821255683899,    0.5966095924377441,    0.3014509081840515,
+    1.0721666812896729,    -0.15374009311199188,  -0.15392498672008514,  0.37398338317871094,   0.0200339388102293,
+    0.11795484274625778,   0.19475820660591125,   1.274043083190918,     -0.2898309528827667,   -0.5765076875686646,
+    -0.40602657198905945,  -0.006087386980652809, -0.731796145439148,    0.40924257040023804,   -0.4644234776496887,
+    -0.26271501183509827,  0.37246835231781006,   -0.14909812808036804,  0.54935222864151,      -0.575748860836029,
+    -0.2394915223121643,   -0.07662180811166763,  -0.12462013959884644,  -0.9783700704574585,   0.01013496145606041,
+    0.20947028696537018,   0.2823309004306793,    -0.2680564820766449,   0.23501445353031158,   -1.243833303451538,
+    0.47040027379989624,   -0.4254577159881592,   -0.743941605091095,    -0.18236328661441803,  0.46043357253074646,
+    -0.12685683369636536,  0.2585914134979248,    -0.29762282967567444,  0.1735217124223709,    -0.40003615617752075,
+    -0.6325829029083252,   -0.30626729130744934,  0.014123844914138317,  0.32095468044281006,   0.014198738150298595,
+    -0.28488123416900635,  0.01906263455748558,   -0.3771534860134125,   0.04975975304841995,   -0.030183998867869377,
+    -0.08404911309480667,  -0.02944859489798546,  -0.4673001170158386,   -0.5962972640991211,   -0.9708330631256104,
+    -0.059134505689144135, 1.044547200202942,     -0.38983309268951416,  0.19209402799606323,   -0.18625280261039734,
+    -0.2558386027812958,   -1.327681064605713,    -0.07789081335067749,  0.2062460482120514,    0.11929241567850113,
+    0.629635214805603,     1.4696294069290161,    -0.017898857593536377, 0.7343769669532776,    -0.7856243252754211,
+    0.06617363542318344,   -0.09090235084295273,  0.07049507647752762,   -0.8684057593345642,   1.2644405364990234,
+    -1.2846211194992065,   -0.24968042969703674,  0.6166265606880188,    -1.3555803298950195,   0.3939058184623718,
+    -0.17208126187324524,  0.3182894289493561,    -0.11724181473255157,  -0.3511843979358673,   0.21490755677223206,
+    0.19395597279071808,   -0.06531400233507156,  -0.2682259976863861,   -0.06114273518323898,  -0.3600750267505646,
+    0.1588061898946762,    -0.21380668878555298,  -0.2715378999710083,   -0.47254711389541626,  -0.33104705810546875,
+    -0.17316371202468872,  -0.7062410712242126,   0.8774145245552063,    -0.13657569885253906,  -0.3476131558418274,
+    -0.58085697889328,     0.03506176173686981,   -0.12995462119579315,  0.8130850791931152,    -0.8825948238372803,
+    0.02127767726778984,   0.5666224360466003,    0.31122735142707825,   0.34503450989723206,   0.1508454829454422,
+    0.1633654087781906,    -0.026032697409391403, 0.04675948992371559,   0.4758658707141876,    -0.03518065810203552,
+    0.06740925461053848,   -0.5464067459106445,   -0.008229643106460571, -0.06885138154029846,  -1.2287235260009766,
+    0.018437666818499565,  -0.12833574414253235,  0.7180194854736328,    0.100511334836483,     0.29788875579833984,
+    -0.5615938901901245,   1.9281375408172607,    -1.043237328529358,    -0.5092522501945496,   -0.25250154733657837,
+    0.940858006477356,     -0.057608723640441895, 0.442787230014801,     -0.03823001682758331,  0.03932753950357437,
+    -0.7973816990852356,   -0.021572740748524666, -0.012097428552806377, 0.44603192806243896,   0.037036895751953125,
+    0.026253171265125275,  0.551152765750885,     0.022793058305978775,  0.02520737797021866,   -0.33890119194984436,
+    -0.14037153124809265,  -0.4849434196949005,   0.9762877225875854,    -0.744393527507782,    -0.6528925895690918,
+    -0.6763091683387756,   -0.18434648215770721,  0.17977438867092133,   -0.017578111961483955, -0.21397998929023743,
+    0.12830503284931183,   0.3734155297279358,    0.21790733933448792,   0.5424362421035767,    0.4686468243598938,
+    -0.1341385692358017,   -0.1958342343568802,   -0.6408882141113281,   0.12545514106750488,   0.5423735976219177,
+    0.27142134308815,      0.11601391434669495,   -0.25757360458374023,  -0.04624907672405243,  0.9374172687530518,
+    -2.4949848651885986,   0.7407810091972351,    -0.8952135443687439,   -0.033138930797576904, 0.5639156103134155,
+    -0.10856513679027557,  0.009162399917840958,  -0.07924200594425201,  -0.14303070306777954,  -0.7779583930969238,
+    0.2935827672481537,    -0.7717241048812866,   0.20550239086151123,   0.23372405767440796,   -0.5634819865226746,
+    0.2795296907424927,    0.5664341449737549,    0.700677216053009,     0.002052687108516693,  0.304521769285202,
+    -0.30129653215408325,  0.2573336362838745,    0.8365859985351562,    0.6364859342575073,    0.058908626437187195,
+    -0.5006195902824402,   -0.4826153814792633,   -0.26027387380599976,  0.11722339689731598,   -0.30926603078842163,
+    -0.8560924530029297,   0.25558382272720337,   0.5563136339187622,    -0.1883685290813446,   0.35683444142341614,
+    0.10122935473918915,   -0.7427250742912292,   -0.8062950968742371,   0.15189823508262634,   0.45204728841781616,
+    -0.42303141951560974,  -0.2962362468242645,   -0.11202385276556015,  -0.3372858464717865,   -0.8008692264556885,
+    -0.6695346236228943,   -0.06476247310638428,  -0.15567071735858917,  0.06840354949235916,   0.003641062881797552,
+    -0.3393755853176117,   0.27873820066452026,   0.18959446251392365,   -0.2498520165681839,   0.35613900423049927,
+    0.24419744312763214,   -0.2964526414871216,   0.14351780712604523,   -0.3444494307041168,   0.06961924582719803,
+    0.010357962921261787,  -0.3296665549278259,   0.22121059894561768,   0.03596833348274231,   0.009499289095401764,
+    -0.7802249193191528,   -0.036683663725852966, 0.7256211638450623,    -0.4699629545211792,   1.3016541004180908,
+    -0.84502112865448,     -0.043152570724487305, 0.08239782601594925,   0.21008910238742828,   0.20315340161323547,
+    0.7723149657249451,    0.23336079716682434,   0.1385372132062912,    0.33408302068710327,   0.10469836741685867,
+    0.18789362907409668,   -0.10157827287912369,  0.1408623903989792,    0.160676971077919,     -0.32752910256385803,
+    -0.012717506848275661, 0.033551570028066635,  0.4346486032009125,    0.25436651706695557,   -0.32317009568214417,
+    0.31261199712753296,   -0.2501973807811737,   2.403465986251831,     0.590274453163147,     0.4444092810153961,
+    -0.009050624445080757, 0.3243369460105896,    -0.01549922302365303,  -0.03059108555316925,  0.3885512948036194,
+    -0.21132613718509674,  0.13766509294509888,   0.051389388740062714,  -0.6044873595237732,   0.3330996334552765,
+    0.12515920400619507,   0.20886816084384918,   -0.3079402446746826,   -0.19307374954223633,  0.5697855353355408,
+    -0.5841793417930603,   0.6734687685966492,    0.9823606014251709,    0.5162457823753357,    0.5998895168304443,
+    -0.38259661197662354,  -0.6676728129386902,   -0.603671133518219,    0.3018419146537781,    0.598136305809021,
+    -0.1314849704504013,   0.5577806830406189,    -0.011851133778691292, -0.5447454452514648,   0.586499035358429,
+    0.38861367106437683,   -0.2762081027030945,   -0.5648051500320435,   0.32108572125434875,   -0.1008700281381607,
+    -0.11956580728292465,  0.7292641997337341,    -0.41959211230278015,  0.48749953508377075,   0.3753940463066101,
+    -0.6346176266670227,   -0.4186594784259796,   0.34982264041900635,   0.5916197896003723,    -0.12363552302122116,
+    -0.21661697328090668,  0.20584210753440857,   -0.12853845953941345,  -0.12476467341184616,  0.13394981622695923,
+    -0.2935285270214081,   -0.35086944699287415,  0.23805022239685059,   -0.04458734765648842,  0.05321737751364708,
+    0.4235750138759613,    0.16053804755210876,   -0.10624103248119354,  0.7020957469940186,    -1.7619984149932861,
+    -1.4251433610916138,   -1.2368415594100952,   -0.30646198987960815,  1.0674651861190796,    0.08638152480125427,
+    -0.4385163187980652,   0.16808277368545532,   -0.37288057804107666,  0.016250401735305786,  0.21207530796527863,
+    -0.29834845662117004,  0.11136513948440552,   0.5229735374450684,    -0.32975468039512634,  0.016786325722932816,
+    0.2812652289867401,    0.16931429505348206,   0.5901670455932617,    0.21386395394802094,   -0.37480899691581726,
+    0.8218953609466553,    0.49571624398231506,   -0.3265692889690399,   -0.4551981985569,      0.3080160915851593,
+    -0.6817617416381836,   -0.09413449466228485,  -0.2439633309841156,   0.021159272640943527,  0.1951492875814438,
+    0.10309156775474548,   0.029220160096883774,  0.13197769224643707,   0.5269254446029663,    -0.027531582862138748,
+    0.0026720964815467596, 0.6690681576728821,    -0.04409429058432579,  -0.018823284655809402, 0.4215637147426605,
+    -0.13890676200389862,  -0.20174568891525269,  -1.0791664123535156,   1.1737149953842163,    -0.6692616939544678,
+    0.5877380967140198,    -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
+    2.6741459369659424,    2.401388168334961,     0.10374880582094193,   0.019999999552965164};
 
-    // Splawn lead 0.029 300ep
-    NamModel6.weights = {
-        -0.25868356227874756,   1.2473822832107544,    -0.8307226896286011,   -1.3814966678619385,    -0.12444639950990677,
-        0.5443196892738342,     1.025166630744934,     0.310539186000824,     -0.5570899248123169,    -1.1391634941101074,
-        -0.05906660109758377,   0.25557801127433777,   0.6560400724411011,    -0.4169011414051056,    -0.30614930391311646,
-        -0.003806812223047018,  0.4492541551589966,    0.4819604754447937,    -0.45824378728866577,   0.15408404171466827,
-        0.6985819935798645,     1.8496956825256348,    -0.08057332783937454,  0.6108173131942749,     -1.2301944494247437,
-        0.07636451721191406,    0.7122834920883179,    0.5331381559371948,    -0.1792999505996704,    -0.24903364479541779,
-        -1.070048451423645,     1.0460143089294434,    0.13597671687602997,   0.27809521555900574,    -0.6370378732681274,
-        -0.5823459625244141,    -0.2965145707130432,   0.2745676636695862,    0.3770180344581604,     0.8222127556800842,
-        -0.8058604001998901,    -0.8994408845901489,   0.14523744583129883,   -0.9486022591590881,    -0.3929419219493866,
-        -0.3532099723815918,    -0.24311493337154388,  0.16536250710487366,   0.4208047688007355,     0.3478728234767914,
-        0.05999111011624336,    -0.13106104731559753,  0.48622938990592957,   -0.33961716294288635,   -0.3608769476413727,
-        -0.5297475457191467,    0.18225419521331787,   0.4843316972255707,    -0.029920965433120728,  -0.05591508373618126,
-        0.3247666358947754,     0.8171476721763611,    -1.500445008277893,    1.058794617652893,      1.1785989999771118,
-        0.7461438179016113,     0.014163320884108543,  0.018333042040467262,  1.192315936088562,      0.9735736846923828,
-        -0.49543923139572144,   -0.9791027903556824,   0.8989591598510742,    0.359054297208786,      -1.9402111768722534,
-        0.2971060276031494,     -0.7303010821342468,   -0.3480653464794159,   -0.0503530353307724,    0.11590792238712311,
-        0.08982563763856888,    0.3019571900367737,    0.2534286081790924,    -0.0708283931016922,    -2.331528902053833,
-        -0.19275584816932678,   -0.20821678638458252,  -0.628897488117218,    0.27495408058166504,    -0.42720094323158264,
-        0.4024397134780884,     2.126387357711792,     -0.4187365770339966,   1.0659719705581665,     -0.5340380072593689,
-        -0.02069981023669243,   0.19202671945095062,   -0.1395273208618164,   -1.7508840560913086,    -0.5373892784118652,
-        -0.4224589169025421,    0.32062193751335144,   -0.33696290850639343,  0.2619897723197937,     -0.714015781879425,
-        -0.40946492552757263,   -0.35495325922966003,  -0.815152645111084,    -0.28988540172576904,   0.5413870215415955,
-        -0.059860896319150925,  0.34228307008743286,   -0.010781009681522846, -0.06590496748685837,   -0.9660515189170837,
-        -0.18699368834495544,   -0.7412270307540894,   0.42318642139434814,   0.15237995982170105,    -0.04655357822775841,
-        -0.13119077682495117,   0.6019646525382996,    0.048385247588157654,  0.25913482904434204,    -0.25099584460258484,
-        -0.5341172218322754,    -0.044916898012161255, 1.3992278575897217,    -1.4516915082931519,    -0.40873435139656067,
-        -1.4083876609802246,    1.6408514976501465,    -0.3530900478363037,   0.11186627298593521,    0.4211919903755188,
-        -0.0065923104993999004, -0.10002745687961578,  0.18142373859882355,   -0.13120073080062866,   0.035109274089336395,
-        -0.6900754570960999,    0.4315761625766754,    -0.5497747659683228,   1.00608491897583,       0.18475137650966644,
-        -1.1326483488082886,    -0.35805121064186096,  -0.22005444765090942,  -0.7851320505142212,    -0.2733829915523529,
-        -1.0759615898132324,    -0.28017380833625793,  0.03230347856879234,   0.1499864161014557,     0.36833426356315613,
-        -0.464525043964386,     0.3204098343849182,    -0.15945613384246826,  -0.3355080783367157,    0.16783492267131805,
-        -0.31746986508369446,   -0.07860139012336731,  -0.20663954317569733,  -0.07627460360527039,   0.4887271821498871,
-        1.2923377752304077,     -0.5135266184806824,   -0.24179156124591827,  0.5008132457733154,     0.25670671463012695,
-        0.0859694629907608,     -1.3310574293136597,   0.2251373678445816,    -0.689996600151062,     -1.0574209690093994,
-        0.3934423327445984,     -0.0496162585914135,   0.1266290694475174,    0.6756103038787842,     -0.927063524723053,
-        0.8316912651062012,     0.5979623198509216,    0.21003343164920807,   0.1789926439523697,     0.276533842086792,
-        0.29341921210289,       -0.042509280145168304, -0.11948647350072861,  -0.18111737072467804,   0.08096060156822205,
-        0.1742156744003296,     0.666646420955658,     0.2111099660396576,    0.22203874588012695,    0.36689817905426025,
-        -0.15680444240570068,   -0.3115602135658264,   -0.5774988532066345,   -0.058552589267492294,  0.042077936232089996,
-        -0.25811079144477844,   0.47437483072280884,   -0.3764249384403229,   0.08340228348970413,    -1.0836271047592163,
-        0.04712728038430214,    -0.18919195234775543,  0.4522722065448761,    0.00018819198885466903, 0.03882316127419472,
-        -3.9247331619262695,    -0.008745736442506313, -0.11560052633285522,  -0.3999623656272888,    -0.0959954634308815,
-        -0.2952406704425812,    -0.5588650107383728,   0.25188159942626953,   0.6061041951179504,     -0.7236788272857666,
-        0.13232764601707458,    0.04569267854094505,   1.2127336263656616,    0.025065382942557335,   -0.6432449817657471,
-        0.47009363770484924,    -0.5353082418441772,   -0.31318241357803345,  -0.12079878896474838,   -0.16886210441589355,
-        0.39609310030937195,    0.9657555222511292,    0.9268592596054077,    0.7369416952133179,     0.6121882200241089,
-        0.14862264692783356,    0.5997313857078552,    0.8156905770301819,    -0.41567984223365784,   0.18836373090744019,
-        0.4126157760620117,     -0.08045660704374313,  -0.42276376485824585,  0.06442160904407501,    -1.8543269634246826,
-        -2.955512046813965,     0.38339123129844666,   -0.8585944175720215,   0.0005025151185691357,  -0.732455313205719,
-        0.09970108419656754,    0.1176866665482521,    0.9490035176277161,    1.5784690380096436,     0.14946521818637848,
-        -0.061561468988657,     -0.48150527477264404,  -0.19326017796993256,  -0.107938751578331,     -0.1571664959192276,
-        -0.36756449937820435,   -0.019566543400287628, -0.39666247367858887,  0.6614565253257751,     0.6245619058609009,
-        -0.5300751328468323,    2.2168750762939453,    0.6308057308197021,    1.077841877937317,      0.2642858028411865,
-        0.35018807649612427,    -0.31713980436325073,  -0.4935510456562042,   0.11177878826856613,    -0.20335939526557922,
-        -0.47642701864242554,   0.15559273958206177,   0.09542914479970932,   0.33743420243263245,    -0.21973922848701477,
-        0.07587503641843796,    0.4257752299308777,    -0.28292712569236755,  0.17034220695495605,    -0.42448699474334717,
-        0.5506340265274048,     -0.4299623668193817,   -0.060260504484176636, 0.3087216317653656,     -0.27128443121910095,
-        0.04240630567073822,    0.6192432045936584,    0.10935303568840027,   -0.44360753893852234,   -0.07403745502233505,
-        -0.4053235650062561,    0.05725172907114029,   0.3350687325000763,    -0.24668072164058685,   -0.2691739797592163,
-        -0.5712977647781372,    0.32408106327056885,   0.09889072179794312,   -0.6304575204849243,    1.246473789215088,
-        0.6332871913909912,     1.1381803750991821,    1.3430275917053223,    0.22061283886432648,    -0.2589854598045349,
-        -0.0881684347987175,    -1.0547477006912231,   1.2845287322998047,    0.1046956330537796,     -0.6861413717269897,
-        -0.005176006816327572,  -0.2579768896102905,   0.026920506730675697,  0.10144249349832535,    0.256148099899292,
-        0.08580717444419861,    -0.06135615333914757,  -0.3071664571762085,   0.14582903683185577,    0.05527651309967041,
-        0.14646387100219727,    -0.22533126175403595,  -0.0744086429476738,   -0.19208042323589325,   0.3447536826133728,
-        0.4702301621437073,     -0.06133829802274704,  0.05585908889770508,   0.0015630611451342702,  -0.45961302518844604,
-        1.5274004936218262,     -0.48333168029785156,  -1.0540059804916382,   0.6038141250610352,     0.43659546971321106,
-        -0.029467351734638214,  0.07454792410135269,   -0.14592614769935608,  0.052382130175828934,   -0.17347599565982819,
-        0.12880995869636536,    0.08412531018257141,   0.0744561105966568,    -0.1126178652048111,    -0.13466019928455353,
-        -0.07322246581315994,   0.20744414627552032,   -0.02901826612651348,  -0.010505840182304382,  -0.1490139365196228,
-        0.11672183126211166,    0.3159020245075226,    0.6707322597503662,    -1.4777194261550903,    -2.0102381706237793,
-        -0.37073463201522827,   -0.5952334403991699,   -0.15507011115550995,  -0.18303270637989044,   0.006445682141929865,
-        0.11797758936882019,    0.2642666697502136,    -0.09641639143228531,  -0.0829630121588707,    -0.23737290501594543,
-        -0.02333083190023899,   0.2787218391895294,    0.33664190769195557,   -0.14748172461986542,   -0.2614055871963501,
-        -0.33984825015068054,   -0.00872207060456276,  -0.006397671531885862, 1.4447580575942993,     1.3625645637512207,
-        2.289715528488159,      1.7885438203811646,    0.3633442223072052,    0.2799672484397888,     0.17379945516586304,
-        -0.17249974608421326,   0.00699948612600565,   -0.020843330770730972, 0.3265380859375,        0.317466676235199,
-        0.26237553358078003,    -0.2539585530757904,   -0.09384262561798096,  -0.32874611020088196,   0.528607189655304,
-        0.014474005438387394,   -0.4268309772014618,   -0.14719383418560028,  0.9228358268737793,     0.42125260829925537,
-        -1.547457218170166,     2.962758779525757,     -0.4027097225189209,   1.342828392982483,      0.32439637184143066,
-        -0.37087103724479675,   0.1479153335094452,    -0.26496851444244385,  0.005562156904488802,   -0.17310091853141785,
-        -0.21126042306423187,   0.07233134657144547,   0.31288766860961914,   -0.5786224603652954,    -0.05128888040781021,
-        -0.48985955119132996,   0.2966512143611908,    0.26711413264274597,   0.08682514727115631,    0.00035958830267190933,
-        -1.0008339881896973,    -1.0441032648086548,   -1.1252896785736084,   1.4135119915008545,     1.8587487936019897,
-        -1.7710243463516235,    0.1494293063879013,    -0.14315743744373322,  -0.03536531329154968,   -0.22271615266799927,
-        -0.24711927771568298,   0.0216091126203537,    0.12270854413509369,   0.7461800575256348,     0.024171460419893265,
-        -0.01684105023741722,   0.6164366602897644,    0.029367530718445778,  0.19943496584892273,    0.2528691291809082,
-        -0.005219743121415377,  -0.26665177941322327,  0.07638368010520935,   0.8331088423728943,     -0.6692616939544678,
-        0.5877380967140198,     -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,    -0.6376116871833801,
-        3.2581100463867188,     3.128552198410034,     0.30544522404670715,   0.019999999552965164};
+// Splawn lead 0.029 300ep
+constexpr float NamModel6[] = {
+    -0.25868356227874756,   1.2473822832107544,    -0.8307226896286011,   -1.3814966678619385,    -0.12444639950990677,
+    0.5443196892738342,     1.025166630744934,     0.310539186000824,     -0.5570899248123169,    -1.1391634941101074,
+    -0.05906660109758377,   0.25557801127433777,   0.6560400724411011,    -0.4169011414051056,    -0.30614930391311646,
+    -0.003806812223047018,  0.4492541551589966,    0.4819604754447937,    -0.45824378728866577,   0.15408404171466827,
+    0.6985819935798645,     1.8496956825256348,    -0.08057332783937454,  0.6108173131942749,     -1.2301944494247437,
+    0.07636451721191406,    0.7122834920883179,    0.5331381559371948,    -0.1792999505996704,    -0.24903364479541779,
+    -1.070048451423645,     1.0460143089294434,    0.13597671687602997,   0.27809521555900574,    -0.6370378732681274,
+    -0.5823459625244141,    -0.2965145707130432,   0.2745676636695862,    0.3770180344581604,     0.8222127556800842,
+    -0.8058604001998901,    -0.8994408845901489,   0.14523744583129883,   -0.9486022591590881,    -0.3929419219493866,
+    -0.3532099723815918,    -0.24311493337154388,  0.16536250710487366,   0.4208047688007355,     0.3478728234767914,
+    0.05999111011624336,    -0.13106104731559753,  0.48622938990592957,   -0.33961716294288635,   -0.3608769476413727,
+    -0.5297475457191467,    0.18225419521331787,   0.4843316972255707,    -0.029920965433120728,  -0.05591508373618126,
+    0.3247666358947754,     0.8171476721763611,    -1.500445008277893,    1.058794617652893,      1.1785989999771118,
+    0.7461438179016113,     0.014163320884108543,  0.018333042040467262,  1.192315936088562,      0.9735736846923828,
+    -0.49543923139572144,   -0.9791027903556824,   0.8989591598510742,    0.359054297208786,      -1.9402111768722534,
+    0.2971060276031494,     -0.7303010821342468,   -0.3480653464794159,   -0.0503530353307724,    0.11590792238712311,
+    0.08982563763856888,    0.3019571900367737,    0.2534286081790924,    -0.0708283931016922,    -2.331528902053833,
+    -0.19275584816932678,   -0.20821678638458252,  -0.628897488117218,    0.27495408058166504,    -0.42720094323158264,
+    0.4024397134780884,     2.126387357711792,     -0.4187365770339966,   1.0659719705581665,     -0.5340380072593689,
+    -0.02069981023669243,   0.19202671945095062,   -0.1395273208618164,   -1.7508840560913086,    -0.5373892784118652,
+    -0.4224589169025421,    0.32062193751335144,   -0.33696290850639343,  0.2619897723197937,     -0.714015781879425,
+    -0.40946492552757263,   -0.35495325922966003,  -0.815152645111084,    -0.28988540172576904,   0.5413870215415955,
+    -0.059860896319150925,  0.34228307008743286,   -0.010781009681522846, -0.06590496748685837,   -0.9660515189170837,
+    -0.18699368834495544,   -0.7412270307540894,   0.42318642139434814,   0.15237995982170105,    -0.04655357822775841,
+    -0.13119077682495117,   0.6019646525382996,    0.048385247588157654,  0.25913482904434204,    -0.25099584460258484,
+    -0.5341172218322754,    -0.044916898012161255, 1.3992278575897217,    -1.4516915082931519,    -0.40873435139656067,
+    -1.4083876609802246,    1.6408514976501465,    -0.3530900478363037,   0.11186627298593521,    0.4211919903755188,
+    -0.0065923104993999004, -0.10002745687961578,  0.18142373859882355,   -0.13120073080062866,   0.035109274089336395,
+    -0.6900754570960999,    0.4315761625766754,    -0.5497747659683228,   1.00608491897583,       0.18475137650966644,
+    -1.1326483488082886,    -0.35805121064186096,  -0.22005444765090942,  -0.7851320505142212,    -0.2733829915523529,
+    -1.0759615898132324,    -0.28017380833625793,  0.03230347856879234,   0.1499864161014557,     0.36833426356315613,
+    -0.464525043964386,     0.3204098343849182,    -0.15945613384246826,  -0.3355080783367157,    0.16783492267131805,
+    -0.31746986508369446,   -0.07860139012336731,  -0.20663954317569733,  -0.07627460360527039,   0.4887271821498871,
+    1.2923377752304077,     -0.5135266184806824,   -0.24179156124591827,  0.5008132457733154,     0.25670671463012695,
+    0.0859694629907608,     -1.3310574293136597,   0.2251373678445816,    -0.689996600151062,     -1.0574209690093994,
+    0.3934423327445984,     -0.0496162585914135,   0.1266290694475174,    0.6756103038787842,     -0.927063524723053,
+    0.8316912651062012,     0.5979623198509216,    0.21003343164920807,   0.1789926439523697,     0.276533842086792,
+    0.29341921210289,       -0.042509280145168304, -0.11948647350072861,  -0.18111737072467804,   0.08096060156822205,
+    0.1742156744003296,     0.666646420955658,     0.2111099660396576,    0.22203874588012695,    0.36689817905426025,
+    -0.15680444240570068,   -0.3115602135658264,   -0.5774988532066345,   -0.058552589267492294,  0.042077936232089996,
+    -0.25811079144477844,   0.47437483072280884,   -0.3764249384403229,   0.08340228348970413,    -1.0836271047592163,
+    0.04712728038430214,    -0.18919195234775543,  0.4522722065448761,    0.00018819198885466903, 0.03882316127419472,
+    -3.9247331619262695,    -0.008745736442506313, -0.11560052633285522,  -0.3999623656272888,    -0.0959954634308815,
+    -0.2952406704425812,    -0.5588650107383728,   0.25188159942626953,   0.6061041951179504,     -0.7236788272857666,
+    0.13232764601707458,    0.04569267854094505,   1.2127336263656616,    0.025065382942557335,   -0.6432449817657471,
+    0.47009363770484924,    -0.5353082418441772,   -0.31318241357803345,  -0.12079878896474838,   -0.16886210441589355,
+    0.39609310030937195,    0.9657555222511292,    0.9268592596054077,    0.7369416952133179,     0.6121882200241089,
+    0.14862264692783356,    0.5997313857078552,    0.8156905770301819,    -0.41567984223365784,   0.18836373090744019,
+    0.4126157760620117,     -0.08045660704374313,  -0.42276376485824585,  0.06442160904407501,    -1.8543269634246826,
+    -2.955512046813965,     0.38339123129844666,   -0.8585944175720215,   0.0005025151185691357,  -0.732455313205719,
+    0.09970108419656754,    0.1176866665482521,    0.9490035176277161,    1.5784690380096436,     0.14946521818637848,
+    -0.061561468988657,     -0.48150527477264404,  -0.19326017796993256,  -0.107938751578331,     -0.1571664959192276,
+    -0.36756449937820435,   -0.019566543400287628, -0.39666247367858887,  0.6614565253257751,     0.6245619058609009,
+    -0.5300751328468323,    2.2168750762939453,    0.6308057308197021,    1.077841877937317,      0.2642858028411865,
+    0.35018807649612427,    -0.31713980436325073,  -0.4935510456562042,   0.11177878826856613,    -0.20335939526557922,
+    -0.47642701864242554,   0.15559273958206177,   0.09542914479970932,   0.33743420243263245,    -0.21973922848701477,
+    0.07587503641843796,    0.4257752299308777,    -0.28292712569236755,  0.17034220695495605,    -0.42448699474334717,
+    0.5506340265274048,     -0.4299623668193817,   -0.060260504484176636, 0.3087216317653656,     -0.27128443121910095,
+    0.04240630567073822,    0.6192432045936584,    0.10935303568840027,   -0.44360753893852234,   -0.07403745502233505,
+    -0.4053235650062561,    0.05725172907114029,   0.3350687325000763,    -0.24668072164058685,   -0.2691739797592163,
+    -0.5712977647781372,    0.32408106327056885,   0.09889072179794312,   -0.6304575204849243,    1.246473789215088,
+    0.6332871913909912,     1.1381803750991821,    1.3430275917053223,    0.22061283886432648,    -0.2589854598045349,
+    -0.0881684347987175,    -1.0547477006912231,   1.2845287322998047,    0.1046956330537796,     -0.6861413717269897,
+    -0.005176006816327572,  -0.2579768896102905,   0.026920506730675697,  0.10144249349832535,    0.256148099899292,
+    0.08580717444419861,    -0.06135615333914757,  -0.3071664571762085,   0.14582903683185577,    0.05527651309967041,
+    0.14646387100219727,    -0.22533126175403595,  -0.0744086429476738,   -0.19208042323589325,   0.3447536826133728,
+    0.4702301621437073,     -0.06133829802274704,  0.05585908889770508,   0.0015630611451342702,  -0.45961302518844604,
+    1.5274004936218262,     -0.48333168029785156,  -1.0540059804916382,   0.6038141250610352,     0.43659546971321106,
+    -0.029467351734638214,  0.07454792410135269,   -0.14592614769935608,  0.052382130175828934,   -0.17347599565982819,
+    0.12880995869636536,    0.08412531018257141,   0.0744561105966568,    -0.1126178652048111,    -0.13466019928455353,
+    -0.07322246581315994,   0.20744414627552032,   -0.02901826612651348,  -0.010505840182304382,  -0.1490139365196228,
+    0.11672183126211166,    0.3159020245075226,    0.6707322597503662,    -1.4777194261550903,    -2.0102381706237793,
+    -0.37073463201522827,   -0.5952334403991699,   -0.15507011115550995,  -0.18303270637989044,   0.006445682141929865,
+    0.11797758936882019,    0.2642666697502136,    -0.09641639143228531,  -0.0829630121588707,    -0.23737290501594543,
+    -0.02333083190023899,   0.2787218391895294,    0.33664190769195557,   -0.14748172461986542,   -0.2614055871963501,
+    -0.33984825015068054,   -0.00872207060456276,  -0.006397671531885862, 1.4447580575942993,     1.3625645637512207,
+    2.289715528488159,      1.7885438203811646,    0.3633442223072052,    0.2799672484397888,     0.17379945516586304,
+    -0.17249974608421326,   0.00699948612600565,   -0.020843330770730972, 0.3265380859375,        0.317466676235199,
+    0.26237553358078003,    -0.2539585530757904,   -0.09384262561798096,  -0.32874611020088196,   0.528607189655304,
+    0.014474005438387394,   -0.4268309772014618,   -0.14719383418560028,  0.9228358268737793,     0.42125260829925537,
+    -1.547457218170166,     2.962758779525757,     -0.4027097225189209,   1.342828392982483,      0.32439637184143066,
+    -0.37087103724479675,   0.1479153335094452,    -0.26496851444244385,  0.005562156904488802,   -0.17310091853141785,
+    -0.21126042306423187,   0.07233134657144547,   0.31288766860961914,   -0.5786224603652954,    -0.05128888040781021,
+    -0.48985955119132996,   0.2966512143611908,    0.26711413264274597,   0.08682514727115631,    0.00035958830267190933,
+    -1.0008339881896973,    -1.0441032648086548,   -1.1252896785736084,   1.4135119915008545,     1.8587487936019897,
+    -1.7710243463516235,    0.1494293063879013,    -0.14315743744373322,  -0.03536531329154968,   -0.22271615266799927,
+    -0.24711927771568298,   0.0216091126203537,    0.12270854413509369,   0.7461800575256348,     0.024171460419893265,
+    -0.01684105023741722,   0.6164366602897644,    0.029367530718445778,  0.19943496584892273,    0.2528691291809082,
+    -0.005219743121415377,  -0.26665177941322327,  0.07638368010520935,   0.8331088423728943,     -0.6692616939544678,
+    0.5877380967140198,     -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,    -0.6376116871833801,
+    3.2581100463867188,     3.128552198410034,     0.30544522404670715,   0.019999999552965164};
 
-    // PRS Archon 0.023 300ep
-    NamModel7.weights = {
-        -0.07047387957572937,   1.12656831741333,      -0.0372258722782135,   -0.6376116275787354,   0.3964749574661255,
-        -0.10848364233970642,   0.5267024636268616,    -0.17139258980751038,  -0.3360658288002014,   -0.5583142042160034,
-        0.27096840739250183,    0.40265050530433655,   0.5460745692253113,    -0.5691279768943787,   -0.1300814300775528,
-        0.0030459179542958736,  -0.041838549077510834, 0.37368693947792053,   -0.6385753750801086,   0.05301017686724663,
-        0.5434098839759827,     1.2283215522766113,    -0.04730268567800522,  0.5334928631782532,    -0.13066823780536652,
-        -1.17116117477417,      1.1503664255142212,    0.25051507353782654,   0.08535334467887878,   -0.4505921006202698,
-        -0.35939475893974304,   0.7859477400779724,    -0.7027295827865601,   -0.39066556096076965,  -0.3706148564815521,
-        -0.25897684693336487,   -0.14698055386543274,  0.3080573081970215,    0.958512008190155,     0.42842531204223633,
-        -0.30432337522506714,   -0.08565088361501694,  0.40226951241493225,   -0.9821062684059143,   -0.36333000659942627,
-        -0.36162781715393066,   0.19450700283050537,   0.06370745599269867,   0.01946265995502472,   0.1606677919626236,
-        0.6549056768417358,     -0.15878309309482574,  -0.02743075229227543,  -0.07250108569860458,  -0.17306584119796753,
-        -0.6080027222633362,    0.02529527246952057,   0.49403467774391174,   -0.10814773291349411,  -0.0701194554567337,
-        0.04648251459002495,    0.43098682165145874,   -1.174904704093933,    1.1515578031539917,    -0.2148238867521286,
-        -0.36276185512542725,   0.12526318430900574,   0.019256658852100372,  0.6882243156433105,    1.058900237083435,
-        -0.552280604839325,     -0.5198309421539307,   0.45107531547546387,   0.6927325129508972,    0.27221113443374634,
-        0.5210884809494019,     -0.7690232396125793,   -0.6213760375976562,   0.25829941034317017,   0.38683292269706726,
-        -0.15786336362361908,   0.1385919153690338,    0.9517620801925659,    -0.6202986836433411,   -0.8336341381072998,
-        0.1640836000442505,     0.04788723960518837,   -0.45012766122817993,  0.367023229598999,     -0.44373154640197754,
-        -0.3335377275943756,    0.6560214161872864,    -0.04729381203651428,  0.46606141328811646,   -0.5981117486953735,
-        -0.017898721620440483,  0.5435640215873718,    0.24522529542446136,   -0.6821203827857971,   -0.5951187014579773,
-        -0.3588319718837738,    0.5786812901496887,    -0.161335289478302,    -0.09588393568992615,  -0.6552160382270813,
-        0.3000674247741699,     -0.5774324536323547,   -0.41483965516090393,  -0.21422459185123444,  0.5109091997146606,
-        -0.16404397785663605,   0.1755780130624771,    -0.19817666709423065,  0.42297500371932983,   0.20886807143688202,
-        0.3550245761871338,     -0.5361049771308899,   -0.24581317603588104,  0.016934709623456,     -0.0131889209151268,
-        -0.4057007431983948,    -0.03789077326655388,  -0.8709909915924072,   0.44089505076408386,   -0.18479129672050476,
-        -0.07721050083637238,   0.07189527899026871,   -0.1287468820810318,   -0.272929847240448,    -1.1519697904586792,
-        -0.0872393473982811,    -0.9644334316253662,   -0.3782065808773041,   -0.11498954892158508,  -0.06817149370908737,
-        0.04790504276752472,    -1.4288139343261719,   0.45534849166870117,   0.598953902721405,     -0.1858043521642685,
-        -0.3225476145744324,    0.7926018238067627,    -0.6379414200782776,   0.18002745509147644,   -0.3080361485481262,
-        -0.0009253344614990056, 0.11760048568248749,   0.2802783250808716,    -0.318774551153183,    -0.06875203549861908,
-        -1.1465662717819214,    -0.5317906737327576,   -0.2936619520187378,   0.11300445348024368,   0.416504830121994,
-        -0.5640036463737488,    0.4032285511493683,    -0.14643169939517975,  -0.22322705388069153,  0.13359004259109497,
-        -0.7381364703178406,    0.018251443281769753,  -0.7099684476852417,   -0.5320580005645752,   -0.20450454950332642,
-        0.16301320493221283,    0.1950208693742752,    0.18080301582813263,   -0.15515005588531494,  0.5991199612617493,
-        0.12376563251018524,    -0.32091963291168213,  0.7761331796646118,    -0.09518224745988846,  0.3650733530521393,
-        1.4225273132324219,     -0.08622722327709198,  -0.11404246091842651,  0.7758257985115051,    -0.3407025933265686,
-        0.6288231015205383,     0.4103097915649414,    -0.21617308259010315,  0.6816392540931702,    0.2831704020500183,
-        0.05022328719496727,    -0.20560836791992188,  -0.24269741773605347,  -0.6885111331939697,   0.12633827328681946,
-        0.2726825177669525,     -0.2633322477340698,   0.02308730036020279,   -0.00844893790781498,  0.44122543931007385,
-        -0.03041169047355652,   -0.002717570634558797, -0.43755656480789185,  -0.07659340649843216,  0.006033665034919977,
-        -0.46675559878349304,   0.08467041701078415,   -0.30789342522621155,  -0.44113194942474365,  -0.4426118731498718,
-        1.3373169898986816,     -0.2673823833465576,   0.4355466365814209,    -0.002277795923873782, 0.11986252665519714,
-        -0.3698657751083374,    0.002676846459507942,  -0.057712845504283905, -0.3690154254436493,   -0.1343354880809784,
-        0.46284914016723633,    1.1482305526733398,    0.1385468989610672,    -0.44911715388298035,  0.1912987381219864,
-        0.1975775808095932,     0.3074134290218353,    0.8971164226531982,    0.005137233529239893,  -0.7527880668640137,
-        0.3176369071006775,     -0.4312463104724884,   -0.024982327595353127, -0.2707706093788147,   -0.24320340156555176,
-        -0.15272776782512665,   0.7981124520301819,    1.2807868719100952,    0.117142453789711,     0.3492650091648102,
-        0.18073156476020813,    0.42353230714797974,   -1.335575819015503,    -2.265064239501953,    -0.14347471296787262,
-        -0.36454105377197266,   -0.42521679401397705,  -0.17338037490844727,  0.04227578267455101,   0.3800225257873535,
-        -0.7572913765907288,    0.3185954988002777,    -0.19183747470378876,  -0.19520924985408783,  -0.9242174029350281,
-        -0.21162572503089905,   0.010490030981600285,  -0.11038367450237274,  -0.06318541616201401,  -0.8947800397872925,
-        -0.45308658480644226,   -0.6787257790565491,   -0.5977303981781006,   -0.4390200674533844,   -0.33461716771125793,
-        0.03397025167942047,    0.06563818454742432,   -0.04003966972231865,  0.19779030978679657,   0.4308333694934845,
-        -0.4637833833694458,    -0.1668936312198639,   -2.0697286128997803,   0.2704874873161316,    0.7499647736549377,
-        -0.3367093801498413,    0.31846046447753906,   -0.4800173044204712,   0.20089371502399445,   -1.0301856994628906,
-        -0.8621596693992615,    0.39988550543785095,   -0.8112371563911438,   -0.7959004044532776,   -0.19772842526435852,
-        0.14002487063407898,    0.5615128874778748,    -0.42552870512008667,  0.1210160031914711,    -0.5899575352668762,
-        0.7072407007217407,     -0.15141557157039642,  0.1772502362728119,    -0.7595775723457336,   0.2525560259819031,
-        -0.41331303119659424,   -0.7542108297348022,   -0.669140636920929,    -0.8908864855766296,   0.23492023348808289,
-        -0.445068895816803,     -0.013369367457926273, -0.5564970970153809,   -0.14870205521583557,  -0.018351474776864052,
-        0.12106350064277649,    -0.2654600739479065,   0.055278975516557693,  0.26783373951911926,   -0.4021190106868744,
-        -0.04678325727581978,   -0.2955646216869354,   0.4072883725166321,    -0.4455402195453644,   -0.05504189804196358,
-        -0.1406496912240982,    -0.15734559297561646,  0.5236334204673767,    0.23598991334438324,   0.30967551469802856,
-        -1.6237605810165405,    -0.1772870421409607,   -0.17229489982128143,  0.05788342282176018,   0.1603001207113266,
-        -0.36021602153778076,   -0.03367503732442856,  -0.18060904741287231,  0.3617134988307953,    0.1812088042497635,
-        0.23932252824306488,    -0.25008970499038696,  -0.2223399430513382,   -0.2433266043663025,   0.1723467856645584,
-        -0.12916480004787445,   0.1702703982591629,    -0.14589934051036835,  0.2766630947589874,    -0.1427599936723709,
-        0.0016016032313928008,  -1.9543195962905884,   -0.7493042349815369,   0.7444731593132019,    0.5422084331512451,
-        0.06486642360687256,    0.15641038119792938,   -0.22967007756233215,  -0.06517893075942993,  -0.15810279548168182,
-        0.19347719848155975,    -0.11108741909265518,  -0.034487199038267136, -0.34029608964920044,  0.11866139620542526,
-        0.041367046535015106,   0.029020268470048904,  0.010189201682806015,  -0.062012363225221634, 0.02308754064142704,
-        -0.26656195521354675,   1.039350152015686,     0.8465033173561096,    -2.304673194885254,    0.9838548898696899,
-        -0.410067617893219,     -0.6524538993835449,   -0.048420000821352005, -0.5246293544769287,   -0.0020438332576304674,
-        0.07593870908021927,    0.4564744532108307,    -0.09551028907299042,  -0.21895839273929596,  -0.2943164110183716,
-        0.21802856028079987,    0.19194883108139038,   0.2672201693058014,    -0.05880149081349373,  -0.2878093421459198,
-        -0.1494349092245102,    -0.29822057485580444,  0.027094600722193718,  0.09947098791599274,   -2.1114413738250732,
-        0.9717762470245361,     -0.1382303535938263,   0.28880324959754944,   0.18352188169956207,   -0.12009091675281525,
-        -0.2683205008506775,    -0.013352541252970695, 0.09021872282028198,   0.19077278673648834,   0.1378612220287323,
-        -0.021667495369911194,  -0.40925130248069763,  -0.054161250591278076, -0.13160991668701172,  0.26952409744262695,
-        0.03560105338692665,    -0.1459503471851349,   -0.18220190703868866,  -0.08276975154876709,  -0.092096708714962,
-        -1.395286202430725,     -2.068805694580078,    -3.8644814491271973,   -0.7273261547088623,   0.017258478328585625,
-        -0.430210143327713,     0.056002676486968994,  0.01275585312396288,   -0.0415852889418602,   -0.04208561033010483,
-        0.21210977435112,       0.05916221812367439,   0.10499530285596848,   -0.09446590393781662,  -0.44507500529289246,
-        -0.05621864274144173,   0.4050789773464203,    0.3906428813934326,    0.0672229528427124,    0.1527637541294098,
-        -0.0838598981499672,    -0.22736239433288574,  -2.658710479736328,    1.4078359603881836,    1.5695819854736328,
-        -1.2129473686218262,    -0.2690678834915161,   -0.9504931569099426,   0.07167297601699829,   0.2994023859500885,
-        -0.5276298522949219,    -0.06431469321250916,  -0.2891750931739807,   0.25220197439193726,   0.023000840097665787,
-        0.2096785604953766,     -0.48965984582901,     -0.01653549261391163,  -0.25612112879753113,  0.31848812103271484,
-        0.43228623270988464,    -0.5170778036117554,   -0.31342464685440063,  0.24625366926193237,   -0.6692616939544678,
-        0.5877380967140198,     -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
-        3.321866035461426,      4.144033432006836,     -0.08026478439569473,  0.019999999552965164};
+// PRS Archon 0.023 300ep
+constexpr float NamModel7[] = {
+    -0.07047387957572937,   1.12656831741333,      -0.0372258722782135,   -0.6376116275787354,   0.3964749574661255,
+    -0.10848364233970642,   0.5267024636268616,    -0.17139258980751038,  -0.3360658288002014,   -0.5583142042160034,
+    0.27096840739250183,    0.40265050530433655,   0.5460745692253113,    -0.5691279768943787,   -0.1300814300775528,
+    0.0030459179542958736,  -0.041838549077510834, 0.37368693947792053,   -0.6385753750801086,   0.05301017686724663,
+    0.5434098839759827,     1.2283215522766113,    -0.04730268567800522,  0.5334928631782532,    -0.13066823780536652,
+    -1.17116117477417,      1.1503664255142212,    0.25051507353782654,   0.08535334467887878,   -0.4505921006202698,
+    -0.35939475893974304,   0.7859477400779724,    -0.7027295827865601,   -0.39066556096076965,  -0.3706148564815521,
+    -0.25897684693336487,   -0.14698055386543274,  0.3080573081970215,    0.958512008190155,     0.42842531204223633,
+    -0.30432337522506714,   -0.08565088361501694,  0.40226951241493225,   -0.9821062684059143,   -0.36333000659942627,
+    -0.36162781715393066,   0.19450700283050537,   0.06370745599269867,   0.01946265995502472,   0.1606677919626236,
+    0.6549056768417358,     -0.15878309309482574,  -0.02743075229227543,  -0.07250108569860458,  -0.17306584119796753,
+    -0.6080027222633362,    0.02529527246952057,   0.49403467774391174,   -0.10814773291349411,  -0.0701194554567337,
+    0.04648251459002495,    0.43098682165145874,   -1.174904704093933,    1.1515578031539917,    -0.2148238867521286,
+    -0.36276185512542725,   0.12526318430900574,   0.019256658852100372,  0.6882243156433105,    1.058900237083435,
+    -0.552280604839325,     -0.5198309421539307,   0.45107531547546387,   0.6927325129508972,    0.27221113443374634,
+    0.5210884809494019,     -0.7690232396125793,   -0.6213760375976562,   0.25829941034317017,   0.38683292269706726,
+    -0.15786336362361908,   0.1385919153690338,    0.9517620801925659,    -0.6202986836433411,   -0.8336341381072998,
+    0.1640836000442505,     0.04788723960518837,   -0.45012766122817993,  0.367023229598999,     -0.44373154640197754,
+    -0.3335377275943756,    0.6560214161872864,    -0.04729381203651428,  0.46606141328811646,   -0.5981117486953735,
+    -0.017898721620440483,  0.5435640215873718,    0.24522529542446136,   -0.6821203827857971,   -0.5951187014579773,
+    -0.3588319718837738,    0.5786812901496887,    -0.161335289478302,    -0.09588393568992615,  -0.6552160382270813,
+    0.3000674247741699,     -0.5774324536323547,   -0.41483965516090393,  -0.21422459185123444,  0.5109091997146606,
+    -0.16404397785663605,   0.1755780130624771,    -0.19817666709423065,  0.42297500371932983,   0.20886807143688202,
+    0.3550245761871338,     -0.5361049771308899,   -0.24581317603588104,  0.016934709623456,     -0.0131889209151268,
+    -0.4057007431983948,    -0.03789077326655388,  -0.8709909915924072,   0.44089505076408386,   -0.18479129672050476,
+    -0.07721050083637238,   0.07189527899026871,   -0.1287468820810318,   -0.272929847240448,    -1.1519697904586792,
+    -0.0872393473982811,    -0.9644334316253662,   -0.3782065808773041,   -0.11498954892158508,  -0.06817149370908737,
+    0.04790504276752472,    -1.4288139343261719,   0.45534849166870117,   0.598953902721405,     -0.1858043521642685,
+    -0.3225476145744324,    0.7926018238067627,    -0.6379414200782776,   0.18002745509147644,   -0.3080361485481262,
+    -0.0009253344614990056, 0.11760048568248749,   0.2802783250808716,    -0.318774551153183,    -0.06875203549861908,
+    -1.1465662717819214,    -0.5317906737327576,   -0.2936619520187378,   0.11300445348024368,   0.416504830121994,
+    -0.5640036463737488,    0.4032285511493683,    -0.14643169939517975,  -0.22322705388069153,  0.13359004259109497,
+    -0.7381364703178406,    0.018251443281769753,  -0.7099684476852417,   -0.5320580005645752,   -0.20450454950332642,
+    0.16301320493221283,    0.1950208693742752,    0.18080301582813263,   -0.15515005588531494,  0.5991199612617493,
+    0.12376563251018524,    -0.32091963291168213,  0.7761331796646118,    -0.09518224745988846,  0.3650733530521393,
+    1.4225273132324219,     -0.08622722327709198,  -0.11404246091842651,  0.7758257985115051,    -0.3407025933265686,
+    0.6288231015205383,     0.4103097915649414,    -0.21617308259010315,  0.6816392540931702,    0.2831704020500183,
+    0.05022328719496727,    -0.20560836791992188,  -0.24269741773605347,  -0.6885111331939697,   0.12633827328681946,
+    0.2726825177669525,     -0.2633322477340698,   0.02308730036020279,   -0.00844893790781498,  0.44122543931007385,
+    -0.03041169047355652,   -0.002717570634558797, -0.43755656480789185,  -0.07659340649843216,  0.006033665034919977,
+    -0.46675559878349304,   0.08467041701078415,   -0.30789342522621155,  -0.44113194942474365,  -0.4426118731498718,
+    1.3373169898986816,     -0.2673823833465576,   0.4355466365814209,    -0.002277795923873782, 0.11986252665519714,
+    -0.3698657751083374,    0.002676846459507942,  -0.057712845504283905, -0.3690154254436493,   -0.1343354880809784,
+    0.46284914016723633,    1.1482305526733398,    0.1385468989610672,    -0.44911715388298035,  0.1912987381219864,
+    0.1975775808095932,     0.3074134290218353,    0.8971164226531982,    0.005137233529239893,  -0.7527880668640137,
+    0.3176369071006775,     -0.4312463104724884,   -0.024982327595353127, -0.2707706093788147,   -0.24320340156555176,
+    -0.15272776782512665,   0.7981124520301819,    1.2807868719100952,    0.117142453789711,     0.3492650091648102,
+    0.18073156476020813,    0.42353230714797974,   -1.335575819015503,    -2.265064239501953,    -0.14347471296787262,
+    -0.36454105377197266,   -0.42521679401397705,  -0.17338037490844727,  0.04227578267455101,   0.3800225257873535,
+    -0.7572913765907288,    0.3185954988002777,    -0.19183747470378876,  -0.19520924985408783,  -0.9242174029350281,
+    -0.21162572503089905,   0.010490030981600285,  -0.11038367450237274,  -0.06318541616201401,  -0.8947800397872925,
+    -0.45308658480644226,   -0.6787257790565491,   -0.5977303981781006,   -0.4390200674533844,   -0.33461716771125793,
+    0.03397025167942047,    0.06563818454742432,   -0.04003966972231865,  0.19779030978679657,   0.4308333694934845,
+    -0.4637833833694458,    -0.1668936312198639,   -2.0697286128997803,   0.2704874873161316,    0.7499647736549377,
+    -0.3367093801498413,    0.31846046447753906,   -0.4800173044204712,   0.20089371502399445,   -1.0301856994628906,
+    -0.8621596693992615,    0.39988550543785095,   -0.8112371563911438,   -0.7959004044532776,   -0.19772842526435852,
+    0.14002487063407898,    0.5615128874778748,    -0.42552870512008667,  0.1210160031914711,    -0.5899575352668762,
+    0.7072407007217407,     -0.15141557157039642,  0.1772502362728119,    -0.7595775723457336,   0.2525560259819031,
+    -0.41331303119659424,   -0.7542108297348022,   -0.669140636920929,    -0.8908864855766296,   0.23492023348808289,
+    -0.445068895816803,     -0.013369367457926273, -0.5564970970153809,   -0.14870205521583557,  -0.018351474776864052,
+    0.12106350064277649,    -0.2654600739479065,   0.055278975516557693,  0.26783373951911926,   -0.4021190106868744,
+    -0.04678325727581978,   -0.2955646216869354,   0.4072883725166321,    -0.4455402195453644,   -0.05504189804196358,
+    -0.1406496912240982,    -0.15734559297561646,  0.5236334204673767,    0.23598991334438324,   0.30967551469802856,
+    -1.6237605810165405,    -0.1772870421409607,   -0.17229489982128143,  0.05788342282176018,   0.1603001207113266,
+    -0.36021602153778076,   -0.03367503732442856,  -0.18060904741287231,  0.3617134988307953,    0.1812088042497635,
+    0.23932252824306488,    -0.25008970499038696,  -0.2223399430513382,   -0.2433266043663025,   0.1723467856645584,
+    -0.12916480004787445,   0.1702703982591629,    -0.14589934051036835,  0.2766630947589874,    -0.1427599936723709,
+    0.0016016032313928008,  -1.9543195962905884,   -0.7493042349815369,   0.7444731593132019,    0.5422084331512451,
+    0.06486642360687256,    0.15641038119792938,   -0.22967007756233215,  -0.06517893075942993,  -0.15810279548168182,
+    0.19347719848155975,    -0.11108741909265518,  -0.034487199038267136, -0.34029608964920044,  0.11866139620542526,
+    0.041367046535015106,   0.029020268470048904,  0.010189201682806015,  -0.062012363225221634, 0.02308754064142704,
+    -0.26656195521354675,   1.039350152015686,     0.8465033173561096,    -2.304673194885254,    0.9838548898696899,
+    -0.410067617893219,     -0.6524538993835449,   -0.048420000821352005, -0.5246293544769287,   -0.0020438332576304674,
+    0.07593870908021927,    0.4564744532108307,    -0.09551028907299042,  -0.21895839273929596,  -0.2943164110183716,
+    0.21802856028079987,    0.19194883108139038,   0.2672201693058014,    -0.05880149081349373,  -0.2878093421459198,
+    -0.1494349092245102,    -0.29822057485580444,  0.027094600722193718,  0.09947098791599274,   -2.1114413738250732,
+    0.9717762470245361,     -0.1382303535938263,   0.28880324959754944,   0.18352188169956207,   -0.12009091675281525,
+    -0.2683205008506775,    -0.013352541252970695, 0.09021872282028198,   0.19077278673648834,   0.1378612220287323,
+    -0.021667495369911194,  -0.40925130248069763,  -0.054161250591278076, -0.13160991668701172,  0.26952409744262695,
+    0.03560105338692665,    -0.1459503471851349,   -0.18220190703868866,  -0.08276975154876709,  -0.092096708714962,
+    -1.395286202430725,     -2.068805694580078,    -3.8644814491271973,   -0.7273261547088623,   0.017258478328585625,
+    -0.430210143327713,     0.056002676486968994,  0.01275585312396288,   -0.0415852889418602,   -0.04208561033010483,
+    0.21210977435112,       0.05916221812367439,   0.10499530285596848,   -0.09446590393781662,  -0.44507500529289246,
+    -0.05621864274144173,   0.4050789773464203,    0.3906428813934326,    0.0672229528427124,    0.1527637541294098,
+    -0.0838598981499672,    -0.22736239433288574,  -2.658710479736328,    1.4078359603881836,    1.5695819854736328,
+    -1.2129473686218262,    -0.2690678834915161,   -0.9504931569099426,   0.07167297601699829,   0.2994023859500885,
+    -0.5276298522949219,    -0.06431469321250916,  -0.2891750931739807,   0.25220197439193726,   0.023000840097665787,
+    0.2096785604953766,     -0.48965984582901,     -0.01653549261391163,  -0.25612112879753113,  0.31848812103271484,
+    0.43228623270988464,    -0.5170778036117554,   -0.31342464685440063,  0.24625366926193237,   -0.6692616939544678,
+    0.5877380967140198,     -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,   -0.6376116871833801,
+    3.321866035461426,      4.144033432006836,     -0.08026478439569473,  0.019999999552965164};
 
-    // JCM800 0.018 300ep
-    NamModel8.weights = {
-        -0.9783204197883606,     0.7235590815544128,    -0.4035477638244629,   -0.7981544137001038,    0.8443640470504761,
-        0.13484646379947662,     0.4092341959476471,    -0.32738640904426575,  -1.429323673248291,     -0.7227996587753296,
-        0.5068479180335999,      0.9849625825881958,    0.20582900941371918,   -0.5936052203178406,    -0.4070972204208374,
-        0.13616642355918884,     -0.24530410766601562,  0.2990027070045471,    -1.173402190208435,     -1.4179954528808594,
-        0.6163345575332642,      1.056818962097168,     0.15168708562850952,   0.4040464460849762,     1.0741358995437622,
-        -0.9657801985740662,     -0.3638003468513489,   -0.9302225112915039,   0.39045679569244385,    0.37166017293930054,
-        -1.0724538564682007,     0.8512765169143677,    -0.06303292512893677,  0.2783999443054199,     -0.6072171926498413,
-        -0.48787906765937805,    -0.24898940324783325,  0.43457257747650146,   1.180107831954956,      0.807541012763977,
-        0.7869592308998108,      -0.525883138179779,    0.607617974281311,     -1.625899076461792,     -0.011074061505496502,
-        -0.5100659132003784,     1.1132460832595825,    -0.1288902759552002,   -0.053145382553339005,  -0.45041754841804504,
-        -0.49602216482162476,    0.9936434030532837,    -0.5610377788543701,   -0.9592041373252869,    0.4243844449520111,
-        -1.0406312942504883,     -0.6088503003120422,   0.10854869335889816,   -0.023229477927088737,  0.25184160470962524,
-        0.6164996027946472,      -0.13754971325397491,  -1.2828969955444336,   -0.4757011830806732,    1.0487282276153564,
-        0.2704504430294037,      0.12955059111118317,   0.22742697596549988,   -0.26591968536376953,   -0.2649085223674774,
-        -0.05017796531319618,    -0.4537297487258911,   1.8453177213668823,    0.1797645539045334,     1.1314306259155273,
-        0.3199383020401001,      0.8262110352516174,    -2.365352153778076,    0.022285090759396553,   0.4487420320510864,
-        -0.3755671977996826,     0.2917715609073639,    -1.296688199043274,    -0.7101432681083679,    0.0947461724281311,
-        -1.2056349515914917,     -0.450387179851532,    -0.7320589423179626,   0.27784937620162964,    -0.1611575186252594,
-        0.08501023799180984,     0.4713039696216583,    0.2504310607910156,    -0.04978707432746887,   -0.6634426712989807,
-        -0.1429206281900406,     0.6060158610343933,    0.43823304772377014,   0.4009459316730499,     -0.390688955783844,
-        0.1864246279001236,      -0.504837155342102,    -0.3183389902114868,   -0.20675989985466003,   0.6573551893234253,
-        4.086616516113281,       -1.4969120025634766,   -0.38561272621154785,  0.7359223961830139,     1.8206251859664917,
-        -0.12761624157428741,    0.36755242943763733,   0.18832753598690033,   0.09544992446899414,    -1.0343549251556396,
-        -0.4873018264770508,     -0.10299026221036911,  -1.379779577255249,    -0.25029227137565613,   -0.2763650715351105,
-        -0.00036097850534133613, 0.013813057914376259,  0.42504069209098816,   -0.19817587733268738,   0.050089240074157715,
-        0.023330723866820335,    -2.7038590908050537,   1.2893202304840088,    -0.18528133630752563,   -0.3595429062843323,
-        0.18836891651153564,     1.1755824089050293,    -0.37253910303115845,  0.11146344244480133,    0.025821136310696602,
-        0.025433968752622604,    -0.10914739966392517,  0.0794689878821373,    0.28401315212249756,    0.41065359115600586,
-        0.27213987708091736,     -0.017224425449967384, -0.2887980341911316,   0.12405001372098923,    0.038469213992357254,
-        -0.20737560093402863,    0.15964625775814056,   0.038806427270174026,  -1.1488521099090576,    0.3124067783355713,
-        -1.1232764720916748,     -1.2622292041778564,   -0.12830570340156555,  -0.20248420536518097,   0.4762875437736511,
-        -0.5682574510574341,     0.33714908361434937,   -0.10722918063402176,  -0.27139922976493835,   0.30440419912338257,
-        -0.5114567279815674,     -0.23602543771266937,  -1.0068894624710083,   -0.6857220530509949,    -0.5292131900787354,
-        -0.08703511953353882,    -0.6033718585968018,   0.18000665307044983,   -0.347349613904953,     -0.35462668538093567,
-        0.1913248598575592,      0.9583742618560791,    0.13754451274871826,   -0.06902415305376053,   -0.17438317835330963,
-        0.38775914907455444,     -0.005947082303464413, -0.3968844413757324,   -1.1228450536727905,    0.519218921661377,
-        -0.25835922360420227,    0.44543761014938354,   -0.7623445391654968,   0.7459598779678345,     0.1741146445274353,
-        0.18167167901992798,     -0.3976432681083679,   -0.008767764084041119, -1.2282565832138062,    0.031521644443273544,
-        0.4487496614456177,      -0.9095537066459656,   -0.19113513827323914,  0.07392231374979019,    -1.213269829750061,
-        0.02192588895559311,     -0.15229691565036774,  -0.4904845058917999,   0.163593128323555,      0.11230147629976273,
-        1.915589451789856,       -1.1473523378372192,   -0.07372751086950302,  -0.5876005291938782,    -0.08721306174993515,
-        -0.6552188992500305,     -0.2324782907962799,   0.4150608479976654,    0.17621587216854095,    0.15660136938095093,
-        -0.5005791783332825,     -0.09296166896820068,  0.14682748913764954,   -0.4175926446914673,    0.04659607633948326,
-        0.020740672945976257,    -0.7646975517272949,   -0.016918828710913658, 0.058758728206157684,   -0.7974666357040405,
-        0.14507608115673065,     0.40022361278533936,   -0.10423186421394348,  1.3426762819290161,     -0.20056593418121338,
-        0.35185644030570984,     -0.23361721634864807,  0.33335307240486145,   -0.20089136064052582,   -0.17910635471343994,
-        -1.5543245077133179,     -0.6465420126914978,   -0.15807859599590302,  -0.31341055035591125,   -0.027949035167694092,
-        -0.018206309527158737,   -0.04821429401636124,  -0.32239341735839844,  -0.06391920149326324,   -0.0523751825094223,
-        -0.1254798024892807,     0.01313867885619402,   -0.08877328038215637,  0.15091902017593384,    -1.8986732959747314,
-        -1.397713303565979,      0.13749165832996368,   -1.7256780862808228,   0.2714410424232483,     -0.9908502101898193,
-        -0.28542789816856384,    -0.03830500319600105,  0.48503828048706055,   -0.31700649857521057,   0.05105183646082878,
-        -0.28952258825302124,    -0.985426127910614,    0.5024229884147644,    -0.5206705331802368,    -0.19466042518615723,
-        -0.38412362337112427,    0.2591004967689514,    0.12673577666282654,   0.6762608885765076,     0.17587177455425262,
-        -0.1841416209936142,     0.22541692852973938,   1.20817232131958,      -0.24569736421108246,   -0.6994468569755554,
-        -0.5669529438018799,     -0.7362455129623413,   -0.5301519632339478,   0.11339670419692993,    0.11530347168445587,
-        -0.24492546916007996,    0.045850832015275955,  -0.22100019454956055,  -0.862239420413971,     0.22489240765571594,
-        -0.2716601490974426,     -0.1303860992193222,   -1.334276556968689,    0.1216844841837883,     -0.676578938961029,
-        0.015037178993225098,    0.038085341453552246,  0.4221758544445038,    0.5857324600219727,     -1.6664122343063354,
-        -0.016951249912381172,   -0.07317505776882172,  0.46022871136665344,   -0.1254020780324936,    0.018700750544667244,
-        -0.39486780762672424,    0.21123658120632172,   -0.14491477608680725,  0.1633630096912384,     -0.07348880171775818,
-        -0.1835215836763382,     -0.6972514390945435,   -0.05623277276754379,  -0.3149752616882324,    0.019758371636271477,
-        -0.05467468127608299,    0.1694127917289734,    -0.1301080882549286,   0.1570725440979004,     -0.9264501333236694,
-        5.183340072631836,       -0.03610338643193245,  0.18775303661823273,   -0.7078856229782104,    0.6635328531265259,
-        1.031058430671692,       -0.23737786710262299,  -0.05407315120100975,  0.06765047460794449,    -0.2013958841562271,
-        -0.2235918492078781,     -0.04894530028104782,  0.030390582978725433,  0.017387155443429947,   -0.21568220853805542,
-        -0.17570888996124268,    -0.15851475298404694,  0.23912741243839264,   0.3921298086643219,     -0.032329123467206955,
-        0.5713362693786621,      -0.16534022986888885,  -0.19545075297355652,  0.41481879353523254,    -1.2433135509490967,
-        -0.9249871373176575,     0.6635118722915649,    0.5482897162437439,    0.9235682487487793,     0.6832424402236938,
-        0.06928831338882446,     -0.08402770757675171,  -0.923750638961792,    -0.34495094418525696,   -0.5390321612358093,
-        -0.08749715983867645,    0.18541748821735382,   0.2124786227941513,    -0.4641205668449402,    -0.19995015859603882,
-        -0.3002820611000061,     0.5852490067481995,    -0.2455669492483139,   0.07934477925300598,    0.004667432513087988,
-        -0.6642214059829712,     0.23625463247299194,   -0.1083112582564354,   0.4997052848339081,     -1.499241590499878,
-        -0.03519564867019653,    -0.37923693656921387,  0.2846718430519104,    -0.24866123497486115,   -0.3730790615081787,
-        -0.38254514336586,       0.08496281504631042,   -1.1200028657913208,   0.12322060018777847,    0.42468565702438354,
-        -0.6443961262702942,     -0.36864152550697327,  -1.0760197639465332,   -1.5784653425216675,    -0.5395673513412476,
-        -0.3071078062057495,     1.437305212020874,     1.2172287702560425,    -0.07140827924013138,   0.45021557807922363,
-        0.6869311928749084,      -0.32826903462409973,  0.5925907492637634,    0.6968080401420593,     0.08675269037485123,
-        0.3926256000995636,      -1.060575246810913,    -0.17708392441272736,  -0.5776646733283997,    0.2702156901359558,
-        0.1600416898727417,      0.22597472369670868,   0.12338154017925262,   -0.20924490690231323,   -0.3658841550350189,
-        0.5582997798919678,      -0.056179825216531754, -0.3555351793766022,   -1.899082899093628,     -0.6663432121276855,
-        0.009612532332539558,    -1.3078054189682007,   -1.272124171257019,    -0.49280476570129395,   0.7387033104896545,
-        -0.5249691605567932,     0.072175532579422,     -0.018240628764033318, -1.629947543144226,     -0.07484104484319687,
-        0.01841658540070057,     0.621047854423523,     -0.002753745997324586, -0.28984975814819336,   -1.1016720533370972,
-        0.00410764105618,        0.17939366400241852,   -0.1475742608308792,   -0.12328589707612991,   0.2008814662694931,
-        -1.5311429500579834,     1.6240075826644897,    -0.7926595211029053,   0.5273397564888,        0.8112470507621765,
-        1.4251494407653809,      0.3361791968345642,    -1.050339698791504,    -0.007874582894146442,  -0.03906901925802231,
-        -0.42937612533569336,    0.04332885891199112,   0.12211940437555313,   1.3690001964569092,     -0.0035163185093551874,
-        0.014436250552535057,    -1.3311598300933838,   -0.06383206695318222,  -0.0044150082394480705, -1.295809268951416,
-        -0.9037972688674927,     -0.5171905755996704,   1.953354835510254,     -0.5172408819198608,    -0.6692616939544678,
-        0.5877380967140198,      -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,    -0.6376116871833801,
-        1.4749704599380493,      1.7796794176101685,    -0.3168823719024658,   0.019999999552965164};
+// JCM800 0.018 300ep
+constexpr float NamModel8[] = {
+    -0.9783204197883606,     0.7235590815544128,    -0.4035477638244629,   -0.7981544137001038,    0.8443640470504761,
+    0.13484646379947662,     0.4092341959476471,    -0.32738640904426575,  -1.429323673248291,     -0.7227996587753296,
+    0.5068479180335999,      0.9849625825881958,    0.20582900941371918,   -0.5936052203178406,    -0.4070972204208374,
+    0.13616642355918884,     -0.24530410766601562,  0.2990027070045471,    -1.173402190208435,     -1.4179954528808594,
+    0.6163345575332642,      1.056818962097168,     0.15168708562850952,   0.4040464460849762,     1.0741358995437622,
+    -0.9657801985740662,     -0.3638003468513489,   -0.9302225112915039,   0.39045679569244385,    0.37166017293930054,
+    -1.0724538564682007,     0.8512765169143677,    -0.06303292512893677,  0.2783999443054199,     -0.6072171926498413,
+    -0.48787906765937805,    -0.24898940324783325,  0.43457257747650146,   1.180107831954956,      0.807541012763977,
+    0.7869592308998108,      -0.525883138179779,    0.607617974281311,     -1.625899076461792,     -0.011074061505496502,
+    -0.5100659132003784,     1.1132460832595825,    -0.1288902759552002,   -0.053145382553339005,  -0.45041754841804504,
+    -0.49602216482162476,    0.9936434030532837,    -0.5610377788543701,   -0.9592041373252869,    0.4243844449520111,
+    -1.0406312942504883,     -0.6088503003120422,   0.10854869335889816,   -0.023229477927088737,  0.25184160470962524,
+    0.6164996027946472,      -0.13754971325397491,  -1.2828969955444336,   -0.4757011830806732,    1.0487282276153564,
+    0.2704504430294037,      0.12955059111118317,   0.22742697596549988,   -0.26591968536376953,   -0.2649085223674774,
+    -0.05017796531319618,    -0.4537297487258911,   1.8453177213668823,    0.1797645539045334,     1.1314306259155273,
+    0.3199383020401001,      0.8262110352516174,    -2.365352153778076,    0.022285090759396553,   0.4487420320510864,
+    -0.3755671977996826,     0.2917715609073639,    -1.296688199043274,    -0.7101432681083679,    0.0947461724281311,
+    -1.2056349515914917,     -0.450387179851532,    -0.7320589423179626,   0.27784937620162964,    -0.1611575186252594,
+    0.08501023799180984,     0.4713039696216583,    0.2504310607910156,    -0.04978707432746887,   -0.6634426712989807,
+    -0.1429206281900406,     0.6060158610343933,    0.43823304772377014,   0.4009459316730499,     -0.390688955783844,
+    0.1864246279001236,      -0.504837155342102,    -0.3183389902114868,   -0.20675989985466003,   0.6573551893234253,
+    4.086616516113281,       -1.4969120025634766,   -0.38561272621154785,  0.7359223961830139,     1.8206251859664917,
+    -0.12761624157428741,    0.36755242943763733,   0.18832753598690033,   0.09544992446899414,    -1.0343549251556396,
+    -0.4873018264770508,     -0.10299026221036911,  -1.379779577255249,    -0.25029227137565613,   -0.2763650715351105,
+    -0.00036097850534133613, 0.013813057914376259,  0.42504069209098816,   -0.19817587733268738,   0.050089240074157715,
+    0.023330723866820335,    -2.7038590908050537,   1.2893202304840088,    -0.18528133630752563,   -0.3595429062843323,
+    0.18836891651153564,     1.1755824089050293,    -0.37253910303115845,  0.11146344244480133,    0.025821136310696602,
+    0.025433968752622604,    -0.10914739966392517,  0.0794689878821373,    0.28401315212249756,    0.41065359115600586,
+    0.27213987708091736,     -0.017224425449967384, -0.2887980341911316,   0.12405001372098923,    0.038469213992357254,
+    -0.20737560093402863,    0.15964625775814056,   0.038806427270174026,  -1.1488521099090576,    0.3124067783355713,
+    -1.1232764720916748,     -1.2622292041778564,   -0.12830570340156555,  -0.20248420536518097,   0.4762875437736511,
+    -0.5682574510574341,     0.33714908361434937,   -0.10722918063402176,  -0.27139922976493835,   0.30440419912338257,
+    -0.5114567279815674,     -0.23602543771266937,  -1.0068894624710083,   -0.6857220530509949,    -0.5292131900787354,
+    -0.08703511953353882,    -0.6033718585968018,   0.18000665307044983,   -0.347349613904953,     -0.35462668538093567,
+    0.1913248598575592,      0.9583742618560791,    0.13754451274871826,   -0.06902415305376053,   -0.17438317835330963,
+    0.38775914907455444,     -0.005947082303464413, -0.3968844413757324,   -1.1228450536727905,    0.519218921661377,
+    -0.25835922360420227,    0.44543761014938354,   -0.7623445391654968,   0.7459598779678345,     0.1741146445274353,
+    0.18167167901992798,     -0.3976432681083679,   -0.008767764084041119, -1.2282565832138062,    0.031521644443273544,
+    0.4487496614456177,      -0.9095537066459656,   -0.19113513827323914,  0.07392231374979019,    -1.213269829750061,
+    0.02192588895559311,     -0.15229691565036774,  -0.4904845058917999,   0.163593128323555,      0.11230147629976273,
+    1.915589451789856,       -1.1473523378372192,   -0.07372751086950302,  -0.5876005291938782,    -0.08721306174993515,
+    -0.6552188992500305,     -0.2324782907962799,   0.4150608479976654,    0.17621587216854095,    0.15660136938095093,
+    -0.5005791783332825,     -0.09296166896820068,  0.14682748913764954,   -0.4175926446914673,    0.04659607633948326,
+    0.020740672945976257,    -0.7646975517272949,   -0.016918828710913658, 0.058758728206157684,   -0.7974666357040405,
+    0.14507608115673065,     0.40022361278533936,   -0.10423186421394348,  1.3426762819290161,     -0.20056593418121338,
+    0.35185644030570984,     -0.23361721634864807,  0.33335307240486145,   -0.20089136064052582,   -0.17910635471343994,
+    -1.5543245077133179,     -0.6465420126914978,   -0.15807859599590302,  -0.31341055035591125,   -0.027949035167694092,
+    -0.018206309527158737,   -0.04821429401636124,  -0.32239341735839844,  -0.06391920149326324,   -0.0523751825094223,
+    -0.1254798024892807,     0.01313867885619402,   -0.08877328038215637,  0.15091902017593384,    -1.8986732959747314,
+    -1.397713303565979,      0.13749165832996368,   -1.7256780862808228,   0.2714410424232483,     -0.9908502101898193,
+    -0.28542789816856384,    -0.03830500319600105,  0.48503828048706055,   -0.31700649857521057,   0.05105183646082878,
+    -0.28952258825302124,    -0.985426127910614,    0.5024229884147644,    -0.5206705331802368,    -0.19466042518615723,
+    -0.38412362337112427,    0.2591004967689514,    0.12673577666282654,   0.6762608885765076,     0.17587177455425262,
+    -0.1841416209936142,     0.22541692852973938,   1.20817232131958,      -0.24569736421108246,   -0.6994468569755554,
+    -0.5669529438018799,     -0.7362455129623413,   -0.5301519632339478,   0.11339670419692993,    0.11530347168445587,
+    -0.24492546916007996,    0.045850832015275955,  -0.22100019454956055,  -0.862239420413971,     0.22489240765571594,
+    -0.2716601490974426,     -0.1303860992193222,   -1.334276556968689,    0.1216844841837883,     -0.676578938961029,
+    0.015037178993225098,    0.038085341453552246,  0.4221758544445038,    0.5857324600219727,     -1.6664122343063354,
+    -0.016951249912381172,   -0.07317505776882172,  0.46022871136665344,   -0.1254020780324936,    0.018700750544667244,
+    -0.39486780762672424,    0.21123658120632172,   -0.14491477608680725,  0.1633630096912384,     -0.07348880171775818,
+    -0.1835215836763382,     -0.6972514390945435,   -0.05623277276754379,  -0.3149752616882324,    0.019758371636271477,
+    -0.05467468127608299,    0.1694127917289734,    -0.1301080882549286,   0.1570725440979004,     -0.9264501333236694,
+    5.183340072631836,       -0.03610338643193245,  0.18775303661823273,   -0.7078856229782104,    0.6635328531265259,
+    1.031058430671692,       -0.23737786710262299,  -0.05407315120100975,  0.06765047460794449,    -0.2013958841562271,
+    -0.2235918492078781,     -0.04894530028104782,  0.030390582978725433,  0.017387155443429947,   -0.21568220853805542,
+    -0.17570888996124268,    -0.15851475298404694,  0.23912741243839264,   0.3921298086643219,     -0.032329123467206955,
+    0.5713362693786621,      -0.16534022986888885,  -0.19545075297355652,  0.41481879353523254,    -1.2433135509490967,
+    -0.9249871373176575,     0.6635118722915649,    0.5482897162437439,    0.9235682487487793,     0.6832424402236938,
+    0.06928831338882446,     -0.08402770757675171,  -0.923750638961792,    -0.34495094418525696,   -0.5390321612358093,
+    -0.08749715983867645,    0.18541748821735382,   0.2124786227941513,    -0.4641205668449402,    -0.19995015859603882,
+    -0.3002820611000061,     0.5852490067481995,    -0.2455669492483139,   0.07934477925300598,    0.004667432513087988,
+    -0.6642214059829712,     0.23625463247299194,   -0.1083112582564354,   0.4997052848339081,     -1.499241590499878,
+    -0.03519564867019653,    -0.37923693656921387,  0.2846718430519104,    -0.24866123497486115,   -0.3730790615081787,
+    -0.38254514336586,       0.08496281504631042,   -1.1200028657913208,   0.12322060018777847,    0.42468565702438354,
+    -0.6443961262702942,     -0.36864152550697327,  -1.0760197639465332,   -1.5784653425216675,    -0.5395673513412476,
+    -0.3071078062057495,     1.437305212020874,     1.2172287702560425,    -0.07140827924013138,   0.45021557807922363,
+    0.6869311928749084,      -0.32826903462409973,  0.5925907492637634,    0.6968080401420593,     0.08675269037485123,
+    0.3926256000995636,      -1.060575246810913,    -0.17708392441272736,  -0.5776646733283997,    0.2702156901359558,
+    0.1600416898727417,      0.22597472369670868,   0.12338154017925262,   -0.20924490690231323,   -0.3658841550350189,
+    0.5582997798919678,      -0.056179825216531754, -0.3555351793766022,   -1.899082899093628,     -0.6663432121276855,
+    0.009612532332539558,    -1.3078054189682007,   -1.272124171257019,    -0.49280476570129395,   0.7387033104896545,
+    -0.5249691605567932,     0.072175532579422,     -0.018240628764033318, -1.629947543144226,     -0.07484104484319687,
+    0.01841658540070057,     0.621047854423523,     -0.002753745997324586, -0.28984975814819336,   -1.1016720533370972,
+    0.00410764105618,        0.17939366400241852,   -0.1475742608308792,   -0.12328589707612991,   0.2008814662694931,
+    -1.5311429500579834,     1.6240075826644897,    -0.7926595211029053,   0.5273397564888,        0.8112470507621765,
+    1.4251494407653809,      0.3361791968345642,    -1.050339698791504,    -0.007874582894146442,  -0.03906901925802231,
+    -0.42937612533569336,    0.04332885891199112,   0.12211940437555313,   1.3690001964569092,     -0.0035163185093551874,
+    0.014436250552535057,    -1.3311598300933838,   -0.06383206695318222,  -0.0044150082394480705, -1.295809268951416,
+    -0.9037972688674927,     -0.5171905755996704,   1.953354835510254,     -0.5172408819198608,    -0.6692616939544678,
+    0.5877380967140198,      -0.28285887837409973,  0.20710033178329468,   0.03224611282348633,    -0.6376116871833801,
+    1.4749704599380493,      1.7796794176101685,    -0.3168823719024658,   0.019999999552965164};
 
-    // Sansamp BDDI V1 Clean loss=0.003   Epochs=100
-    NamModel9.levelAdjust = 8.0f;
-    NamModel9.weights = {
-        -0.07428223639726639,   0.5361705422401428,    -0.4401775896549225,   -0.993681013584137,     0.5040351152420044,
-        0.27065470814704895,    0.4614688456058502,    -0.21312259137630463,  -0.21711748838424683,   -0.5853351950645447,
-        0.16161677241325378,    0.10547272861003876,   0.18901540338993073,   -0.5774031281471252,    -0.09321866929531097,
-        -0.07589351385831833,   -0.12869344651699066,  0.3058880567550659,    -0.48546162247657776,   -0.22167544066905975,
-        0.6017120480537415,     0.4956251382827759,    0.025103453546762466,  0.4784192144870758,     -0.31217139959335327,
-        -0.2563987672328949,    0.29991716146469116,   -0.18312160670757294,  0.012579687871038914,   -0.11106159538030624,
-        0.3022170662879944,     0.3865387737751007,    -0.537104070186615,    -0.291903555393219,     -0.31810855865478516,
-        -0.318412721157074,     -0.24280813336372375,  0.3226173222064972,    0.42030346393585205,    0.34398791193962097,
-        -0.1037469282746315,    -0.8372530341148376,   0.19594095647335052,   -1.3449335098266602,    -0.27275609970092773,
-        -0.4884621202945709,    -0.011603856459259987, 0.3643105626106262,    -0.21259286999702454,   -0.5120953321456909,
-        -0.2064160853624344,    0.04251612350344658,   0.033216819167137146,  0.24478194117546082,    0.1796066164970398,
-        -1.2480396032333374,    0.4571903645992279,    0.09867950528860092,   -0.1517760008573532,    -0.09904058277606964,
-        0.010122613050043583,   0.2181938737630844,    -0.4644095003604889,   -0.5707827210426331,    0.5442866683006287,
-        -0.04055523872375488,   0.04348254203796387,   0.20765675604343414,   0.10738728195428848,    0.7471619248390198,
-        -0.46599048376083374,   -0.8238483667373657,   0.6491845846176147,    0.3715021312236786,     0.451272189617157,
-        -0.0892253890633583,    0.29507336020469666,   0.833261251449585,     -0.9282605051994324,    0.16640615463256836,
-        -0.18766702711582184,   0.2665674686431885,    -0.25381335616111755,  -0.19351869821548462,   1.1028224229812622,
-        -0.1502331793308258,    -0.39900317788124084,  -0.10179829597473145,  0.32808834314346313,    -0.43940532207489014,
-        -0.32761144638061523,   -0.38105398416519165,  0.8337113857269287,    0.14154152572155,       -0.5870640277862549,
-        0.0196510162204504,     -0.11466213315725327,  0.25652647018432617,   -0.37252047657966614,   -0.31700611114501953,
-        0.6016473770141602,     -0.003056789981201291, -0.14366205036640167,  -0.035895150154829025,  -0.10098370164632797,
-        0.027764447033405304,   -0.8056663870811462,   -0.6343904137611389,   -0.5697711706161499,    0.7255609035491943,
-        -0.1258385330438614,    0.3805848956108093,    -0.07445235550403595,  -0.4135836064815521,    0.9889198541641235,
-        -0.25315359234809875,   -0.20706747472286224,  0.02375246398150921,   -0.0684763565659523,    -0.08984342217445374,
-        -0.10495501011610031,   0.0032352637499570847, -0.1835576295852661,   0.31389641761779785,    -0.26759395003318787,
-        -0.08868785947561264,   0.13588841259479523,   -0.09909971803426743,  -0.29562586545944214,   -0.7216057181358337,
-        -0.531444787979126,     -0.4061911404132843,   -0.43083107471466064,  0.020100537687540054,   0.22568172216415405,
-        0.31975194811820984,    0.007944900542497635,  0.022843170911073685,  0.3191709816455841,     0.11399038136005402,
-        0.2890992760658264,     0.3566973805427551,    -0.003943911753594875, 0.20107097923755646,    -0.02142232470214367,
-        0.3020328879356384,     0.24945180118083954,   -0.05282580107450485,  -0.050767406821250916,  -0.5055436491966248,
-        -1.1389148235321045,    -0.6273018717765808,   -0.9328107237815857,   -0.7691627144813538,    0.4108177423477173,
-        -0.28636863827705383,   0.6080170273780823,    -1.034875512123108,    0.043697379529476166,   -0.7443228363990784,
-        -0.7933276295661926,    0.04429587349295616,   -0.24172338843345642,  -0.7084991335868835,    0.15258799493312836,
-        0.2970108091831207,     -0.671629011631012,    0.013117028400301933,  -0.018411926925182343,  -0.08843950182199478,
-        0.16529473662376404,    -0.22092826664447784,  -0.13490483164787292,  -0.037056129425764084,  -0.2730925977230072,
-        0.29432082176208496,    -0.08188536763191223,  -0.135422945022583,    0.4788643419742584,     -0.4618157744407654,
-        0.5418865084648132,     -0.004009840544313192, 0.37525174021720886,   -0.15389971435070038,   0.2982892096042633,
-        -0.13315574824810028,   0.030204614624381065,  0.014828191138803959,  -0.535650908946991,     0.03286576271057129,
-        0.2819148004055023,     0.21807855367660522,   -0.01040765829384327,  -0.0325641855597496,    -0.5821632146835327,
-        -0.019930487498641014,  -0.14953255653381348,  0.19221027195453644,   -0.2150401622056961,    0.041500773280858994,
-        0.16519227623939514,    0.4760567247867584,    -0.7157306671142578,   -0.6524088978767395,    0.20339424908161163,
-        0.5995264053344727,     -0.245347797870636,    0.5124877691268921,    -0.024284999817609787,  -0.034529753029346466,
-        -0.2017126977443695,    -0.021888859570026398, 0.01013649720698595,   -0.19406750798225403,   0.07302025705575943,
-        0.3709366023540497,     -0.4887939393520355,   -0.15270370244979858,  0.24572837352752686,    -0.33562204241752625,
-        -0.04214285686612129,   0.4220011234283447,    0.3816524147987366,    -0.1436139941215515,    -0.679099977016449,
-        0.18040764331817627,    -0.3506547808647156,   -0.11733931303024292,  -0.1639997661113739,    -0.19487160444259644,
-        -0.08465716987848282,   -0.16614878177642822,  -0.09474190324544907,  0.4183606505393982,     0.36141276359558105,
-        -0.22444581985473633,   -0.41635146737098694,  -0.5443052053451538,   0.4607004225254059,     -0.1073787659406662,
-        -0.056155867874622345,  0.16062963008880615,   -0.08554132282733917,  -0.02498098462820053,   -0.07235655933618546,
-        -0.0649903416633606,    0.4161231517791748,    -1.0097072124481201,   0.7224265336990356,     0.15872879326343536,
-        -0.3362601697444916,    0.08733096718788147,   0.7015666365623474,    -0.24385222792625427,   -0.2899159789085388,
-        -0.22283753752708435,   -0.41631412506103516,  0.20103442668914795,   0.5639655590057373,     -0.3357893228530884,
-        -0.31442347168922424,   0.1370433270931244,    0.20834769308567047,   0.37025025486946106,    0.19628429412841797,
-        0.011730263009667397,   -0.1961880624294281,   0.3603694438934326,    0.4708237648010254,     0.1971709281206131,
-        -0.396721214056015,     -0.18975262343883514,  -0.6029514074325562,   0.18799471855163574,    -0.03534693270921707,
-        -0.27472570538520813,   0.11369067430496216,   -0.4621341824531555,   -0.3721367120742798,    0.15528304874897003,
-        0.027888387441635132,   -0.4322352409362793,   -0.7104746103286743,   0.31643128395080566,    0.11534854769706726,
-        0.504393994808197,      -0.10606935620307922,  0.36691853404045105,   -0.10651960223913193,   -0.014047468081116676,
-        -0.6441861987113953,    0.25937214493751526,   0.001766897039487958,  -0.030960379168391228,  -0.08792870491743088,
-        -0.46336570382118225,   0.1411239504814148,    0.01693105697631836,   -0.024158410727977753,  -0.02012772671878338,
-        -0.488506942987442,     0.1608385592699051,    -0.3666180670261383,   0.436788946390152,      -0.1331666111946106,
-        -0.11368106305599213,   -0.3254759609699249,   0.11639915406703949,   0.19091854989528656,    -0.04079850763082504,
-        -0.4871445298194885,    0.02399120107293129,   0.035278595983982086,  0.32050424814224243,    -0.3293459117412567,
-        0.2815322279930115,     -0.3342527449131012,   0.1308862417936325,    0.005057783797383308,   -0.20903949439525604,
-        -0.05132545903325081,   -0.12713617086410522,  0.04826907813549042,   0.008590147830545902,   0.24464412033557892,
-        0.23028169572353363,    0.19297605752944946,   0.007430114783346653,  0.36293739080429077,    -0.243394672870636,
-        -0.40608182549476624,   -0.3875596225261688,   0.1977357566356659,    -0.0014057524967938662, -0.5751609802246094,
-        0.2834725081920624,     0.351168692111969,     0.7202690839767456,    0.658423662185669,      0.6665032505989075,
-        -0.006355835124850273,  -0.3657218813896179,   -0.04964504763484001,  -0.10297247022390366,   -0.31493157148361206,
-        0.5072610378265381,     0.5746340751647949,    0.12911948561668396,   -0.44192367792129517,   0.11815539002418518,
-        -0.383012592792511,     -0.016106896102428436, -0.09237732738256454,  0.19452008605003357,    0.006560890935361385,
-        0.0027275222819298506,  -0.7890745401382446,   0.4576944410800934,    -1.7839546203613281,    0.7874680161476135,
-        -0.44523435831069946,   -0.37401050329208374,  -0.25758227705955505,  0.40759751200675964,    0.045622602105140686,
-        0.49077534675598145,    0.5472063422203064,    -0.6083946824073792,   -0.09052202105522156,   0.10964596271514893,
-        -0.2651746869087219,    0.502630889415741,     -0.08620814979076385,  -0.08874618262052536,   -0.3027849495410919,
-        -0.21258938312530518,   0.02930402383208275,   -0.006833826657384634, 0.6674760580062866,     -0.059942033141851425,
-        0.6312546133995056,     0.06914345175027847,   0.25887081027030945,   0.6206352710723877,     0.04530211538076401,
-        0.5736048221588135,     -0.059472352266311646, 0.2636570334434509,    0.1454354226589203,     -0.1285480409860611,
-        -0.0010303114540874958, -0.004942124243825674, -0.8053663372993469,   0.02846703864634037,    -0.06930719316005707,
-        -0.47340208292007446,   0.22108611464500427,   0.047206174582242966,  0.14493654668331146,    0.03248044475913048,
-        0.3681478798389435,     0.4074654281139374,    -0.4417368471622467,   1.0427671670913696,     0.25118497014045715,
-        -0.4448242783546448,    0.21375824511051178,   0.47312015295028687,   -0.3997417688369751,    -0.08505988866090775,
-        -0.024532515555620193,  -0.3001963198184967,   -0.06625310331583023,  0.34157127141952515,    -0.625533938407898,
-        -0.24968528747558594,   0.12478100508451462,   -0.19105733931064606,  0.06619510799646378,    0.3308810889720917,
-        -0.14045681059360504,   -0.21675725281238556,  -0.04819890856742859,  0.2968429923057556,     0.8984353542327881,
-        -0.3508625030517578,    -0.15181055665016174,  -0.2940239906311035,   0.1424524039030075,     0.0718713328242302,
-        -0.6759563088417053,    0.2254391461610794,    0.15997456014156342,   -0.05200541391968727,   0.05688982084393501,
-        -0.15713757276535034,   -0.13352824747562408,  -0.16112090647220612,  0.10683981329202652,    -0.4571095407009125,
-        -0.3997173607349396,    -0.3885703980922699,   -0.2644728422164917,   0.6312426924705505,     -0.6692616939544678,
-        0.587738037109375,      -0.28285887837409973,  0.20710033178329468,   0.03224613144993782,    -0.6376116871833801,
-        0.7629627585411072,     0.4983873665332794,    0.717919647693634,     0.019999999552965164};
+// Sansamp BDDI V1 Clean loss=0.003   Epochs=100
+constexpr float NamModel9[] = {
+    -0.07428223639726639,   0.5361705422401428,    -0.4401775896549225,   -0.993681013584137,     0.5040351152420044,
+    0.27065470814704895,    0.4614688456058502,    -0.21312259137630463,  -0.21711748838424683,   -0.5853351950645447,
+    0.16161677241325378,    0.10547272861003876,   0.18901540338993073,   -0.5774031281471252,    -0.09321866929531097,
+    -0.07589351385831833,   -0.12869344651699066,  0.3058880567550659,    -0.48546162247657776,   -0.22167544066905975,
+    0.6017120480537415,     0.4956251382827759,    0.025103453546762466,  0.4784192144870758,     -0.31217139959335327,
+    -0.2563987672328949,    0.29991716146469116,   -0.18312160670757294,  0.012579687871038914,   -0.11106159538030624,
+    0.3022170662879944,     0.3865387737751007,    -0.537104070186615,    -0.291903555393219,     -0.31810855865478516,
+    -0.318412721157074,     -0.24280813336372375,  0.3226173222064972,    0.42030346393585205,    0.34398791193962097,
+    -0.1037469282746315,    -0.8372530341148376,   0.19594095647335052,   -1.3449335098266602,    -0.27275609970092773,
+    -0.4884621202945709,    -0.011603856459259987, 0.3643105626106262,    -0.21259286999702454,   -0.5120953321456909,
+    -0.2064160853624344,    0.04251612350344658,   0.033216819167137146,  0.24478194117546082,    0.1796066164970398,
+    -1.2480396032333374,    0.4571903645992279,    0.09867950528860092,   -0.1517760008573532,    -0.09904058277606964,
+    0.010122613050043583,   0.2181938737630844,    -0.4644095003604889,   -0.5707827210426331,    0.5442866683006287,
+    -0.04055523872375488,   0.04348254203796387,   0.20765675604343414,   0.10738728195428848,    0.7471619248390198,
+    -0.46599048376083374,   -0.8238483667373657,   0.6491845846176147,    0.3715021312236786,     0.451272189617157,
+    -0.0892253890633583,    0.29507336020469666,   0.833261251449585,     -0.9282605051994324,    0.16640615463256836,
+    -0.18766702711582184,   0.2665674686431885,    -0.25381335616111755,  -0.19351869821548462,   1.1028224229812622,
+    -0.1502331793308258,    -0.39900317788124084,  -0.10179829597473145,  0.32808834314346313,    -0.43940532207489014,
+    -0.32761144638061523,   -0.38105398416519165,  0.8337113857269287,    0.14154152572155,       -0.5870640277862549,
+    0.0196510162204504,     -0.11466213315725327,  0.25652647018432617,   -0.37252047657966614,   -0.31700611114501953,
+    0.6016473770141602,     -0.003056789981201291, -0.14366205036640167,  -0.035895150154829025,  -0.10098370164632797,
+    0.027764447033405304,   -0.8056663870811462,   -0.6343904137611389,   -0.5697711706161499,    0.7255609035491943,
+    -0.1258385330438614,    0.3805848956108093,    -0.07445235550403595,  -0.4135836064815521,    0.9889198541641235,
+    -0.25315359234809875,   -0.20706747472286224,  0.02375246398150921,   -0.0684763565659523,    -0.08984342217445374,
+    -0.10495501011610031,   0.0032352637499570847, -0.1835576295852661,   0.31389641761779785,    -0.26759395003318787,
+    -0.08868785947561264,   0.13588841259479523,   -0.09909971803426743,  -0.29562586545944214,   -0.7216057181358337,
+    -0.531444787979126,     -0.4061911404132843,   -0.43083107471466064,  0.020100537687540054,   0.22568172216415405,
+    0.31975194811820984,    0.007944900542497635,  0.022843170911073685,  0.3191709816455841,     0.11399038136005402,
+    0.2890992760658264,     0.3566973805427551,    -0.003943911753594875, 0.20107097923755646,    -0.02142232470214367,
+    0.3020328879356384,     0.24945180118083954,   -0.05282580107450485,  -0.050767406821250916,  -0.5055436491966248,
+    -1.1389148235321045,    -0.6273018717765808,   -0.9328107237815857,   -0.7691627144813538,    0.4108177423477173,
+    -0.28636863827705383,   0.6080170273780823,    -1.034875512123108,    0.043697379529476166,   -0.7443228363990784,
+    -0.7933276295661926,    0.04429587349295616,   -0.24172338843345642,  -0.7084991335868835,    0.15258799493312836,
+    0.2970108091831207,     -0.671629011631012,    0.013117028400301933,  -0.018411926925182343,  -0.08843950182199478,
+    0.16529473662376404,    -0.22092826664447784,  -0.13490483164787292,  -0.037056129425764084,  -0.2730925977230072,
+    0.29432082176208496,    -0.08188536763191223,  -0.135422945022583,    0.4788643419742584,     -0.4618157744407654,
+    0.5418865084648132,     -0.004009840544313192, 0.37525174021720886,   -0.15389971435070038,   0.2982892096042633,
+    -0.13315574824810028,   0.030204614624381065,  0.014828191138803959,  -0.535650908946991,     0.03286576271057129,
+    0.2819148004055023,     0.21807855367660522,   -0.01040765829384327,  -0.0325641855597496,    -0.5821632146835327,
+    -0.019930487498641014,  -0.14953255653381348,  0.19221027195453644,   -0.2150401622056961,    0.041500773280858994,
+    0.16519227623939514,    0.4760567247867584,    -0.7157306671142578,   -0.6524088978767395,    0.20339424908161163,
+    0.5995264053344727,     -0.245347797870636,    0.5124877691268921,    -0.024284999817609787,  -0.034529753029346466,
+    -0.2017126977443695,    -0.021888859570026398, 0.01013649720698595,   -0.19406750798225403,   0.07302025705575943,
+    0.3709366023540497,     -0.4887939393520355,   -0.15270370244979858,  0.24572837352752686,    -0.33562204241752625,
+    -0.04214285686612129,   0.4220011234283447,    0.3816524147987366,    -0.1436139941215515,    -0.679099977016449,
+    0.18040764331817627,    -0.3506547808647156,   -0.11733931303024292,  -0.1639997661113739,    -0.19487160444259644,
+    -0.08465716987848282,   -0.16614878177642822,  -0.09474190324544907,  0.4183606505393982,     0.36141276359558105,
+    -0.22444581985473633,   -0.41635146737098694,  -0.5443052053451538,   0.4607004225254059,     -0.1073787659406662,
+    -0.056155867874622345,  0.16062963008880615,   -0.08554132282733917,  -0.02498098462820053,   -0.07235655933618546,
+    -0.0649903416633606,    0.4161231517791748,    -1.0097072124481201,   0.7224265336990356,     0.15872879326343536,
+    -0.3362601697444916,    0.08733096718788147,   0.7015666365623474,    -0.24385222792625427,   -0.2899159789085388,
+    -0.22283753752708435,   -0.41631412506103516,  0.20103442668914795,   0.5639655590057373,     -0.3357893228530884,
+    -0.31442347168922424,   0.1370433270931244,    0.20834769308567047,   0.37025025486946106,    0.19628429412841797,
+    0.011730263009667397,   -0.1961880624294281,   0.3603694438934326,    0.4708237648010254,     0.1971709281206131,
+    -0.396721214056015,     -0.18975262343883514,  -0.6029514074325562,   0.18799471855163574,    -0.03534693270921707,
+    -0.27472570538520813,   0.11369067430496216,   -0.4621341824531555,   -0.3721367120742798,    0.15528304874897003,
+    0.027888387441635132,   -0.4322352409362793,   -0.7104746103286743,   0.31643128395080566,    0.11534854769706726,
+    0.504393994808197,      -0.10606935620307922,  0.36691853404045105,   -0.10651960223913193,   -0.014047468081116676,
+    -0.6441861987113953,    0.25937214493751526,   0.001766897039487958,  -0.030960379168391228,  -0.08792870491743088,
+    -0.46336570382118225,   0.1411239504814148,    0.01693105697631836,   -0.024158410727977753,  -0.02012772671878338,
+    -0.488506942987442,     0.1608385592699051,    -0.3666180670261383,   0.436788946390152,      -0.1331666111946106,
+    -0.11368106305599213,   -0.3254759609699249,   0.11639915406703949,   0.19091854989528656,    -0.04079850763082504,
+    -0.4871445298194885,    0.02399120107293129,   0.035278595983982086,  0.32050424814224243,    -0.3293459117412567,
+    0.2815322279930115,     -0.3342527449131012,   0.1308862417936325,    0.005057783797383308,   -0.20903949439525604,
+    -0.05132545903325081,   -0.12713617086410522,  0.04826907813549042,   0.008590147830545902,   0.24464412033557892,
+    0.23028169572353363,    0.19297605752944946,   0.007430114783346653,  0.36293739080429077,    -0.243394672870636,
+    -0.40608182549476624,   -0.3875596225261688,   0.1977357566356659,    -0.0014057524967938662, -0.5751609802246094,
+    0.2834725081920624,     0.351168692111969,     0.7202690839767456,    0.658423662185669,      0.6665032505989075,
+    -0.006355835124850273,  -0.3657218813896179,   -0.04964504763484001,  -0.10297247022390366,   -0.31493157148361206,
+    0.5072610378265381,     0.5746340751647949,    0.12911948561668396,   -0.44192367792129517,   0.11815539002418518,
+    -0.383012592792511,     -0.016106896102428436, -0.09237732738256454,  0.19452008605003357,    0.006560890935361385,
+    0.0027275222819298506,  -0.7890745401382446,   0.4576944410800934,    -1.7839546203613281,    0.7874680161476135,
+    -0.44523435831069946,   -0.37401050329208374,  -0.25758227705955505,  0.40759751200675964,    0.045622602105140686,
+    0.49077534675598145,    0.5472063422203064,    -0.6083946824073792,   -0.09052202105522156,   0.10964596271514893,
+    -0.2651746869087219,    0.502630889415741,     -0.08620814979076385,  -0.08874618262052536,   -0.3027849495410919,
+    -0.21258938312530518,   0.02930402383208275,   -0.006833826657384634, 0.6674760580062866,     -0.059942033141851425,
+    0.6312546133995056,     0.06914345175027847,   0.25887081027030945,   0.6206352710723877,     0.04530211538076401,
+    0.5736048221588135,     -0.059472352266311646, 0.2636570334434509,    0.1454354226589203,     -0.1285480409860611,
+    -0.0010303114540874958, -0.004942124243825674, -0.8053663372993469,   0.02846703864634037,    -0.06930719316005707,
+    -0.47340208292007446,   0.22108611464500427,   0.047206174582242966,  0.14493654668331146,    0.03248044475913048,
+    0.3681478798389435,     0.4074654281139374,    -0.4417368471622467,   1.0427671670913696,     0.25118497014045715,
+    -0.4448242783546448,    0.21375824511051178,   0.47312015295028687,   -0.3997417688369751,    -0.08505988866090775,
+    -0.024532515555620193,  -0.3001963198184967,   -0.06625310331583023,  0.34157127141952515,    -0.625533938407898,
+    -0.24968528747558594,   0.12478100508451462,   -0.19105733931064606,  0.06619510799646378,    0.3308810889720917,
+    -0.14045681059360504,   -0.21675725281238556,  -0.04819890856742859,  0.2968429923057556,     0.8984353542327881,
+    -0.3508625030517578,    -0.15181055665016174,  -0.2940239906311035,   0.1424524039030075,     0.0718713328242302,
+    -0.6759563088417053,    0.2254391461610794,    0.15997456014156342,   -0.05200541391968727,   0.05688982084393501,
+    -0.15713757276535034,   -0.13352824747562408,  -0.16112090647220612,  0.10683981329202652,    -0.4571095407009125,
+    -0.3997173607349396,    -0.3885703980922699,   -0.2644728422164917,   0.6312426924705505,     -0.6692616939544678,
+    0.587738037109375,      -0.28285887837409973,  0.20710033178329468,   0.03224613144993782,    -0.6376116871833801,
+    0.7629627585411072,     0.4983873665332794,    0.717919647693634,     0.019999999552965164};
 
-    // Friedman BE-100 (11) [Thanks brianbuckles!] loss=0.033   Epochs=300
-    // https://www.tone3000.com/tones/friedman-be-100-29391
-    // 11 Friedman BE-100 BE C45 P7B3M5T5G7.nam
-    NamModel10.weights = {
-        -0.07817695289850235,   0.7157977223396301,      -0.15838435292243958,    -0.7834149599075317,    -0.000994115136563778,
-        -0.02695056051015854,   0.5424638390541077,      0.11172795295715332,     0.38895824551582336,    -0.27872636914253235,
-        -0.38620975613594055,   -0.6186843514442444,     -0.1252366453409195,     -0.09398357570171356,   -0.11028195172548294,
-        -0.06922123581171036,   0.17624886333942413,     0.768626868724823,       -0.510353147983551,     0.1768898069858551,
-        0.295562744140625,      0.7088932394981384,      0.08304374665021896,     0.46620485186576843,    0.8470261693000793,
-        0.37307557463645935,    0.42933377623558044,     -0.7358261942863464,     -0.1916044056415558,    0.11822876334190369,
-        -0.5155805945396423,    -0.12837888300418854,    0.22539103031158447,     -0.06633809953927994,   -0.062115851789712906,
-        -0.8649882674217224,    0.05497882887721062,     0.28605198860168457,     0.5360815525054932,     0.022079013288021088,
-        -0.6045073866844177,    -0.28410568833351135,    0.2679591476917267,      -0.6311888098716736,    -0.37545058131217957,
-        -0.344370573759079,     -0.640130877494812,      0.32035934925079346,     0.12180235236883163,    0.9590368866920471,
-        0.34526216983795166,    -0.09561346471309662,    0.7295026183128357,      -0.32121938467025757,   -0.2472243458032608,
-        -0.4850994944572449,    0.1713356375694275,      0.20361711084842682,     -0.12663987278938293,   -0.05742679536342621,
-        0.35421666502952576,    0.31302282214164734,     -1.1381374597549438,     1.0489680767059326,     0.26636064052581787,
-        -0.1253829002380371,    0.12245693057775497,     0.06447715312242508,     0.8140496611595154,     0.09982676059007645,
-        -0.7465706467628479,    -0.999912440776825,      0.692363977432251,       0.19566017389297485,    0.31972643733024597,
-        0.2533458173274994,     -0.2241806983947754,     -0.7776590585708618,     0.6547247171401978,     -0.288023978471756,
-        0.07338644564151764,    0.1415916383266449,      -0.2883676588535309,     -0.9568542242050171,    -0.3567361533641815,
-        -0.5473814010620117,    -0.12674415111541748,    -1.044877052307129,      0.40601322054862976,    -0.260407954454422,
-        -0.0010421487968415022, 1.7469600439071655,      0.06809075176715851,     0.6609832644462585,     -0.5278687477111816,
-        0.3960590958595276,     -0.11921998113393784,    -1.444858193397522,      -0.159067764878273,     -0.18651485443115234,
-        0.6023486256599426,     -0.16576792299747467,    -0.15437915921211243,    0.2751834988594055,     -0.6662603616714478,
-        0.5124492049217224,     -2.9028987884521484,     0.6334432363510132,      -0.18101097643375397,   1.9175206422805786,
-        0.04907726123929024,    0.3492071330547333,      -0.2630702257156372,     0.20165075361728668,    0.14910632371902466,
-        0.459856778383255,      -0.31691527366638184,    0.08336873352527618,     0.21395176649093628,    0.2491425722837448,
-        1.520457148551941,      -0.28555652499198914,    -0.040035590529441833,   1.2004996538162231,     -0.14049458503723145,
-        0.2594815194606781,     0.5419241189956665,      -0.4706254303455353,     -1.0296995639801025,    0.7452036738395691,
-        -0.6662648320198059,    0.8076003193855286,      -0.14029967784881592,    -0.029563862830400467,  0.5224649310112,
-        -0.04566112905740738,   -0.3940717577934265,     -0.7728886604309082,     0.7045696973800659,     0.1297644078731537,
-        0.9788025617599487,     -0.2506479024887085,     -0.49738809466362,       -0.10948865860700607,   -0.11486232280731201,
-        0.1976601779460907,     0.30208921432495117,     0.23778584599494934,     0.4202624559402466,     -0.15992310643196106,
-        -0.6737210154533386,    -0.3577280044555664,     -0.21537752449512482,    -0.04936371371150017,   0.5783149003982544,
-        -0.4740477204322815,    0.4266200065612793,      -0.28834468126296997,    -0.158578023314476,     0.009964062832295895,
-        -0.32166150212287903,   0.11628621071577072,     -0.08195151388645172,    -0.4022025465965271,    -0.004136355128139257,
-        0.2386845499277115,     -0.6207923889160156,     0.006433676462620497,    -0.2154451161623001,    0.09279608726501465,
-        -0.1233755350112915,    -0.923562228679657,      0.32547298073768616,     0.011211412027478218,   -0.1635391116142273,
-        0.00537174241617322,    -0.08987446874380112,    -0.6085630655288696,     1.011724591255188,      0.22428765892982483,
-        0.2936120629310608,     -0.08970950543880463,    0.7733898758888245,      -0.055712565779685974,  0.2710596024990082,
-        0.022776653990149498,   0.22548377513885498,     -0.4933828115463257,     -0.5447299480438232,    -0.13225984573364258,
-        0.3323211669921875,     -1.6668482203385793e-05, -0.04994586110115051,    0.13126088678836823,    -0.07715175300836563,
-        0.038559433072805405,   -0.06620652973651886,    0.11367791146039963,     -0.00568503700196743,   -0.024989336729049683,
-        -1.2377153635025024,    1.6060105562210083,      -0.035348501056432724,   -0.43583622574806213,   0.16967107355594635,
-        0.8774704933166504,     -0.22122672200202942,    0.3062079846858978,      -0.0002483967982698232, -0.02284293621778488,
-        1.0187404155731201,     -0.0013183432165533304,  -0.00018086889758706093, -0.5070119500160217,    0.00347444717772305,
-        -0.02522985450923443,   -0.4179399609565735,     -0.003356627421453595,   0.017687639221549034,   -1.5234055519104004,
-        0.04219506308436394,    0.7870474457740784,      -0.9574131965637207,     -0.8951737284660339,    -0.42565134167671204,
-        1.0823832750320435,     0.40168526768684387,     -0.018496565520763397,   -0.1501086801290512,    -0.2774917185306549,
-        -0.013846931979060173,  0.0778253898024559,      0.059641290456056595,    0.766284167766571,      0.6076551675796509,
-        -0.567253828048706,     -0.14854252338409424,    -0.6573917269706726,     -0.6546130776405334,    0.13956128060817719,
-        0.620173990726471,      -0.09856674820184708,    0.08695366978645325,     -0.05293511599302292,   -0.0946197658777237,
-        -0.5685763359069824,    0.4807130992412567,      -0.8664171099662781,     2.0151126384735107,     0.19669398665428162,
-        -0.23763464391231537,   -0.18184149265289307,    -0.4198479950428009,     0.3732399642467499,     -0.36836159229278564,
-        -0.442812442779541,     -0.7663752436637878,     -0.8080130219459534,     -1.1163188219070435,    -0.18376219272613525,
-        -0.33519479632377625,   0.1211753636598587,      -0.4899649918079376,     -0.7558971047401428,    0.7030168771743774,
-        0.16101090610027313,    -0.7203140258789062,     2.2424142360687256,      1.0073635578155518,     -0.7530048489570618,
-        -1.4122544527053833,    -1.4356637001037598,     -0.34245699644088745,    0.09820506721735,       -0.34910356998443604,
-        0.15981851518154144,    0.46967658400535583,     -0.1342034488916397,     -0.013667906634509563,  0.369517058134079,
-        0.5499237179756165,     0.3703189194202423,      -0.9394347071647644,     0.26043930649757385,    -0.16461177170276642,
-        -0.14725221693515778,   -0.020753316581249237,   -0.03860223665833473,    -0.03770775347948074,   0.476895272731781,
-        -0.8254811763763428,    0.3637276291847229,      -0.6325265765190125,     1.2952944040298462,     0.42033401131629944,
-        -0.4064403176307678,    -1.4377100467681885,     0.48698216676712036,     -0.18491128087043762,   -0.6416193842887878,
-        -1.3613306283950806,    -0.15593954920768738,    0.7711644768714905,      1.121580719947815,      -0.4659675061702728,
-        0.5533149838447571,     0.49582651257514954,     1.4612641334533691,      0.019922366365790367,   -0.09961795806884766,
-        -0.8963264226913452,    -0.7727547883987427,     0.8115096092224121,      -1.2924456596374512,    0.7617528438568115,
-        0.5251389145851135,     0.031493667513132095,    -0.308960497379303,      0.1612289696931839,     0.17427176237106323,
-        -0.5425058007240295,    0.08490630239248276,     -0.3745858073234558,     0.5793855786323547,     0.05324304848909378,
-        0.09540964663028717,    -0.17412088811397552,    0.01640537567436695,     0.03730558604001999,    -0.14163163304328918,
-        0.19564677774906158,    0.016393158584833145,    1.2875713109970093,      0.060543619096279144,   -0.28616562485694885,
-        3.1750192642211914,     0.30706050992012024,     2.4550859928131104,      0.6412503123283386,     0.3964386284351349,
-        0.03146805614233017,    0.49307534098625183,     -0.13248206675052643,    0.14867003262043,       0.3930499851703644,
-        -0.14260247349739075,   0.2667887508869171,      0.8250752687454224,      -1.3642683029174805,    0.3760565519332886,
-        -0.23010212182998657,   0.9431852698326111,      -0.35516759753227234,    -0.11654824018478394,   -0.23861433565616608,
-        1.8795857429504395,     0.509786069393158,       0.1124647781252861,      1.4051449298858643,     -0.3160592019557953,
-        -0.21517638862133026,   -0.35497888922691345,    0.047195933759212494,    0.18405264616012573,    -0.08802896738052368,
-        0.06350991874933243,    0.14272858202457428,     -0.047527819871902466,   0.0928945317864418,     0.32853686809539795,
-        0.03385898098349571,    0.07414218038320541,     0.09887731820344925,     -0.23180867731571198,   0.12090504169464111,
-        -0.48005834221839905,   0.26689136028289795,     -2.141871929168701,      2.0965049266815186,     1.1476080417633057,
-        2.7513222694396973,     -0.8541063070297241,     0.18709632754325867,     0.5979262590408325,     -0.025901228189468384,
-        -0.08677949756383896,   0.08836852759122849,     -0.030669189989566803,   -0.34205886721611023,   0.11835766583681107,
-        -0.11005742102861404,   -0.27936431765556335,    0.23323509097099304,     -0.09901725500822067,   -0.06707614660263062,
-        0.28963884711265564,    0.1992616504430771,      -0.12527261674404144,    0.15743900835514069,    0.5859094858169556,
-        -0.17124781012535095,   -1.4289140701293945,     -0.10405462980270386,    -0.252022922039032,     0.11215800791978836,
-        -0.6291318535804749,    0.04915864020586014,     -0.1801331788301468,     0.004316677805036306,   0.03554834797978401,
-        -0.12619104981422424,   0.09922406822443008,     0.13882803916931152,     -0.05489722639322281,   0.10437272489070892,
-        0.1114591658115387,     -0.0734996348619461,     0.9544532895088196,      0.16472046077251434,    -0.8739557862281799,
-        0.437492311000824,      -8.26181411743164,       1.6243253946304321,      0.7135139107704163,     0.26799309253692627,
-        -0.31004178524017334,   -0.6279886960983276,     -0.3817604184150696,     0.014208042062819004,   -0.0002987505286000669,
-        -0.19919992983341217,   0.009500319138169289,    0.05800395831465721,     1.688582420349121,      0.0137960035353899,
-        -0.059444572776556015,  0.19472554326057434,     0.005556271877139807,    -0.006144409999251366,  0.2169761210680008,
-        -0.10991451144218445,   -0.20390520989894867,    2.320981502532959,       -0.9909382462501526,    -0.6692616939544678,
-        0.5877380967140198,     -0.28285887837409973,    0.20710033178329468,     0.03224611282348633,    -0.6376116871833801,
-        1.6891554594039917,     1.4297676086425781,      1.0472970008850098,      0.019999999552965164};
+// Friedman BE-100 (11) [Thanks brianbuckles!] loss=0.033   Epochs=300
+// https://www.tone3000.com/tones/friedman-be-100-29391
+// 11 Friedman BE-100 BE C45 P7B3M5T5G7.nam
+constexpr float NamModel10[] = {
+    -0.07817695289850235,   0.7157977223396301,      -0.15838435292243958,    -0.7834149599075317,    -0.000994115136563778,
+    -0.02695056051015854,   0.5424638390541077,      0.11172795295715332,     0.38895824551582336,    -0.27872636914253235,
+    -0.38620975613594055,   -0.6186843514442444,     -0.1252366453409195,     -0.09398357570171356,   -0.11028195172548294,
+    -0.06922123581171036,   0.17624886333942413,     0.768626868724823,       -0.510353147983551,     0.1768898069858551,
+    0.295562744140625,      0.7088932394981384,      0.08304374665021896,     0.46620485186576843,    0.8470261693000793,
+    0.37307557463645935,    0.42933377623558044,     -0.7358261942863464,     -0.1916044056415558,    0.11822876334190369,
+    -0.5155805945396423,    -0.12837888300418854,    0.22539103031158447,     -0.06633809953927994,   -0.062115851789712906,
+    -0.8649882674217224,    0.05497882887721062,     0.28605198860168457,     0.5360815525054932,     0.022079013288021088,
+    -0.6045073866844177,    -0.28410568833351135,    0.2679591476917267,      -0.6311888098716736,    -0.37545058131217957,
+    -0.344370573759079,     -0.640130877494812,      0.32035934925079346,     0.12180235236883163,    0.9590368866920471,
+    0.34526216983795166,    -0.09561346471309662,    0.7295026183128357,      -0.32121938467025757,   -0.2472243458032608,
+    -0.4850994944572449,    0.1713356375694275,      0.20361711084842682,     -0.12663987278938293,   -0.05742679536342621,
+    0.35421666502952576,    0.31302282214164734,     -1.1381374597549438,     1.0489680767059326,     0.26636064052581787,
+    -0.1253829002380371,    0.12245693057775497,     0.06447715312242508,     0.8140496611595154,     0.09982676059007645,
+    -0.7465706467628479,    -0.999912440776825,      0.692363977432251,       0.19566017389297485,    0.31972643733024597,
+    0.2533458173274994,     -0.2241806983947754,     -0.7776590585708618,     0.6547247171401978,     -0.288023978471756,
+    0.07338644564151764,    0.1415916383266449,      -0.2883676588535309,     -0.9568542242050171,    -0.3567361533641815,
+    -0.5473814010620117,    -0.12674415111541748,    -1.044877052307129,      0.40601322054862976,    -0.260407954454422,
+    -0.0010421487968415022, 1.7469600439071655,      0.06809075176715851,     0.6609832644462585,     -0.5278687477111816,
+    0.3960590958595276,     -0.11921998113393784,    -1.444858193397522,      -0.159067764878273,     -0.18651485443115234,
+    0.6023486256599426,     -0.16576792299747467,    -0.15437915921211243,    0.2751834988594055,     -0.6662603616714478,
+    0.5124492049217224,     -2.9028987884521484,     0.6334432363510132,      -0.18101097643375397,   1.9175206422805786,
+    0.04907726123929024,    0.3492071330547333,      -0.2630702257156372,     0.20165075361728668,    0.14910632371902466,
+    0.459856778383255,      -0.31691527366638184,    0.08336873352527618,     0.21395176649093628,    0.2491425722837448,
+    1.520457148551941,      -0.28555652499198914,    -0.040035590529441833,   1.2004996538162231,     -0.14049458503723145,
+    0.2594815194606781,     0.5419241189956665,      -0.4706254303455353,     -1.0296995639801025,    0.7452036738395691,
+    -0.6662648320198059,    0.8076003193855286,      -0.14029967784881592,    -0.029563862830400467,  0.5224649310112,
+    -0.04566112905740738,   -0.3940717577934265,     -0.7728886604309082,     0.7045696973800659,     0.1297644078731537,
+    0.9788025617599487,     -0.2506479024887085,     -0.49738809466362,       -0.10948865860700607,   -0.11486232280731201,
+    0.1976601779460907,     0.30208921432495117,     0.23778584599494934,     0.4202624559402466,     -0.15992310643196106,
+    -0.6737210154533386,    -0.3577280044555664,     -0.21537752449512482,    -0.04936371371150017,   0.5783149003982544,
+    -0.4740477204322815,    0.4266200065612793,      -0.28834468126296997,    -0.158578023314476,     0.009964062832295895,
+    -0.32166150212287903,   0.11628621071577072,     -0.08195151388645172,    -0.4022025465965271,    -0.004136355128139257,
+    0.2386845499277115,     -0.6207923889160156,     0.006433676462620497,    -0.2154451161623001,    0.09279608726501465,
+    -0.1233755350112915,    -0.923562228679657,      0.32547298073768616,     0.011211412027478218,   -0.1635391116142273,
+    0.00537174241617322,    -0.08987446874380112,    -0.6085630655288696,     1.011724591255188,      0.22428765892982483,
+    0.2936120629310608,     -0.08970950543880463,    0.7733898758888245,      -0.055712565779685974,  0.2710596024990082,
+    0.022776653990149498,   0.22548377513885498,     -0.4933828115463257,     -0.5447299480438232,    -0.13225984573364258,
+    0.3323211669921875,     -1.6668482203385793e-05, -0.04994586110115051,    0.13126088678836823,    -0.07715175300836563,
+    0.038559433072805405,   -0.06620652973651886,    0.11367791146039963,     -0.00568503700196743,   -0.024989336729049683,
+    -1.2377153635025024,    1.6060105562210083,      -0.035348501056432724,   -0.43583622574806213,   0.16967107355594635,
+    0.8774704933166504,     -0.22122672200202942,    0.3062079846858978,      -0.0002483967982698232, -0.02284293621778488,
+    1.0187404155731201,     -0.0013183432165533304,  -0.00018086889758706093, -0.5070119500160217,    0.00347444717772305,
+    -0.02522985450923443,   -0.4179399609565735,     -0.003356627421453595,   0.017687639221549034,   -1.5234055519104004,
+    0.04219506308436394,    0.7870474457740784,      -0.9574131965637207,     -0.8951737284660339,    -0.42565134167671204,
+    1.0823832750320435,     0.40168526768684387,     -0.018496565520763397,   -0.1501086801290512,    -0.2774917185306549,
+    -0.013846931979060173,  0.0778253898024559,      0.059641290456056595,    0.766284167766571,      0.6076551675796509,
+    -0.567253828048706,     -0.14854252338409424,    -0.6573917269706726,     -0.6546130776405334,    0.13956128060817719,
+    0.620173990726471,      -0.09856674820184708,    0.08695366978645325,     -0.05293511599302292,   -0.0946197658777237,
+    -0.5685763359069824,    0.4807130992412567,      -0.8664171099662781,     2.0151126384735107,     0.19669398665428162,
+    -0.23763464391231537,   -0.18184149265289307,    -0.4198479950428009,     0.3732399642467499,     -0.36836159229278564,
+    -0.442812442779541,     -0.7663752436637878,     -0.8080130219459534,     -1.1163188219070435,    -0.18376219272613525,
+    -0.33519479632377625,   0.1211753636598587,      -0.4899649918079376,     -0.7558971047401428,    0.7030168771743774,
+    0.16101090610027313,    -0.7203140258789062,     2.2424142360687256,      1.0073635578155518,     -0.7530048489570618,
+    -1.4122544527053833,    -1.4356637001037598,     -0.34245699644088745,    0.09820506721735,       -0.34910356998443604,
+    0.15981851518154144,    0.46967658400535583,     -0.1342034488916397,     -0.013667906634509563,  0.369517058134079,
+    0.5499237179756165,     0.3703189194202423,      -0.9394347071647644,     0.26043930649757385,    -0.16461177170276642,
+    -0.14725221693515778,   -0.020753316581249237,   -0.03860223665833473,    -0.03770775347948074,   0.476895272731781,
+    -0.8254811763763428,    0.3637276291847229,      -0.6325265765190125,     1.2952944040298462,     0.42033401131629944,
+    -0.4064403176307678,    -1.4377100467681885,     0.48698216676712036,     -0.18491128087043762,   -0.6416193842887878,
+    -1.3613306283950806,    -0.15593954920768738,    0.7711644768714905,      1.121580719947815,      -0.4659675061702728,
+    0.5533149838447571,     0.49582651257514954,     1.4612641334533691,      0.019922366365790367,   -0.09961795806884766,
+    -0.8963264226913452,    -0.7727547883987427,     0.8115096092224121,      -1.2924456596374512,    0.7617528438568115,
+    0.5251389145851135,     0.031493667513132095,    -0.308960497379303,      0.1612289696931839,     0.17427176237106323,
+    -0.5425058007240295,    0.08490630239248276,     -0.3745858073234558,     0.5793855786323547,     0.05324304848909378,
+    0.09540964663028717,    -0.17412088811397552,    0.01640537567436695,     0.03730558604001999,    -0.14163163304328918,
+    0.19564677774906158,    0.016393158584833145,    1.2875713109970093,      0.060543619096279144,   -0.28616562485694885,
+    3.1750192642211914,     0.30706050992012024,     2.4550859928131104,      0.6412503123283386,     0.3964386284351349,
+    0.03146805614233017,    0.49307534098625183,     -0.13248206675052643,    0.14867003262043,       0.3930499851703644,
+    -0.14260247349739075,   0.2667887508869171,      0.8250752687454224,      -1.3642683029174805,    0.3760565519332886,
+    -0.23010212182998657,   0.9431852698326111,      -0.35516759753227234,    -0.11654824018478394,   -0.23861433565616608,
+    1.8795857429504395,     0.509786069393158,       0.1124647781252861,      1.4051449298858643,     -0.3160592019557953,
+    -0.21517638862133026,   -0.35497888922691345,    0.047195933759212494,    0.18405264616012573,    -0.08802896738052368,
+    0.06350991874933243,    0.14272858202457428,     -0.047527819871902466,   0.0928945317864418,     0.32853686809539795,
+    0.03385898098349571,    0.07414218038320541,     0.09887731820344925,     -0.23180867731571198,   0.12090504169464111,
+    -0.48005834221839905,   0.26689136028289795,     -2.141871929168701,      2.0965049266815186,     1.1476080417633057,
+    2.7513222694396973,     -0.8541063070297241,     0.18709632754325867,     0.5979262590408325,     -0.025901228189468384,
+    -0.08677949756383896,   0.08836852759122849,     -0.030669189989566803,   -0.34205886721611023,   0.11835766583681107,
+    -0.11005742102861404,   -0.27936431765556335,    0.23323509097099304,     -0.09901725500822067,   -0.06707614660263062,
+    0.28963884711265564,    0.1992616504430771,      -0.12527261674404144,    0.15743900835514069,    0.5859094858169556,
+    -0.17124781012535095,   -1.4289140701293945,     -0.10405462980270386,    -0.252022922039032,     0.11215800791978836,
+    -0.6291318535804749,    0.04915864020586014,     -0.1801331788301468,     0.004316677805036306,   0.03554834797978401,
+    -0.12619104981422424,   0.09922406822443008,     0.13882803916931152,     -0.05489722639322281,   0.10437272489070892,
+    0.1114591658115387,     -0.0734996348619461,     0.9544532895088196,      0.16472046077251434,    -0.8739557862281799,
+    0.437492311000824,      -8.26181411743164,       1.6243253946304321,      0.7135139107704163,     0.26799309253692627,
+    -0.31004178524017334,   -0.6279886960983276,     -0.3817604184150696,     0.014208042062819004,   -0.0002987505286000669,
+    -0.19919992983341217,   0.009500319138169289,    0.05800395831465721,     1.688582420349121,      0.0137960035353899,
+    -0.059444572776556015,  0.19472554326057434,     0.005556271877139807,    -0.006144409999251366,  0.2169761210680008,
+    -0.10991451144218445,   -0.20390520989894867,    2.320981502532959,       -0.9909382462501526,    -0.6692616939544678,
+    0.5877380967140198,     -0.28285887837409973,    0.20710033178329468,     0.03224611282348633,    -0.6376116871833801,
+    1.6891554594039917,     1.4297676086425781,      1.0472970008850098,      0.019999999552965164};
 
-    // ADD YOUR MODEL IDENTIFIER HERE ////////////////////////////////// < -------------------------
-    model_collection_nam = {
-        NamModel1, NamModel2, NamModel3, NamModel4, NamModel5, NamModel6, NamModel7, NamModel8, NamModel9, NamModel10,
-    };
-}
\ No newline at end of file
+// ADD YOUR MODEL IDENTIFIER HERE ////////////////////////////////// < -------------------------
+constexpr modelDataNam model_collection_nam[] = {
+    {NamModel1}, {NamModel2}, {NamModel3}, {NamModel4}, {NamModel5}, {NamModel6}, {NamModel7}, {NamModel8}, {NamModel9, 8.0f},
+    {NamModel10},
+};
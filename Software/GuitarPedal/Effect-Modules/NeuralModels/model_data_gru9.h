@@ -1,55 +1,46 @@
+// Model weights for the Amp module, stored as constant tables so they stay in flash instead of being copied to the heap
+// at startup. The GRU has a hidden size of 9, the gate weights of the three gates are stored side by side.
+
+constexpr int kGruHiddenSize = 9;
+
 struct modelData {
-    std::vector<std::vector<float>> rec_weight_ih_l0;
-    std::vector<std::vector<float>> rec_weight_hh_l0;
-    std::vector<std::vector<float>> lin_weight;
-    std::vector<float> lin_bias;
-    std::vector<std::vector<float>> rec_bias;
+    float rec_weight_ih_l0[1][3 * kGruHiddenSize];
+    float rec_weight_hh_l0[kGruHiddenSize][3 * kGruHiddenSize];
+    float lin_weight[1][kGruHiddenSize];
+    float lin_bias[1];
+    float rec_bias[2][3 * kGruHiddenSize];
     float levelAdjust;
 };
 
-// ADD YOUR MODEL IDENTIFIER HERE ////////////////////////////////// < -------------------
-modelData Model1;
-modelData Model2;
-modelData Model3;
-modelData Model4;
-modelData Model5;
-modelData Model6;
-modelData Model7;
-
-/////////////////////////////////////////////////////////////////
-
-std::vector<modelData> model_collection;
-
 /*========================================================================*/
 
-void setupWeights() {
-
-    // COPY AND PASTE YOUR MODEL WEIGHTS BELOW (After converting .json to .h file) ////////////////////////////////// <
-    // -------------------
-    //   ADD AND REMOVE MODELS AS DESIRED (CAN HOLD AROUND 15-16 MODELS IN FLASH MEMORY)
-
-    //========================================================================
-    //../newNeuralSeedModel fender57_g5_gru9_p003_shift16 maybe keep
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model1.rec_weight_ih_l0 = {{0.010945625603199005, -0.050199560821056366, -0.06624435633420944,   -0.1976807862520218,
-                                0.1158326119184494,   -0.06330181658267975,  -0.0030009972397238016, 0.010331690311431885,
-                                0.04662841558456421,  0.050783343613147736,  -0.14239542186260223,   -0.146307110786438,
-                                -0.0151847954839468,  0.025679081678390503,  -0.1442670226097107,    0.06651495397090912,
-                                0.1271495223045349,   0.13272543251514435,   -0.43817561864852905,   -1.1551047563552856,
-                                -0.03793826326727867, 0.8241645097732544,    0.842648446559906,      0.8103972673416138,
-                                -0.01621781662106514, -1.3673923015594482,   0.8390907645225525}};
-
-    Model1.rec_weight_hh_l0 = {
+// COPY AND PASTE YOUR MODEL WEIGHTS BELOW (After converting .json to .h file) ////////////////////////////////// <
+// -------------------
+//   ADD AND REMOVE MODELS AS DESIRED (CAN HOLD AROUND 15-16 MODELS IN FLASH MEMORY)
+
+//========================================================================
+//../newNeuralSeedModel fender57_g5_gru9_p003_shift16 maybe keep
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model1 = {
+    .rec_weight_ih_l0 = {{0.010945625603199005, -0.050199560821056366, -0.06624435633420944,   -0.1976807862520218,
+                         0.1158326119184494,   -0.06330181658267975,  -0.0030009972397238016, 0.010331690311431885,
+                         0.04662841558456421,  0.050783343613147736,  -0.14239542186260223,   -0.146307110786438,
+                         -0.0151847954839468,  0.025679081678390503,  -0.1442670226097107,    0.06651495397090912,
+                         0.1271495223045349,   0.13272543251514435,   -0.43817561864852905,   -1.1551047563552856,
+                         -0.03793826326727867, 0.8241645097732544,    0.842648446559906,      0.8103972673416138,
+                         -0.01621781662106514, -1.3673923015594482,   0.8390907645225525}},
+
+    .rec_weight_hh_l0 = {
         {0.2660585641860962,   -0.06399577111005783, 0.1198706179857254,   0.11052851378917694,   0.20094873011112213,
          -0.2052612602710724,  -0.21146216988563538, -0.12754301726818085, 0.32190588116645813,   0.14035136997699738,
          -0.07555074989795685, 0.21440546214580536,  0.41187435388565063,  0.0024969112128019333, 0.29178300499916077,
@@ -103,49 +94,51 @@ void setupWeights() {
          0.16545747220516205,  -0.6271731853485107,  -0.22290657460689545, -0.18057112395763397, -0.12936334311962128,
          -0.7296581268310547,  0.45515164732933044,  -0.04487355053424835, -0.45728376507759094, -0.19084632396697998,
          -0.2084663063287735,  -0.26941245794296265, 0.0866464152932167,   0.9208748936653137,   0.08087804168462753,
-         0.8704594373703003,   1.3329368829727173}};
-
-    Model1.lin_weight = {{-0.15525458753108978, 0.5315423607826233, 0.8522182703018188, 0.022386819124221802, 0.19309879839420319,
-                          -0.518962562084198, 0.580614447593689, 0.37257859110832214, 0.5456886887550354}};
-
-    Model1.lin_bias = {0.06967336684465408};
-
-    Model1.rec_bias = {{1.1973379850387573,   -0.44106385111808777, -0.13644300401210785, -0.3490041494369507,   1.3261643648147583,
-                        -0.380979061126709,   0.19212310016155243,  -0.24578654766082764, 1.454893708229065,     0.34279128909111023,
-                        0.30362242460250854,  0.3117355704307556,   0.5360283255577087,   -0.018552329391241074, 0.3106920123100281,
-                        0.0398116409778595,   -0.0714878961443901,  0.07045018672943115,  -0.3137598931789398,   0.06450533866882324,
-                        0.0797731876373291,   0.0582866370677948,   -0.14376848936080933, 0.27043846249580383,   -0.21152986586093903,
-                        -0.28778964281082153, 0.2651936709880829},
-                       {1.1973379850387573,  -0.44106385111808777,  -0.13644300401210785, -0.3490041494369507,   1.3261642456054688,
-                        -0.380979061126709,  0.19212310016155243,   -0.24578654766082764, 1.454893708229065,     0.3406675457954407,
-                        0.30381959676742554, 0.311753511428833,     0.536015510559082,    -0.017991140484809875, 0.3106525242328644,
-                        0.03981161117553711, -0.07112261652946472,  0.07591364532709122,  0.4408111870288849,    0.13189712166786194,
-                        0.2187042236328125,  -0.040134504437446594, 0.08460792899131775,  -0.19480018317699432,  -0.1755005568265915,
-                        0.04271353408694267, -0.5428429841995239}};
-    Model1.levelAdjust = 0.9;
-
-    //========================================================================
-    //../newNeuralSeedModel matchless_gru9_p02_shift51   keep (sounds better than the ac30 model)
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model2.rec_weight_ih_l0 = {{-0.029231837019324303, -0.3149751126766205, -0.5631013512611389,  0.6397935748100281,
-                                -0.03381464630365372,  0.639824390411377,   -0.22903455793857574, 0.15575867891311646,
-                                -0.30347883701324463,  0.08316066116094589, 0.4032779335975647,   -0.10985194146633148,
-                                -0.0464772954583168,   0.06623080372810364, 0.3327423632144928,   0.5125880837440491,
-                                0.5497733354568481,    1.3290865421295166,  -0.4052441120147705,  -0.297264963388443,
-                                0.5754965543746948,    0.44692426919937134, -0.6242079734802246,  0.815628170967102,
-                                -0.20662333071231842,  -1.0047993659973145, -1.3757998943328857}};
-
-    Model2.rec_weight_hh_l0 = {
+         0.8704594373703003,   1.3329368829727173}},
+
+    .lin_weight = {{-0.15525458753108978, 0.5315423607826233, 0.8522182703018188, 0.022386819124221802, 0.19309879839420319,
+                   -0.518962562084198, 0.580614447593689, 0.37257859110832214, 0.5456886887550354}},
+
+    .lin_bias = {0.06967336684465408},
+
+    .rec_bias = {{1.1973379850387573,   -0.44106385111808777, -0.13644300401210785, -0.3490041494369507,   1.3261643648147583,
+                 -0.380979061126709,   0.19212310016155243,  -0.24578654766082764, 1.454893708229065,     0.34279128909111023,
+                 0.30362242460250854,  0.3117355704307556,   0.5360283255577087,   -0.018552329391241074, 0.3106920123100281,
+                 0.0398116409778595,   -0.0714878961443901,  0.07045018672943115,  -0.3137598931789398,   0.06450533866882324,
+                 0.0797731876373291,   0.0582866370677948,   -0.14376848936080933, 0.27043846249580383,   -0.21152986586093903,
+                 -0.28778964281082153, 0.2651936709880829},
+                {1.1973379850387573,  -0.44106385111808777,  -0.13644300401210785, -0.3490041494369507,   1.3261642456054688,
+                 -0.380979061126709,  0.19212310016155243,   -0.24578654766082764, 1.454893708229065,     0.3406675457954407,
+                 0.30381959676742554, 0.311753511428833,     0.536015510559082,    -0.017991140484809875, 0.3106525242328644,
+                 0.03981161117553711, -0.07112261652946472,  0.07591364532709122,  0.4408111870288849,    0.13189712166786194,
+                 0.2187042236328125,  -0.040134504437446594, 0.08460792899131775,  -0.19480018317699432,  -0.1755005568265915,
+                 0.04271353408694267, -0.5428429841995239}},
+    .levelAdjust = 0.9,
+};
+
+//========================================================================
+//../newNeuralSeedModel matchless_gru9_p02_shift51   keep (sounds better than the ac30 model)
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model2 = {
+    .rec_weight_ih_l0 = {{-0.029231837019324303, -0.3149751126766205, -0.5631013512611389,  0.6397935748100281,
+                         -0.03381464630365372,  0.639824390411377,   -0.22903455793857574, 0.15575867891311646,
+                         -0.30347883701324463,  0.08316066116094589, 0.4032779335975647,   -0.10985194146633148,
+                         -0.0464772954583168,   0.06623080372810364, 0.3327423632144928,   0.5125880837440491,
+                         0.5497733354568481,    1.3290865421295166,  -0.4052441120147705,  -0.297264963388443,
+                         0.5754965543746948,    0.44692426919937134, -0.6242079734802246,  0.815628170967102,
+                         -0.20662333071231842,  -1.0047993659973145, -1.3757998943328857}},
+
+    .rec_weight_hh_l0 = {
         {0.1051379069685936,   0.12829001247882843,  0.2898087501525879,   -0.16671307384967804, -0.036237336695194244,
          0.21648991107940674,  -0.533916711807251,   -0.22937588393688202, -0.2554420232772827,  0.4378296136856079,
          0.7202093005180359,   -0.34362006187438965, -0.03987767547369003, 0.24171796441078186,  0.3179763853549957,
@@ -199,49 +192,51 @@ void setupWeights() {
          0.08641715347766876,  -0.2782328128814697,  -0.8476051688194275,  -0.21279795467853546, 0.09541693329811096,
          -0.24904178082942963, -1.1415947675704956,  -1.593221664428711,   -0.3557261824607849,  -1.6010098457336426,
          -0.6294101476669312,  0.6125853657722473,   -0.07568871974945068, -0.8783455491065979,  0.256775826215744,
-         -0.7667081952095032,  1.3150516748428345}};
-
-    Model2.lin_weight = {{1.3266512155532837, 0.34957095980644226, 0.501087486743927, 0.21891072392463684, 1.2271435260772705,
-                          0.43608468770980835, 1.0895591974258423, 0.7009875774383545, 0.630840003490448}};
-
-    Model2.lin_bias = {-0.3153194189071655};
-
-    Model2.rec_bias = {{1.6665621995925903,   0.11900100111961365,  1.0300720930099487,  -0.6648464798927307,   1.8063621520996094,
-                        0.2966279089450836,   0.14621761441230774,  -0.6517598628997803, -0.8084750175476074,   0.24817079305648804,
-                        0.30441635847091675,  0.1947382092475891,   0.5575229525566101,  -0.010426747612655163, 0.30423736572265625,
-                        0.30738455057144165,  0.3932950794696808,   0.4195604920387268,  -0.09829548001289368,  -0.046609267592430115,
-                        -0.05279914289712906, -0.10833795368671417, -0.0716700553894043, -0.12667514383792877,  -0.16283537447452545,
-                        0.5098429918289185,   0.7824194431304932},
-                       {1.6665621995925903,   0.11900100111961365, 1.0300720930099487,  -0.6648464798927307,   1.8063621520996094,
-                        0.2966279089450836,   0.14621761441230774, -0.6517598628997803, -0.8084750175476074,   0.24812166392803192,
-                        0.30441638827323914,  0.1947382092475891,  0.5575229525566101,  -0.010421093553304672, 0.30423736572265625,
-                        0.30738455057144165,  0.3932950794696808,  0.41956254839897156, 0.3314102292060852,    -0.14917393028736115,
-                        -0.06163574755191803, 0.43613073229789734, 0.15843312442302704, 0.34317588806152344,   0.2971913814544678,
-                        -0.6883634328842163,  -1.0945156812667847}};
-    Model2.levelAdjust = 0.9;
-
-    //========================================================================
-    //../newNeuralSeedModel klonBB_g5_gru9_p0047  keep
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model3.rec_weight_ih_l0 = {{0.10444662719964981,  -0.2509694993495941,   -0.18859492242336273,  0.12905894219875336,
-                                -0.0213624257594347,  -0.016602396965026855, -0.029290301725268364, -0.05750759690999985,
-                                0.1664680391550064,   -0.016206733882427216, 0.4715864360332489,    -0.31052863597869873,
-                                0.49569058418273926,  -0.05896488204598427,  -0.48247647285461426,  -0.17611847817897797,
-                                0.29290953278541565,  -0.05502455681562424,  -0.7477683424949646,   -0.7449806928634644,
-                                -0.08731792122125626, -0.3478814959526062,   0.1061646044254303,    0.34091150760650635,
-                                0.49752071499824524,  -1.4278879165649414,   -0.04526274651288986}};
-
-    Model3.rec_weight_hh_l0 = {
+         -0.7667081952095032,  1.3150516748428345}},
+
+    .lin_weight = {{1.3266512155532837, 0.34957095980644226, 0.501087486743927, 0.21891072392463684, 1.2271435260772705,
+                   0.43608468770980835, 1.0895591974258423, 0.7009875774383545, 0.630840003490448}},
+
+    .lin_bias = {-0.3153194189071655},
+
+    .rec_bias = {{1.6665621995925903,   0.11900100111961365,  1.0300720930099487,  -0.6648464798927307,   1.8063621520996094,
+                 0.2966279089450836,   0.14621761441230774,  -0.6517598628997803, -0.8084750175476074,   0.24817079305648804,
+                 0.30441635847091675,  0.1947382092475891,   0.5575229525566101,  -0.010426747612655163, 0.30423736572265625,
+                 0.30738455057144165,  0.3932950794696808,   0.4195604920387268,  -0.09829548001289368,  -0.046609267592430115,
+                 -0.05279914289712906, -0.10833795368671417, -0.0716700553894043, -0.12667514383792877,  -0.16283537447452545,
+                 0.5098429918289185,   0.7824194431304932},
+                {1.6665621995925903,   0.11900100111961365, 1.0300720930099487,  -0.6648464798927307,   1.8063621520996094,
+                 0.2966279089450836,   0.14621761441230774, -0.6517598628997803, -0.8084750175476074,   0.24812166392803192,
+                 0.30441638827323914,  0.1947382092475891,  0.5575229525566101,  -0.010421093553304672, 0.30423736572265625,
+                 0.30738455057144165,  0.3932950794696808,  0.41956254839897156, 0.3314102292060852,    -0.14917393028736115,
+                 -0.06163574755191803, 0.43613073229789734, 0.15843312442302704, 0.34317588806152344,   0.2971913814544678,
+                 -0.6883634328842163,  -1.0945156812667847}},
+    .levelAdjust = 0.9,
+};
+
+//========================================================================
+//../newNeuralSeedModel klonBB_g5_gru9_p0047  keep
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model3 = {
+    .rec_weight_ih_l0 = {{0.10444662719964981,  -0.2509694993495941,   -0.18859492242336273,  0.12905894219875336,
+                         -0.0213624257594347,  -0.016602396965026855, -0.029290301725268364, -0.05750759690999985,
+                         0.1664680391550064,   -0.016206733882427216, 0.4715864360332489,    -0.31052863597869873,
+                         0.49569058418273926,  -0.05896488204598427,  -0.48247647285461426,  -0.17611847817897797,
+                         0.29290953278541565,  -0.05502455681562424,  -0.7477683424949646,   -0.7449806928634644,
+                         -0.08731792122125626, -0.3478814959526062,   0.1061646044254303,    0.34091150760650635,
+                         0.49752071499824524,  -1.4278879165649414,   -0.04526274651288986}},
+
+    .rec_weight_hh_l0 = {
         {0.11525661498308182,   0.6589143872261047,   0.16308119893074036,  -0.44736701250076294, -0.03189338743686676,
          -0.1479557305574417,   0.18253415822982788,  -0.08080007135868073, -0.9788373112678528,  -0.3142144978046417,
          -0.09491956979036331,  -0.05581255629658699, 0.016370652243494987, -0.11913515627384186, 1.1204142570495605,
@@ -295,48 +290,50 @@ void setupWeights() {
          0.2694636285305023,  -0.17081515491008759, -0.04263731464743614, -0.16356860101222992, -0.10777611285448074,
          -0.4365864098072052, -0.05461650714278221, -0.5749713182449341,  -0.27074748277664185, -0.06198790296912193,
          -0.973074734210968,  0.13153722882270813,  0.40570488572120667,  1.3750284910202026,   0.15387660264968872,
-         0.4259757101535797,  1.1943823099136353}};
-
-    Model3.lin_weight = {{0.06555154174566269, 0.585723340511322, 1.1993820667266846, -0.01910593919456005, -0.3254941701889038,
-                          -0.18385043740272522, 0.26696881651878357, 0.7222235202789307, 0.28651198744773865}};
-
-    Model3.lin_bias = {-0.31255820393562317};
-
-    Model3.rec_bias = {{-0.28041866421699524,  1.2571043968200684,    0.6403751373291016,  0.08690151572227478, 1.4934308528900146,
-                        -0.35028815269470215,  -0.49143001437187195,  -0.4895656108856201, 1.1014631986618042,  0.4520479738712311,
-                        -0.022474439814686775, -0.048601340502500534, 0.366519957780838,   0.3722822368144989,  0.2166307419538498,
-                        0.5753155946731567,    0.15795785188674927,   0.36920756101608276, -0.8323541283607483, -0.03967277333140373,
-                        -0.1421913504600525,   0.18015331029891968,   -0.2311353236436844, 0.4627038240432739,  -0.18875837326049805,
-                        -0.40674322843551636,  0.16267065703868866},
-                       {-0.28041866421699524,  1.2571043968200684,   0.6403751373291016,   0.08690151572227478,  1.4934287071228027,
-                        -0.35028815269470215,  -0.49143001437187195, -0.4895656108856201,  1.1014631986618042,   0.4475357234477997,
-                        -0.021434111520648003, -0.04855117201805115, 0.3662669360637665,   0.3732965588569641,   0.21644414961338043,
-                        0.5753154754638672,    0.15866373479366302,  0.37739455699920654,  -0.13255757093429565, -0.004366916138678789,
-                        -0.009892309084534645, 0.05774591863155365,  0.024283472448587418, 0.0388004370033741,   -0.1363939493894577,
-                        -0.03807279095053673,  -0.8816646337509155}};
-    Model3.levelAdjust = 0.6;
-    //========================================================================
-    //../newNeuralSeedModel messa iic eq original p0128 shift 183 instead of 182  lowest noise, sounds good
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model4.rec_weight_ih_l0 = {{0.2814430296421051,   -0.10601122677326202, -0.04945099353790283, 0.07485648989677429,
-                                -0.6961054801940918,  -0.4910812973976135,  -0.2718484401702881,  -0.01627524197101593,
-                                -0.0374501496553421,  0.3474334478378296,   0.2117074728012085,   0.2299647480249405,
-                                -0.33109351992607117, 0.08094002306461334,  0.7625245451927185,   -1.2907862663269043,
-                                -0.20513100922107697, -0.10652125626802444, 0.13559933006763458,  -0.2833845913410187,
-                                -0.12616285681724548, 0.9066472053527832,   0.014374015852808952, 2.100292682647705,
-                                -0.8516016006469727,  0.06624177098274231,  0.3447319567203522}};
-
-    Model4.rec_weight_hh_l0 = {
+         0.4259757101535797,  1.1943823099136353}},
+
+    .lin_weight = {{0.06555154174566269, 0.585723340511322, 1.1993820667266846, -0.01910593919456005, -0.3254941701889038,
+                   -0.18385043740272522, 0.26696881651878357, 0.7222235202789307, 0.28651198744773865}},
+
+    .lin_bias = {-0.31255820393562317},
+
+    .rec_bias = {{-0.28041866421699524,  1.2571043968200684,    0.6403751373291016,  0.08690151572227478, 1.4934308528900146,
+                 -0.35028815269470215,  -0.49143001437187195,  -0.4895656108856201, 1.1014631986618042,  0.4520479738712311,
+                 -0.022474439814686775, -0.048601340502500534, 0.366519957780838,   0.3722822368144989,  0.2166307419538498,
+                 0.5753155946731567,    0.15795785188674927,   0.36920756101608276, -0.8323541283607483, -0.03967277333140373,
+                 -0.1421913504600525,   0.18015331029891968,   -0.2311353236436844, 0.4627038240432739,  -0.18875837326049805,
+                 -0.40674322843551636,  0.16267065703868866},
+                {-0.28041866421699524,  1.2571043968200684,   0.6403751373291016,   0.08690151572227478,  1.4934287071228027,
+                 -0.35028815269470215,  -0.49143001437187195, -0.4895656108856201,  1.1014631986618042,   0.4475357234477997,
+                 -0.021434111520648003, -0.04855117201805115, 0.3662669360637665,   0.3732965588569641,   0.21644414961338043,
+                 0.5753154754638672,    0.15866373479366302,  0.37739455699920654,  -0.13255757093429565, -0.004366916138678789,
+                 -0.009892309084534645, 0.05774591863155365,  0.024283472448587418, 0.0388004370033741,   -0.1363939493894577,
+                 -0.03807279095053673,  -0.8816646337509155}},
+    .levelAdjust = 0.6,
+};
+//========================================================================
+//../newNeuralSeedModel messa iic eq original p0128 shift 183 instead of 182  lowest noise, sounds good
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model4 = {
+    .rec_weight_ih_l0 = {{0.2814430296421051,   -0.10601122677326202, -0.04945099353790283, 0.07485648989677429,
+                         -0.6961054801940918,  -0.4910812973976135,  -0.2718484401702881,  -0.01627524197101593,
+                         -0.0374501496553421,  0.3474334478378296,   0.2117074728012085,   0.2299647480249405,
+                         -0.33109351992607117, 0.08094002306461334,  0.7625245451927185,   -1.2907862663269043,
+                         -0.20513100922107697, -0.10652125626802444, 0.13559933006763458,  -0.2833845913410187,
+                         -0.12616285681724548, 0.9066472053527832,   0.014374015852808952, 2.100292682647705,
+                         -0.8516016006469727,  0.06624177098274231,  0.3447319567203522}},
+
+    .rec_weight_hh_l0 = {
         {-0.4776725172996521,  0.1264982968568802,   0.061123594641685486, 0.17677165567874908,  0.3383761942386627,
          0.1352197676897049,   -0.01300827693194151, -0.2117326408624649,  -0.1239427775144577,  -0.5578879117965698,
          -0.2872251570224762,  0.014583979733288288, 0.0511850081384182,   -0.36074841022491455, 0.012815308757126331,
@@ -390,49 +387,51 @@ void setupWeights() {
          0.1398843377828598,    -0.08113209903240204, 0.2720661163330078,    -0.1036592572927475,  0.041199710220098495,
          -0.003946354147046804, -0.15092526376247406, 0.17666849493980408,   -0.5239841938018799,  0.048218898475170135,
          0.45783737301826477,   0.21446239948272705,  0.18674954771995544,   -0.10356154292821884, -0.18619294464588165,
-         0.5749920010566711,    1.1640300750732422}};
-
-    Model4.lin_weight = {{0.559700608253479, 0.05602197349071503, 0.037872590124607086, -0.5296688079833984, 0.040486838668584824,
-                          -0.345439612865448, 0.6072275638580322, -1.1746656894683838, -1.3116488456726074}};
-
-    Model4.lin_bias = {-0.009952176362276077};
-
-    Model4.rec_bias = {{1.4544556140899658,   0.3116452097892761,  0.2023361623287201,   -0.7783133387565613,  0.1474064290523529,
-                        -0.37509268522262573, 1.2265702486038208,  1.5453016757965088,   1.5517385005950928,   -0.0994311198592186,
-                        0.7627780437469482,   0.6167539358139038,  0.4681053161621094,   0.8334406614303589,   0.31196537613868713,
-                        -0.9086094498634338,  0.4087037742137909,  0.3023912012577057,   -0.04329086095094681, -1.0118701457977295,
-                        0.10204429924488068,  0.6014783382415771,  -0.31283214688301086, 0.016538623720407486, -0.1563028246164322,
-                        -0.05946138873696327, -0.03175334632396698},
-                       {1.4544686079025269,   0.3116452097892761,  0.2023361623287201, -0.7783133387565613, 0.1474064290523529,
-                        -0.37509268522262573, 1.2265706062316895,  1.5453016757965088, 1.5517358779907227,  -0.09944087266921997,
-                        0.7628083825111389,   0.6167539358139038,  0.4681053161621094, 0.8334406614303589,  0.31196537613868713,
-                        -0.9086100459098816,  0.4087037742137909,  0.3023912012577057, -0.1834275722503662, 1.4153164625167847,
-                        -0.03216709941625595, -0.6119195222854614, 0.3455105423927307, 0.4000234603881836,  -0.5442468523979187,
-                        0.027705200016498566, 0.006273994687944651}};
-    Model4.levelAdjust = 0.6;
-
-    //========================================================================
-    //../newNeuralSeedModel bassman_g25_gru9_p0072_shift29  keep
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model5.rec_weight_ih_l0 = {{-0.0552828311920166,  -0.030351951718330383, -0.15669558942317963,  -0.015707779675722122,
-                                0.1726430356502533,   0.02735975757241249,   0.10895262658596039,   -0.05913861468434334,
-                                0.058854252099990845, -0.06770405173301697,  -0.13166548311710358,  -0.0541447214782238,
-                                -0.2306060492992401,  0.06153033301234245,   -0.030178779736161232, 0.36140143871307373,
-                                -0.02121734619140625, 0.08116284012794495,   0.37203648686408997,   0.47551172971725464,
-                                -0.11820589005947113, -0.5386384725570679,   -0.40045833587646484,  2.2536823749542236,
-                                0.7497175335884094,   -0.2842807173728943,   -0.7832939624786377}};
-
-    Model5.rec_weight_hh_l0 = {
+         0.5749920010566711,    1.1640300750732422}},
+
+    .lin_weight = {{0.559700608253479, 0.05602197349071503, 0.037872590124607086, -0.5296688079833984, 0.040486838668584824,
+                   -0.345439612865448, 0.6072275638580322, -1.1746656894683838, -1.3116488456726074}},
+
+    .lin_bias = {-0.009952176362276077},
+
+    .rec_bias = {{1.4544556140899658,   0.3116452097892761,  0.2023361623287201,   -0.7783133387565613,  0.1474064290523529,
+                 -0.37509268522262573, 1.2265702486038208,  1.5453016757965088,   1.5517385005950928,   -0.0994311198592186,
+                 0.7627780437469482,   0.6167539358139038,  0.4681053161621094,   0.8334406614303589,   0.31196537613868713,
+                 -0.9086094498634338,  0.4087037742137909,  0.3023912012577057,   -0.04329086095094681, -1.0118701457977295,
+                 0.10204429924488068,  0.6014783382415771,  -0.31283214688301086, 0.016538623720407486, -0.1563028246164322,
+                 -0.05946138873696327, -0.03175334632396698},
+                {1.4544686079025269,   0.3116452097892761,  0.2023361623287201, -0.7783133387565613, 0.1474064290523529,
+                 -0.37509268522262573, 1.2265706062316895,  1.5453016757965088, 1.5517358779907227,  -0.09944087266921997,
+                 0.7628083825111389,   0.6167539358139038,  0.4681053161621094, 0.8334406614303589,  0.31196537613868713,
+                 -0.9086100459098816,  0.4087037742137909,  0.3023912012577057, -0.1834275722503662, 1.4153164625167847,
+                 -0.03216709941625595, -0.6119195222854614, 0.3455105423927307, 0.4000234603881836,  -0.5442468523979187,
+                 0.027705200016498566, 0.006273994687944651}},
+    .levelAdjust = 0.6,
+};
+
+//========================================================================
+//../newNeuralSeedModel bassman_g25_gru9_p0072_shift29  keep
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model5 = {
+    .rec_weight_ih_l0 = {{-0.0552828311920166,  -0.030351951718330383, -0.15669558942317963,  -0.015707779675722122,
+                         0.1726430356502533,   0.02735975757241249,   0.10895262658596039,   -0.05913861468434334,
+                         0.058854252099990845, -0.06770405173301697,  -0.13166548311710358,  -0.0541447214782238,
+                         -0.2306060492992401,  0.06153033301234245,   -0.030178779736161232, 0.36140143871307373,
+                         -0.02121734619140625, 0.08116284012794495,   0.37203648686408997,   0.47551172971725464,
+                         -0.11820589005947113, -0.5386384725570679,   -0.40045833587646484,  2.2536823749542236,
+                         0.7497175335884094,   -0.2842807173728943,   -0.7832939624786377}},
+
+    .rec_weight_hh_l0 = {
         {0.15995670855045319, -0.14914067089557648, -0.2789002060890198,  -0.002169999061152339, 0.3963034451007843,
          0.04536328464746475, 0.06132527440786362,  -0.30639609694480896, -0.021007409319281578, -0.036907680332660675,
          0.06018674373626709, -0.2205009162425995,  0.39237722754478455,  0.07671437412500381,   -0.02492983639240265,
@@ -486,49 +485,51 @@ void setupWeights() {
          -0.13642166554927826, 0.4358243942260742,  -0.11376588046550751,  0.053209174424409866, -0.05504632368683815,
          -0.3834777772426605,  -1.2233458757400513, -0.30505573749542236,  0.3453841507434845,   0.3678337335586548,
          -0.45556241273880005, 0.45243704319000244, -0.05878376588225365,  -1.026667833328247,   0.7402567863464355,
-         -0.7902718186378479,  0.5626970529556274}};
-
-    Model5.lin_weight = {{-0.35878172516822815, -0.35143688321113586, 0.0438566580414772, 0.09557642787694931, 0.35244128108024597,
-                          -0.5041103959083557, 0.6719605922698975, 1.4568132162094116, 0.5651177763938904}};
-
-    Model5.lin_bias = {-0.39557117223739624};
-
-    Model5.rec_bias = {{1.4791090488433838,   0.8872252106666565,   1.255505084991455,    -0.6273059844970703,  2.0530476570129395,
-                        -0.8202617764472961,  -0.6621493101119995,  -0.2523471713066101,  -0.0486859567463398,  0.15896804630756378,
-                        0.14054542779922485,  0.10158023238182068,  0.6378490924835205,   0.16620376706123352,  0.3358059227466583,
-                        0.22175993025302887,  0.23002469539642334,  0.4394044876098633,   -0.23089683055877686, 0.027949901297688484,
-                        0.007241227198392153, 0.015315423719584942, -0.04764167219400406, -0.10548243671655655, -0.11819690465927124,
-                        0.08399385958909988,  0.3320634663105011},
-                       {1.4791090488433838,   0.8872252106666565,  1.255505084991455,   -0.6273059844970703, 2.0530476570129395,
-                        -0.8202617764472961,  -0.6621493101119995, -0.2523471713066101, -0.0486859567463398, 0.15723247826099396,
-                        0.1405564695596695,   0.10158234089612961, 0.6378490924835205,  0.16658557951450348, 0.3358058035373688,
-                        0.22175993025302887,  0.23002585768699646, 0.4395991861820221,  0.5436006784439087,  -0.1353028416633606,
-                        0.10029082000255585,  0.18212758004665375, 0.10946966707706451, 0.13357312977313995, 0.030321570113301277,
-                        -0.07347753643989563, -0.41494783759117126}};
-    Model5.levelAdjust = 0.8;
-
-    //========================================================================
-    //../newNeuralSeedModel 5150_g5_gru9_p005_shift26
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model6.rec_weight_ih_l0 = {{-0.10029491037130356,  0.39539408683776855,  -0.003912642132490873, 0.15781715512275696,
-                                0.30069857835769653,   -0.13050690293312073, 0.15909086167812347,   0.19767779111862183,
-                                -0.14876919984817505,  0.010837454348802567, 0.08312078565359116,   0.010858718305826187,
-                                -0.12213930487632751,  0.13805551826953888,  0.002928786678239703,  0.12726815044879913,
-                                -0.047198496758937836, 0.1211603507399559,   2.087261199951172,     2.8326735496520996,
-                                -0.9548537135124207,   -0.15895815193653107, 0.10418925434350967,   0.3447468876838684,
-                                -0.34842681884765625,  0.4084584712982178,   -0.3318082392215729}};
-
-    Model6.rec_weight_hh_l0 = {
+         -0.7902718186378479,  0.5626970529556274}},
+
+    .lin_weight = {{-0.35878172516822815, -0.35143688321113586, 0.0438566580414772, 0.09557642787694931, 0.35244128108024597,
+                   -0.5041103959083557, 0.6719605922698975, 1.4568132162094116, 0.5651177763938904}},
+
+    .lin_bias = {-0.39557117223739624},
+
+    .rec_bias = {{1.4791090488433838,   0.8872252106666565,   1.255505084991455,    -0.6273059844970703,  2.0530476570129395,
+                 -0.8202617764472961,  -0.6621493101119995,  -0.2523471713066101,  -0.0486859567463398,  0.15896804630756378,
+                 0.14054542779922485,  0.10158023238182068,  0.6378490924835205,   0.16620376706123352,  0.3358059227466583,
+                 0.22175993025302887,  0.23002469539642334,  0.4394044876098633,   -0.23089683055877686, 0.027949901297688484,
+                 0.007241227198392153, 0.015315423719584942, -0.04764167219400406, -0.10548243671655655, -0.11819690465927124,
+                 0.08399385958909988,  0.3320634663105011},
+                {1.4791090488433838,   0.8872252106666565,  1.255505084991455,   -0.6273059844970703, 2.0530476570129395,
+                 -0.8202617764472961,  -0.6621493101119995, -0.2523471713066101, -0.0486859567463398, 0.15723247826099396,
+                 0.1405564695596695,   0.10158234089612961, 0.6378490924835205,  0.16658557951450348, 0.3358058035373688,
+                 0.22175993025302887,  0.23002585768699646, 0.4395991861820221,  0.5436006784439087,  -0.1353028416633606,
+                 0.10029082000255585,  0.18212758004665375, 0.10946966707706451, 0.13357312977313995, 0.030321570113301277,
+                 -0.07347753643989563, -0.41494783759117126}},
+    .levelAdjust = 0.8,
+};
+
+//========================================================================
+//../newNeuralSeedModel 5150_g5_gru9_p005_shift26
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model6 = {
+    .rec_weight_ih_l0 = {{-0.10029491037130356,  0.39539408683776855,  -0.003912642132490873, 0.15781715512275696,
+                         0.30069857835769653,   -0.13050690293312073, 0.15909086167812347,   0.19767779111862183,
+                         -0.14876919984817505,  0.010837454348802567, 0.08312078565359116,   0.010858718305826187,
+                         -0.12213930487632751,  0.13805551826953888,  0.002928786678239703,  0.12726815044879913,
+                         -0.047198496758937836, 0.1211603507399559,   2.087261199951172,     2.8326735496520996,
+                         -0.9548537135124207,   -0.15895815193653107, 0.10418925434350967,   0.3447468876838684,
+                         -0.34842681884765625,  0.4084584712982178,   -0.3318082392215729}},
+
+    .rec_weight_hh_l0 = {
         {0.279853880405426,   0.4110238254070282,   -0.02184336632490158, -0.026962880045175552, -0.07450610399246216,
          -0.101193867623806,  0.5569225549697876,   0.051143400371074677, 0.021359063684940338,  0.14612971246242523,
          0.11226102709770203, -0.15400274097919464, -0.33306899666786194, 0.014791703782975674,  0.21884165704250336,
@@ -582,49 +583,51 @@ void setupWeights() {
          0.35273537039756775,  0.3670301139354706,  0.4426630139350891,   -0.04335176572203636, -0.07593750208616257,
          -0.15744592249393463, 0.33702242374420166, -0.20504538714885712, 0.9893298745155334,   0.5818567276000977,
          -0.36911237239837646, 1.0018742084503174,  -0.3915467858314514,  -0.483379065990448,   0.025392325595021248,
-         -0.32757896184921265, 0.3506688177585602}};
-
-    Model6.lin_weight = {{-0.21571148931980133, 0.009336142800748348, 1.1046335697174072, 0.7788750529289246, -0.7268757224082947,
-                          0.008250449784100056, -0.15866594016551971, 0.5746699571609497, 0.7435592412948608}};
-
-    Model6.lin_bias = {0.1311880350112915};
-
-    Model6.rec_bias = {{-0.6570056676864624,  -0.7625259757041931, -0.4935401380062103, 0.3882617950439453,   1.6678688526153564,
-                        1.1328665018081665,   0.7226774096488953,  -0.6539076566696167, 1.1644433736801147,   0.4385550320148468,
-                        0.7962636947631836,   0.10724996030330658, 0.36334332823753357, 0.2530021369457245,   0.17276468873023987,
-                        0.22074736654758453,  0.5745679140090942,  0.11506269872188568, -0.12087058275938034, -0.22438204288482666,
-                        -0.12205783277750015, -0.3330017924308777, 0.12413868308067322, -0.07059116661548615, 0.06413894891738892,
-                        -0.21534445881843567, 0.1563182920217514},
-                       {-0.6570056676864624, -0.7625259757041931, -0.4935401380062103, 0.3882596790790558,  1.672628402709961,
-                        1.1337413787841797,  0.7226774096488953,  -0.6539076566696167, 1.1628081798553467,  0.4378686547279358,
-                        0.7965229153633118,  0.09567991644144058, 0.36506515741348267, 0.2470959722995758,  0.13386721909046173,
-                        0.22055870294570923, 0.574568510055542,   0.05572935566306114, -0.1475081890821457, 0.05165950208902359,
-                        -0.1899762749671936, 0.09854485094547272, -0.2138112634420395, 0.10794822871685028, -0.09042128175497055,
-                        0.1349363476037979,  0.09115724265575409}};
-    Model6.levelAdjust = 0.6;
-
-    //========================================================================
-    //../newNeuralSeedModel splawn lesseq p016
-    /*
-    model : SimpleRNN
-    input_size : 1
-    skip : 1
-    output_size : 1
-    unit_type : GRU
-    num_layers : 1
-    hidden_size : 9
-    bias_fl : True
-    */
-
-    Model7.rec_weight_ih_l0 = {{-0.1962304264307022,  -0.1355326771736145,   -0.2770193815231323,    -0.026640359312295914,
-                                -0.32773613929748535, -0.032444391399621964, -0.19838671386241913,   -0.03420368954539299,
-                                0.07451529055833817,  -0.15546947717666626,  -0.0015930901281535625, -0.14246152341365814,
-                                -0.31645432114601135, 0.09271357953548431,   0.28320756554603577,    -0.16182054579257965,
-                                0.038472067564725876, -0.14872537553310394,  0.4264770746231079,     -0.9290569424629211,
-                                0.33339518308639526,  0.36250436305999756,   2.993844985961914,      3.2608554363250732,
-                                -1.0870774984359741,  -0.008460208773612976, 0.16107945144176483}};
-
-    Model7.rec_weight_hh_l0 = {
+         -0.32757896184921265, 0.3506688177585602}},
+
+    .lin_weight = {{-0.21571148931980133, 0.009336142800748348, 1.1046335697174072, 0.7788750529289246, -0.7268757224082947,
+                   0.008250449784100056, -0.15866594016551971, 0.5746699571609497, 0.7435592412948608}},
+
+    .lin_bias = {0.1311880350112915},
+
+    .rec_bias = {{-0.6570056676864624,  -0.7625259757041931, -0.4935401380062103, 0.3882617950439453,   1.6678688526153564,
+                 1.1328665018081665,   0.7226774096488953,  -0.6539076566696167, 1.1644433736801147,   0.4385550320148468,
+                 0.7962636947631836,   0.10724996030330658, 0.36334332823753357, 0.2530021369457245,   0.17276468873023987,
+                 0.22074736654758453,  0.5745679140090942,  0.11506269872188568, -0.12087058275938034, -0.22438204288482666,
+                 -0.12205783277750015, -0.3330017924308777, 0.12413868308067322, -0.07059116661548615, 0.06413894891738892,
+                 -0.21534445881843567, 0.1563182920217514},
+                {-0.6570056676864624, -0.7625259757041931, -0.4935401380062103, 0.3882596790790558,  1.672628402709961,
+                 1.1337413787841797,  0.7226774096488953,  -0.6539076566696167, 1.1628081798553467,  0.4378686547279358,
+                 0.7965229153633118,  0.09567991644144058, 0.36506515741348267, 0.2470959722995758,  0.13386721909046173,
+                 0.22055870294570923, 0.574568510055542,   0.05572935566306114, -0.1475081890821457, 0.05165950208902359,
+                 -0.1899762749671936, 0.09854485094547272, -0.2138112634420395, 0.10794822871685028, -0.09042128175497055,
+                 0.1349363476037979,  0.09115724265575409}},
+    .levelAdjust = 0.6,
+};
+
+//========================================================================
+//../newNeuralSeedModel splawn lesseq p016
+/*
+model : SimpleRNN
+input_size : 1
+skip : 1
+output_size : 1
+unit_type : GRU
+num_layers : 1
+hidden_size : 9
+bias_fl : True
+*/
+
+constexpr modelData Model7 = {
+    .rec_weight_ih_l0 = {{-0.1962304264307022,  -0.1355326771736145,   -0.2770193815231323,    -0.026640359312295914,
+                         -0.32773613929748535, -0.032444391399621964, -0.19838671386241913,   -0.03420368954539299,
+                         0.07451529055833817,  -0.15546947717666626,  -0.0015930901281535625, -0.14246152341365814,
+                         -0.31645432114601135, 0.09271357953548431,   0.28320756554603577,    -0.16182054579257965,
+                         0.038472067564725876, -0.14872537553310394,  0.4264770746231079,     -0.9290569424629211,
+                         0.33339518308639526,  0.36250436305999756,   2.993844985961914,      3.2608554363250732,
+                         -1.0870774984359741,  -0.008460208773612976, 0.16107945144176483}},
+
+    .rec_weight_hh_l0 = {
         {-0.027524592354893684, 0.22197243571281433, -1.139214038848877,  -0.4078858196735382,  -0.47172272205352783,
          -0.11344176530838013,  0.7284901142120361,  0.20500048995018005, -0.04185975342988968, 0.31803059577941895,
          0.37160950899124146,   0.05201788246631622, 0.01207520067691803, 0.29934701323509216,  0.26072925329208374,
@@ -678,30 +681,30 @@ void setupWeights() {
          0.15491782128810883,  -1.9108493328094482,  -0.6965234875679016,   0.1296902447938919,  -0.0025165663100779057,
          0.2260102927684784,   0.21223454177379608,  0.14853651821613312,   -0.5169532895088196, -0.22295399010181427,
          0.34596478939056396,  0.20344090461730957,  -0.014062924310564995, -0.1367579847574234, -0.10022738575935364,
-         0.662987232208252,    1.4477633237838745}};
-
-    Model7.lin_weight = {{-0.18492355942726135, 0.1578197330236435, -0.9123080372810364, -1.2465184926986694, 0.05437188595533371,
-                          -0.3180641233921051, 0.8285513520240784, -0.3889249265193939, -0.9665180444717407}};
-
-    Model7.lin_bias = {0.7220124006271362};
-
-    Model7.rec_bias = {{2.0609941482543945,   -0.6399329304695129, -0.08864486217498779, 0.20826853811740875, -0.9970732927322388,
-                        -0.7389999032020569,  1.6598868370056152,  1.9578510522842407,   1.6268224716186523,  0.17324931919574738,
-                        0.8972873091697693,   0.9106922149658203,  0.2138533890247345,   1.1183505058288574,  0.8165175318717957,
-                        -0.19522859156131744, 0.21931886672973633, 0.5094407796859741,   0.20262053608894348, -1.2791446447372437,
-                        0.37031975388526917,  0.5160494446754456,  -0.14140361547470093, 0.08626745641231537, -0.047812435775995255,
-                        -0.11191973835229874, 0.12530671060085297},
-                       {2.061035633087158,    -0.6399329304695129,  -0.08864486217498779, 0.20826853811740875,  -0.9970732927322388,
-                        -0.7389999032020569,  1.659889817237854,    1.9578510522842407,   1.6267966032028198,   0.17323251068592072,
-                        0.8974360227584839,   0.9106932878494263,   0.21385356783866882,  1.1183505058288574,   0.8165175318717957,
-                        -0.19522970914840698, 0.2193187177181244,   0.5094400644302368,   -0.17801499366760254, 1.1853747367858887,
-                        -0.49953359365463257, -0.07018504291772842, 0.5975275635719299,   0.43096187710762024,  -0.22361980378627777,
-                        -0.03789837658405304, -0.008905002847313881}};
-
-    Model7.levelAdjust = 0.5;
+         0.662987232208252,    1.4477633237838745}},
+
+    .lin_weight = {{-0.18492355942726135, 0.1578197330236435, -0.9123080372810364, -1.2465184926986694, 0.05437188595533371,
+                   -0.3180641233921051, 0.8285513520240784, -0.3889249265193939, -0.9665180444717407}},
+
+    .lin_bias = {0.7220124006271362},
+
+    .rec_bias = {{2.0609941482543945,   -0.6399329304695129, -0.08864486217498779, 0.20826853811740875, -0.9970732927322388,
+                 -0.7389999032020569,  1.6598868370056152,  1.9578510522842407,   1.6268224716186523,  0.17324931919574738,
+                 0.8972873091697693,   0.9106922149658203,  0.2138533890247345,   1.1183505058288574,  0.8165175318717957,
+                 -0.19522859156131744, 0.21931886672973633, 0.5094407796859741,   0.20262053608894348, -1.2791446447372437,
+                 0.37031975388526917,  0.5160494446754456,  -0.14140361547470093, 0.08626745641231537, -0.047812435775995255,
+                 -0.11191973835229874, 0.12530671060085297},
+                {2.061035633087158,    -0.6399329304695129,  -0.08864486217498779, 0.20826853811740875,  -0.9970732927322388,
+                 -0.7389999032020569,  1.659889817237854,    1.9578510522842407,   1.6267966032028198,   0.17323251068592072,
+                 0.8974360227584839,   0.9106932878494263,   0.21385356783866882,  1.1183505058288574,   0.8165175318717957,
+                 -0.19522970914840698, 0.2193187177181244,   0.5094400644302368,   -0.17801499366760254, 1.1853747367858887,
+                 -0.49953359365463257, -0.07018504291772842, 0.5975275635719299,   0.43096187710762024,  -0.22361980378627777,
+                 -0.03789837658405304, -0.008905002847313881}},
+
+    .levelAdjust = 0.5,
+};
 
-    /*========================================================================*/
+/*========================================================================*/
 
-    // ADD YOUR MODEL IDENTIFIER HERE ////////////////////////////////// < -------------------------
-    model_collection = {Model1, Model2, Model3, Model4, Model5, Model6, Model7};
-}
\ No newline at end of file
+// ADD YOUR MODEL IDENTIFIER HERE ////////////////////////////////// < -------------------------
+constexpr const modelData *model_collection[] = {&Model1, &Model2, &Model3, &Model4, &Model5, &Model6, &Model7};
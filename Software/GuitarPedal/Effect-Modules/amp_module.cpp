@@ -1,8 +1,10 @@
 #include "amp_module.h"
 #include "../Util/audio_utilities.h"
+#include "../Util/profiler.h"
 #include "ImpulseResponse/ir_data.h"
 #include "NeuralModels/model_data_gru9.h"
 #include <array>
+#include <span>
 
 using namespace bkshepherd;
 
@@ -19,6 +21,11 @@ static const char *s_modelBinNames[7] = {"Fender57", "Matchless", "Klon", "Mesa
 
 static const char *s_irNames[4] = {"Marsh", "Proteus", "US Deluxe", "British"};
 
+// Profiler stages for the expensive parts of the amp, shown on the profiler debug page
+static ProfilerStage s_profileModel("Amp GRU");
+static ProfilerStage s_profileTone("Amp Tone");
+static ProfilerStage s_profileIR("Amp IR");
+
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, AmpModule::PARAM_COUNT> params{};
 
@@ -110,6 +117,10 @@ AmpModule::AmpModule()
 
     // Initialize Parameters for this Effect
     this->InitParams(static_cast<int>(s_metaData.size()));
+
+    // Loading a Model or IR takes longer than a block, so it's done on the main loop with the Amp suspended
+    SetParameterChangedOnControlThread(MODEL, true);
+    SetParameterChangedOnControlThread(IR, true);
 }
 
 // Destructor
@@ -119,15 +130,17 @@ AmpModule::~AmpModule() {
 
 void AmpModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
-    setupWeights(); // in the model data .h file
-    SelectModel();
-    SelectIR();
     CalculateMix();
     tone.Init(sample_rate);
     // bal.Init(sample_rate);
     CalculateTone();
 }
 
+void AmpModule::Prepare() {
+    SelectModel();
+    SelectIR();
+}
+
 void AmpModule::ParameterChanged(int parameter_id) {
     if (parameter_id == MODEL) { // Change Model
         SelectModel();
@@ -139,22 +152,54 @@ void AmpModule::ParameterChanged(int parameter_id) {
         SelectIR();
     }
 }
+// RTNeural takes the weights as vectors, they are copied from the tables in flash into these. The sizes are the same for
+// every model so only the first model selected allocates.
+static std::vector<std::vector<float>> s_weightsIh;
+static std::vector<std::vector<float>> s_weightsHh;
+static std::vector<std::vector<float>> s_biases;
+static std::vector<std::vector<float>> s_linWeights;
+
+template <size_t Rows, size_t Columns>
+static void CopyWeights(const float (&source)[Rows][Columns], std::vector<std::vector<float>> &target) {
+    target.resize(Rows);
+
+    for (size_t i = 0; i < Rows; i++) {
+        const std::span<const float> row(source[i]);
+        target[i].assign(row.begin(), row.end());
+    }
+}
+
 void AmpModule::SelectModel() {
     int modelIndex = GetParameterAsBinnedValue(MODEL) - 1;
     if (m_currentModelindex != modelIndex) {
+        const modelData &modelWeights = *model_collection[modelIndex];
         auto &gru = (model).template get<0>();
         auto &dense = (model).template get<1>();
-        gru.setWVals(model_collection[modelIndex].rec_weight_ih_l0);
-        gru.setUVals(model_collection[modelIndex].rec_weight_hh_l0);
-        gru.setBVals(model_collection[modelIndex].rec_bias);
-        dense.setWeights(model_collection[modelIndex].lin_weight);
-        dense.setBias(model_collection[modelIndex].lin_bias.data());
+        CopyWeights(modelWeights.rec_weight_ih_l0, s_weightsIh);
+        CopyWeights(modelWeights.rec_weight_hh_l0, s_weightsHh);
+        CopyWeights(modelWeights.rec_bias, s_biases);
+        CopyWeights(modelWeights.lin_weight, s_linWeights);
+        gru.setWVals(s_weightsIh);
+        gru.setUVals(s_weightsHh);
+        gru.setBVals(s_biases);
+        dense.setWeights(s_linWeights);
+        dense.setBias(modelWeights.lin_bias);
         model.reset();
-        nnLevelAdjust = model_collection[modelIndex].levelAdjust;
+        nnLevelAdjust = modelWeights.levelAdjust;
         m_currentModelindex = modelIndex;
     }
 }
 
+// Lower quality levels only use the start of the IR, 0 uses the whole IR
+static const size_t s_irLengthForQualityLevel[] = {0, 200, 100};
+
+void AmpModule::SetQualityLevel(int level) {
+    BaseEffectModule::SetQualityLevel(level);
+    mIR.SetLengthLimit(s_irLengthForQualityLevel[GetQualityLevel()]);
+}
+
+int AmpModule::GetQualityLevelCount() const { return sizeof(s_irLengthForQualityLevel) / sizeof(s_irLengthForQualityLevel[0]); }
+
 void AmpModule::SelectIR() {
     int irIndex = GetParameterAsBinnedValue(IR) - 1;
     if (irIndex != m_currentIRindex) {
@@ -195,14 +240,18 @@ void AmpModule::ProcessMono(float in) {
 
     // NEURAL MODEL //
     if (GetParameterAsBool(NEURAL_MODEL)) {
+        s_profileModel.Begin();
         ampOut = model.forward(input_arr) + input_arr[0]; // Run Model and add Skip Connection
         ampOut *= nnLevelAdjust * 0.4;                    // Level adjustment
+        s_profileModel.End();
     } else {
         ampOut = input_arr[0];
     }
 
     // TONE //
+    s_profileTone.Begin();
     float filter_out = tone.Process(ampOut); // Apply tone Low Pass filter
+    s_profileTone.End();
     // float balanced_out = bal.Process(filter_out, ampOut); // Apply level adjustment to increase level of filtered signal
 
     // MIX //
@@ -212,7 +261,9 @@ void AmpModule::ProcessMono(float in) {
 
     // IMPULSE RESPONSE //
     if (GetParameterAsBool(IR_ON)) {
+        s_profileIR.Begin();
         m_audioLeft = mIR.Process(mix_out) * level * 0.2; // 0.2 is level adjust for loud output
+        s_profileIR.End();
     } else {
         m_audioLeft = mix_out * level;
     }
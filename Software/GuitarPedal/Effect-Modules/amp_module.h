@@ -34,6 +34,7 @@ class AmpModule : public BaseEffectModule {
     ~AmpModule();
 
     void Init(float sample_rate) override;
+    void Prepare() override;
     void ParameterChanged(int parameter_id) override;
     void SelectModel();
     void SelectIR();
@@ -42,6 +43,8 @@ class AmpModule : public BaseEffectModule {
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    void SetQualityLevel(int level) override;
+    int GetQualityLevelCount() const override;
 
   private:
     float m_gainMin;
@@ -1,15 +1,28 @@
 #include "base_effect_module.h"
 #include "../Util/audio_utilities.h"
+#include "../Util/block_trace.h"
+#include <cstring>
+#include <math.h>
 
 // This can be used to show the CPU on the default UI
 constexpr bool showCPU = false;
 
+// Shortest time the input and output must be silent before an Effect is considered idle, covers short internal delays
+// (chorus, flanger, filters) in effects that don't declare a tail
+constexpr float minimumIdleHoldInSeconds = 0.1f;
+
 using namespace bkshepherd;
 
 // Default Constructor
 BaseEffectModule::BaseEffectModule()
     : m_paramCount(0), m_presetCount(1), m_currentPreset(0), m_params(nullptr), m_audioLeft(0.0f), m_audioRight(0.0f),
-      m_settingsArrayStartIdx(0), m_isEnabled(false) {
+      m_paramSnapshot(nullptr), m_paramPendingMask(nullptr), m_paramDirtyMask(nullptr), m_paramNotifyMask(nullptr),
+      m_paramControlMask(nullptr), m_paramSuspendMask(nullptr), m_paramControlPendingMask(nullptr),
+      m_controlUpdateState(ControlUpdateState::Idle), m_paramMaskWordCount(0), m_forceAllParametersDirty(false),
+      m_paramChangesHeld(false), m_paramSmoothing(nullptr),
+      m_smoothedParamIDs(nullptr), m_smoothedParamCount(0), m_smoothingBlockSize(0), m_blockSampleIndex(0), m_isEnabled(false),
+      m_qualityLevel(0), m_silentSamples(0), m_isIdle(false), m_processingCostTicks(0), m_isPrepared(false), m_hasResources(false),
+      m_resourcesReleased(false), m_isStereo(false), m_sampleRate(0.0f) {
     m_name = "Base";
     m_paramMetaData = nullptr;
 }
@@ -19,9 +32,26 @@ BaseEffectModule::~BaseEffectModule() {
     if (m_params != nullptr) {
         delete[] m_params;
     }
+
+    if (m_paramSnapshot != nullptr) {
+        delete[] m_paramSnapshot;
+        delete[] m_paramPendingMask;
+        delete[] m_paramDirtyMask;
+        delete[] m_paramNotifyMask;
+        delete[] m_paramControlMask;
+        delete[] m_paramSuspendMask;
+        delete[] m_paramControlPendingMask;
+        delete[] m_paramSmoothing;
+        delete[] m_smoothedParamIDs;
+    }
 }
 
-void BaseEffectModule::Init(float sample_rate) { m_sampleRate = sample_rate; }
+void BaseEffectModule::Init(float sample_rate) {
+    m_sampleRate = sample_rate;
+
+    // Force the smoothing coefficients to be recalculated for the new sample rate
+    m_smoothingBlockSize = 0;
+}
 
 const char *BaseEffectModule::GetName() { return m_name; }
 
@@ -32,7 +62,31 @@ void BaseEffectModule::InitParams(int count) {
         m_params = nullptr;
     }
 
+    if (m_paramSnapshot != nullptr) {
+        delete[] m_paramSnapshot;
+        delete[] m_paramPendingMask;
+        delete[] m_paramDirtyMask;
+        delete[] m_paramNotifyMask;
+        delete[] m_paramControlMask;
+        delete[] m_paramSuspendMask;
+        delete[] m_paramControlPendingMask;
+        delete[] m_paramSmoothing;
+        delete[] m_smoothedParamIDs;
+        m_paramSnapshot = nullptr;
+        m_paramPendingMask = nullptr;
+        m_paramDirtyMask = nullptr;
+        m_paramNotifyMask = nullptr;
+        m_paramControlMask = nullptr;
+        m_paramSuspendMask = nullptr;
+        m_paramControlPendingMask = nullptr;
+        m_paramSmoothing = nullptr;
+        m_smoothedParamIDs = nullptr;
+    }
+
     m_paramCount = 0;
+    m_paramMaskWordCount = 0;
+    m_smoothedParamCount = 0;
+    m_smoothingBlockSize = 0;
 
     if (count > 0) {
         // Create new parameter storage
@@ -55,6 +109,269 @@ void BaseEffectModule::InitParams(int count) {
                 m_params[i] = 0;
             }
         }
+
+        // Create the decoded snapshot and the bitmasks used to track parameter changes between audio blocks
+        m_paramMaskWordCount = (m_paramCount + 31) / 32;
+        m_paramSnapshot = new ParameterSnapshot[m_paramCount];
+        m_paramPendingMask = new std::atomic<uint32_t>[m_paramMaskWordCount];
+        m_paramDirtyMask = new uint32_t[m_paramMaskWordCount];
+        m_paramNotifyMask = new uint32_t[m_paramMaskWordCount];
+        m_paramControlMask = new uint32_t[m_paramMaskWordCount];
+        m_paramSuspendMask = new uint32_t[m_paramMaskWordCount];
+        m_paramControlPendingMask = new std::atomic<uint32_t>[m_paramMaskWordCount];
+
+        for (int i = 0; i < m_paramCount; i++) {
+            DecodeParameterSnapshot(i);
+        }
+
+        for (int i = 0; i < m_paramMaskWordCount; i++) {
+            m_paramPendingMask[i].store(0, std::memory_order_relaxed);
+            m_paramDirtyMask[i] = 0;
+            m_paramNotifyMask[i] = 0;
+            m_paramControlMask[i] = 0;
+            m_paramSuspendMask[i] = 0;
+            m_paramControlPendingMask[i].store(0, std::memory_order_relaxed);
+        }
+
+        // Collect the Float parameters that have smoothing enabled so only those are advanced every block
+        m_paramSmoothing = new ParameterSmoothingState[m_paramCount];
+        m_smoothedParamIDs = new int[m_paramCount];
+
+        for (int i = 0; i < m_paramCount; i++) {
+            m_paramSmoothing[i].rate = 0.0f;
+
+            if (HasParameterSmoothing(i)) {
+                m_smoothedParamIDs[m_smoothedParamCount++] = i;
+            }
+        }
+
+        ResetParameterSmoothing();
+
+        // Every parameter is reported as dirty for the first block so effects can set up their block rate state
+        m_forceAllParametersDirty = true;
+    }
+}
+
+void BaseEffectModule::DecodeParameterSnapshot(int parameter_id) {
+    ParameterSnapshot &snapshot = m_paramSnapshot[parameter_id];
+    const uint32_t raw = m_params[parameter_id];
+
+    std::memcpy(&snapshot.asFloat, &raw, sizeof(float));
+    snapshot.asBinned = GetParameterAsBinnedValue(parameter_id);
+    snapshot.asBool = raw > 0;
+}
+
+void BaseEffectModule::MarkParameterPending(int parameter_id) {
+    if (m_paramPendingMask != nullptr) {
+        const int word = parameter_id >> 5;
+        const uint32_t bit = 1U << (parameter_id & 31);
+
+        if (m_paramControlMask[word] & bit) {
+            m_paramControlPendingMask[word].fetch_or(bit, std::memory_order_release);
+        }
+
+        m_paramPendingMask[word].fetch_or(bit, std::memory_order_release);
+    }
+}
+
+void BaseEffectModule::SetParameterChangedOnControlThread(int parameter_id, bool suspendProcessing) {
+    if (parameter_id < 0 || parameter_id >= m_paramCount) {
+        return;
+    }
+
+    const uint32_t bit = 1U << (parameter_id & 31);
+    m_paramControlMask[parameter_id >> 5] |= bit;
+
+    if (suspendProcessing) {
+        m_paramSuspendMask[parameter_id >> 5] |= bit;
+    }
+}
+
+void BaseEffectModule::ProcessControlParameterChanges(bool processedByAudio) {
+    bool anyPending = false;
+    bool needsSuspend = false;
+
+    for (int word = 0; word < m_paramMaskWordCount; word++) {
+        const uint32_t pending = m_paramControlPendingMask[word].load(std::memory_order_acquire);
+        anyPending = anyPending || pending != 0;
+        needsSuspend = needsSuspend || (pending & m_paramSuspendMask[word]) != 0;
+    }
+
+    if (!anyPending) {
+        return;
+    }
+
+    const ControlUpdateState state = m_controlUpdateState.load(std::memory_order_acquire);
+
+    // Ask the audio callback to stop processing the Effect and come back once it has, an Effect that is bypassed or idle
+    // is only suspended once the audio callback gets back to it
+    if (needsSuspend && processedByAudio && state != ControlUpdateState::Suspended) {
+        if (state == ControlUpdateState::Idle) {
+            m_controlUpdateState.store(ControlUpdateState::Requested, std::memory_order_release);
+        }
+
+        return;
+    }
+
+    for (int word = 0; word < m_paramMaskWordCount; word++) {
+        uint32_t mask = m_paramControlPendingMask[word].exchange(0, std::memory_order_acquire);
+
+        while (mask != 0) {
+            const int bit = __builtin_ctz(mask);
+            mask &= mask - 1U;
+            ParameterChanged(word * 32 + bit);
+        }
+    }
+
+    // Let the audio callback process the Effect again
+    m_controlUpdateState.store(ControlUpdateState::Idle, std::memory_order_release);
+}
+
+void BaseEffectModule::UpdateParameterSmoothing(int parameter_id, size_t size, bool changed) {
+    ParameterSmoothingState &state = m_paramSmoothing[parameter_id];
+    const float target = m_paramSnapshot[parameter_id].asFloat;
+    const float smoothingTime = m_paramMetaData[parameter_id].smoothingTimeInSeconds;
+
+    state.start = state.end;
+
+    if (smoothingTime <= 0.0f || m_sampleRate <= 0.0f) {
+        state.end = target;
+        state.increment = 0.0f;
+        return;
+    }
+
+    // The Exponential coefficient only depends on the block size, so it is only recalculated when that changes
+    const bool isLinear = m_paramMetaData[parameter_id].smoothingType == ParameterSmoothingType::Linear;
+
+    if (!isLinear && size != m_smoothingBlockSize) {
+        state.rate = 1.0f - expf(-static_cast<float>(size) / (smoothingTime * m_sampleRate));
+    }
+
+    if (state.start == target) {
+        state.end = target;
+    } else if (isLinear) {
+        // Each new target is reached smoothingTime after it was set, regardless of how far it moved
+        if (changed) {
+            state.rate = fabsf(target - state.start) / (smoothingTime * m_sampleRate);
+        }
+
+        const float delta = target - state.start;
+        const float maxDelta = state.rate * static_cast<float>(size);
+        state.end = fabsf(delta) <= maxDelta ? target : state.start + copysignf(maxDelta, delta);
+    } else {
+        state.end = state.start + (target - state.start) * state.rate;
+
+        // Snap to the target once the remaining distance is inaudible so the ramp ends
+        if (fabsf(target - state.end) <= 1e-5f * fmaxf(1.0f, fabsf(target))) {
+            state.end = target;
+        }
+    }
+
+    state.increment = (state.end - state.start) / static_cast<float>(size);
+}
+
+bool BaseEffectModule::HasParameterSmoothing(int parameter_id) const {
+    return m_paramMetaData != nullptr && GetParameterType(parameter_id) == ParameterValueType::Float &&
+           m_paramMetaData[parameter_id].smoothingType != ParameterSmoothingType::None;
+}
+
+void BaseEffectModule::FillSmoothedParameterRamp(int parameter_id, float *ramp, size_t size) const {
+    const ParameterSmoothingState &state = m_paramSmoothing[parameter_id];
+
+    for (size_t i = 0; i < size; i++) {
+        ramp[i] = state.start + state.increment * static_cast<float>(i);
+    }
+}
+
+void BaseEffectModule::ResetParameterSmoothing() {
+    for (int i = 0; i < m_paramCount; i++) {
+        ParameterSmoothingState &state = m_paramSmoothing[i];
+        state.start = m_paramSnapshot[i].asFloat;
+        state.end = state.start;
+        state.increment = 0.0f;
+    }
+}
+
+void BaseEffectModule::UpdateParameterSnapshot(size_t size, int maxParameterChanges) {
+    bool anyDirty = false;
+    bool anyNotify = false;
+
+    // While a whole set of values is being written the changes stay pending, so they all land in the same block
+    const bool changesHeld = m_paramChangesHeld.load(std::memory_order_acquire);
+
+    // Stop processing the Effect if the main loop asked to, the changes stay pending until it hands the Effect back
+    AcceptSuspendRequest();
+
+    if (IsSuspended()) {
+        return;
+    }
+
+    for (int word = 0; word < m_paramMaskWordCount; word++) {
+        // Take the pending changes for this word, anything that changes after this will be picked up next block
+        uint32_t mask = changesHeld ? 0U : m_paramPendingMask[word].exchange(0, std::memory_order_acquire);
+
+        // Queue up the ParameterChanged notifications for the changed parameters, except the ones the main loop delivers
+        m_paramNotifyMask[word] |= mask & ~m_paramControlMask[word];
+        anyNotify = anyNotify || m_paramNotifyMask[word] != 0;
+
+        if (m_forceAllParametersDirty && !changesHeld) {
+            mask = 0xffffffffU;
+        }
+
+        // Ignore the padding bits past the last parameter
+        if (word == m_paramMaskWordCount - 1 && (m_paramCount & 31) != 0) {
+            mask &= (1U << (m_paramCount & 31)) - 1U;
+        }
+
+        m_paramDirtyMask[word] = mask;
+
+        while (mask != 0) {
+            const int parameter_id = word * 32 + __builtin_ctz(mask);
+            DecodeParameterSnapshot(parameter_id);
+
+            // Parameters without smoothing step straight to their new value
+            if (!HasParameterSmoothing(parameter_id)) {
+                ParameterSmoothingState &state = m_paramSmoothing[parameter_id];
+                state.start = m_paramSnapshot[parameter_id].asFloat;
+                state.end = state.start;
+                state.increment = 0.0f;
+            }
+
+            mask &= mask - 1U;
+            anyDirty = true;
+        }
+    }
+
+    m_forceAllParametersDirty = m_forceAllParametersDirty && changesHeld;
+
+    // Advance the ramps of the smoothed parameters by one block
+    m_blockSampleIndex = 0;
+
+    if (size > 0) {
+        for (int i = 0; i < m_smoothedParamCount; i++) {
+            UpdateParameterSmoothing(m_smoothedParamIDs[i], size, IsParameterDirty(m_smoothedParamIDs[i]));
+        }
+
+        m_smoothingBlockSize = size;
+    }
+
+    if (anyDirty || anyNotify) {
+        BlockTrace::MarkTask(BlockTraceTask::Parameters);
+    }
+
+    // Deliver the deferred ParameterChanged notifications, bounded so that a burst of changes
+    // (preset loads, fast knob moves) is spread over several blocks instead of overrunning one.
+    for (int word = 0; anyNotify && word < m_paramMaskWordCount && maxParameterChanges > 0; word++) {
+        while (m_paramNotifyMask[word] != 0 && maxParameterChanges > 0) {
+            const int bit = __builtin_ctz(m_paramNotifyMask[word]);
+            m_paramNotifyMask[word] &= m_paramNotifyMask[word] - 1U;
+            maxParameterChanges--;
+            ParameterChanged(word * 32 + bit);
+        }
+    }
+
+    if (anyDirty) {
+        ParameterSnapshotChanged();
     }
 }
 
@@ -68,10 +385,6 @@ void BaseEffectModule::SetCurrentPreset(uint32_t preset) { m_currentPreset = pre
 
 uint32_t BaseEffectModule::GetCurrentPreset() const { return m_currentPreset; }
 
-void BaseEffectModule::SetSettingsArrayStartIdx(uint32_t start_idx) { m_settingsArrayStartIdx = start_idx; }
-
-uint32_t BaseEffectModule::GetSettingsArrayStartIdx() const { return m_settingsArrayStartIdx; }
-
 const char *BaseEffectModule::GetParameterName(int parameter_id) const {
     // Make sure parameter_id is valid.
     if (m_params == nullptr || parameter_id < 0 || parameter_id >= m_paramCount || m_paramMetaData == nullptr) {
@@ -252,8 +565,8 @@ void BaseEffectModule::SetParameterRaw(int parameter_id, uint32_t value) {
     if (value != m_params[parameter_id]) {
         m_params[parameter_id] = value;
 
-        // Notify anyone listening if the parameter actually changed.
-        ParameterChanged(parameter_id);
+        // Notify anyone listening at the start of the next audio block if the parameter actually changed.
+        MarkParameterPending(parameter_id);
     }
 }
 
@@ -341,8 +654,8 @@ void BaseEffectModule::SetParameterAsFloat(int parameter_id, float value) {
         if (tmp != m_params[parameter_id]) {
             m_params[parameter_id] = tmp;
 
-            // Notify anyone listening if the parameter actually changed.
-            ParameterChanged(parameter_id);
+            // Notify anyone listening at the start of the next audio block if the parameter actually changed.
+            MarkParameterPending(parameter_id);
         }
     }
 }
@@ -368,6 +681,26 @@ void BaseEffectModule::SetParameterAsBinnedValue(int parameter_id, int value) {
     SetParameterRaw(parameter_id, value - 1);
 }
 
+void BaseEffectModule::SetParametersRaw(const uint32_t *values, int count) {
+    if (m_params == nullptr || values == nullptr) {
+        return;
+    }
+
+    count = count < m_paramCount ? count : m_paramCount;
+
+    m_paramChangesHeld.store(true, std::memory_order_release);
+
+    for (int parameter_id = 0; parameter_id < count; parameter_id++) {
+        // Only update the values that changed, the pending bits coalesce the notifications
+        if (values[parameter_id] != m_params[parameter_id]) {
+            m_params[parameter_id] = values[parameter_id];
+            MarkParameterPending(parameter_id);
+        }
+    }
+
+    m_paramChangesHeld.store(false, std::memory_order_release);
+}
+
 void BaseEffectModule::ProcessMono(float in) {
     m_audioLeft = in;
     m_audioRight = in;
@@ -378,6 +711,30 @@ void BaseEffectModule::ProcessStereo(float inL, float inR) {
     m_audioRight = inR;
 }
 
+void BaseEffectModule::ProcessBlock(const float *const *in, float *const *out, size_t size) {
+    // Adapt the block onto the per sample processing functions. Effects that override this
+    // should process the whole block in a single loop instead.
+    if (m_isStereo) {
+        for (size_t i = 0; i < size; i++) {
+            m_blockSampleIndex = i;
+            ProcessStereo(in[0][i], in[1][i]);
+            out[0][i] = m_audioLeft;
+            out[1][i] = m_audioRight;
+        }
+    } else {
+        for (size_t i = 0; i < size; i++) {
+            m_blockSampleIndex = i;
+            ProcessMono(in[0][i]);
+            out[0][i] = m_audioLeft;
+            out[1][i] = m_audioRight;
+        }
+    }
+}
+
+void BaseEffectModule::SetStereoProcessing(bool isStereo) { m_isStereo = isStereo; }
+
+bool BaseEffectModule::IsStereoProcessing() const { return m_isStereo; }
+
 float BaseEffectModule::GetAudioLeft() const { return m_audioLeft; }
 
 float BaseEffectModule::GetAudioRight() const { return m_audioRight; }
@@ -406,10 +763,156 @@ void BaseEffectModule::SetTempo(uint32_t bpm) {
     // Effect modules are expected to override this fucntion if they are time based.
 }
 
+void BaseEffectModule::SetQualityLevel(int level) {
+    if (level < 0) {
+        level = 0;
+    } else if (level > GetQualityLevelCount() - 1) {
+        level = GetQualityLevelCount() - 1;
+    }
+
+    m_qualityLevel = level;
+}
+
+int BaseEffectModule::GetQualityLevel() const { return m_qualityLevel; }
+
+int BaseEffectModule::GetQualityLevelCount() const {
+    // Effects only have full quality unless they override this.
+    return 1;
+}
+
+float BaseEffectModule::GetTailLengthInSeconds() const {
+    // Most effects have no tail worth keeping.
+
+    // Effects with delay lines or that make their own sound are expected to override this function.
+    return 0.0f;
+}
+
+void BaseEffectModule::UpdateIdleState(const float *const *in, const float *const *out, size_t size) {
+    if (!IsBlockSilent(in, size) || !IsBlockSilent(out, size)) {
+        m_silentSamples = 0;
+        m_isIdle = false;
+        return;
+    }
+
+    const float tailLength = GetTailLengthInSeconds();
+
+    if (tailLength < 0.0f) {
+        return;
+    }
+
+    if (m_silentSamples < UINT32_MAX - size) {
+        m_silentSamples += size;
+    }
+
+    const float holdLength = tailLength > minimumIdleHoldInSeconds ? tailLength : minimumIdleHoldInSeconds;
+    m_isIdle = m_silentSamples >= static_cast<uint32_t>(holdLength * m_sampleRate);
+}
+
+bool BaseEffectModule::IsIdle() const { return m_isIdle; }
+
+void BaseEffectModule::MarkIdle() {
+    // Effects that make their own sound are never idle
+    if (GetTailLengthInSeconds() < 0.0f) {
+        return;
+    }
+
+    m_silentSamples = 0;
+    m_isIdle = true;
+}
+
+void BaseEffectModule::RecordProcessingCost(uint32_t ticks) {
+    if (ticks > m_processingCostTicks) {
+        m_processingCostTicks = ticks;
+    } else {
+        m_processingCostTicks -= m_processingCostTicks / 1024;
+    }
+}
+
+uint32_t BaseEffectModule::GetProcessingCostTicks() const { return m_processingCostTicks; }
+
+int BaseEffectModule::GetProcessedEffectCount() const { return 1; }
+
+const BaseEffectModule *BaseEffectModule::GetProcessedEffect(int index) const { return this; }
+
+void BaseEffectModule::PrepareResources() {
+    if (!m_isPrepared) {
+        Prepare();
+        m_isPrepared = true;
+    }
+}
+
+bool BaseEffectModule::IsPrepared() const { return m_isPrepared; }
+
+bool BaseEffectModule::AcquireResources(SdramArena &arena) {
+    if (HasResources()) {
+        return true;
+    }
+
+    PrepareResources();
+
+    if (!Acquire(arena)) {
+        Release(arena);
+        return false;
+    }
+
+    // Anything ParameterChanged set up in the buffers of a previous Acquire is gone, so deliver every parameter again
+    if (m_resourcesReleased) {
+        for (int i = 0; i < m_paramCount; i++) {
+            MarkParameterPending(i);
+        }
+    }
+
+    // Publish the buffers before the audio callback is allowed to use them
+    m_hasResources.store(true, std::memory_order_release);
+    return true;
+}
+
+void BaseEffectModule::ReleaseResources(SdramArena &arena) {
+    if (!HasResources()) {
+        return;
+    }
+
+    m_hasResources.store(false, std::memory_order_relaxed);
+    m_resourcesReleased = true;
+    Release(arena);
+}
+
+bool BaseEffectModule::HasResources() const { return m_hasResources.load(std::memory_order_acquire); }
+
+void BaseEffectModule::Prepare() {
+    // Do nothing.
+}
+
+bool BaseEffectModule::Acquire(SdramArena &arena) {
+    // Effects without large buffers have nothing to allocate
+    return true;
+}
+
+void BaseEffectModule::Release(SdramArena &arena) {
+    // Do nothing.
+}
+
+bool BaseEffectModule::IsBlockSilent(const float *const *buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        if (fabsf(buffer[0][i]) > kIdleThreshold || fabsf(buffer[1][i]) > kIdleThreshold) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void BaseEffectModule::ParameterChanged(int parameter_id) {
     // Do nothing.
 }
 
+void BaseEffectModule::ParameterSnapshotChanged() {
+    // Do nothing.
+
+    // Effect modules are expected to override this function if they have state that only needs to be
+    // recalculated at block rate when a parameter changes.
+}
+
 void BaseEffectModule::MidiCCValueNotification(uint8_t control_num, uint8_t value) {
     // Handle the incoming Midi CC Value Notification if needed
     int effectParamID = GetMappedParameterIDForMidiCC(control_num);
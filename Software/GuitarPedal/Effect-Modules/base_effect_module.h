@@ -2,7 +2,10 @@
 #ifndef BASE_EFFECT_MODULE_H
 #define BASE_EFFECT_MODULE_H
 
+#include "../Util/memory_placement.h"
+#include "../Util/sdram_arena.h"
 #include "daisy_seed.h"
+#include <atomic>
 #include <stdint.h>
 #ifdef __cplusplus
 
@@ -32,6 +35,13 @@ enum ParameterValueCurve {
     InverseLog,
 };
 
+/** How changes to a Float Parameter are ramped by the audio processing */
+enum class ParameterSmoothingType {
+    None,        // Changes are applied at the start of the next block
+    Linear,      // Changes ramp linearly to the new value over smoothingTimeInSeconds
+    Exponential, // Changes approach the new value with a time constant of smoothingTimeInSeconds
+};
+
 // Meta data for an individual Effect Parameter.  Effects may have zero or more Parameters.
 // This data structure contains information about the Effect Parameter.
 struct ParameterMetaData {
@@ -47,6 +57,24 @@ struct ParameterMetaData {
     int minValue = 0;  // The minimum value of the parameter
     int maxValue = 1;  // The maximum value of the parameter
     float fineStepSize = 0.01f; // For Float Parameters, this will set the fineStepSize multiple in the menu
+    ParameterSmoothingType smoothingType = ParameterSmoothingType::None; // For Float Parameters, how value changes are ramped
+    float smoothingTimeInSeconds = 0.0f; // The ramp time (Linear) or time constant (Exponential) used for smoothing
+};
+
+// The smoothed value of a Parameter for the current block, evaluated once per block as a linear ramp
+struct ParameterSmoothingState {
+    float start;     // The value at the first sample of the block
+    float end;       // The value reached after the last sample of the block (the start of the next block)
+    float increment; // The per sample increment from start to end
+    float rate;      // Linear: the per sample step toward the target. Exponential: the per block coefficient
+};
+
+// A decoded copy of an Effect Parameter value. The snapshot is refreshed once per audio block so that the
+// audio processing can read plain values instead of decoding the raw parameter storage every sample.
+struct ParameterSnapshot {
+    float asFloat; // The value as a float (only meaningful for Float Parameters)
+    int asBinned;  // The value as a bin number 1..Bin Count (only meaningful for Binned Parameters)
+    bool asBool;   // The value as a bool, True when the raw value is greater than zero
 };
 
 class BaseEffectModule {
@@ -79,16 +107,6 @@ class BaseEffectModule {
     */
     void SetPresetCount(uint16_t preset_count);
 
-    /** Sets the start index of the Settings Array
-     \param the array index where settings for the effect start
-    */
-    void SetSettingsArrayStartIdx(uint32_t start_idx);
-
-    /** Gets the start position in settings for this effect
-     \return the the start position in settings array for this effect.
-    */
-    uint32_t GetSettingsArrayStartIdx() const;
-
     /** Sets the start index of the Settings Array
      \param the array index where settings for the effect start
     */
@@ -218,6 +236,13 @@ class BaseEffectModule {
     */
     void SetParameterAsBinnedValue(int parameter_id, int value);
 
+    /** Sets the Raw Values of all the Effect Parameters at once, ex. to recall a preset. The audio callback picks up every
+     * value that changed at the start of the same block, and each Parameter that changed gets a single ParameterChanged call.
+        \param values the uint32_t Values to set, in the same format as GetParameterRaw (Floats as their bits).
+        \param count the number of values, values past the last Parameter are ignored.
+    */
+    void SetParametersRaw(const uint32_t *values, int count);
+
     /** Processes the Effect in Mono for a single sample.  This should only be called once per sample. Also, if this is called, don't
      call ProcessStereo too. \param in Input sample.
     */
@@ -228,6 +253,59 @@ class BaseEffectModule {
     */
     virtual void ProcessStereo(float inL, float inR);
 
+    /** Refreshes the decoded Parameter Snapshot for any Parameters that changed since the last refresh, latches
+     which Parameters are dirty for this block, advances the smoothed Parameter ramps and delivers the deferred
+     ParameterChanged notifications, except the ones ProcessControlParameterChanges delivers from the main loop. This
+     should be called once at the start of every audio block, before ProcessBlock, from the audio callback. It does
+     nothing while the Effect is suspended (see IsSuspended).
+     \param size Number of samples in the upcoming block.
+     \param maxParameterChanges The maximum number of ParameterChanged notifications to deliver for this block, any
+     remaining notifications are delivered in the following blocks.
+    */
+    void UpdateParameterSnapshot(size_t size, int maxParameterChanges);
+
+    /** Delivers the ParameterChanged calls of the Parameters handled on the control thread (see
+     * SetParameterChangedOnControlThread), call regularly from the main loop. When one of them suspends processing the
+     * calls wait until the audio callback has stopped processing the Effect, so it can take a few calls to deliver them.
+     \param processedByAudio true if the audio callback may be processing the Effect, false to deliver them straight away
+    */
+    void ProcessControlParameterChanges(bool processedByAudio);
+
+    /** Suspends the Effect if ProcessControlParameterChanges asked for it. UpdateParameterSnapshot takes care of this, the
+     * audio callback calls it directly for the blocks it skips the Effect (bypassed, idle) so the main loop isn't left
+     * waiting on it.
+    */
+    void AcceptSuspendRequest() {
+        ControlUpdateState requested = ControlUpdateState::Requested;
+        m_controlUpdateState.compare_exchange_strong(requested, ControlUpdateState::Suspended, std::memory_order_acq_rel);
+    }
+
+    /** Checks if the Effect is suspended while the main loop changes it. The audio callback must not call ProcessBlock
+     * for a suspended Effect and outputs silence in its place, check after UpdateParameterSnapshot.
+     \return true while the Effect must not be processed
+    */
+    bool IsSuspended() const {
+        return m_controlUpdateState.load(std::memory_order_acquire) == ControlUpdateState::Suspended;
+    }
+
+    /** Processes the Effect for a whole block of samples. The default implementation adapts the block onto the per-sample
+     ProcessMono / ProcessStereo functions, so effects only need to override this when they have a tighter block based inner loop.
+     \param in Input buffers, in[0] is the Left (or Mono) channel and in[1] is the Right channel.
+     \param out Output buffers, out[0] is the Left channel and out[1] is the Right channel.
+     \param size Number of samples per channel in the block.
+    */
+    virtual void ProcessBlock(const float *const *in, float *const *out, size_t size);
+
+    /** Sets whether the default ProcessBlock implementation processes the effect in Stereo or Mono
+     \param isStereo True to call ProcessStereo, False to call ProcessMono.
+    */
+    void SetStereoProcessing(bool isStereo);
+
+    /** Returns if the Effect is being processed in Stereo
+     \return Value True if ProcessBlock processes in Stereo, False if it processes in Mono
+    */
+    bool IsStereoProcessing() const;
+
     /**  Gets the most recently calculated Sample Value for the Left Stereo Channel (or Mono)
      \return Last floating point sample for the left channel.
     */
@@ -258,6 +336,113 @@ class BaseEffectModule {
      */
     virtual void SetTempo(uint32_t bpm);
 
+    /** Sets the processing quality of this Effect. Level 0 is full quality and each higher level is a cheaper tier.
+     * This is called from the audio callback when the effect keeps overrunning the audio block deadline, effects
+     * with cheaper tiers override this (and GetQualityLevelCount) to apply them.
+     * @param level the quality level, clamped to 0..GetQualityLevelCount() - 1
+     */
+    virtual void SetQualityLevel(int level);
+
+    /** Gets the current processing quality level of this Effect
+     * @return the quality level, 0 is full quality
+     */
+    int GetQualityLevel() const;
+
+    /** Gets the number of quality levels this Effect supports
+     * @return the number of quality levels, 1 if the Effect has no cheaper tiers
+     */
+    virtual int GetQualityLevelCount() const;
+
+    /** Gets how long this Effect can hold sound internally while its output is silent, ex. the longest delay time.
+     * The Effect is only considered idle once its input and output have both been silent for this long.
+     * Effects returning more than 0 also keep their tail ringing out when bypassed (spillover). Effects that make
+     * sound without an input (loopers, synths, metronomes) return kInfiniteTail so they are never idle.
+     * @return the tail length in seconds, 0 for effects with no tail
+     */
+    virtual float GetTailLengthInSeconds() const;
+
+    /** Tracks the signal level of the block just processed to decide if this Effect has gone idle.
+     * Called by the audio callback after each processed block.
+     \param in the input buffers that were processed
+     \param out the output buffers that were produced
+     \param size the number of samples in the block
+    */
+    void UpdateIdleState(const float *const *in, const float *const *out, size_t size);
+
+    /** Returns whether this Effect has gone idle, ie. its input is silent and its tail has died out. Processing can be
+     * skipped while the input stays silent.
+     \return true if the Effect is idle
+    */
+    bool IsIdle() const;
+
+    /** Marks this Effect as idle, used when processing stops without the tail ringing out (ex. relay bypass) so the
+     * Effect knows its internal state is stale
+     */
+    void MarkIdle();
+
+    /** Checks if a block is below the idle threshold on both channels
+     \param buffer the buffers to check
+     \param size the number of samples in the block
+     \return true if every sample is below the idle threshold
+    */
+    static bool IsBlockSilent(const float *const *buffer, size_t size);
+
+    /** Records how long this Effect took to process one block. The estimate rises immediately and decays slowly
+     * so it leans towards the worst case.
+     \param ticks the processing time of the block, in Profiler ticks
+    */
+    void RecordProcessingCost(uint32_t ticks);
+
+    /** Gets the estimated worst case time this Effect takes to process one block
+     \return the processing time in Profiler ticks, 0 if the Effect has never been measured
+    */
+    uint32_t GetProcessingCostTicks() const;
+
+    /** Gets the number of Effects this module processes, more than one for modules that combine other Effects
+     \return the number of Effects processed
+    */
+    virtual int GetProcessedEffectCount() const;
+
+    /** Gets one of the Effects this module processes, used to check that no Effect is processed twice in a block
+     \param index the index of the Effect, 0..GetProcessedEffectCount() - 1
+     \return the Effect, this module itself for plain Effects
+    */
+    virtual const BaseEffectModule *GetProcessedEffect(int index) const;
+
+    /** Runs the expensive one time setup of this Effect (ex. loading model weights) if it hasn't run yet. Called from
+     * the main loop by the first AcquireResources, or ahead of time while the pedal has nothing else to do.
+     */
+    void PrepareResources();
+
+    /** Checks if the one time setup of this Effect has run
+     \return true once PrepareResources has been called
+    */
+    bool IsPrepared() const;
+
+    /** Hands this Effect the SDRAM it needs to process audio. Called from the main loop before the audio callback
+     * processes the Effect, the audio callback leaves an Effect alone until it has its resources.
+     \param arena the arena to allocate from
+     \return true if the Effect has its resources, false if the arena didn't have room (nothing is kept allocated)
+    */
+    bool AcquireResources(SdramArena &arena);
+
+    /** Gives the SDRAM of this Effect back to the arena, anything it was holding (ex. a recorded loop) is lost.
+     * Only call from the main loop once the audio callback has stopped processing the Effect.
+     \param arena the arena the resources were acquired from
+    */
+    void ReleaseResources(SdramArena &arena);
+
+    /** Checks if this Effect has the resources it needs to be processed
+     \return true between a successful AcquireResources and the next ReleaseResources
+    */
+    bool HasResources() const;
+
+    static constexpr float kInfiniteTail = -1.0f;  // Tail length for Effects that are never idle
+    static constexpr float kIdleThreshold = 1e-4f; // Signal level treated as silence (-80 dBFS)
+
+    // Memory region the instance of the Effect is placed in by load_effects, a module redeclares it to move out of DTCMRAM
+    static constexpr MemoryRegion kMemoryRegion = MemoryRegion::Dtcm;
+
     /** Handles updating the custom UI for this Effect.
      * @param elapsedTime a float value of how much time (in seconds) has elapsed since the last update
      */
@@ -317,13 +502,120 @@ class BaseEffectModule {
     */
     virtual void InitParams(int count);
 
-    /** This function gets called every time a parameter changes values.
-     * By default it does nothing, but it's a good one to override if your effect
+    /** This function gets called after a parameter changes values. Changes are deferred to the start of the next
+     * audio block and called from the audio callback (see UpdateParameterSnapshot), so several changes to the same
+     * parameter between two blocks result in a single call. Parameters set up with SetParameterChangedOnControlThread
+     * are called from the main loop instead. By default it does nothing, but it's a good one to override if your effect
      * needs to do things when specific parameters change.
      * @param parameter_id  The id of the parameter that changed.
      */
     virtual void ParameterChanged(int parameter_id);
 
+    /** Moves the ParameterChanged calls of a Parameter out of the audio callback to the main loop, for changes that take
+     * longer than an audio block (loading a model, copying an IR) or that allocate. Call after InitParams.
+        \param parameter_id Id of the parameter.
+        \param suspendProcessing true if the audio callback must not process the Effect during the call, ex. while a model
+        it runs is rebuilt. The Effect's output is silent for the few blocks that takes. With false the call must only
+        make changes the audio callback can pick up at any point, ex. new targets for values it ramps towards.
+    */
+    void SetParameterChangedOnControlThread(int parameter_id, bool suspendProcessing);
+
+    /** This function gets called from UpdateParameterSnapshot at the start of an audio block when one or more
+     * parameters changed since the previous block. By default it does nothing, override it to recalculate values that
+     * only need to change at block rate (filter coefficients, gains, etc) and use IsParameterDirty to see what changed.
+     */
+    virtual void ParameterSnapshotChanged();
+
+    /** Runs the setup that only needs to happen once but takes too long to do for every Effect at boot (ex. building
+     * tables or loading model weights), Init should only set up what the parameters and UI need. Called from the main
+     * loop before the first Acquire, while the Effect isn't processed.
+     */
+    virtual void Prepare();
+
+    /** Allocates the SDRAM this Effect needs and initializes what lives in it, override in Effects with large
+     * buffers instead of reserving them at link time. Called from the main loop while the Effect isn't processed.
+     \param arena the arena to allocate from
+     \return true on success, on failure Release is called to free whatever was allocated
+    */
+    virtual bool Acquire(SdramArena &arena);
+
+    /** Frees everything Acquire allocated, must cope with a partially completed Acquire
+     \param arena the arena to free to
+    */
+    virtual void Release(SdramArena &arena);
+
+    /** Gets the decoded float value of a Parameter from the current block's snapshot. No validation is done, this is
+     * intended for the audio processing hot path.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the float Value for given parameter.
+    */
+    float GetSnapshotAsFloat(int parameter_id) const { return m_paramSnapshot[parameter_id].asFloat; }
+
+    /** Gets the decoded bin number (1..Bin Count) of a Parameter from the current block's snapshot.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the bin number as an int value (1..Bin Count) of the specified parameter
+    */
+    int GetSnapshotAsBinnedValue(int parameter_id) const { return m_paramSnapshot[parameter_id].asBinned; }
+
+    /** Gets the decoded bool value of a Parameter from the current block's snapshot.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the Value of the specified parameter mapped to True / False
+    */
+    bool GetSnapshotAsBool(int parameter_id) const { return m_paramSnapshot[parameter_id].asBool; }
+
+    /** Checks if a Parameter changed since the previous audio block.
+        \param parameter_id Id of the parameter to check.
+        \return True if the parameter changed value for the current block.
+    */
+    bool IsParameterDirty(int parameter_id) const { return (m_paramDirtyMask[parameter_id >> 5] & (1U << (parameter_id & 31))) != 0; }
+
+    /** Gets the smoothed value of a Float Parameter for the sample currently being processed. Only valid from
+     * ProcessMono / ProcessStereo when they are driven by the default ProcessBlock implementation.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the smoothed float Value for given parameter.
+    */
+    float GetSmoothedParameter(int parameter_id) const {
+        const ParameterSmoothingState &state = m_paramSmoothing[parameter_id];
+        return state.start + state.increment * static_cast<float>(m_blockSampleIndex);
+    }
+
+    /** Gets the smoothed value of a Float Parameter at the first sample of the current block.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the smoothed float Value at the start of the block.
+    */
+    float GetSmoothedParameterStart(int parameter_id) const { return m_paramSmoothing[parameter_id].start; }
+
+    /** Gets the per sample increment of a smoothed Float Parameter for the current block, sample i of the block has the
+     * value GetSmoothedParameterStart + i * GetSmoothedParameterIncrement.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the per sample increment for the block.
+    */
+    float GetSmoothedParameterIncrement(int parameter_id) const { return m_paramSmoothing[parameter_id].increment; }
+
+    /** Gets the smoothed value of a Float Parameter reached at the end of the current block.
+        \param parameter_id Id of the parameter to retrieve.
+        \return the smoothed float Value at the end of the block.
+    */
+    float GetSmoothedParameterEnd(int parameter_id) const { return m_paramSmoothing[parameter_id].end; }
+
+    /** Checks if a smoothed Float Parameter is moving during the current block.
+        \param parameter_id Id of the parameter to check.
+        \return True if the value ramps during the current block.
+    */
+    bool IsParameterSmoothing(int parameter_id) const {
+        return m_paramSmoothing[parameter_id].start != m_paramSmoothing[parameter_id].end;
+    }
+
+    /** Fills a buffer with the per sample smoothed values of a Float Parameter for the current block.
+        \param parameter_id Id of the parameter to retrieve.
+        \param ramp the buffer to fill.
+        \param size Number of samples to fill, normally the block size.
+    */
+    void FillSmoothedParameterRamp(int parameter_id, float *ramp, size_t size) const;
+
+    /** Jumps every smoothed Parameter straight to its current value, ending any ramps in progress. */
+    void ResetParameterSmoothing();
+
     float GetSampleRate() const { return m_sampleRate; }
 
     const char *m_name;                       // Name of the Effect
@@ -334,9 +626,51 @@ class BaseEffectModule {
     const ParameterMetaData *m_paramMetaData; // Dynamic Array of the Meta Data for each Effect Parameter
     float m_audioLeft;                        // Last Audio Sample value for the Left Stereo Channel (or Mono)
     float m_audioRight;                       // Last Audio Sample value for the Right Stereo Channel
-    uint32_t m_settingsArrayStartIdx;         // Start index of settings persistent storage struct
   private:
+    /** Handshake between ProcessControlParameterChanges and the audio callback for the changes that suspend processing */
+    enum class ControlUpdateState : uint8_t {
+        Idle,      // The audio callback processes the Effect as usual
+        Requested, // The main loop is waiting for the audio callback to stop processing the Effect
+        Suspended, // The audio callback has stopped processing the Effect, the main loop can change it
+    };
+
+    /** Decodes the raw value of a Parameter into its snapshot entry */
+    void DecodeParameterSnapshot(int parameter_id);
+
+    /** Flags a Parameter as changed so it is decoded at the start of the next audio block */
+    void MarkParameterPending(int parameter_id);
+
+    /** Checks if a Parameter is a Float Parameter with smoothing enabled in its meta data */
+    bool HasParameterSmoothing(int parameter_id) const;
+
+    /** Advances the smoothing ramp of a Parameter by one block */
+    void UpdateParameterSmoothing(int parameter_id, size_t size, bool changed);
+
+    ParameterSnapshot *m_paramSnapshot;                   // Dynamic Array of the decoded Parameter values for the current block
+    std::atomic<uint32_t> *m_paramPendingMask;            // Bitmask of Parameters changed since the last snapshot refresh
+    uint32_t *m_paramDirtyMask;                           // Bitmask of Parameters that changed for the current block
+    uint32_t *m_paramNotifyMask;                          // Bitmask of Parameters still waiting for their ParameterChanged call
+    uint32_t *m_paramControlMask;                         // Bitmask of Parameters whose ParameterChanged runs on the main loop
+    uint32_t *m_paramSuspendMask;                         // Bitmask of those that suspend processing during the call
+    std::atomic<uint32_t> *m_paramControlPendingMask;     // Bitmask of Parameters waiting for their main loop ParameterChanged
+    std::atomic<ControlUpdateState> m_controlUpdateState; // Where the handshake for suspending processing is at
+    int m_paramMaskWordCount;                             // Number of 32bit words in the Parameter bitmasks
+    bool m_forceAllParametersDirty;                       // Report every Parameter as dirty on the next snapshot refresh
+    std::atomic<bool> m_paramChangesHeld;                 // Set while SetParametersRaw writes, the changes stay pending
+    ParameterSmoothingState *m_paramSmoothing;            // Dynamic Array of the smoothing ramp for each Parameter
+    int *m_smoothedParamIDs;                              // Dynamic Array of the IDs of the Parameters that have smoothing enabled
+    int m_smoothedParamCount;                             // Number of Parameters that have smoothing enabled
+    size_t m_smoothingBlockSize;                          // Block size the Exponential smoothing coefficients were calculated for
+    size_t m_blockSampleIndex;                            // Index of the sample being processed by the default ProcessBlock
     bool m_isEnabled;
+    int m_qualityLevel; // Current processing quality level, 0 is full quality
+    uint32_t m_silentSamples;         // Number of samples the input and output have both been silent for
+    bool m_isIdle;                    // True once the input and tail have died out
+    uint32_t m_processingCostTicks;   // Decaying peak of the block processing time, 0 if never measured
+    bool m_isPrepared;                // True once Prepare has run
+    std::atomic<bool> m_hasResources; // Set by the main loop once Acquire succeeded, read by the audio callback
+    bool m_resourcesReleased;         // True once ReleaseResources has been called, the next Acquire starts from scratch
+    bool m_isStereo; // True if ProcessBlock should drive ProcessStereo instead of ProcessMono
     float m_sampleRate; // Current Sample Rate this Effect was initialized for.
     float m_cpuUsage;   // CPU usage of the audio callback, can be used for rendering to display
 };
@@ -6,7 +6,7 @@
 // delay line memory to SDRAM (64MB available on Daisy)
 // #define CUSTOM_POOL_SIZE (48*1024*1024)
 // #define CUSTOM_POOL_SIZE (48*512*512) // works
-#define CUSTOM_POOL_SIZE (48 * 384 * 384) // Works! test more thoroughly with other presets, if it freezes, check here first TODO
+#define CUSTOM_POOL_SIZE bkshepherd::CloudSeedModule::kCustomPoolBytes
 // #define CUSTOM_POOL_SIZE (48*256*256) // freezes
 
 DSY_SDRAM_BSS char custom_pool[CUSTOM_POOL_SIZE];
@@ -134,6 +134,10 @@ static auto s_metaData = [] {
 //     Currently the max stereo line count is 2 on the Daisy Seed, so the presets will sound different than the desktop CloudSeed
 //     plugin.
 
+// Number of delay lines used at each quality level, the line count is the main cost of the reverb. The presets don't set
+// the line count so it carries over when the preset changes.
+static constexpr int s_lineCountForQualityLevel[] = {3, 2, 1};
+
 // Default Constructor
 CloudSeedModule::CloudSeedModule() : BaseEffectModule(), m_gainMin(0.0f), m_gainMax(1.0f), m_cachedEffectMagnitudeValue(1.0f) {
     // Set the name of the effect
@@ -144,6 +148,10 @@ CloudSeedModule::CloudSeedModule() : BaseEffectModule(), m_gainMin(0.0f), m_gain
 
     // Initialize Parameters for this Effect
     this->InitParams(static_cast<int>(s_metaData.size()));
+
+    // Changing the preset clears and rebuilds the reverb, which takes longer than a block, so it's done on the main loop
+    // with the Effect suspended
+    SetParameterChangedOnControlThread(PRESET, true);
 }
 
 // Destructor
@@ -157,17 +165,38 @@ void CloudSeedModule::Init(float sample_rate) {
     AudioLib::ValueTables::Init();
     CloudSeed::FastSin::Init();
 
-    reverb = new CloudSeed::ReverbController(sample_rate);
-    reverb->ClearBuffers();
-    reverb->initFactoryRubiKaFields();                // Not setting a preset at the beginning allows you to save the previous preset
-    reverb->SetParameter(::Parameter2::LineCount, 3); // 2 on factory chorus for stereo is max, 3 froze it
+    // The reverb is built in Acquire, once it has its memory pool
     CalculateMix();
 }
 
+bool CloudSeedModule::Acquire(SdramArena &arena) {
+    // The reverb's destructors can't give the pool back, so the reverb is built once in the static pool and kept from
+    // then on, nothing is taken from the arena
+    if (reverb == 0) {
+        pool_index = 0;
+        reverb = new CloudSeed::ReverbController(GetSampleRate());
+        reverb->initFactoryRubiKaFields(); // Not setting a preset at the beginning allows you to save the previous preset
+        reverb->SetParameter(::Parameter2::LineCount,
+                             s_lineCountForQualityLevel[GetQualityLevel()]); // 2 on factory chorus for stereo is max, 3 froze it
+    }
+
+    reverb->ClearBuffers();
+    return true;
+}
+
+void CloudSeedModule::Release(SdramArena &arena) {
+    // The pool is static and stays with the reverb, see Acquire
+}
+
 void CloudSeedModule::ParameterChanged(int parameter_id) // Somewhere here is causeing issues on start up, if I take them out it works,
                                                          // adding them in breaks, but it worked once???
 {
     if (parameter_id == PRESET) { // Preset
+        // The reverb is built in Acquire, which marks every parameter as changed so the preset is applied then
+        if (reverb == 0) {
+            return;
+        }
+
         // Change the preset and then override with current knob settings
         changePreset();
         if (GetParameterAsBool(
@@ -182,42 +211,35 @@ void CloudSeedModule::ParameterChanged(int parameter_id) // Somewhere here is ca
             reverb->SetParameter(::Parameter2::PostCutoffFrequency, GetParameterAsFloat(TONE));
         }
     } else {
-
-        if (throttle_counter > 5) {  // The calls to reverb settings need to be throttled, else it will freeze the pedal on startup
-                                     // TODO: This will prevent single param change calls (such as a single programmed midi message) to
-                                     // only work every 5 calls. Figure out a better fix
-            if (parameter_id == PRE_DELAY) { // {PreDelay
-                reverb->SetParameter(::Parameter2::PreDelay, GetParameterAsFloat(PRE_DELAY) * 0.95); // Was freezing pedal when set to 127
-            } else if (parameter_id == MIX) {                                                  // Mix
-                if (!inputMuteForWet) {
-                    linearChangeDryLevel.deactivate();
-                    // If the wet-input is not frozen, update the mix normally
-                    CalculateMix();
-                } else {
-                    // otherwise - update only the wet mix value
-                    currentMix.wet = CalculateMix(GetParameterAsFloat(MIX)).wet;
-                }
-            } else if (parameter_id == DECAY) { // Decay
-                reverb->SetParameter(::Parameter2::LineDecay, GetParameterAsFloat(DECAY));
-            } else if (parameter_id == MOD_AMT) { // Mod Amt
-                reverb->SetParameter(::Parameter2::LineModAmount, GetParameterAsFloat(MOD_AMT));
-            } else if (parameter_id == MOD_RATE) { // Mod Rate
-                reverb->SetParameter(::Parameter2::LineModRate, GetParameterAsFloat(MOD_RATE));
-            } else if (parameter_id == TONE) { // Tone
-                reverb->SetParameter(
-                    ::Parameter2::CutoffEnabled,
-                    1.0); // If this knob is moved, turn on the cutoff filter, the presets will reset this on/off as needed
-                reverb->SetParameter(::Parameter2::PostCutoffFrequency, GetParameterAsFloat(TONE));
-            } else if (parameter_id == DRY_VOLUME) { // Dry Volume, when wet-input is muted
-                if (inputMuteForWet) {
-                    linearChangeDryLevel.deactivate();
-                    // When wet-input is frozen, this knob controls the dry input volume for the mix directly
-                    currentMix.dry = GetParameterAsFloat(DRY_VOLUME);
-                }
+        if (parameter_id == PRE_DELAY) { // {PreDelay
+            reverb->SetParameter(::Parameter2::PreDelay, GetParameterAsFloat(PRE_DELAY) * 0.95); // Was freezing pedal when set to 127
+        } else if (parameter_id == MIX) { // Mix
+            if (!inputMuteForWet) {
+                linearChangeDryLevel.deactivate();
+                // If the wet-input is not frozen, update the mix normally
+                CalculateMix();
+            } else {
+                // otherwise - update only the wet mix value
+                currentMix.wet = CalculateMix(GetParameterAsFloat(MIX)).wet;
+            }
+        } else if (parameter_id == DECAY) { // Decay
+            reverb->SetParameter(::Parameter2::LineDecay, GetParameterAsFloat(DECAY));
+        } else if (parameter_id == MOD_AMT) { // Mod Amt
+            reverb->SetParameter(::Parameter2::LineModAmount, GetParameterAsFloat(MOD_AMT));
+        } else if (parameter_id == MOD_RATE) { // Mod Rate
+            reverb->SetParameter(::Parameter2::LineModRate, GetParameterAsFloat(MOD_RATE));
+        } else if (parameter_id == TONE) { // Tone
+            reverb->SetParameter(
+                ::Parameter2::CutoffEnabled,
+                1.0); // If this knob is moved, turn on the cutoff filter, the presets will reset this on/off as needed
+            reverb->SetParameter(::Parameter2::PostCutoffFrequency, GetParameterAsFloat(TONE));
+        } else if (parameter_id == DRY_VOLUME) { // Dry Volume, when wet-input is muted
+            if (inputMuteForWet) {
+                linearChangeDryLevel.deactivate();
+                // When wet-input is frozen, this knob controls the dry input volume for the mix directly
+                currentMix.dry = GetParameterAsFloat(DRY_VOLUME);
             }
-            throttle_counter = 0;
         }
-        throttle_counter += 1;
     }
 }
 
@@ -241,6 +263,18 @@ void CloudSeedModule::AlternateFootswitchPressed() {
     }
 }
 
+void CloudSeedModule::SetQualityLevel(int level) {
+    BaseEffectModule::SetQualityLevel(level);
+
+    if (reverb != 0) {
+        reverb->SetParameter(::Parameter2::LineCount, s_lineCountForQualityLevel[GetQualityLevel()]);
+    }
+}
+
+int CloudSeedModule::GetQualityLevelCount() const {
+    return sizeof(s_lineCountForQualityLevel) / sizeof(s_lineCountForQualityLevel[0]);
+}
+
 void CloudSeedModule::changePreset() {
 
     int c = (GetParameterAsBinnedValue(PRESET) - 1);
@@ -38,17 +38,28 @@ class CloudSeedModule : public BaseEffectModule {
         PARAM_COUNT
     };
 
+    // Bytes of the SDRAM pool the reverb's delay lines are allocated from. The reverb can't give them back, so the pool
+    // is a static of its own that the firmware leaves out of the SDRAM arena. Works! test more thoroughly with other
+    // presets, if it freezes, check here first TODO
+    static constexpr size_t kCustomPoolBytes = 48 * 384 * 384;
+
     CloudSeedModule();
     ~CloudSeedModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
     void changePreset();
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    // Covers the pre delay, the reverb output decays continuously after that
+    float GetTailLengthInSeconds() const override { return 1.0f; }
     bool AlternateFootswitchForTempo() const override { return false; }
     void AlternateFootswitchPressed() override;
+    void SetQualityLevel(int level) override;
+    int GetQualityLevelCount() const override;
 
   private:
     struct Mix {
@@ -63,7 +74,6 @@ class CloudSeedModule : public BaseEffectModule {
 
     float m_gainMin;
     float m_gainMax;
-    int throttle_counter = 0;
 
     Mix currentMix;
 
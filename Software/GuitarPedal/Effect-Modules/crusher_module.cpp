@@ -175,6 +175,15 @@ void CrusherModule::ParameterChanged(int parameter_id) {
     }
 }
 
+void CrusherModule::ParameterSnapshotChanged() {
+    // The low pass filter coefficients only need to be recalculated when the cutoff moves
+    if(IsParameterDirty(CUTOFF)) {
+        const float cutoff = m_cutoffMin + GetSnapshotAsFloat(CUTOFF) * (m_cutoffMax - m_cutoffMin);
+        m_lpFilter[0].config(cutoff, m_rateMax);
+        m_lpFilter[1].config(cutoff, m_rateMax);
+    }
+}
+
 float CrusherModule::GetRateControlForFrequency(float rate) const {
     const float clampedRate = std::clamp(rate, m_rateMin, m_rateMax);
     const float rateRange = m_rateMax / m_rateMin;
@@ -199,7 +208,7 @@ float CrusherModule::GetBrightnessForLED(int led_id) const {
 float CrusherModule::GetSrrRate(float detectorInput) {
     const float manualRate = m_rateMin * powf(m_rateMax / m_rateMin, m_manualRateControl);
 
-    if(!GetParameterAsBool(PITCH_TRACKING)) {
+    if(!GetSnapshotAsBool(PITCH_TRACKING)) {
         return manualRate;
     }
 
@@ -209,7 +218,7 @@ float CrusherModule::GetSrrRate(float detectorInput) {
         m_pitchDetector.Init(m_rateMax);
     }
 
-    const float rateControl = GetParameterAsFloat(RATE);
+    const float rateControl = GetSnapshotAsFloat(RATE);
     const int multiplierIndex =
         std::clamp(static_cast<int>(rateControl * static_cast<float>(std::size(s_pitchTrackMultipliers))), 0, static_cast<int>(std::size(s_pitchTrackMultipliers)) - 1);
     const float trackedRate = m_pitchDetector.Process(detectorInput) * s_pitchTrackMultipliers[multiplierIndex];
@@ -225,14 +234,12 @@ float CrusherModule::GetSrrRate(float detectorInput) {
 void CrusherModule::ProcessMono(float in) {
     BaseEffectModule::ProcessMono(in);
 
-    float level = GetParameterAsFloat(LEVEL);
-    float bits = (float)GetParameterAsBinnedValue(BITS);
+    float level = GetSnapshotAsFloat(LEVEL);
+    float bits = (float)GetSnapshotAsBinnedValue(BITS);
     float rate = GetSrrRate(in);
-    float jitter = GetParameterAsFloat(JITTER);
-    float cutoff = m_cutoffMin + GetParameterAsFloat(CUTOFF) * (m_cutoffMax - m_cutoffMin);
-    float mix = GetParameterAsFloat(MIX);
+    float jitter = GetSnapshotAsFloat(JITTER);
+    float mix = GetSnapshotAsFloat(MIX);
 
-    m_lpFilter[0].config(cutoff, m_rateMax);
     m_bitcrusherL.setNumberOfBits(bits);
     m_bitcrusherL.setTargetSampleRate(rate);
     m_bitcrusherL.setJitter(jitter);
@@ -247,15 +254,11 @@ void CrusherModule::ProcessMono(float in) {
 void CrusherModule::ProcessStereo(float inL, float inR) {
     BaseEffectModule::ProcessStereo(inL, inR);
 
-    float level = GetParameterAsFloat(LEVEL);
-    float bits = (float)GetParameterAsBinnedValue(BITS);
+    float level = GetSnapshotAsFloat(LEVEL);
+    float bits = (float)GetSnapshotAsBinnedValue(BITS);
     float rate = GetSrrRate(0.5f * (inL + inR));
-    float jitter = GetParameterAsFloat(JITTER);
-    float cutoff = m_cutoffMin + GetParameterAsFloat(CUTOFF) * (m_cutoffMax - m_cutoffMin);
-    float mix = GetParameterAsFloat(MIX);
-
-    m_lpFilter[0].config(cutoff, m_rateMax);
-    m_lpFilter[1].config(cutoff, m_rateMax);
+    float jitter = GetSnapshotAsFloat(JITTER);
+    float mix = GetSnapshotAsFloat(MIX);
 
     m_bitcrusherL.setNumberOfBits(bits);
     m_bitcrusherL.setTargetSampleRate(rate);
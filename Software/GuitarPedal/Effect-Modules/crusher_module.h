@@ -129,6 +129,7 @@ class CrusherModule : public BaseEffectModule {
     bool AlternateFootswitchForTempo() const override { return false; }
     void AlternateFootswitchPressed() override;
     void ParameterChanged(int parameter_id) override;
+    void ParameterSnapshotChanged() override;
 
   private:
     Bitcrusher m_bitcrusherL;
@@ -12,12 +12,6 @@ static const char *s_modParamNames[4] = {"None", "DelayTime", "DelayLevel", "Del
 static const char *s_delayModes[3] = {"Normal", "Triplett", "Dotted 8th"};
 static const char *s_delayTypes[6] = {"Forward", "Reverse", "Octave", "ReverseOct", "Dual", "DualOct"};
 
-DelayLineRevOct<float, MAX_DELAY_NORM> DSY_SDRAM_BSS delayLineLeft;
-DelayLineRevOct<float, MAX_DELAY_NORM> DSY_SDRAM_BSS delayLineRight;
-DelayLineReverse<float, MAX_DELAY_REV> DSY_SDRAM_BSS delayLineRevLeft;
-DelayLineReverse<float, MAX_DELAY_REV> DSY_SDRAM_BSS delayLineRevRight;
-DelayLine<float, MAX_DELAY_SPREAD> DSY_SDRAM_BSS delayLineSpread;
-
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, DelayModule::PARAM_COUNT> params{};
 
@@ -182,28 +176,24 @@ void DelayModule::CalculateDelayMix() {
 void DelayModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
 
-    delayLineLeft.Init();
-    delayLineRevLeft.Init();
-    delayLeft.del = &delayLineLeft;
-    delayLeft.delreverse = &delayLineRevLeft;
+    // The delay lines are allocated from the SDRAM arena in Acquire
+    delayLeft.del = nullptr;
+    delayLeft.delreverse = nullptr;
     delayLeft.delayTarget = 24000; // in samples
     delayLeft.feedback = 0.0;
     delayLeft.active = true; // Default to no delay
     delayLeft.toneOctLP.Init(sample_rate);
     delayLeft.toneOctLP.SetFreq(20000.0);
 
-    delayLineRight.Init();
-    delayLineRevRight.Init();
-    delayRight.del = &delayLineRight;
-    delayRight.delreverse = &delayLineRevRight;
+    delayRight.del = nullptr;
+    delayRight.delreverse = nullptr;
     delayRight.delayTarget = 24000; // in samples
     delayRight.feedback = 0.0;
     delayRight.active = true; // Default to no
     delayRight.toneOctLP.Init(sample_rate);
     delayRight.toneOctLP.SetFreq(20000.0);
 
-    delayLineSpread.Init();
-    delaySpread.del = &delayLineSpread;
+    delaySpread.del = nullptr;
     delaySpread.delayTarget = 1500; // in samples
     delaySpread.active = true;
 
@@ -221,6 +211,41 @@ void DelayModule::Init(float sample_rate) {
     CalculateDelayMix();
 }
 
+bool DelayModule::Acquire(SdramArena &arena) {
+    delayLeft.del = arena.Create<DelayLineRevOct<float, MAX_DELAY_NORM>>(GetName());
+    delayLeft.delreverse = arena.Create<DelayLineReverse<float, MAX_DELAY_REV>>(GetName());
+    delayRight.del = arena.Create<DelayLineRevOct<float, MAX_DELAY_NORM>>(GetName());
+    delayRight.delreverse = arena.Create<DelayLineReverse<float, MAX_DELAY_REV>>(GetName());
+    delaySpread.del = arena.Create<DelayLineWatermark<float, MAX_DELAY_SPREAD>>(GetName());
+
+    if (delayLeft.del == nullptr || delayLeft.delreverse == nullptr || delayRight.del == nullptr ||
+        delayRight.delreverse == nullptr || delaySpread.del == nullptr) {
+        return false;
+    }
+
+    delayLeft.del->Init();
+    delayLeft.delreverse->Init();
+    delayRight.del->Init();
+    delayRight.delreverse->Init();
+    delaySpread.del->Init();
+
+    return true;
+}
+
+void DelayModule::Release(SdramArena &arena) {
+    arena.Free(delayLeft.del);
+    arena.Free(delayLeft.delreverse);
+    arena.Free(delayRight.del);
+    arena.Free(delayRight.delreverse);
+    arena.Free(delaySpread.del);
+
+    delayLeft.del = nullptr;
+    delayLeft.delreverse = nullptr;
+    delayRight.del = nullptr;
+    delayRight.delreverse = nullptr;
+    delaySpread.del = nullptr;
+}
+
 void DelayModule::ParameterChanged(int parameter_id) {
     if (parameter_id == DELAY_TIME) { // Delay Time
         UpdateLEDRate();
@@ -249,21 +274,21 @@ void DelayModule::ParameterChanged(int parameter_id) {
 }
 
 void DelayModule::ProcessModulation() {
-    int modParam = (GetParameterAsBinnedValue(MOD_PARAM) - 1);
+    int modParam = (GetSnapshotAsBinnedValue(MOD_PARAM) - 1);
     // Calculate Modulation
 
-    int waveForm = GetParameterAsBinnedValue(MOD_WAVE) - 1;
+    int waveForm = GetSnapshotAsBinnedValue(MOD_WAVE) - 1;
     float wowDepth = 2.0f;
     float flutterDepth = 2.0f;
     if (waveForm == 5) { // If using tape modulation
-        float freq = GetParameterAsFloat(MOD_RATE);
+        float freq = GetSnapshotAsFloat(MOD_RATE);
         float wowRate = 0.2f + 2.0f * freq;
         float flutterRate = 2.0f + 5.0f * freq;
         m_currentMod = modTape.GetTapeSpeed(wowRate, flutterRate, wowDepth, flutterDepth);
     } else {
         modOsc.SetWaveform(waveForm);
 
-        if (GetParameterAsBool(SYNC_MOD_F)) { // If mod frequency synced to delay time, override mod rate setting
+        if (GetSnapshotAsBool(SYNC_MOD_F)) { // If mod frequency synced to delay time, override mod rate setting
             float dividor;
             if (modParam == 2 || modParam == 3) {
                 dividor = 2.0;
@@ -273,7 +298,7 @@ void DelayModule::ProcessModulation() {
             float freq = (effect_samplerate / delayLeft.delayTarget) / dividor;
             modOsc.SetFreq(freq);
         } else {
-            modOsc.SetFreq(m_modOscFreqMin + (m_modOscFreqMax - m_modOscFreqMin) * GetParameterAsFloat(MOD_RATE));
+            modOsc.SetFreq(m_modOscFreqMin + (m_modOscFreqMax - m_modOscFreqMin) * GetSnapshotAsFloat(MOD_RATE));
         }
 
         // Ease the effect value into it's target to avoid clipping with square or sawtooth waves
@@ -281,12 +306,12 @@ void DelayModule::ProcessModulation() {
     }
 
     float mod = m_currentMod;
-    float mod_amount = GetParameterAsFloat(MOD_AMT);
+    float mod_amount = GetSnapshotAsFloat(MOD_AMT);
 
     // {"None", "DelayTime", "DelayLevel", "Level", "DelayPan"};
     if (modParam == 1) {
         float delayTarget;
-        float timeParam = GetParameterAsFloat(DELAY_TIME);
+        float timeParam = GetSnapshotAsFloat(DELAY_TIME);
         const float D_min = 1.0f; // minimum allowable delay time: 1 sample
 
         if (waveForm == 5) {
@@ -337,15 +362,15 @@ void DelayModule::ProcessMono(float in) {
     m_LEDValue = led_osc.Process(); // update the tempo LED
 
     // Calculate the effect
-    int delayType = GetParameterAsBinnedValue(DELAY_TYPE) - 1;
+    int delayType = GetSnapshotAsBinnedValue(DELAY_TYPE) - 1;
 
-    float timeParam = GetParameterAsFloat(DELAY_TIME);
+    float timeParam = GetSnapshotAsFloat(DELAY_TIME);
 
     delayLeft.delayTarget = m_delaySamplesMin + (m_delaySamplesMax - m_delaySamplesMin) * timeParam;
     delayRight.delayTarget = m_delaySamplesMin + (m_delaySamplesMax - m_delaySamplesMin) * timeParam;
 
-    delayLeft.feedback = GetParameterAsFloat(D_FEEDBACK);
-    delayRight.feedback = GetParameterAsFloat(D_FEEDBACK);
+    delayLeft.feedback = GetSnapshotAsFloat(D_FEEDBACK);
+    delayRight.feedback = GetSnapshotAsFloat(D_FEEDBACK);
     if (delayType == 1 || delayType == 3) {
         delayLeft.reverseMode = true;
         delayRight.reverseMode = true;
@@ -369,11 +394,11 @@ void DelayModule::ProcessMono(float in) {
     }
 
     if (delayType == 4 || delayType == 5) { // If dual delay is turned on, spread controls the L/R panning of the two delays
-        delayLeft.level = GetParameterAsFloat(D_SPREAD) + 1.0;
-        delayRight.level = 1.0 - GetParameterAsFloat(D_SPREAD);
+        delayLeft.level = GetSnapshotAsFloat(D_SPREAD) + 1.0;
+        delayRight.level = 1.0 - GetSnapshotAsFloat(D_SPREAD);
 
-        delayLeft.level_reverse = 1.0 - GetParameterAsFloat(D_SPREAD);
-        delayRight.level_reverse = GetParameterAsFloat(D_SPREAD) + 1.0;
+        delayLeft.level_reverse = 1.0 - GetSnapshotAsFloat(D_SPREAD);
+        delayRight.level_reverse = GetSnapshotAsFloat(D_SPREAD) + 1.0;
 
     } else { // If dual delay is off reset the levels to normal, spread controls the amount of additional delay applied to the right
              // channel
@@ -392,9 +417,9 @@ void DelayModule::ProcessMono(float in) {
     // float delRight_out = delLeft_out;
 
     // Calculate any delay spread
-    delaySpread.delayTarget = m_delaySpreadMin + (m_delaySpreadMax - m_delaySpreadMin) * GetParameterAsFloat(D_SPREAD);
+    delaySpread.delayTarget = m_delaySpreadMin + (m_delaySpreadMax - m_delaySpreadMin) * GetSnapshotAsFloat(D_SPREAD);
     float delSpread_out = delaySpread.Process(delRight_out);
-    if (GetParameterRaw(D_SPREAD) > 0 && delayType != 4 && delayType != 5) {
+    if (GetSnapshotAsFloat(D_SPREAD) > 0.0f && delayType != 4 && delayType != 5) {
         delRight_out = delSpread_out;
     }
 
@@ -412,15 +437,15 @@ void DelayModule::ProcessStereo(float inL, float inR) {
     m_LEDValue = led_osc.Process(); // update the tempo LED
 
     // Calculate the effect
-    int delayType = GetParameterAsBinnedValue(DELAY_TYPE) - 1;
+    int delayType = GetSnapshotAsBinnedValue(DELAY_TYPE) - 1;
 
-    float timeParam = GetParameterAsFloat(DELAY_TIME);
+    float timeParam = GetSnapshotAsFloat(DELAY_TIME);
 
     delayLeft.delayTarget = m_delaySamplesMin + (m_delaySamplesMax - m_delaySamplesMin) * timeParam;
     delayRight.delayTarget = m_delaySamplesMin + (m_delaySamplesMax - m_delaySamplesMin) * timeParam;
 
-    delayLeft.feedback = GetParameterAsFloat(D_FEEDBACK);
-    delayRight.feedback = GetParameterAsFloat(D_FEEDBACK);
+    delayLeft.feedback = GetSnapshotAsFloat(D_FEEDBACK);
+    delayRight.feedback = GetSnapshotAsFloat(D_FEEDBACK);
     if (delayType == 1 || delayType == 3) {
         delayLeft.reverseMode = true;
         delayRight.reverseMode = true;
@@ -444,11 +469,11 @@ void DelayModule::ProcessStereo(float inL, float inR) {
     }
 
     if (delayType == 4 || delayType == 5) { // If dual delay is turned on, spread controls the L/R panning of the two delays
-        delayLeft.level = GetParameterAsFloat(D_SPREAD) + 1.0;
-        delayRight.level = 1.0 - GetParameterAsFloat(D_SPREAD);
+        delayLeft.level = GetSnapshotAsFloat(D_SPREAD) + 1.0;
+        delayRight.level = 1.0 - GetSnapshotAsFloat(D_SPREAD);
 
-        delayLeft.level_reverse = 1.0 - GetParameterAsFloat(D_SPREAD);
-        delayRight.level_reverse = GetParameterAsFloat(D_SPREAD) + 1.0;
+        delayLeft.level_reverse = 1.0 - GetSnapshotAsFloat(D_SPREAD);
+        delayRight.level_reverse = GetSnapshotAsFloat(D_SPREAD) + 1.0;
 
     } else { // If dual delay is off reset the levels to normal, spread controls the amount of additional delay applied to the right
              // channel
@@ -467,9 +492,9 @@ void DelayModule::ProcessStereo(float inL, float inR) {
     // float delRight_out = delLeft_out;
 
     // Calculate any delay spread
-    delaySpread.delayTarget = m_delaySpreadMin + (m_delaySpreadMax - m_delaySpreadMin) * GetParameterAsFloat(D_SPREAD);
+    delaySpread.delayTarget = m_delaySpreadMin + (m_delaySpreadMax - m_delaySpreadMin) * GetSnapshotAsFloat(D_SPREAD);
     float delSpread_out = delaySpread.Process(delRight_out);
-    if (GetParameterRaw(D_SPREAD) > 0 && delayType != 4 && delayType != 5) {
+    if (GetSnapshotAsFloat(D_SPREAD) > 0.0f && delayType != 4 && delayType != 5) {
         delRight_out = delSpread_out;
     }
 
@@ -4,6 +4,7 @@
 
 #include "Delays/delayline_reverse.h"
 #include "Delays/delayline_revoct.h"
+#include "Delays/delayline_watermark.h"
 #include "../Util/tape_modulator.h"
 #include "base_effect_module.h"
 #include "daisysp.h"
@@ -93,7 +94,7 @@ struct delayRevOct {
 //    A short, zero feedback (one repeat) delay for stereo spread
 
 struct delay_spread {
-    DelayLine<float, MAX_DELAY_SPREAD> *del;
+    DelayLineWatermark<float, MAX_DELAY_SPREAD> *del;
     float currentDelay;
     float delayTarget;
     float active = false;
@@ -138,12 +139,15 @@ class DelayModule : public BaseEffectModule {
     void Init(float sample_rate) override;
     void UpdateLEDRate();
     void CalculateDelayMix();
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
     void ProcessModulation();
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     void SetTempo(uint32_t bpm) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return static_cast<float>(MAX_DELAY_NORM) / GetSampleRate(); }
     int GetMappedParameterIDForKnob(int knob_id) const override;
     void AlternateFootswitchHeldFor1Second() override;
     void DrawUI(OneBitGraphicsDisplay &display, int currentIndex, int numItemsTotal, Rectangle boundsToDrawIn,
@@ -14,7 +14,8 @@ cycfi::q::highpass preFilter(preFilterCutoffBase, 48000); // Dummy values that g
 cycfi::q::lowpass postFilter(postFilterCutoff, 48000);    // Dummy values that get overwritten in Init
 cycfi::q::lowpass upsamplingLowpassFilter(0.0f, 48000);   // Dummy values that get overwritten in Init
 
-constexpr uint8_t oversamplingFactor = 16;
+// Oversampling factor used at each quality level, lower levels trade aliasing for processing time
+static constexpr uint8_t s_oversamplingFactorForQualityLevel[] = {16, 4, 1};
 
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, DistortionModule::PARAM_COUNT> params{};
@@ -102,19 +103,20 @@ void DistortionModule::Init(float sample_rate) {
     m_tone.SetFreq(500.0f + 1500.0f * GetParameterAsFloat(TONE));
 
     m_oversampling = GetParameterAsBool(OVERSAMP);
+    m_oversamplingFactor = s_oversamplingFactorForQualityLevel[GetQualityLevel()];
     InitializeFilters();
 }
 
 void DistortionModule::InitializeFilters() {
     preFilter.config(preFilterCutoffBase, GetSampleRate());
 
-    if (m_oversampling) {
-        postFilter.config(postFilterCutoff, GetSampleRate() * oversamplingFactor);
+    if (m_oversampling && m_oversamplingFactor > 1) {
+        postFilter.config(postFilterCutoff, GetSampleRate() * m_oversamplingFactor);
     } else {
         postFilter.config(postFilterCutoff, GetSampleRate());
     }
 
-    upsamplingLowpassFilter.config(GetSampleRate() / (2.0f * static_cast<float>(oversamplingFactor)), GetSampleRate());
+    upsamplingLowpassFilter.config(GetSampleRate() / (2.0f * static_cast<float>(m_oversamplingFactor)), GetSampleRate());
 }
 
 void DistortionModule::ParameterChanged(int parameter_id) {
@@ -127,6 +129,21 @@ void DistortionModule::ParameterChanged(int parameter_id) {
     }
 }
 
+void DistortionModule::SetQualityLevel(int level) {
+    BaseEffectModule::SetQualityLevel(level);
+
+    const uint8_t factor = s_oversamplingFactorForQualityLevel[GetQualityLevel()];
+
+    if (factor != m_oversamplingFactor) {
+        m_oversamplingFactor = factor;
+        InitializeFilters();
+    }
+}
+
+int DistortionModule::GetQualityLevelCount() const {
+    return sizeof(s_oversamplingFactorForQualityLevel) / sizeof(s_oversamplingFactorForQualityLevel[0]);
+}
+
 float hardClipping(float input, float threshold) { return std::clamp(input, -threshold, threshold); }
 
 float diodeClipping(float input, float threshold) {
@@ -264,10 +281,10 @@ void DistortionModule::ProcessMono(float in) {
     // Reduce signal amplitude before clipping
     distorted = distorted * 0.5f;
 
-    if (m_oversampling) {
+    if (m_oversampling && m_oversamplingFactor > 1) {
         // Prepare signal for oversampling
         std::vector<float> monoInput = {distorted};
-        std::vector<float> oversampledInput = upsample(monoInput, oversamplingFactor, GetSampleRate());
+        std::vector<float> oversampledInput = upsample(monoInput, m_oversamplingFactor, GetSampleRate());
 
         // Apply gain and distortion processing
         for (float &sample : oversampledInput) {
@@ -278,11 +295,11 @@ void DistortionModule::ProcessMono(float in) {
         }
 
         // Downsample back to original sample rate
-        const std::vector<float> downsampledOutput = downsample(oversampledInput, oversamplingFactor);
+        const std::vector<float> downsampledOutput = downsample(oversampledInput, m_oversamplingFactor);
         distorted = downsampledOutput[0];
 
         // Apply gain compensation for oversampling
-        distorted *= oversamplingFactor;
+        distorted *= m_oversamplingFactor;
     } else {
         processDistortion(distorted, gain, clippingType, intensity);
 
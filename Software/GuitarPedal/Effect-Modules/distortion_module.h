@@ -35,6 +35,8 @@ class DistortionModule : public BaseEffectModule {
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    void SetQualityLevel(int level) override;
+    int GetQualityLevelCount() const override;
 
   private:
     float ProcessTiltToneControl(float in);
@@ -49,6 +51,7 @@ class DistortionModule : public BaseEffectModule {
     Tone m_tone;
 
     bool m_oversampling;
+    uint8_t m_oversamplingFactor; // Set by the quality level, oversampling is skipped when this is 1
 };
 } // namespace bkshepherd
 #endif
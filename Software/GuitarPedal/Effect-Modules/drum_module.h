@@ -41,6 +41,7 @@ class DrumModule : public BaseEffectModule {
     void OnNoteOff(float notenumber, float velocity) override;
     void SetTempo(uint32_t bpm) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return kInfiniteTail; }
 
   private:
     int instrument_;
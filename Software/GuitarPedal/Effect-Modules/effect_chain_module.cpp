@@ -0,0 +1,420 @@
+#include "effect_chain_module.h"
+#include "../Util/rt_safety.h"
+
+using namespace bkshepherd;
+
+// Checks if any of the first count slots holds an Effect
+static bool SlotsContain(const EffectChainModule::Slot *slots, int effectID, int count = EffectChainModule::kMaxSlots) {
+    for (int i = 0; i < count; i++) {
+        if (slots[i].effectID == effectID) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Default Constructor
+EffectChainModule::EffectChainModule()
+    : BaseEffectModule(), m_effects(nullptr), m_effectCount(0), m_maxParameterChangesPerBlock(1), m_hasPendingSlots(false),
+      m_slotProfiles{ProfilerStage("Slot 1"), ProfilerStage("Slot 2"), ProfilerStage("Slot 3"), ProfilerStage("Slot 4")} {
+    m_name = "Chain";
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        m_slots[i] = {kEmptySlot, false};
+        m_pendingSlots[i] = {kEmptySlot, false};
+    }
+
+    for (int i = 0; i < 2; i++) {
+        m_scratch[i][0] = m_scratchLeft[i];
+        m_scratch[i][1] = m_scratchRight[i];
+    }
+}
+
+// Destructor
+EffectChainModule::~EffectChainModule() {
+    // No Code Needed
+}
+
+void EffectChainModule::Init(float sample_rate) { BaseEffectModule::Init(sample_rate); }
+
+void EffectChainModule::SetAvailableEffects(BaseEffectModule **effects, int count, int maxParameterChangesPerBlock) {
+    m_effects = effects;
+    m_effectCount = count;
+    m_maxParameterChangesPerBlock = maxParameterChangesPerBlock;
+}
+
+void EffectChainModule::SetSlots(const Slot *slots) {
+    Slot previousSlots[kMaxSlots];
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        previousSlots[i] = m_slots[i];
+        m_slots[i] = slots[i];
+
+        // Ignore Effects that don't exist (ex. from settings saved with a different set of Effects), and an Effect
+        // can only be in one slot since it holds a single set of state
+        if (m_slots[i].effectID < 0 || m_slots[i].effectID >= m_effectCount || SlotsContain(m_slots, m_slots[i].effectID, i)) {
+            m_slots[i].effectID = kEmptySlot;
+        }
+    }
+
+    // Stop the Effects that left the chain, their tails are cut off so their state is stale
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (previousSlots[i].effectID == kEmptySlot) {
+            continue;
+        }
+
+        BaseEffectModule *effect = m_effects[previousSlots[i].effectID];
+
+        if (!ContainsEffect(effect)) {
+            effect->SetEnabled(false);
+            effect->MarkIdle();
+        }
+    }
+
+    // Effects joining the chain start from silence with the chain's state
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr && !SlotsContain(previousSlots, m_slots[i].effectID)) {
+            effect->SetEnabled(IsEnabled());
+            effect->SetQualityLevel(GetQualityLevel());
+            effect->MarkIdle();
+        }
+    }
+}
+
+void EffectChainModule::SetPendingSlots(const Slot *slots) {
+    for (int i = 0; i < kMaxSlots; i++) {
+        m_pendingSlots[i] = slots[i];
+    }
+
+    m_hasPendingSlots = true;
+}
+
+void EffectChainModule::ApplyPendingSlots() {
+    if (!m_hasPendingSlots) {
+        return;
+    }
+
+    m_hasPendingSlots = false;
+    SetSlots(m_pendingSlots);
+}
+
+bool EffectChainModule::HasEffects() const {
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (m_slots[i].effectID != kEmptySlot) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool EffectChainModule::ContainsEffect(const BaseEffectModule *effect) const {
+    if (effect == nullptr) {
+        return false;
+    }
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (GetSlotEffect(i) == effect) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t EffectChainModule::EstimateCostTicks(const Slot *slots) const {
+    uint32_t cost = 0;
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (slots[i].effectID >= 0 && slots[i].effectID < m_effectCount && !slots[i].bypassed) {
+            cost += m_effects[slots[i].effectID]->GetProcessingCostTicks();
+        }
+    }
+
+    return cost;
+}
+
+uint32_t EffectChainModule::PackSlots(const Slot *slots) {
+    uint32_t packed = 0;
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        uint32_t value = 0xFF;
+
+        if (slots[i].effectID >= 0 && slots[i].effectID <= kMaxEffectID) {
+            value = static_cast<uint32_t>(slots[i].effectID) | (slots[i].bypassed ? 0x80 : 0x00);
+        }
+
+        packed |= value << (i * 8);
+    }
+
+    return packed;
+}
+
+void EffectChainModule::UnpackSlots(uint32_t packed, Slot *slots) {
+    for (int i = 0; i < kMaxSlots; i++) {
+        const uint32_t value = (packed >> (i * 8)) & 0xFF;
+
+        if (value == 0xFF) {
+            slots[i] = {kEmptySlot, false};
+        } else {
+            slots[i] = {static_cast<int>(value & 0x7F), (value & 0x80) != 0};
+        }
+    }
+}
+
+BaseEffectModule *EffectChainModule::GetSlotEffect(int slot) const {
+    if (m_slots[slot].effectID == kEmptySlot) {
+        return nullptr;
+    }
+
+    return m_effects[m_slots[slot].effectID];
+}
+
+void EffectChainModule::ProcessBlock(const float *const *in, float *const *out, size_t size) {
+    // The scratch buffers hold one piece of the block at a time
+    for (size_t offset = 0; offset < size; offset += kMaxBlockSize) {
+        const size_t pieceSize = size - offset < kMaxBlockSize ? size - offset : kMaxBlockSize;
+        const float *const pieceIn[2] = {in[0] + offset, in[1] + offset};
+        float *pieceOut[2] = {out[0] + offset, out[1] + offset};
+
+        ProcessSlots(pieceIn, pieceOut, pieceSize);
+    }
+}
+
+void EffectChainModule::ProcessSlots(const float *const *in, float *const *out, size_t size) {
+    // The last slot that runs writes straight into the output
+    int lastSlot = -1;
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (m_slots[i].effectID != kEmptySlot && !m_slots[i].bypassed) {
+            lastSlot = i;
+        } else if (GetSlotEffect(i) != nullptr) {
+            // A bypassed Effect isn't processed, so it can be handed to the main loop straight away
+            GetSlotEffect(i)->AcceptSuspendRequest();
+        }
+    }
+
+    const float *const *slotIn = in;
+
+    for (int i = 0; i <= lastSlot; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect == nullptr || m_slots[i].bypassed) {
+            continue;
+        }
+
+        float *const *slotOut = i == lastSlot ? out : (slotIn == m_scratch[0] ? m_scratch[1] : m_scratch[0]);
+
+        // An idle Effect fed silence would only produce silence, pass the audio on without processing it
+        if (effect->IsIdle() && IsBlockSilent(slotIn, size)) {
+            effect->AcceptSuspendRequest();
+
+            if (i == lastSlot) {
+                for (size_t j = 0; j < size; j++) {
+                    out[0][j] = slotIn[0][j];
+                    out[1][j] = slotIn[1][j];
+                }
+            }
+
+            continue;
+        }
+
+        ProfilerStage &profile = m_slotProfiles[i];
+        const uint32_t ticksBefore = profile.GetBlockTicks();
+
+        RT_SAFETY_SCOPE(effect->GetName());
+        profile.Begin();
+        effect->UpdateParameterSnapshot(size, m_maxParameterChangesPerBlock);
+
+        // The main loop is changing the Effect, it stays silent until it's handed back
+        if (effect->IsSuspended()) {
+            profile.End();
+
+            for (size_t j = 0; j < size; j++) {
+                slotOut[0][j] = 0.0f;
+                slotOut[1][j] = 0.0f;
+            }
+
+            slotIn = slotOut;
+            continue;
+        }
+
+        effect->ProcessBlock(slotIn, slotOut, size);
+        profile.End();
+
+        effect->RecordProcessingCost(profile.GetBlockTicks() - ticksBefore);
+        effect->UpdateIdleState(slotIn, slotOut, size);
+
+        slotIn = slotOut;
+    }
+
+    // Every slot is bypassed or empty
+    if (lastSlot < 0) {
+        for (size_t j = 0; j < size; j++) {
+            out[0][j] = in[0][j];
+            out[1][j] = in[1][j];
+        }
+    }
+}
+
+float EffectChainModule::GetBrightnessForLED(int led_id) const {
+    // LED 0 shows the chain state, the other LEDs follow the last Effect in the chain that isn't bypassed
+    if (led_id > 0) {
+        for (int i = kMaxSlots - 1; i >= 0; i--) {
+            BaseEffectModule *effect = GetSlotEffect(i);
+
+            if (effect != nullptr && !m_slots[i].bypassed) {
+                return effect->GetBrightnessForLED(led_id);
+            }
+        }
+    }
+
+    return BaseEffectModule::GetBrightnessForLED(led_id);
+}
+
+void EffectChainModule::SetEnabled(bool isEnabled) {
+    BaseEffectModule::SetEnabled(isEnabled);
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->SetEnabled(isEnabled);
+        }
+    }
+}
+
+void EffectChainModule::SetTempo(uint32_t bpm) {
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->SetTempo(bpm);
+        }
+    }
+}
+
+void EffectChainModule::OnNoteOn(float notenumber, float velocity) {
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->OnNoteOn(notenumber, velocity);
+        }
+    }
+}
+
+void EffectChainModule::OnNoteOff(float notenumber, float velocity) {
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->OnNoteOff(notenumber, velocity);
+        }
+    }
+}
+
+void EffectChainModule::SetQualityLevel(int level) {
+    BaseEffectModule::SetQualityLevel(level);
+
+    // Every slot drops a tier together, slots with fewer tiers stay at their cheapest
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->SetQualityLevel(GetQualityLevel());
+        }
+    }
+}
+
+int EffectChainModule::GetQualityLevelCount() const {
+    int count = 1;
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr && effect->GetQualityLevelCount() > count) {
+            count = effect->GetQualityLevelCount();
+        }
+    }
+
+    return count;
+}
+
+float EffectChainModule::GetTailLengthInSeconds() const {
+    // Each slot rings out into the next so the tails add up, the chain is never idle if any slot makes its own sound
+    float tailLength = 0.0f;
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect == nullptr || m_slots[i].bypassed) {
+            continue;
+        }
+
+        const float effectTailLength = effect->GetTailLengthInSeconds();
+
+        if (effectTailLength < 0.0f) {
+            return kInfiniteTail;
+        }
+
+        tailLength += effectTailLength;
+    }
+
+    return tailLength;
+}
+
+int EffectChainModule::GetProcessedEffectCount() const {
+    int count = 0;
+
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (m_slots[i].effectID != kEmptySlot) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+const BaseEffectModule *EffectChainModule::GetProcessedEffect(int index) const {
+    for (int i = 0; i < kMaxSlots; i++) {
+        if (m_slots[i].effectID != kEmptySlot && index-- == 0) {
+            return GetSlotEffect(i);
+        }
+    }
+
+    return nullptr;
+}
+
+void EffectChainModule::AlternateFootswitchPressed() {
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->AlternateFootswitchPressed();
+        }
+    }
+}
+
+void EffectChainModule::AlternateFootswitchReleased() {
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->AlternateFootswitchReleased();
+        }
+    }
+}
+
+void EffectChainModule::AlternateFootswitchHeldFor1Second() {
+    for (int i = 0; i < kMaxSlots; i++) {
+        BaseEffectModule *effect = GetSlotEffect(i);
+
+        if (effect != nullptr) {
+            effect->AlternateFootswitchHeldFor1Second();
+        }
+    }
+}
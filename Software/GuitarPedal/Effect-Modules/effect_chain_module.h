@@ -0,0 +1,142 @@
+#pragma once
+#ifndef EFFECT_CHAIN_MODULE_H
+#define EFFECT_CHAIN_MODULE_H
+
+#include "../Util/profiler.h"
+#include "base_effect_module.h"
+#include "daisy_seed.h"
+#include <stdint.h>
+#ifdef __cplusplus
+
+/** @file effect_chain_module.h */
+
+namespace bkshepherd {
+
+/** Runs several Effects in series as one Effect. Each slot processes the whole block into a scratch buffer that
+ * the next slot reads, so handing audio between slots costs one ProcessBlock call per slot and no per sample calls.
+ * The time each slot takes is recorded on its Effect (BaseEffectModule::GetProcessingCostTicks) and on a
+ * ProfilerStage per slot, so a chain can be checked against the block deadline before it is configured.
+ *
+ * The slots are changed from the audio callback only, with SetSlots while the chain isn't being processed or with
+ * SetPendingSlots / ApplyPendingSlots while its output is faded out.
+ */
+class EffectChainModule : public BaseEffectModule {
+  public:
+    static constexpr int kMaxSlots = 4;         // Number of slots in the chain
+    static constexpr int kEmptySlot = -1;       // Effect ID of a slot with no Effect
+    static constexpr int kMaxEffectID = 126;    // Largest Effect ID that fits in a packed slot
+    static constexpr size_t kMaxBlockSize = 48; // Size of the scratch buffers, larger blocks are processed in pieces
+
+    /** A single position in the chain */
+    struct Slot {
+        int effectID;  // Index into the available Effects, kEmptySlot for none
+        bool bypassed; // True to pass the audio through the slot without processing it
+    };
+
+    EffectChainModule();
+    ~EffectChainModule();
+
+    /** Sets the Effects the slots refer to, call once at startup after the Effects are initialized
+     \param effects the available Effects, indexed by Effect ID
+     \param count the number of available Effects
+     \param maxParameterChangesPerBlock the maximum ParameterChanged notifications each slot delivers per block
+    */
+    void SetAvailableEffects(BaseEffectModule **effects, int count, int maxParameterChangesPerBlock);
+
+    /** Replaces the slots of the chain. Effects leaving the chain are stopped and Effects joining it start idle.
+     * Only call while the chain isn't being processed.
+     \param slots kMaxSlots slots in processing order
+    */
+    void SetSlots(const Slot *slots);
+
+    /** Stores slots to replace the current ones with once ApplyPendingSlots is called
+     \param slots kMaxSlots slots in processing order
+    */
+    void SetPendingSlots(const Slot *slots);
+
+    /** Replaces the slots with the ones stored by SetPendingSlots, if any */
+    void ApplyPendingSlots();
+
+    /** Checks if slots are waiting for ApplyPendingSlots
+     \return true if SetPendingSlots was called since the last ApplyPendingSlots
+    */
+    bool HasPendingSlots() const { return m_hasPendingSlots; }
+
+    /** Gets one of the current slots
+     \param slot the slot index, 0..kMaxSlots - 1
+     \return the slot
+    */
+    const Slot &GetSlot(int slot) const { return m_slots[slot]; }
+
+    /** Checks if the chain has at least one Effect in it
+     \return true if any slot has an Effect, bypassed or not
+    */
+    bool HasEffects() const;
+
+    /** Checks if an Effect is in one of the slots
+     \param effect the Effect to look for
+     \return true if a slot (bypassed or not) holds the Effect
+    */
+    bool ContainsEffect(const BaseEffectModule *effect) const;
+
+    /** Estimates how long a set of slots takes to process one block from the measured cost of each Effect
+     \param slots kMaxSlots slots to estimate
+     \return the sum of the processing cost of the slots that aren't bypassed, in Profiler ticks
+    */
+    uint32_t EstimateCostTicks(const Slot *slots) const;
+
+    /** Packs slots into one value so they can be sent to the audio callback in an AudioCommand
+     \param slots kMaxSlots slots to pack
+     \return one byte per slot, the Effect ID in the low 7 bits with the top bit set when bypassed, 0xFF for empty
+    */
+    static uint32_t PackSlots(const Slot *slots);
+
+    /** Unpacks slots packed by PackSlots
+     \param packed the packed slots
+     \param slots kMaxSlots slots to fill in
+    */
+    static void UnpackSlots(uint32_t packed, Slot *slots);
+
+    void Init(float sample_rate) override;
+    void ProcessBlock(const float *const *in, float *const *out, size_t size) override;
+    float GetBrightnessForLED(int led_id) const override;
+    void SetEnabled(bool isEnabled) override;
+    void SetTempo(uint32_t bpm) override;
+    void OnNoteOn(float notenumber, float velocity) override;
+    void OnNoteOff(float notenumber, float velocity) override;
+    void SetQualityLevel(int level) override;
+    int GetQualityLevelCount() const override;
+    float GetTailLengthInSeconds() const override;
+    int GetProcessedEffectCount() const override;
+    const BaseEffectModule *GetProcessedEffect(int index) const override;
+    void AlternateFootswitchPressed() override;
+    void AlternateFootswitchReleased() override;
+    void AlternateFootswitchHeldFor1Second() override;
+
+  private:
+    /** Runs the slots over one piece of a block no longer than kMaxBlockSize */
+    void ProcessSlots(const float *const *in, float *const *out, size_t size);
+
+    /** Gets the Effect in a slot
+     \return the Effect, nullptr for an empty slot
+    */
+    BaseEffectModule *GetSlotEffect(int slot) const;
+
+    BaseEffectModule **m_effects;
+    int m_effectCount;
+    int m_maxParameterChangesPerBlock;
+
+    Slot m_slots[kMaxSlots];
+    Slot m_pendingSlots[kMaxSlots];
+    bool m_hasPendingSlots;
+
+    ProfilerStage m_slotProfiles[kMaxSlots];
+
+    // Ping pong buffers handing the audio from one slot to the next
+    float m_scratchLeft[2][kMaxBlockSize];
+    float m_scratchRight[2][kMaxBlockSize];
+    float *m_scratch[2][2];
+};
+} // namespace bkshepherd
+#endif
+#endif
@@ -262,6 +262,7 @@ class FmKeysModule : public BaseEffectModule {
     void OnNoteOff(float notenumber, float velocity) override;
 
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return kInfiniteTail; }
 
   private:
     float m_freqMin;
@@ -34,7 +34,9 @@ static const auto s_metaData = [] {
         knobMapping : 0,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[GraphicEQModule::BAND_200] = {
@@ -45,7 +47,9 @@ static const auto s_metaData = [] {
         knobMapping : 1,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[GraphicEQModule::BAND_400] = {
@@ -56,7 +60,9 @@ static const auto s_metaData = [] {
         knobMapping : 2,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[GraphicEQModule::BAND_800] = {
@@ -67,7 +73,9 @@ static const auto s_metaData = [] {
         knobMapping : 3,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[GraphicEQModule::BAND_1600] = {
@@ -78,7 +86,9 @@ static const auto s_metaData = [] {
         knobMapping : 4,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[GraphicEQModule::BAND_3200] = {
@@ -89,7 +99,9 @@ static const auto s_metaData = [] {
         knobMapping : 5,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     return params;
@@ -136,8 +148,16 @@ void GraphicEQModule::ProcessStereo(float inL, float inR) {
     ProcessMono(inL);
 }
 
-void GraphicEQModule::ParameterChanged(int parameter_id) {
-    filter[parameter_id].config(GetParameterAsFloat(parameter_id), centerFrequency[parameter_id], GetSampleRate(), q[parameter_id]);
+void GraphicEQModule::ProcessBlock(const float *const *in, float *const *out, size_t size) {
+    // Band gains are smoothed in the meta data, so while a band is moving its filter is reconfigured once
+    // per block at the end of the ramp instead of jumping straight to the new gain.
+    for (uint8_t i = 0; i < NUM_FILTERS; i++) {
+        if (IsParameterSmoothing(BAND_100 + i)) {
+            filter[i].config(GetSmoothedParameterEnd(BAND_100 + i), centerFrequency[i], GetSampleRate(), q[i]);
+        }
+    }
+
+    BaseEffectModule::ProcessBlock(in, out, size);
 }
 
 void GraphicEQModule::DrawUI(OneBitGraphicsDisplay &display, int currentIndex, int numItemsTotal, Rectangle boundsToDrawIn,
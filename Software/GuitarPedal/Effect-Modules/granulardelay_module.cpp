@@ -8,7 +8,7 @@ using namespace bkshepherd;
 // 1/2 second at 48kHz
 #define MAX_SAMPLE_GRAN 24000
 
-float DSY_SDRAM_BSS buffer_gran_delay[MAX_SAMPLE_GRAN];
+float *buffer_gran_delay = nullptr; // Allocated from the SDRAM arena in Acquire
 
 static const char *s_grainEnvNames[3] = {"Cos", "SlowAtk", "FastAtk"};
 
@@ -110,23 +110,37 @@ GranularDelayModule::~GranularDelayModule() {
 void GranularDelayModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
 
-    // Init the looper
-    m_looper.Init(buffer_gran_delay, MAX_SAMPLE_GRAN);
-    m_looper.SetMode(static_cast<daisysp::Looper::Mode>(3)); // Frippertronics mode
-
-    granular.Init(buffer_gran_delay, MAX_SAMPLE_GRAN, sample_rate, 0.0, 0.5);
-
     m_pitch = 0.0;
 
     m_hold = false;
     m_loop_recorded = false;
     first_count = 0;
+}
+
+bool GranularDelayModule::Acquire(SdramArena &arena) {
+    buffer_gran_delay = static_cast<float *>(arena.Allocate(sizeof(float) * MAX_SAMPLE_GRAN, GetName()));
 
-    for (int i = 0; i < MAX_SAMPLE_GRAN; i++) {
-        buffer_gran_delay[i] = 0.;
+    if (buffer_gran_delay == nullptr) {
+        return false;
     }
 
+    // Init the looper, it clears the buffer the granular player reads from too
+    m_looper.Init(buffer_gran_delay, MAX_SAMPLE_GRAN);
+    m_looper.SetMode(static_cast<daisysp::Looper::Mode>(3)); // Frippertronics mode
+
+    granular.Init(buffer_gran_delay, MAX_SAMPLE_GRAN, GetSampleRate(), 0.0, 0.5);
     granular.setStereoSpread(0.4);
+
+    // The recording starts over in the new buffer
+    m_loop_recorded = false;
+    first_count = 0;
+
+    return true;
+}
+
+void GranularDelayModule::Release(SdramArena &arena) {
+    arena.Free(buffer_gran_delay);
+    buffer_gran_delay = nullptr;
 }
 
 void GranularDelayModule::ParameterChanged(int parameter_id) {
@@ -218,6 +232,8 @@ void GranularDelayModule::ProcessStereo(float inL, float inR) {
     ProcessMono(inL);
 }
 
+float GranularDelayModule::GetTailLengthInSeconds() const { return static_cast<float>(MAX_SAMPLE_GRAN) / GetSampleRate(); }
+
 float GranularDelayModule::GetBrightnessForLED(int led_id) const {
     float value = BaseEffectModule::GetBrightnessForLED(led_id);
 
@@ -32,10 +32,13 @@ class GranularDelayModule : public BaseEffectModule {
     ~GranularDelayModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override;
     bool AlternateFootswitchForTempo() const override { return false; }
     void AlternateFootswitchPressed() override;
 
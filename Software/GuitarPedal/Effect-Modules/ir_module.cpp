@@ -41,6 +41,9 @@ IrModule::IrModule() : BaseEffectModule(), m_levelMin(0.0f), m_levelMax(2.0f), m
 
     // Initialize Parameters for this Effect
     this->InitParams(static_cast<int>(s_metaData.size()));
+
+    // Copying an IR takes longer than a block, so it's done on the main loop with the Effect suspended
+    SetParameterChangedOnControlThread(IR, true);
 }
 
 // Destructor
@@ -48,10 +51,9 @@ IrModule::~IrModule() {
     // No Code Needed
 }
 
-void IrModule::Init(float sample_rate) {
-    BaseEffectModule::Init(sample_rate);
-    SelectIR();
-}
+void IrModule::Init(float sample_rate) { BaseEffectModule::Init(sample_rate); }
+
+void IrModule::Prepare() { SelectIR(); }
 
 void IrModule::ParameterChanged(int parameter_id) {
     if (parameter_id == IR) { // Change IR
@@ -74,6 +76,16 @@ void IrModule::ParameterChanged(int parameter_id) {
 
 //}
 
+// Lower quality levels only use the start of the IR, 0 uses the whole IR
+static const size_t s_irLengthForQualityLevel[] = {0, 512, 256};
+
+void IrModule::SetQualityLevel(int level) {
+    BaseEffectModule::SetQualityLevel(level);
+    mIR.SetLengthLimit(s_irLengthForQualityLevel[GetQualityLevel()]);
+}
+
+int IrModule::GetQualityLevelCount() const { return sizeof(s_irLengthForQualityLevel) / sizeof(s_irLengthForQualityLevel[0]); }
+
 void IrModule::SelectIR() {
     unsigned int irIndex = GetParameterAsBinnedValue(IR) - 1;
     if (irIndex != m_currentIRindex) {
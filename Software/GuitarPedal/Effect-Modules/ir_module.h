@@ -27,12 +27,15 @@ class IrModule : public BaseEffectModule {
     ~IrModule();
 
     void Init(float sample_rate) override;
+    void Prepare() override;
     void ParameterChanged(int parameter_id) override;
 
     void SelectIR();
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    void SetQualityLevel(int level) override;
+    int GetQualityLevelCount() const override;
     // void AlternateFootswitchPressed() override;
 
   private:
@@ -5,11 +5,14 @@
 
 using namespace bkshepherd;
 
-// 60 seconds at 48kHz
-#define kBuffSize 48000 * 60
+// The loop buffers take what the SDRAM arena has free when the looper is selected, up to a minute (the loop length the
+// looper always had), leaving room for the Effects it may be chained with. Less than 10 seconds isn't worth looping.
+constexpr size_t kMaxLoopSeconds = 60;
+constexpr size_t kMinLoopSeconds = 10;
+constexpr size_t kChainReserveBytes = 16 * 1024 * 1024;
 
-float DSY_SDRAM_BSS buffer[kBuffSize];
-float DSY_SDRAM_BSS bufferR[kBuffSize];
+float *buffer = nullptr;
+float *bufferR = nullptr;
 
 static const char *s_loopModeNames[4] = {"Normal", "One-time", "Replace", "Fripp"};
 
@@ -110,20 +113,49 @@ LooperModule::~LooperModule() {
 void LooperModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
 
-    // Init the looper
-    m_looper.Init(buffer, kBuffSize);
-    m_looperR.Init(bufferR, kBuffSize);
-
-    SetLooperMode();
+    // The loopers are initialized in Acquire once they have their buffers
     tone.Init(sample_rate);
     toneR.Init(sample_rate);
     currentSpeed = 1.0;
 }
 
+bool LooperModule::Acquire(SdramArena &arena) {
+    const size_t largestFree = arena.GetLargestFreeBlock();
+    const size_t available = largestFree > kChainReserveBytes ? largestFree - kChainReserveBytes : 0;
+    const size_t sampleRate = static_cast<size_t>(GetSampleRate());
+    const size_t bufferSize = std::min(available / (2 * sizeof(float)), kMaxLoopSeconds * sampleRate);
+
+    if (bufferSize < kMinLoopSeconds * sampleRate) {
+        return false;
+    }
+
+    buffer = static_cast<float *>(arena.Allocate(sizeof(float) * bufferSize, GetName()));
+    bufferR = static_cast<float *>(arena.Allocate(sizeof(float) * bufferSize, GetName()));
+
+    if (buffer == nullptr || bufferR == nullptr) {
+        return false;
+    }
+
+    // Init the looper, the buffers aren't cleared since a loop only reads back what it recorded
+    m_looper.Init(buffer, bufferSize);
+    m_looperR.Init(bufferR, bufferSize);
+
+    SetLooperMode();
+    return true;
+}
+
+void LooperModule::Release(SdramArena &arena) {
+    arena.Free(buffer);
+    arena.Free(bufferR);
+
+    buffer = nullptr;
+    bufferR = nullptr;
+}
+
 void LooperModule::SetLooperMode() {
     const int modeIndex = GetParameterAsBinnedValue(MODE) - 1;
-    m_looper.SetMode(static_cast<daisysp::Looper::Mode>(modeIndex));
-    m_looperR.SetMode(static_cast<daisysp::Looper::Mode>(modeIndex));
+    m_looper.SetMode(static_cast<LooperMod::Mode>(modeIndex));
+    m_looperR.SetMode(static_cast<LooperMod::Mode>(modeIndex));
 }
 
 void LooperModule::ParameterChanged(int parameter_id) {
@@ -132,6 +164,15 @@ void LooperModule::ParameterChanged(int parameter_id) {
     }
 }
 
+void LooperModule::ParameterSnapshotChanged() {
+    // Set low pass filter as exponential taper, only when the filter parameter moves
+    if (IsParameterDirty(LP_FILTER)) {
+        const float lpFilter = GetSnapshotAsFloat(LP_FILTER);
+        tone.SetFreq(m_toneFreqMin + lpFilter * lpFilter * (m_toneFreqMax - m_toneFreqMin));
+        toneR.SetFreq(m_toneFreqMin + lpFilter * lpFilter * (m_toneFreqMax - m_toneFreqMin));
+    }
+}
+
 void LooperModule::AlternateFootswitchPressed() {
     m_looper.TrigRecord();
     m_looperR.TrigRecord();
@@ -146,21 +187,18 @@ void LooperModule::AlternateFootswitchHeldFor1Second() {
 void LooperModule::ProcessMono(float in) {
     BaseEffectModule::ProcessMono(in);
 
-    const float inputLevel = m_inputLevelMin + (GetParameterAsFloat(INPUT_LEVEL) * (m_inputLevelMax - m_inputLevelMin));
+    const float inputLevel = m_inputLevelMin + (GetSnapshotAsFloat(INPUT_LEVEL) * (m_inputLevelMax - m_inputLevelMin));
 
-    const float loopLevel = m_loopLevelMin + (GetParameterAsFloat(LOOP_LEVEL) * (m_loopLevelMax - m_loopLevelMin));
+    const float loopLevel = m_loopLevelMin + (GetSnapshotAsFloat(LOOP_LEVEL) * (m_loopLevelMax - m_loopLevelMin));
 
     float input = in * inputLevel;
 
-    // Set low pass filter as exponential taper
-    tone.SetFreq(m_toneFreqMin + GetParameterAsFloat(LP_FILTER) * GetParameterAsFloat(LP_FILTER) * (m_toneFreqMax - m_toneFreqMin));
-
     // Handle speed and direction changes smoothly (like a tape reel)
     // TODO maybe move out to only do this when speed param changes
-    int speedModeIndex = GetParameterAsBinnedValue(SPEED_MODE) - 1;
+    int speedModeIndex = GetSnapshotAsBinnedValue(SPEED_MODE) - 1;
 
     if (speedModeIndex == 2) {
-        float speed = GetParameterAsFloat(SPEED);
+        float speed = GetSnapshotAsFloat(SPEED);
         daisysp::fonepole(currentSpeed, speed, .00006f);
         if (currentSpeed < 0.0) {
             m_looper.SetReverse(true);
@@ -171,7 +209,7 @@ void LooperModule::ProcessMono(float in) {
         m_looper.SetIncrementSize(speed_input_abs);
 
     } else if (speedModeIndex == 1) {
-        float speed = GetParameterAsFloat(SPEED) * 2;
+        float speed = GetSnapshotAsFloat(SPEED) * 2;
         int temp_speed = speed;
         float ftemp_speed = temp_speed;
         float stepped_speed = ftemp_speed / 2;
@@ -206,28 +244,24 @@ void LooperModule::ProcessStereo(float inL, float inR) {
 
     BaseEffectModule::ProcessStereo(inL, inR);
 
-    const float inputLevel = m_inputLevelMin + (GetParameterAsFloat(INPUT_LEVEL) * (m_inputLevelMax - m_inputLevelMin));
+    const float inputLevel = m_inputLevelMin + (GetSnapshotAsFloat(INPUT_LEVEL) * (m_inputLevelMax - m_inputLevelMin));
 
-    const float loopLevel = m_loopLevelMin + (GetParameterAsFloat(LOOP_LEVEL) * (m_loopLevelMax - m_loopLevelMin));
+    const float loopLevel = m_loopLevelMin + (GetSnapshotAsFloat(LOOP_LEVEL) * (m_loopLevelMax - m_loopLevelMin));
 
     float inputR = 0.0;
     float input = m_audioLeft * inputLevel;
-    if (!GetParameterAsBool(MISO)) { // If "MISO" is on, copy left input to right, otherwise do true stereo
+    if (!GetSnapshotAsBool(MISO)) { // If "MISO" is on, copy left input to right, otherwise do true stereo
         inputR = m_audioRight * inputLevel;
     } else {
         inputR = input;
     }
 
-    // Set low pass filter as exponential taper
-    tone.SetFreq(m_toneFreqMin + GetParameterAsFloat(LP_FILTER) * GetParameterAsFloat(LP_FILTER) * (m_toneFreqMax - m_toneFreqMin));
-    toneR.SetFreq(m_toneFreqMin + GetParameterAsFloat(LP_FILTER) * GetParameterAsFloat(LP_FILTER) * (m_toneFreqMax - m_toneFreqMin));
-
     // Handle speed and direction changes smoothly (like a tape reel)
     // TODO maybe move out to only do this when speed param changes
-    int speedModeIndex = GetParameterAsBinnedValue(SPEED_MODE) - 1;
+    int speedModeIndex = GetSnapshotAsBinnedValue(SPEED_MODE) - 1;
 
     if (speedModeIndex == 2) {
-        float speed = GetParameterAsFloat(SPEED);
+        float speed = GetSnapshotAsFloat(SPEED);
         daisysp::fonepole(currentSpeed, speed, .00006f);
         if (currentSpeed < 0.0) {
             m_looper.SetReverse(true);
@@ -241,7 +275,7 @@ void LooperModule::ProcessStereo(float inL, float inR) {
         m_looperR.SetIncrementSize(speed_input_abs);
 
     } else if (speedModeIndex == 1) {
-        float speed = GetParameterAsFloat(SPEED) * 2;
+        float speed = GetSnapshotAsFloat(SPEED) * 2;
         int temp_speed = speed;
         float ftemp_speed = temp_speed;
         float stepped_speed = ftemp_speed / 2;
@@ -296,7 +330,8 @@ void LooperModule::DrawUI(OneBitGraphicsDisplay &display, int currentIndex, int
 
     int width = boundsToDrawIn.GetWidth();
 
-    if (m_looper.GetRecSize() > 0) {
+    // The loop only exists while the looper has its buffers
+    if (HasResources() && m_looper.GetRecSize() > 0) {
         float percentageDone = 100.0 * (m_looper.GetPos() / m_looper.GetRecSize());
         int numBlocks = 20;
         int blockWidth = width / numBlocks;
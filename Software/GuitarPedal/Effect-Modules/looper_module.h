@@ -2,6 +2,7 @@
 #ifndef LOOPER_MODULE_H
 #define LOOPER_MODULE_H
 
+#include "../Util/loopermod.h"
 #include "base_effect_module.h"
 #include "daisysp.h"
 #include <stdint.h>
@@ -28,10 +29,14 @@ class LooperModule : public BaseEffectModule {
     ~LooperModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
+    void ParameterSnapshotChanged() override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return kInfiniteTail; }
     bool AlternateFootswitchForTempo() const override { return false; }
     void AlternateFootswitchPressed() override;
     void AlternateFootswitchHeldFor1Second() override;
@@ -42,8 +47,8 @@ class LooperModule : public BaseEffectModule {
     void SetLooperMode();
     daisysp::Tone tone;  // Low Pass
     daisysp::Tone toneR; // Low Pass
-    daisysp::Looper m_looper;
-    daisysp::Looper m_looperR; // Added another looper for stereo loops
+    LooperMod m_looper;
+    LooperMod m_looperR; // Added another looper for stereo loops
 
     float m_inputLevelMin;
     float m_inputLevelMax;
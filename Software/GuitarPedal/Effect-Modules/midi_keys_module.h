@@ -154,6 +154,7 @@ class MidiKeysModule : public BaseEffectModule {
     void OnNoteOff(float notenumber, float velocity) override;
 
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return kInfiniteTail; }
 
   private:
     float m_freqMin;
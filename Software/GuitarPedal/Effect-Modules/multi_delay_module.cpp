@@ -2,21 +2,20 @@
 #include "../Util/audio_utilities.h"
 #include "Delays/delayline_reverse.h"
 #include "Delays/delayline_revoct.h"
+#include "Delays/delayline_watermark.h"
 #include "daisysp.h"
 #include <array>
 
 using namespace bkshepherd;
 
-PitchShifter DSY_SDRAM_BSS ps_taps[4];
+PitchShifter *ps_taps = nullptr; // 4 pitch shifters allocated from the SDRAM arena in Acquire
 // Delay Max Definitions (Assumes 48kHz samplerate)
 constexpr size_t MAX_DELAY_TAP = static_cast<size_t>(48000.0f * 8.f);
-DelayLine<float, MAX_DELAY_TAP> DSY_SDRAM_BSS delayLineLeft0;
-DelayLine<float, MAX_DELAY_TAP> DSY_SDRAM_BSS delayLineRight0;
 
 float tap_delays[4] = {0.0f, 0.0f, 0.0f, 0.0f};
 namespace {
 struct delay {
-    DelayLine<float, MAX_DELAY_TAP> *del;
+    DelayLineWatermark<float, MAX_DELAY_TAP> *del;
     float currentDelay;
     float delayTarget;
 
@@ -46,7 +45,9 @@ static const auto s_metaData = [] {
         knobMapping : 0,
         midiCCMapping : 20,
         minValue : 0,
-        maxValue : 1
+        maxValue : 1,
+        smoothingType : ParameterSmoothingType::Linear,
+        smoothingTimeInSeconds : 0.02f
     };
 
     params[MultiDelayModule::DELAY_L_MS] = {
@@ -82,6 +83,8 @@ static const auto s_metaData = [] {
         midiCCMapping : 31,
         minValue : 0,
         maxValue : 1,
+        smoothingType : ParameterSmoothingType::Linear,
+        smoothingTimeInSeconds : 0.02f
     };
 
     params[MultiDelayModule::TAP_MODE] = {
@@ -216,16 +219,39 @@ MultiDelayModule::~MultiDelayModule() {
 
 void MultiDelayModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
-    delayLineLeft0.Init();
-    delayLineRight0.Init();
-    delays[0].del = &delayLineLeft0;
+    delays[0].del = nullptr;
     delays[0].currentDelay = GetParameterAsFloat(DELAY_L_MS);
-    delays[1].del = &delayLineRight0;
+    delays[1].del = nullptr;
     delays[1].currentDelay = GetParameterAsFloat(DELAY_R_MS);
+}
+
+bool MultiDelayModule::Acquire(SdramArena &arena) {
+    delays[0].del = arena.Create<DelayLineWatermark<float, MAX_DELAY_TAP>>(GetName());
+    delays[1].del = arena.Create<DelayLineWatermark<float, MAX_DELAY_TAP>>(GetName());
+    ps_taps = arena.CreateArray<PitchShifter>(4, GetName());
+
+    if (delays[0].del == nullptr || delays[1].del == nullptr || ps_taps == nullptr) {
+        return false;
+    }
+
+    delays[0].del->Init();
+    delays[1].del->Init();
 
     for (int i = 0; i < 4; ++i) {
-        ps_taps[i].Init(sample_rate);
+        ps_taps[i].Init(GetSampleRate());
     }
+
+    return true;
+}
+
+void MultiDelayModule::Release(SdramArena &arena) {
+    arena.Free(delays[0].del);
+    arena.Free(delays[1].del);
+    arena.Free(ps_taps);
+
+    delays[0].del = nullptr;
+    delays[1].del = nullptr;
+    ps_taps = nullptr;
 }
 
 void MultiDelayModule::ParameterChanged(int parameter_id) {
@@ -266,7 +292,7 @@ void MultiDelayModule::ProcessMono(float in) {
     BaseEffectModule::ProcessMono(in);
 
     float taps[2];
-    float sig = delays[0].Process(GetParameterAsFloat(FEEDBACK), m_audioLeft) / 3.f;
+    float sig = delays[0].Process(GetSmoothedParameter(FEEDBACK), m_audioLeft) / 3.f;
     for (int i = 0; i < 2; ++i) {
         PreProcessTaps(&tap_delays[i], m_tapTargetDelay[i]);
         taps[i] = delays[0].del->Read(tap_delays[i]);
@@ -277,7 +303,8 @@ void MultiDelayModule::ProcessMono(float in) {
 
     sig += taps[0] / 3.f + taps[1] / 3.f;
 
-    m_audioLeft = sig * GetParameterAsFloat(WET) + m_audioLeft * (1.0f - GetParameterAsFloat(WET));
+    const float wet = GetSmoothedParameter(WET);
+    m_audioLeft = sig * wet + m_audioLeft * (1.0f - wet);
     m_audioRight = m_audioLeft;
 }
 
@@ -288,7 +315,7 @@ void MultiDelayModule::ProcessStereo(float inL, float inR) {
     // Do the base stereo calculation (which resets the right signal to be the inputR instead of combined mono)
     BaseEffectModule::ProcessStereo(m_audioLeft, inR);
     float taps[2];
-    float sig = delays[1].Process(GetParameterAsFloat(FEEDBACK), m_audioRight) / 3.f;
+    float sig = delays[1].Process(GetSmoothedParameter(FEEDBACK), m_audioRight) / 3.f;
     for (int i = 0; i < 2; ++i) {
         PreProcessTaps(&tap_delays[i + 2], m_tapTargetDelay[i + 2]);
         taps[i] = delays[1].del->Read(tap_delays[i + 2]);
@@ -298,13 +325,16 @@ void MultiDelayModule::ProcessStereo(float inL, float inR) {
     }
     sig += taps[0] / 3.f + taps[1] / 3.f;
 
-    m_audioRight = sig * GetParameterAsFloat(WET) + m_audioRight * (1.0f - GetParameterAsFloat(WET));
+    const float wet = GetSmoothedParameter(WET);
+    m_audioRight = sig * wet + m_audioRight * (1.0f - wet);
 }
 
 void MultiDelayModule::SetTempo(uint32_t bpm) {
     // TODO: Add Tempo handling
 }
 
+float MultiDelayModule::GetTailLengthInSeconds() const { return static_cast<float>(MAX_DELAY_TAP) / GetSampleRate(); }
+
 float MultiDelayModule::GetBrightnessForLED(int led_id) const {
     float value = BaseEffectModule::GetBrightnessForLED(led_id);
 
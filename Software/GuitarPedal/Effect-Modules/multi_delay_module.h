@@ -36,10 +36,13 @@ class MultiDelayModule : public BaseEffectModule {
     ~MultiDelayModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     void SetTempo(uint32_t bpm) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override;
     void SetDelayTime(uint8_t index, float delay);
     void ParameterChanged(int parameter_id);
     void SetTargetTapDelayTime(uint8_t index, float value, float multiplier);
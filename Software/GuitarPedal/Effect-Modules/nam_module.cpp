@@ -20,8 +20,8 @@ cycfi::q::peaking filter_nam[NUM_FILTERS_NAM] = {{0, centerFrequencyNam[0], 4800
                                                  {0, centerFrequencyNam[1], 48000, q_nam[1]},
                                                  {0, centerFrequencyNam[2], 48000, q_nam[2]}};
 
-// This must match the length of the model_collection_nam array in model_data_nam.h
-const size_t k_numModels = 10;
+// One name per model in the model_collection_nam array in model_data_nam.h
+constexpr size_t k_numModels = std::size(model_collection_nam);
 
 static const char *s_modelBinNames[k_numModels] = {
     "Mesa", "Match30", "DumHighG", "DumLowG", "Ethos", "Splawn", "PRSArch", "JCM800", "SansAmp", "BE-100",
@@ -158,6 +158,9 @@ NamModule::NamModule()
 
     // Initialize Parameters for this Effect
     this->InitParams(static_cast<int>(s_metaData.size()));
+
+    // Loading a Model takes longer than a block, so it's done on the main loop with the Effect suspended
+    SetParameterChangedOnControlThread(MODEL, true);
 }
 
 // Destructor
@@ -167,14 +170,14 @@ NamModule::~NamModule() {
 
 void NamModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
-    setupWeightsNam(); // in the model data nam .h file
-    SelectModel();
 
     filter_nam[0].config(GetParameterAsFloat(BASS), centerFrequencyNam[0], sample_rate, q_nam[0]);
     filter_nam[1].config(GetParameterAsFloat(MID), centerFrequencyNam[1], sample_rate, q_nam[1]);
     filter_nam[2].config(GetParameterAsFloat(TREBLE), centerFrequencyNam[2], sample_rate, q_nam[2]);
 }
 
+void NamModule::Prepare() { SelectModel(); }
+
 void NamModule::ParameterChanged(int parameter_id) {
     if (parameter_id == MODEL) { // Change Model
         SelectModel();
@@ -29,6 +29,7 @@ class NamModule : public BaseEffectModule {
     ~NamModule();
 
     void Init(float sample_rate) override;
+    void Prepare() override;
     void ParameterChanged(int parameter_id) override;
     void SelectModel();
 
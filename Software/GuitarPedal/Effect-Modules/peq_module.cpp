@@ -36,7 +36,9 @@ static const auto s_metaData = [] {
         knobMapping : 0,
         midiCCMapping : -1,
         minValue : 35,
-        maxValue : 500
+        maxValue : 500,
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[ParametricEQModule::MID_FREQ] = {
@@ -48,7 +50,9 @@ static const auto s_metaData = [] {
         knobMapping : 1,
         midiCCMapping : -1,
         minValue : 250,
-        maxValue : 5000
+        maxValue : 5000,
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[ParametricEQModule::HIGH_FREQ] = {
@@ -60,7 +64,9 @@ static const auto s_metaData = [] {
         knobMapping : 2,
         midiCCMapping : -1,
         minValue : 1000,
-        maxValue : 20000
+        maxValue : 20000,
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[ParametricEQModule::LOW_GAIN] = {
@@ -71,7 +77,9 @@ static const auto s_metaData = [] {
         knobMapping : 3,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[ParametricEQModule::MID_GAIN] = {
@@ -82,7 +90,9 @@ static const auto s_metaData = [] {
         knobMapping : 4,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[ParametricEQModule::HIGH_GAIN] = {
@@ -93,7 +103,9 @@ static const auto s_metaData = [] {
         knobMapping : 5,
         midiCCMapping : -1,
         minValue : static_cast<int>(minGain),
-        maxValue : static_cast<int>(maxGain)
+        maxValue : static_cast<int>(maxGain),
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.03f
     };
 
     params[ParametricEQModule::LOW_Q] = {
@@ -174,30 +186,26 @@ void ParametricEQModule::ProcessStereo(float inL, float inR) {
     ProcessMono(inL);
 }
 
-void ParametricEQModule::ParameterChanged(int parameter_id) {
-    switch (parameter_id) {
-    case LOW_FREQ:
-    case LOW_GAIN:
-    case LOW_Q: {
-        const int qLowIndex = GetParameterAsBinnedValue(LOW_Q) - 1;
-        filterLows.config(GetParameterAsFloat(LOW_GAIN), GetParameterAsFloat(LOW_FREQ), GetSampleRate(), qLow[qLowIndex]);
-        break;
+void ParametricEQModule::ProcessBlock(const float *const *in, float *const *out, size_t size) {
+    // Frequency and gain are smoothed in the meta data, so while a band is moving its filter is reconfigured
+    // once per block at the end of the ramp. A change in Q is applied straight away.
+    if (IsParameterSmoothing(LOW_FREQ) || IsParameterSmoothing(LOW_GAIN) || IsParameterDirty(LOW_Q)) {
+        const int qLowIndex = GetSnapshotAsBinnedValue(LOW_Q) - 1;
+        filterLows.config(GetSmoothedParameterEnd(LOW_GAIN), GetSmoothedParameterEnd(LOW_FREQ), GetSampleRate(), qLow[qLowIndex]);
     }
-    case MID_FREQ:
-    case MID_GAIN:
-    case MID_Q: {
-        const int qMidIndex = GetParameterAsBinnedValue(MID_Q) - 1;
-        filterMids.config(GetParameterAsFloat(MID_GAIN), GetParameterAsFloat(MID_FREQ), GetSampleRate(), qMid[qMidIndex]);
-        break;
-    }
-    case HIGH_FREQ:
-    case HIGH_GAIN:
-    case HIGH_Q: {
-        const int qHighIndex = GetParameterAsBinnedValue(HIGH_Q) - 1;
-        filterHighs.config(GetParameterAsFloat(HIGH_GAIN), GetParameterAsFloat(HIGH_FREQ), GetSampleRate(), qHigh[qHighIndex]);
-        break;
+
+    if (IsParameterSmoothing(MID_FREQ) || IsParameterSmoothing(MID_GAIN) || IsParameterDirty(MID_Q)) {
+        const int qMidIndex = GetSnapshotAsBinnedValue(MID_Q) - 1;
+        filterMids.config(GetSmoothedParameterEnd(MID_GAIN), GetSmoothedParameterEnd(MID_FREQ), GetSampleRate(), qMid[qMidIndex]);
     }
+
+    if (IsParameterSmoothing(HIGH_FREQ) || IsParameterSmoothing(HIGH_GAIN) || IsParameterDirty(HIGH_Q)) {
+        const int qHighIndex = GetSnapshotAsBinnedValue(HIGH_Q) - 1;
+        filterHighs.config(GetSmoothedParameterEnd(HIGH_GAIN), GetSmoothedParameterEnd(HIGH_FREQ), GetSampleRate(),
+                           qHigh[qHighIndex]);
     }
+
+    BaseEffectModule::ProcessBlock(in, out, size);
 }
 
 void ParametricEQModule::DrawUI(OneBitGraphicsDisplay &display, int currentIndex, int numItemsTotal, Rectangle boundsToDrawIn,
@@ -33,7 +33,7 @@ class ParametricEQModule : public BaseEffectModule {
     void Init(float sample_rate) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
-    void ParameterChanged(int parameter_id) override;
+    void ProcessBlock(const float *const *in, float *const *out, size_t size) override;
     void DrawUI(OneBitGraphicsDisplay &display, int currentIndex, int numItemsTotal, Rectangle boundsToDrawIn,
                 bool isEditing) override;
 };
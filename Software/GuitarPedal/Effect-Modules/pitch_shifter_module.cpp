@@ -89,8 +89,9 @@ static const auto s_metaData = [] {
     return params;
 }();
 
-DSY_SDRAM_BSS float pitch_delay_buffer_a[k_maxSamplesDelayPitchShifter];
-DSY_SDRAM_BSS float pitch_delay_buffer_b[k_maxSamplesDelayPitchShifter];
+// Allocated from the SDRAM arena in Acquire
+float *pitch_delay_buffer_a = nullptr;
+float *pitch_delay_buffer_b = nullptr;
 
 static daisysp_modified::PitchShifter pitchShifter;
 static daisysp::CrossFade pitchCrossfade;
@@ -143,12 +144,6 @@ void PitchShifterModule::SetTranspose(float semitone) {
 void PitchShifterModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
 
-    // clear and initialize SDRAM for pitch shift buffers
-    memset(pitch_delay_buffer_a, 0, sizeof(pitch_delay_buffer_a));
-    memset(pitch_delay_buffer_b, 0, sizeof(pitch_delay_buffer_b));
-
-    pitchShifter.Init(sample_rate, pitch_delay_buffer_a, pitch_delay_buffer_b, k_maxSamplesDelayPitchShifter);
-
     pitchCrossfade.Init(CROSSFADE_CPOW);
     pitchCrossfade.SetPos(GetParameterAsFloat(CROSSFADE));
 
@@ -164,6 +159,29 @@ void PitchShifterModule::Init(float sample_rate) {
     m_samplesToDelayReturn = static_cast<uint32_t>(static_cast<float>(k_maxSamplesMaxTime) * GetParameterAsFloat(RETURN));
 }
 
+bool PitchShifterModule::Acquire(SdramArena &arena) {
+    pitch_delay_buffer_a = static_cast<float *>(arena.Allocate(sizeof(float) * k_maxSamplesDelayPitchShifter, GetName()));
+    pitch_delay_buffer_b = static_cast<float *>(arena.Allocate(sizeof(float) * k_maxSamplesDelayPitchShifter, GetName()));
+
+    if (pitch_delay_buffer_a == nullptr || pitch_delay_buffer_b == nullptr) {
+        return false;
+    }
+
+    // The delay lines read unwritten parts of the buffers as silence, so they don't need clearing
+    pitchShifter.Init(GetSampleRate(), pitch_delay_buffer_a, pitch_delay_buffer_b, k_maxSamplesDelayPitchShifter);
+    SetTranspose(m_semitoneTarget);
+
+    return true;
+}
+
+void PitchShifterModule::Release(SdramArena &arena) {
+    arena.Free(pitch_delay_buffer_a);
+    arena.Free(pitch_delay_buffer_b);
+
+    pitch_delay_buffer_a = nullptr;
+    pitch_delay_buffer_b = nullptr;
+}
+
 void PitchShifterModule::ParameterChanged(int parameter_id) {
     if (parameter_id == SEMITONE || parameter_id == DIRECTION) {
         m_directionDown = GetParameterAsBinnedValue(DIRECTION) == 1;
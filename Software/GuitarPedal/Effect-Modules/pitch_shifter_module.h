@@ -27,6 +27,8 @@ class PitchShifterModule : public BaseEffectModule {
     ~PitchShifterModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     void ParameterChanged(int parameter_id) override;
@@ -4,7 +4,7 @@
 
 using namespace bkshepherd;
 
-DelayLine<float, MAX_DELAY_PLUCKECHO> DSY_SDRAM_BSS delay;
+DelayLine<float, MAX_DELAY_PLUCKECHO> *delay = nullptr; // Allocated from the SDRAM arena in Acquire
 
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, PluckEchoModule::PARAM_COUNT> params{};
@@ -70,14 +70,28 @@ void PluckEchoModule::Init(float sample_rate) {
 
     synth.Init(sample_rate);
 
-    delay.Init();
-    delay.SetDelay(sample_rate * 0.8f);
-
     // verb.Init(sample_rate);
     // verb.SetFeedback(0.85f);
     // verb.SetLpFreq(2000.0f);
 }
 
+bool PluckEchoModule::Acquire(SdramArena &arena) {
+    delay = arena.Create<DelayLine<float, MAX_DELAY_PLUCKECHO>>(GetName());
+
+    if (delay == nullptr) {
+        return false;
+    }
+
+    delay->Init();
+    delay->SetDelay(GetSampleRate() * 0.8f);
+    return true;
+}
+
+void PluckEchoModule::Release(SdramArena &arena) {
+    arena.Free(delay);
+    delay = nullptr;
+}
+
 void PluckEchoModule::ParameterChanged(int parameter_id) {
     if (parameter_id == STRING_DECAY) {
         float decay = 0.5f + GetParameterAsFloat(STRING_DECAY) * 0.5f;
@@ -112,15 +126,15 @@ void PluckEchoModule::ProcessMono(float in) {
 
     // Smooth delaytime, and set.
     fonepole(smooth_time, deltime, 0.0005f);
-    delay.SetDelay(smooth_time);
+    delay->SetDelay(smooth_time);
 
     // Synthesize Plucks
     float sig = synth.Process(trig, nn);
     trig = 0.0;
 
     //		// Handle Delay
-    float delsig = delay.Read();
-    delay.Write(sig + (delsig * delfb));
+    float delsig = delay->Read();
+    delay->Write(sig + (delsig * delfb));
 
     // Create Reverb Send
     float dry = sig + delsig;
@@ -150,15 +164,15 @@ void PluckEchoModule::ProcessStereo(float inL, float inR) {
 
     // Smooth delaytime, and set.
     fonepole(smooth_time, deltime, 0.0005f);
-    delay.SetDelay(smooth_time);
+    delay->SetDelay(smooth_time);
 
     // Synthesize Plucks
     float sig = synth.Process(trig, nn);
     trig = 0.0;
 
     //		// Handle Delay
-    float delsig = delay.Read();
-    delay.Write(sig + (delsig * delfb));
+    float delsig = delay->Read();
+    delay->Write(sig + (delsig * delfb));
 
     // Create Reverb Send
     float dry = sig + delsig;
@@ -30,12 +30,15 @@ class PluckEchoModule : public BaseEffectModule {
     ~PluckEchoModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
     void OnNoteOn(float notenumber, float velocity) override;
     void OnNoteOff(float notenumber, float velocity) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return kInfiniteTail; }
 
   private:
     // Synthesis
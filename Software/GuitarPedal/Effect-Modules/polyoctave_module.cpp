@@ -18,7 +18,7 @@ static Decimator2 decimate;
 static Interpolator interpolate;
 static const auto sample_rate_temp =
     48000; // hard code for now                          // NOTE: the sample_rate must be divisible by the resample_factor (48/6 = 8)
-static OctaveGenerator octave(sample_rate_temp / resample_factor); // resample_factor is defined in Multirate.h and equals 6
+static OctaveGenerator *octave = nullptr; // Built in Prepare, its filter bank takes a while to set up
 static q::highshelf eq1(-11, 140_Hz, sample_rate_temp);
 static q::lowshelf eq2(5, 160_Hz, sample_rate_temp);
 
@@ -89,6 +89,10 @@ void PolyOctaveModule::Init(float sample_rate) {
     }
 }
 
+void PolyOctaveModule::Prepare() {
+    octave = new OctaveGenerator(sample_rate_temp / resample_factor); // resample_factor is defined in Multirate.h and equals 6
+}
+
 void PolyOctaveModule::ProcessMono(float in) {
     BaseEffectModule::ProcessMono(in);
 
@@ -110,10 +114,10 @@ void PolyOctaveModule::ProcessMono(float in) {
         const auto sample = decimate(in_chunk);
 
         float octave_mix = 0;
-        octave.update(sample);
-        octave_mix += up1Level * octave.up1() * 4.0; // TODO May need to update parameter scaling from 0 to 1 to 1 to 20?
-        octave_mix += down1Level * octave.down1() * 4.0;
-        octave_mix += down2Level * octave.down2() * 4.0;
+        octave->update(sample);
+        octave_mix += up1Level * octave->up1() * 4.0; // TODO May need to update parameter scaling from 0 to 1 to 1 to 20?
+        octave_mix += down1Level * octave->down1() * 4.0;
+        octave_mix += down2Level * octave->down2() * 4.0;
 
         auto out_chunk = interpolate(octave_mix);
         for (size_t j = 0; j < out_chunk.size(); ++j) {
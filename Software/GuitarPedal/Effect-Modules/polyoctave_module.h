@@ -31,6 +31,7 @@ class PolyOctaveModule : public BaseEffectModule {
     ~PolyOctaveModule();
 
     void Init(float sample_rate) override;
+    void Prepare() override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
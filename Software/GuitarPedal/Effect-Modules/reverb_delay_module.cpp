@@ -10,12 +10,6 @@ static const char *s_waveBinNames[5] = {"Sine", "Triangle", "Saw", "Ramp",
 static const char *s_modParamNames[5] = {"None", "DelayTime", "DelayLevel", "ReverbLevel", "DelayPan"};
 static const char *s_delayModes[3] = {"Normal", "Triplett", "Dotted 8th"};
 
-DelayLineRevOct<float, MAX_DELAY> DSY_SDRAM_BSS delayLineLeft;
-DelayLineRevOct<float, MAX_DELAY> DSY_SDRAM_BSS delayLineRight;
-DelayLineReverse<float, MAX_DELAY_REV> DSY_SDRAM_BSS delayLineRevLeft;
-DelayLineReverse<float, MAX_DELAY_REV> DSY_SDRAM_BSS delayLineRevRight;
-DelayLine<float, MAX_DELAY_SPREAD> DSY_SDRAM_BSS delayLineSpread;
-
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, ReverbDelayModule::PARAM_COUNT> params{};
 
@@ -253,28 +247,24 @@ void ReverbDelayModule::CalculateReverbMix() {
 void ReverbDelayModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
 
-    delayLineLeft.Init();
-    delayLineRevLeft.Init();
-    delayLeft.del = &delayLineLeft;
-    delayLeft.delreverse = &delayLineRevLeft;
+    // The delay lines are allocated from the SDRAM arena in Acquire
+    delayLeft.del = nullptr;
+    delayLeft.delreverse = nullptr;
     delayLeft.delayTarget = 24000; // in samples
     delayLeft.feedback = 0.0;
     delayLeft.active = true; // Default to no delay
     delayLeft.toneOctLP.Init(sample_rate);
     delayLeft.toneOctLP.SetFreq(20000.0);
 
-    delayLineRight.Init();
-    delayLineRevRight.Init();
-    delayRight.del = &delayLineRight;
-    delayRight.delreverse = &delayLineRevRight;
+    delayRight.del = nullptr;
+    delayRight.delreverse = nullptr;
     delayRight.delayTarget = 24000; // in samples
     delayRight.feedback = 0.0;
     delayRight.active = true; // Default to no
     delayRight.toneOctLP.Init(sample_rate);
     delayRight.toneOctLP.SetFreq(20000.0);
 
-    delayLineSpread.Init();
-    delaySpread.del = &delayLineSpread;
+    delaySpread.del = nullptr;
     delaySpread.delayTarget = 1500; // in samples
     delaySpread.active = true;
 
@@ -294,6 +284,41 @@ void ReverbDelayModule::Init(float sample_rate) {
     CalculateReverbMix();
 }
 
+bool ReverbDelayModule::Acquire(SdramArena &arena) {
+    delayLeft.del = arena.Create<DelayLineRevOct<float, MAX_DELAY>>(GetName());
+    delayLeft.delreverse = arena.Create<DelayLineReverse<float, MAX_DELAY_REV>>(GetName());
+    delayRight.del = arena.Create<DelayLineRevOct<float, MAX_DELAY>>(GetName());
+    delayRight.delreverse = arena.Create<DelayLineReverse<float, MAX_DELAY_REV>>(GetName());
+    delaySpread.del = arena.Create<DelayLineWatermark<float, MAX_DELAY_SPREAD>>(GetName());
+
+    if (delayLeft.del == nullptr || delayLeft.delreverse == nullptr || delayRight.del == nullptr ||
+        delayRight.delreverse == nullptr || delaySpread.del == nullptr) {
+        return false;
+    }
+
+    delayLeft.del->Init();
+    delayLeft.delreverse->Init();
+    delayRight.del->Init();
+    delayRight.delreverse->Init();
+    delaySpread.del->Init();
+
+    return true;
+}
+
+void ReverbDelayModule::Release(SdramArena &arena) {
+    arena.Free(delayLeft.del);
+    arena.Free(delayLeft.delreverse);
+    arena.Free(delayRight.del);
+    arena.Free(delayRight.delreverse);
+    arena.Free(delaySpread.del);
+
+    delayLeft.del = nullptr;
+    delayLeft.delreverse = nullptr;
+    delayRight.del = nullptr;
+    delayRight.delreverse = nullptr;
+    delaySpread.del = nullptr;
+}
+
 void ReverbDelayModule::ParameterChanged(int parameter_id) {
     if (parameter_id == DELAY_TIME) { // Delay Time
         UpdateLEDRate();
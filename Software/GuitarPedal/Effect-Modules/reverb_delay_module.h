@@ -4,6 +4,7 @@
 
 #include "Delays/delayline_reverse.h"
 #include "Delays/delayline_revoct.h"
+#include "Delays/delayline_watermark.h"
 #include "base_effect_module.h"
 #include "daisysp.h"
 #include <stdint.h>
@@ -92,7 +93,7 @@ struct dual_delay_reverb {
 //    A short, zero feedback (one repeat) delay for stereo spread
 
 struct delay_spread {
-    DelayLine<float, MAX_DELAY_SPREAD> *del;
+    DelayLineWatermark<float, MAX_DELAY_SPREAD> *del;
     float currentDelay;
     float delayTarget;
     float active = false;
@@ -140,16 +141,22 @@ class ReverbDelayModule : public BaseEffectModule {
     ReverbDelayModule();
     ~ReverbDelayModule();
 
+    // The ReverbSc kept in the object takes several hundred KB, far more than fits in DTCMRAM
+    static constexpr MemoryRegion kMemoryRegion = MemoryRegion::Sdram;
+
     void Init(float sample_rate) override;
     void UpdateLEDRate();
     void CalculateDelayMix();
     void CalculateReverbMix();
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
     void ProcessModulation();
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     void SetTempo(uint32_t bpm) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return static_cast<float>(MAX_DELAY) / GetSampleRate(); }
 
   private:
     ReverbSc m_reverbStereo;
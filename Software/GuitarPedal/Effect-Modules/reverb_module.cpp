@@ -36,7 +36,6 @@ static const auto s_metaData = [] {
     return params;
 }();
 
-ReverbSc DSY_SDRAM_BSS reverbStereo;
 // Default Constructor
 ReverbModule::ReverbModule()
     : BaseEffectModule(), m_timeMin(0.6f), m_timeMax(1.0f), m_lpFreqMin(600.0f), m_lpFreqMax(16000.0f)
@@ -59,8 +58,25 @@ ReverbModule::~ReverbModule() {
 
 void ReverbModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
-    m_reverbStereo = &reverbStereo;
-    m_reverbStereo->Init(sample_rate);
+
+    // The reverb is allocated from the SDRAM arena in Acquire
+    m_reverbStereo = nullptr;
+}
+
+bool ReverbModule::Acquire(SdramArena &arena) {
+    m_reverbStereo = arena.Create<ReverbSc>(GetName());
+
+    if (m_reverbStereo == nullptr) {
+        return false;
+    }
+
+    m_reverbStereo->Init(GetSampleRate());
+    return true;
+}
+
+void ReverbModule::Release(SdramArena &arena) {
+    arena.Free(m_reverbStereo);
+    m_reverbStereo = nullptr;
 }
 
 void ReverbModule::ProcessMono(float in) {
@@ -26,9 +26,13 @@ class ReverbModule : public BaseEffectModule {
     ~ReverbModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    // The reverb output decays continuously, this only needs to cover its delay lines so the tail spills over on bypass
+    float GetTailLengthInSeconds() const override { return 0.1f; }
 
   private:
     ReverbSc *m_reverbStereo;
@@ -23,8 +23,6 @@ static OctaveGenerator octave_scifi(sample_rate_temp / resample_factor); // resa
 static q::highshelf eq1_scifi(-11, 140_Hz, sample_rate_temp);
 static q::lowshelf eq2_scifi(5, 160_Hz, sample_rate_temp);
 
-ReverbSc DSY_SDRAM_BSS reverbStereo_scifi;
-
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, SciFiModule::PARAM_COUNT> params{};
 
@@ -112,7 +110,7 @@ static const auto s_metaData = [] {
 // Default Constructor
 SciFiModule::SciFiModule()
     : BaseEffectModule(), m_driveMin(0.4f), m_driveMax(0.6f), m_levelMin(0.0f), m_levelMax(1.0f), m_timeMin(0.6f), m_timeMax(1.0f),
-      m_lpFreqMin(500.0f), m_lpFreqMax(16000.0f), m_cachedEffectMagnitudeValue(1.0f) {
+      m_lpFreqMin(500.0f), m_lpFreqMax(16000.0f), m_driveSetting(0.4f), m_cachedEffectMagnitudeValue(1.0f) {
     // Set the name of the effect
     m_name = "SciFi";
 
@@ -137,13 +135,51 @@ void SciFiModule::Init(float sample_rate) {
         buff_out[j] = 0.0;
     }
 
-    m_reverbStereo = &reverbStereo_scifi;
-    m_reverbStereo->Init(sample_rate);
+    // The reverb is allocated from the SDRAM arena in Acquire
+    m_reverbStereo = nullptr;
 
     m_overdriveLeft.Init();
     m_overdriveRight.Init();
 }
 
+bool SciFiModule::Acquire(SdramArena &arena) {
+    m_reverbStereo = arena.Create<ReverbSc>(GetName());
+
+    if (m_reverbStereo == nullptr) {
+        return false;
+    }
+
+    m_reverbStereo->Init(GetSampleRate());
+    return true;
+}
+
+void SciFiModule::Release(SdramArena &arena) {
+    arena.Free(m_reverbStereo);
+    m_reverbStereo = nullptr;
+}
+
+void SciFiModule::ParameterSnapshotChanged() {
+    // Reverb settings only need to be updated when their parameters move
+    if (IsParameterDirty(TIME)) {
+        m_reverbStereo->SetFeedback(m_timeMin + GetSnapshotAsFloat(TIME) * (m_timeMax - m_timeMin));
+    }
+
+    if (IsParameterDirty(DAMP)) {
+        float invertedFreq =
+            1.0 - GetSnapshotAsFloat(DAMP); // Invert the damping param so that knob left is less dampening, knob right is more dampening
+        invertedFreq = invertedFreq * invertedFreq; // also square it for exponential taper (more control over lower frequencies)
+
+        m_reverbStereo->SetLpFreq(m_lpFreqMin + invertedFreq * (m_lpFreqMax - m_lpFreqMin));
+    }
+
+    // Overdrive drive setting is also only recalculated when it changes
+    if (IsParameterDirty(DRIVE)) {
+        m_driveSetting = m_driveMin + (GetSnapshotAsFloat(DRIVE) * (m_driveMax - m_driveMin));
+        m_overdriveLeft.SetDrive(m_driveSetting);
+        m_overdriveRight.SetDrive(m_driveSetting);
+    }
+}
+
 void SciFiModule::ProcessMono(float in) {
     BaseEffectModule::ProcessMono(in);
 
@@ -151,10 +187,10 @@ void SciFiModule::ProcessMono(float in) {
     buff[bin_counter] =
         m_audioLeft; // making a workaround for only processing sample by sample instead of block, will add 6 samples of latency
 
-    float dryLevel = GetParameterAsFloat(DRY);
-    float down1Level = GetParameterAsFloat(OCT_DOWN); // Setting 2 oct down and 1 oct down with one parameter
-    float down2Level = GetParameterAsFloat(OCT_DOWN); // Setting 2 oct down and 1 oct down with one parameter
-    float up1Level = GetParameterAsFloat(OCT_UP);
+    float dryLevel = GetSnapshotAsFloat(DRY);
+    float down1Level = GetSnapshotAsFloat(OCT_DOWN); // Setting 2 oct down and 1 oct down with one parameter
+    float down2Level = GetSnapshotAsFloat(OCT_DOWN); // Setting 2 oct down and 1 oct down with one parameter
+    float up1Level = GetSnapshotAsFloat(OCT_UP);
 
     // Process PolyOctave //////////////////////////////
 
@@ -192,21 +228,12 @@ void SciFiModule::ProcessMono(float in) {
 
     sendl = sendr = buff_out[bin_counter];
 
-    m_reverbStereo->SetFeedback(m_timeMin + GetParameterAsFloat(TIME) * (m_timeMax - m_timeMin));
-    float invertedFreq =
-        1.0 - GetParameterAsFloat(DAMP); // Invert the damping param so that knob left is less dampening, knob right is more dampening
-    invertedFreq = invertedFreq * invertedFreq; // also square it for exponential taper (more control over lower frequencies)
-
-    m_reverbStereo->SetLpFreq(m_lpFreqMin + invertedFreq * (m_lpFreqMax - m_lpFreqMin));
-
     m_reverbStereo->Process(sendl, sendr, &wetl, &wetr);
 
     //////////////////////////////////////////////////////////////
 
     // Overdrive the reverb output
-    float drive_setting = m_driveMin + (GetParameterAsFloat(DRIVE) * (m_driveMax - m_driveMin));
-    m_overdriveLeft.SetDrive(drive_setting);
-    m_overdriveRight.SetDrive(drive_setting);
+    const float drive_setting = m_driveSetting;
 
     float od_out_left =
         m_overdriveLeft.Process(wetl * 0.8) *
@@ -216,12 +243,12 @@ void SciFiModule::ProcessMono(float in) {
         (1.0 - (drive_setting * drive_setting * 2.8 - 0.1296)); // reduce volume as od drive goes up (otherwise way too loud)
 
     // Mix regular reverb with overdriven reverb (default is full overdrive)
-    float overdrive_mix_left = od_out_left * GetParameterAsFloat(OD_MIX) * 0.6 + wetl * (1.0 - GetParameterAsFloat(OD_MIX));
-    float overdrive_mix_right = od_out_right * GetParameterAsFloat(OD_MIX) * 0.6 + wetr * (1.0 - GetParameterAsFloat(OD_MIX));
+    float overdrive_mix_left = od_out_left * GetSnapshotAsFloat(OD_MIX) * 0.6 + wetl * (1.0 - GetSnapshotAsFloat(OD_MIX));
+    float overdrive_mix_right = od_out_right * GetSnapshotAsFloat(OD_MIX) * 0.6 + wetr * (1.0 - GetSnapshotAsFloat(OD_MIX));
 
     // Mix in the dry signal and set overall level
-    m_audioLeft = (overdrive_mix_left * GetParameterAsFloat(MIX) + input * (1.0 - GetParameterAsFloat(MIX))) * GetParameterAsFloat(LEVEL);
-    m_audioRight = (overdrive_mix_right * GetParameterAsFloat(MIX) + input * (1.0 - GetParameterAsFloat(MIX))) * GetParameterAsFloat(LEVEL);
+    m_audioLeft = (overdrive_mix_left * GetSnapshotAsFloat(MIX) + input * (1.0 - GetSnapshotAsFloat(MIX))) * GetSnapshotAsFloat(LEVEL);
+    m_audioRight = (overdrive_mix_right * GetSnapshotAsFloat(MIX) + input * (1.0 - GetSnapshotAsFloat(MIX))) * GetSnapshotAsFloat(LEVEL);
 }
 
 void SciFiModule::ProcessStereo(float inL, float inR) {
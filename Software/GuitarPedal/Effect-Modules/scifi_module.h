@@ -38,6 +38,9 @@ class SciFiModule : public BaseEffectModule {
     ~SciFiModule();
 
     void Init(float sample_rate) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
+    void ParameterSnapshotChanged() override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
@@ -60,6 +63,7 @@ class SciFiModule : public BaseEffectModule {
 
     Overdrive m_overdriveLeft;
     Overdrive m_overdriveRight;
+    float m_driveSetting;
 
     float m_cachedEffectMagnitudeValue;
 };
@@ -20,6 +20,9 @@ class ScopeModule : public BaseEffectModule {
     ScopeModule();
     ~ScopeModule();
 
+    // Only feeds the display, its buffer doesn't need DTCMRAM
+    static constexpr MemoryRegion kMemoryRegion = MemoryRegion::Sram;
+
     void Init(float sample_rate) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
@@ -7,10 +7,9 @@ using namespace bkshepherd;
 using namespace soundmath;
 
 #define PI 3.1415926535897932384626433832795
-// convenient lookup tables
-Wave<float> hann([](float phase) -> float {
-    return 0.5 * (1 - cos(2 * PI * phase));
-}); // see if moving this to sdram significantly slows things down, YES, fails to load if allocated to SDRAM
+// convenient lookup tables, the window is read for every sample of every frame so it is kept in DTCMRAM (it fails to
+// load if allocated to SDRAM), its constructor fills the whole table
+Wave<float> DSP_HOT_BSS hann([](float phase) -> float { return 0.5 * (1 - cos(2 * PI * phase)); });
 // Wave<float> halfhann([] (float phase) -> float { return sin(PI * phase); });
 
 // 4 overlapping windows of size 2^12 = 4096
@@ -29,13 +28,13 @@ static const size_t offset = N / 2; // equals 512
 
 // buffers for STFT processing
 // audio --> in --(fft)--> middle --(process)--> out --(ifft)--> in -->
-// each of these is a few circular buffers stacked end-to-end.
-float DSY_SDRAM_BSS in[buffsize];     // buffers for input and output (from / to user audio callback)
-float DSY_SDRAM_BSS middle[buffsize]; // buffers for unprocessed frequency domain data
-float DSY_SDRAM_BSS out[buffsize];    // buffers for processed frequency domain data
+// each of these is a few circular buffers stacked end-to-end, allocated from the SDRAM arena in Acquire.
+float *in = nullptr;     // buffers for input and output (from / to user audio callback)
+float *middle = nullptr; // buffers for unprocessed frequency domain data
+float *out = nullptr;    // buffers for processed frequency domain data
 
 ShyFFT<float, N, RotationPhasor> *fft; // fft object
-Fourier<float, N> *stft;               // stft object
+Fourier<float, N> *stft = nullptr;     // stft object, created in Acquire since it holds the buffers
 
 float fft_size = N / 2;
 
@@ -45,8 +44,12 @@ constexpr size_t MAX_DELAY_SPECTRAL_DELAY =
 
 // const int delay_array_size = 175;
 const int delay_array_size = 120;
-DelayLine<float, MAX_DELAY_SPECTRAL_DELAY> DSY_SDRAM_BSS delayLine_array_real[delay_array_size];
-DelayLine<float, MAX_DELAY_SPECTRAL_DELAY> DSY_SDRAM_BSS delayLine_array_imag[delay_array_size];
+DelayLine<float, MAX_DELAY_SPECTRAL_DELAY> *delayLine_array_real = nullptr; // delay_array_size lines from the SDRAM arena
+DelayLine<float, MAX_DELAY_SPECTRAL_DELAY> *delayLine_array_imag = nullptr; // delay_array_size lines from the SDRAM arena
+
+// Number of bins delayed at each quality level, the fft size is fixed at compile time so lower levels delay fewer bins
+static constexpr size_t s_delayBinsForQualityLevel[] = {delay_array_size, 80, 40};
+size_t active_delay_bins = delay_array_size;
 
 float vtone = 0.0;
 bool mono_mode = false;
@@ -83,7 +86,7 @@ inline void spectraldelay(const float *in, float *out) {
         float test = vtone * 20;
         size_t tone_bins = static_cast<size_t>(test);
         // each delayline affects 1 bin. 512 total bins. only using first 175 bins in more audible frequencies, more causes dropouts
-        if (i < delay_array_size && i > tone_bins) {
+        if (i < active_delay_bins && i > tone_bins) {
 
             real = in[i];
             imag = in[i + offset];
@@ -168,6 +171,13 @@ SpectralDelayModule::SpectralDelayModule() : BaseEffectModule(), m_cachedEffectM
 
     // Initialize Parameters for this Effect
     this->InitParams(static_cast<int>(s_metaData.size()));
+
+    // Recalculating every bin is too slow for the audio callback, each bin just picks up its new delay target and
+    // feedback when they're written so they can be updated from the main loop while the Effect runs
+    SetParameterChangedOnControlThread(TIME, false);
+    SetParameterChangedOnControlThread(TIME_MODE, false);
+    SetParameterChangedOnControlThread(FDBK, false);
+    SetParameterChangedOnControlThread(FDBK_MODE, false);
 }
 
 // Destructor
@@ -178,25 +188,74 @@ SpectralDelayModule::~SpectralDelayModule() {
 void SpectralDelayModule::Init(float sample_rate) {
     BaseEffectModule::Init(sample_rate);
 
-    // initialize FFT and STFT objects
+    // Initialize delay array settings, the delay lines are hooked up in Acquire
+    for (int i = 0; i < delay_array_size; i++) {
+        delay_array_real[i].del = nullptr;
+        delay_array_real[i].delayTarget = 100; // in samples
+        delay_array_real[i].feedback = 0.0;
+        delay_array_real[i].active = true;
+
+        delay_array_imag[i].del = nullptr;
+        delay_array_imag[i].delayTarget = 100; // in samples
+        delay_array_imag[i].feedback = 0.0;
+        delay_array_imag[i].active = true;
+    }
+}
+
+void SpectralDelayModule::Prepare() {
+    // initialize FFT, the STFT is created with its buffers in Acquire
     fft = new ShyFFT<float, N, RotationPhasor>();
     fft->Init();
-    stft = new Fourier<float, N>(spectraldelay, fft, &hann, laps, in, middle, out);
+}
+
+bool SpectralDelayModule::Acquire(SdramArena &arena) {
+    in = static_cast<float *>(arena.Allocate(sizeof(float) * buffsize, GetName()));
+    middle = static_cast<float *>(arena.Allocate(sizeof(float) * buffsize, GetName()));
+    out = static_cast<float *>(arena.Allocate(sizeof(float) * buffsize, GetName()));
+    delayLine_array_real = arena.CreateArray<DelayLine<float, MAX_DELAY_SPECTRAL_DELAY>>(delay_array_size, GetName());
+    delayLine_array_imag = arena.CreateArray<DelayLine<float, MAX_DELAY_SPECTRAL_DELAY>>(delay_array_size, GetName());
+
+    if (in == nullptr || middle == nullptr || out == nullptr || delayLine_array_real == nullptr || delayLine_array_imag == nullptr) {
+        return false;
+    }
+
+    memset(in, 0, sizeof(float) * buffsize);
+    memset(middle, 0, sizeof(float) * buffsize);
+    memset(out, 0, sizeof(float) * buffsize);
 
-    // Initialize delay array settings
     for (int i = 0; i < delay_array_size; i++) {
         delayLine_array_real[i].Init();
         delay_array_real[i].del = &delayLine_array_real[i];
-        delay_array_real[i].delayTarget = 100; // in samples
-        delay_array_real[i].feedback = 0.0;
-        delay_array_real[i].active = true;
 
         delayLine_array_imag[i].Init();
         delay_array_imag[i].del = &delayLine_array_imag[i];
-        delay_array_imag[i].delayTarget = 100; // in samples
-        delay_array_imag[i].feedback = 0.0;
-        delay_array_imag[i].active = true;
     }
+
+    stft = new Fourier<float, N>(spectraldelay, fft, &hann, laps, in, middle, out);
+
+    return true;
+}
+
+void SpectralDelayModule::Release(SdramArena &arena) {
+    delete stft;
+    stft = nullptr;
+
+    for (int i = 0; i < delay_array_size; i++) {
+        delay_array_real[i].del = nullptr;
+        delay_array_imag[i].del = nullptr;
+    }
+
+    arena.Free(in);
+    arena.Free(middle);
+    arena.Free(out);
+    arena.Free(delayLine_array_real);
+    arena.Free(delayLine_array_imag);
+
+    in = nullptr;
+    middle = nullptr;
+    out = nullptr;
+    delayLine_array_real = nullptr;
+    delayLine_array_imag = nullptr;
 }
 
 void SpectralDelayModule::ParameterChanged(int parameter_id) // Somewhere here is causeing issues on start up, if I take them out it
@@ -294,6 +353,20 @@ void SpectralDelayModule::ProcessStereo(float inL, float inR) {
     // m_audioRight = m_audioRight * m_cachedEffectMagnitudeValue;
 }
 
+float SpectralDelayModule::GetTailLengthInSeconds() const {
+    // The delay lines run once per fft hop, so their length is in hops rather than samples
+    return static_cast<float>(MAX_DELAY_SPECTRAL_DELAY) / 188.0f + static_cast<float>(buffsize) / GetSampleRate();
+}
+
+void SpectralDelayModule::SetQualityLevel(int level) {
+    BaseEffectModule::SetQualityLevel(level);
+    active_delay_bins = s_delayBinsForQualityLevel[GetQualityLevel()];
+}
+
+int SpectralDelayModule::GetQualityLevelCount() const {
+    return sizeof(s_delayBinsForQualityLevel) / sizeof(s_delayBinsForQualityLevel[0]);
+}
+
 float SpectralDelayModule::GetBrightnessForLED(int led_id) const {
     float value = BaseEffectModule::GetBrightnessForLED(led_id);
 
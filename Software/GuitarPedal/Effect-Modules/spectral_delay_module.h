@@ -46,10 +46,16 @@ class SpectralDelayModule : public BaseEffectModule {
     ~SpectralDelayModule();
 
     void Init(float sample_rate) override;
+    void Prepare() override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ParameterChanged(int parameter_id) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override;
+    void SetQualityLevel(int level) override;
+    int GetQualityLevelCount() const override;
 
   private:
     float m_cachedEffectMagnitudeValue;
@@ -9,10 +9,6 @@ static const char *s_modeNames[4] = {"Fixed", "Multi", "Single", "LoFi"};
 static const char *s_divisionNames[3] = {"Quarter", "Dotted8", "Triplet"};
 static const char *s_headConfigNames[3] = {"Head1", "Head2", "Head3"};
 
-DelayLine<float, TAPE_MAX_DELAY_SAMPLES> DSY_SDRAM_BSS s_tapeDelayLineL;
-DelayLine<float, TAPE_MAX_DELAY_SAMPLES> DSY_SDRAM_BSS s_tapeDelayLineR;
-ReverbSc DSY_SDRAM_BSS s_tapeReverb;
-
 static const auto s_metaData = [] {
     std::array<ParameterMetaData, TapeDelayModule::PARAM_COUNT> params{};
 
@@ -22,7 +18,9 @@ static const auto s_metaData = [] {
         valueBinCount : 0,
         defaultValue : {.float_value = 0.25f},
         knobMapping : 0,
-        midiCCMapping : 60
+        midiCCMapping : 60,
+        smoothingType : ParameterSmoothingType::Exponential,
+        smoothingTimeInSeconds : 0.04f
     };
 
     params[TapeDelayModule::MIX] = {
@@ -31,7 +29,9 @@ static const auto s_metaData = [] {
         valueBinCount : 0,
         defaultValue : {.float_value = 0.4f},
         knobMapping : 1,
-        midiCCMapping : 61
+        midiCCMapping : 61,
+        smoothingType : ParameterSmoothingType::Linear,
+        smoothingTimeInSeconds : 0.02f
     };
 
     params[TapeDelayModule::REPEATS] = {
@@ -40,7 +40,9 @@ static const auto s_metaData = [] {
         valueBinCount : 0,
         defaultValue : {.float_value = 0.15f},
         knobMapping : 2,
-        midiCCMapping : 62
+        midiCCMapping : 62,
+        smoothingType : ParameterSmoothingType::Linear,
+        smoothingTimeInSeconds : 0.02f
     };
 
     params[TapeDelayModule::MODE] = {
@@ -298,7 +300,7 @@ void TapeDelayModule::UpdateImperfections(float amount, float &dropoutGain, floa
     crinkleOffset = m_crinkleOffset;
 }
 
-void TapeDelayModule::GetHeadMix(float baseSamples, DelayLine<float, TAPE_MAX_DELAY_SAMPLES> &delay, float &out) const {
+void TapeDelayModule::GetHeadMix(float baseSamples, DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES> &delay, float &out) const {
     // Binned values in this framework are 1..N, so convert to zero-based here.
     int mode = GetParameterAsBinnedValue(MODE) - 1;
     int headCfg = GetParameterAsBinnedValue(HEAD_CONFIG) - 1;
@@ -351,7 +353,7 @@ void TapeDelayModule::GetHeadMix(float baseSamples, DelayLine<float, TAPE_MAX_DE
 
 float TapeDelayModule::ProcessChannel(float input, float speedMod, float dropoutGain, float crinkleOffset, float age,
                                       bool isLoFi,
-                                      DelayLine<float, TAPE_MAX_DELAY_SAMPLES> &delay, Tone &tone, Svf &hp) {
+                                      DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES> &delay, Tone &tone, Svf &hp) {
     float division = isLoFi ? 1.0f : GetDivisionMultiplier();
     float baseSamples = m_currentDelaySamples * division + speedMod + crinkleOffset;
     float minDelay = isLoFi ? 2.0f : 1.0f;
@@ -414,13 +416,10 @@ float TapeDelayModule::ProcessChannel(float input, float speedMod, float dropout
 }
 
 void TapeDelayModule::ResetInternalState() {
-    if (m_delayL != nullptr) {
+    // The delay lines and reverb only exist between Acquire and Release
+    if (HasResources()) {
         m_delayL->Init();
-    }
-    if (m_delayR != nullptr) {
         m_delayR->Init();
-    }
-    if (m_reverb != nullptr) {
         m_reverb->Init(m_sampleRate);
         m_reverb->SetFeedback(0.85f);
         m_reverb->SetLpFreq(9000.0f);
@@ -440,9 +439,12 @@ void TapeDelayModule::ResetInternalState() {
     m_dropoutSamplesRemaining = 0.0f;
     m_crinkleSamplesRemaining = 0.0f;
     m_imperfectionCooldownSamples = 0.0f;
-    m_smoothedTime = GetParameterAsFloat(TIME);
-    m_smoothedMix = GetParameterAsFloat(MIX);
-    m_smoothedRepeats = GetParameterAsFloat(REPEATS);
+
+    ResetParameterSmoothing();
+    m_smoothedTime = GetSmoothedParameterStart(TIME);
+    m_smoothedMix = GetSmoothedParameterStart(MIX);
+    m_smoothedRepeats = GetSmoothedParameterStart(REPEATS);
+    UpdateMix();
 }
 
 void TapeDelayModule::Init(float sample_rate) {
@@ -450,13 +452,6 @@ void TapeDelayModule::Init(float sample_rate) {
 
     m_sampleRate = sample_rate;
 
-    m_delayL = &s_tapeDelayLineL;
-    m_delayR = &s_tapeDelayLineR;
-    m_reverb = &s_tapeReverb;
-
-    m_delayL->Init();
-    m_delayR->Init();
-
     m_toneL.Init(sample_rate);
     m_toneR.Init(sample_rate);
 
@@ -465,10 +460,6 @@ void TapeDelayModule::Init(float sample_rate) {
     m_hpL.SetRes(0.1f);
     m_hpR.SetRes(0.1f);
 
-    m_reverb->Init(sample_rate);
-    m_reverb->SetFeedback(0.85f);
-    m_reverb->SetLpFreq(9000.0f);
-
     m_tapeModL.Init(sample_rate);
     m_tapeModR.Init(sample_rate);
 
@@ -477,21 +468,49 @@ void TapeDelayModule::Init(float sample_rate) {
     m_ledOsc.SetAmp(1.0f);
     m_ledOsc.SetFreq(2.0f);
 
-    UpdateMix();
     ResetInternalState();
 }
 
-void TapeDelayModule::ParameterChanged(int parameter_id) {
-    if (parameter_id == MIX) {
-        UpdateMix();
+bool TapeDelayModule::Acquire(SdramArena &arena) {
+    m_delayL = arena.Create<DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES>>(GetName());
+    m_delayR = arena.Create<DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES>>(GetName());
+    m_reverb = arena.Create<ReverbSc>(GetName());
+
+    if (m_delayL == nullptr || m_delayR == nullptr || m_reverb == nullptr) {
+        return false;
     }
+
+    m_delayL->Init();
+    m_delayR->Init();
+    m_reverb->Init(m_sampleRate);
+    m_reverb->SetFeedback(0.85f);
+    m_reverb->SetLpFreq(9000.0f);
+
+    return true;
+}
+
+void TapeDelayModule::Release(SdramArena &arena) {
+    arena.Free(m_delayL);
+    arena.Free(m_delayR);
+    arena.Free(m_reverb);
+
+    m_delayL = nullptr;
+    m_delayR = nullptr;
+    m_reverb = nullptr;
 }
 
 void TapeDelayModule::ProcessTapeBlock() {
     // Tape-style motor glide on Time sweeps; faster smoothing on mix/repeats just kills zipper noise.
-    fonepole(m_smoothedTime, GetParameterAsFloat(TIME), 0.0005f);
-    fonepole(m_smoothedMix, GetParameterAsFloat(MIX), 0.02f);
-    fonepole(m_smoothedRepeats, GetParameterAsFloat(REPEATS), 0.02f);
+    // The ramps are set up in the parameter meta data and evaluated once per block by the base class.
+    m_smoothedTime = GetSmoothedParameter(TIME);
+    m_smoothedRepeats = GetSmoothedParameter(REPEATS);
+
+    const float mix = GetSmoothedParameter(MIX);
+
+    if (mix != m_smoothedMix) {
+        m_smoothedMix = mix;
+        UpdateMix();
+    }
 
     UpdateDelayTimeAndLed();
     bool isLoFi = IsLoFiMode();
@@ -536,7 +555,8 @@ void TapeDelayModule::SetEnabled(bool isEnabled) {
     BaseEffectModule::SetEnabled(isEnabled);
 
     // Re-entering the effect should always start from silence to avoid stale, loud tails.
-    if (isEnabled && !wasEnabled) {
+    // A tail that is still spilling over from the bypass isn't stale, so leave it running.
+    if (isEnabled && !wasEnabled && IsIdle()) {
         ResetInternalState();
     }
 }
@@ -3,6 +3,7 @@
 #define TAPE_DELAY_MODULE_H
 
 #include "../Util/tape_modulator.h"
+#include "Delays/delayline_watermark.h"
 #include "base_effect_module.h"
 #include "daisy_seed.h"
 #include "daisysp.h"
@@ -40,11 +41,13 @@ class TapeDelayModule : public BaseEffectModule {
     ~TapeDelayModule();
 
     void Init(float sample_rate) override;
-    void ParameterChanged(int parameter_id) override;
+    bool Acquire(SdramArena &arena) override;
+    void Release(SdramArena &arena) override;
     void ProcessMono(float in) override;
     void ProcessStereo(float inL, float inR) override;
     void SetTempo(uint32_t bpm) override;
     float GetBrightnessForLED(int led_id) const override;
+    float GetTailLengthInSeconds() const override { return static_cast<float>(TAPE_MAX_DELAY_SAMPLES) / GetSampleRate(); }
     void SetEnabled(bool isEnabled) override;
     int GetMappedParameterIDForKnob(int knob_id) const override;
     void AlternateFootswitchHeldFor1Second() override;
@@ -87,8 +90,8 @@ class TapeDelayModule : public BaseEffectModule {
 
     float m_sampleRate;
 
-    DelayLine<float, TAPE_MAX_DELAY_SAMPLES> *m_delayL;
-    DelayLine<float, TAPE_MAX_DELAY_SAMPLES> *m_delayR;
+    DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES> *m_delayL;
+    DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES> *m_delayR;
 
     Tone m_toneL;
     Tone m_toneR;
@@ -107,11 +110,11 @@ class TapeDelayModule : public BaseEffectModule {
     float GetWowFlutterOffset(TapeModulator &mod, float rateScale);
     float Random01();
     void UpdateImperfections(float amount, float &dropoutGain, float &crinkleOffset);
-    void GetHeadMix(float baseSamples, DelayLine<float, TAPE_MAX_DELAY_SAMPLES> &delay, float &out) const;
+    void GetHeadMix(float baseSamples, DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES> &delay, float &out) const;
     void ResetInternalState();
     float ApplySafetyLimiter(float sample) const;
     float ProcessChannel(float input, float speedMod, float dropoutGain, float crinkleOffset, float age, bool isLoFi,
-               DelayLine<float, TAPE_MAX_DELAY_SAMPLES> &delay, Tone &tone, Svf &hp);
+               DelayLineWatermark<float, TAPE_MAX_DELAY_SAMPLES> &delay, Tone &tone, Svf &hp);
     void ProcessTapeBlock();
 };
 } // namespace bkshepherd
@@ -6,7 +6,7 @@ using namespace bkshepherd;
 
 // Globals
 extern BaseHardwareModule hardware;
-extern PersistentStorage<Settings> storage;
+extern SettingsStorage storage;
 extern int availableEffectsCount;
 extern BaseEffectModule **availableEffects;
 extern int activeEffectID;
@@ -27,13 +27,22 @@ void ClearCanvas(const daisy::UiCanvasDescriptor &canvasDescriptor) {
     }
 }
 
+// Names of the Effect Chain menu items
+static const char *s_effectChainSlotItemNames[EffectChainModule::kMaxSlots] = {"Slot 1", "Slot 2", "Slot 3", "Slot 4"};
+static const char *s_effectChainSlotOnItemNames[EffectChainModule::kMaxSlots] = {"Slot 1 On", "Slot 2 On", "Slot 3 On", "Slot 4 On"};
+
 // Default Constructor
 GuitarPedalUI::GuitarPedalUI()
     : m_needToCloseActiveEffectSettingsMenu(false), m_paramIdToReturnTo(-1), m_numActiveEffectSettingsItems(0),
       m_activePresetSelected(0), m_activePresetSettingIntValue(0, 255, 0, 1, 1), m_midiChannelSettingValue(1, 16, 1, 1, 5),
-      m_displayingSaveSettingsNotification(false), m_secondsSinceLastActiveEffectSettingsSave(0.0f)
+      m_effectChainSlotNames(nullptr), m_displayingSaveSettingsNotification(false), m_settingsSaveInProgress(false),
+      m_secondsSinceLastActiveEffectSettingsSave(0.0f)
 
-{}
+{
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        m_effectChainSlotMappedValues[i] = nullptr;
+    }
+}
 
 // Destructor
 GuitarPedalUI::~GuitarPedalUI() {}
@@ -111,15 +120,41 @@ void GuitarPedalUI::UpdateActiveEffectParameterValues() {
     }
 }
 
+void GuitarPedalUI::UpdateActivePreset() {
+    // Keep the menu from loading the preset it had selected over the recalled one
+    m_activePresetSelected = activeEffect->GetCurrentPreset();
+    m_activePresetSettingIntValue.Set(m_activePresetSelected);
+
+    UpdateActiveEffectParameterValues();
+}
+
 void GuitarPedalUI::ShowSavingSettingsScreen() {
     m_displayingSaveSettingsNotification = true;
+    m_settingsSaveInProgress = true;
     m_secondsSinceLastActiveEffectSettingsSave = 0.0f;
 }
 
+void GuitarPedalUI::SettingsSaved() { m_settingsSaveInProgress = false; }
+
 bool GuitarPedalUI::IsShowingSavingSettingsScreen() { return m_displayingSaveSettingsNotification; }
 
 int GuitarPedalUI::GetActiveEffectIDFromSettingsMenu() { return m_availableEffectListMappedValues->GetIndex(); }
 
+int GuitarPedalUI::GetEffectChainSlotFromSettingsMenu(int slot) {
+    // The first entry of the list is "Off"
+    return m_effectChainSlotMappedValues[slot]->GetIndex() - 1;
+}
+
+void GuitarPedalUI::UpdateEffectChain() {
+    if (hardware.SupportsDisplay()) {
+        Settings &settings = storage.GetSettings();
+
+        for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+            m_effectChainSlotMappedValues[i]->SetIndex(settings.globalEffectChain[i] + 1);
+        }
+    }
+}
+
 void GuitarPedalUI::InitUi() {
     UI::SpecialControlIds specialControlIds;
     if (hardware.SupportsEncoder()) {
@@ -302,32 +337,74 @@ void GuitarPedalUI::InitGlobalSettingsUIPages() {
     m_globalSettingsMenuItems[0].text = "Effect";
     m_globalSettingsMenuItems[0].asMappedValueItem.valueToModify = m_availableEffectListMappedValues;
 
-    m_globalSettingsMenuItems[1].type = AbstractMenu::ItemType::checkboxItem;
-    m_globalSettingsMenuItems[1].text = "True Bypass";
-    m_globalSettingsMenuItems[1].asCheckboxItem.valueToModify = &settings.globalRelayBypassEnabled;
+    m_globalSettingsMenuItems[1].type = AbstractMenu::ItemType::openUiPageItem;
+    m_globalSettingsMenuItems[1].text = "Chain";
+    m_globalSettingsMenuItems[1].asOpenUiPageItem.pageToOpen = &m_effectChainMenu;
 
     m_globalSettingsMenuItems[2].type = AbstractMenu::ItemType::checkboxItem;
-    m_globalSettingsMenuItems[2].text = "Split Mono";
-    m_globalSettingsMenuItems[2].asCheckboxItem.valueToModify = &settings.globalSplitMonoInputToStereo;
+    m_globalSettingsMenuItems[2].text = "True Bypass";
+    m_globalSettingsMenuItems[2].asCheckboxItem.valueToModify = &settings.globalRelayBypassEnabled;
 
     m_globalSettingsMenuItems[3].type = AbstractMenu::ItemType::checkboxItem;
-    m_globalSettingsMenuItems[3].text = "Midi On";
-    m_globalSettingsMenuItems[3].asCheckboxItem.valueToModify = &settings.globalMidiEnabled;
+    m_globalSettingsMenuItems[3].text = "Split Mono";
+    m_globalSettingsMenuItems[3].asCheckboxItem.valueToModify = &settings.globalSplitMonoInputToStereo;
 
     m_globalSettingsMenuItems[4].type = AbstractMenu::ItemType::checkboxItem;
-    m_globalSettingsMenuItems[4].text = "Midi Thru";
-    m_globalSettingsMenuItems[4].asCheckboxItem.valueToModify = &settings.globalMidiThrough;
+    m_globalSettingsMenuItems[4].text = "Midi On";
+    m_globalSettingsMenuItems[4].asCheckboxItem.valueToModify = &settings.globalMidiEnabled;
 
-    m_globalSettingsMenuItems[5].type = AbstractMenu::ItemType::valueItem;
-    m_globalSettingsMenuItems[5].text = "Midi Ch";
+    m_globalSettingsMenuItems[5].type = AbstractMenu::ItemType::checkboxItem;
+    m_globalSettingsMenuItems[5].text = "Midi Thru";
+    m_globalSettingsMenuItems[5].asCheckboxItem.valueToModify = &settings.globalMidiThrough;
+
+    m_globalSettingsMenuItems[6].type = AbstractMenu::ItemType::valueItem;
+    m_globalSettingsMenuItems[6].text = "Midi Ch";
     m_midiChannelSettingValue.Set(settings.globalMidiChannel);
-    m_globalSettingsMenuItems[5].asMappedValueItem.valueToModify = &m_midiChannelSettingValue;
+    m_globalSettingsMenuItems[6].asMappedValueItem.valueToModify = &m_midiChannelSettingValue;
 
-    m_globalSettingsMenuItems[6].type = AbstractMenu::ItemType::closeMenuItem;
-    m_globalSettingsMenuItems[6].text = "Back";
+    m_globalSettingsMenuItems[7].type = AbstractMenu::ItemType::closeMenuItem;
+    m_globalSettingsMenuItems[7].text = "Back";
 
     m_globalSettingsMenu.Init(m_globalSettingsMenuItems, kNumGlobalSettingsMenuItems);
 
+    // ====================================================================
+    // The "Chain" menu, an effect (or Off) and an on / off switch for each slot
+    // ====================================================================
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        if (m_effectChainSlotMappedValues[i] != nullptr) {
+            delete m_effectChainSlotMappedValues[i];
+        }
+    }
+
+    if (m_effectChainSlotNames != nullptr) {
+        delete[] m_effectChainSlotNames;
+    }
+
+    m_effectChainSlotNames = new const char *[availableEffectsCount + 1];
+    m_effectChainSlotNames[0] = "Off";
+
+    for (int i = 0; i < availableEffectsCount; i++) {
+        m_effectChainSlotNames[i + 1] = m_availableEffectNames[i];
+    }
+
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        m_effectChainSlotMappedValues[i] =
+            new MappedStringListValue(m_effectChainSlotNames, availableEffectsCount + 1, settings.globalEffectChain[i] + 1);
+
+        m_effectChainMenuItems[2 * i].type = AbstractMenu::ItemType::valueItem;
+        m_effectChainMenuItems[2 * i].text = s_effectChainSlotItemNames[i];
+        m_effectChainMenuItems[2 * i].asMappedValueItem.valueToModify = m_effectChainSlotMappedValues[i];
+
+        m_effectChainMenuItems[2 * i + 1].type = AbstractMenu::ItemType::checkboxItem;
+        m_effectChainMenuItems[2 * i + 1].text = s_effectChainSlotOnItemNames[i];
+        m_effectChainMenuItems[2 * i + 1].asCheckboxItem.valueToModify = &settings.globalEffectChainSlotEnabled[i];
+    }
+
+    m_effectChainMenuItems[kNumEffectChainMenuItems - 1].type = AbstractMenu::ItemType::closeMenuItem;
+    m_effectChainMenuItems[kNumEffectChainMenuItems - 1].text = "Back";
+
+    m_effectChainMenu.Init(m_effectChainMenuItems, kNumEffectChainMenuItems);
+
     m_presetsMenuItems[0].type = AbstractMenu::ItemType::valueItem;
     m_presetsMenuItems[0].text = "Preset #";
     m_presetsMenuItems[0].asMappedValueItem.valueToModify = &m_activePresetSettingIntValue;
@@ -400,7 +477,8 @@ void GuitarPedalUI::UpdateUI(float elapsedTime) {
         // Change the main menu text to say saved
         m_effectModuleMenuItem.SetIsSavingData(true);
 
-        if (m_secondsSinceLastActiveEffectSettingsSave > 2.0f) {
+        // Keep it up until the save is in the flash, and long enough to be read
+        if (!m_settingsSaveInProgress && m_secondsSinceLastActiveEffectSettingsSave > 1.0f) {
             m_displayingSaveSettingsNotification = false;
             m_effectModuleMenuItem.SetIsSavingData(false);
         }
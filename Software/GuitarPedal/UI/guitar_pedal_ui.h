@@ -2,13 +2,15 @@
 #ifndef GUITAR_PEDAL_UI_H
 #define GUITAR_PEDAL_UI_H
 
+#include "../Effect-Modules/effect_chain_module.h"
 #include "CustomMappedValues.h"
 #include "daisy_seed.h"
 #include "effect_module_menu_item.h"
 using namespace daisy;
 
 const int kNumMainMenuItems = 3;
-const int kNumGlobalSettingsMenuItems = 7;
+const int kNumGlobalSettingsMenuItems = 8;
+const int kNumEffectChainMenuItems = 2 * bkshepherd::EffectChainModule::kMaxSlots + 1;
 const int kNumPresetSettingsItems = 3;
 
 namespace bkshepherd {
@@ -29,9 +31,15 @@ class GuitarPedalUI {
     /** Handle updating all Parameter Values for the Active Effect Module */
     void UpdateActiveEffectParameterValues();
 
-    /** Handle Showing the Saving Settings Screen */
+    /** Handle updating the Preset menu and all Parameter Values after a preset was recalled from outside the menu (ex. Midi) */
+    void UpdateActivePreset();
+
+    /** Handle Showing the Saving Settings Screen, it stays up until SettingsSaved is called */
     void ShowSavingSettingsScreen();
 
+    /** Called once the saved settings have been written to the flash, lets the Saving Settings Screen close */
+    void SettingsSaved();
+
     /** Query the UI to see if the Saving Settings Screen is showing
     \return True if the Savings Setting Screen is showing, False otherwise.
     */
@@ -42,6 +50,15 @@ class GuitarPedalUI {
     */
     int GetActiveEffectIDFromSettingsMenu();
 
+    /** Gets the Effect picked for a slot of the Effect Chain in the Settings Menu
+    \param slot the slot index, 0..EffectChainModule::kMaxSlots - 1
+    \return the ID of the Effect, EffectChainModule::kEmptySlot if the slot is Off
+    */
+    int GetEffectChainSlotFromSettingsMenu(int slot);
+
+    /** Handle updating the Effect Chain menu from the persistant storage settings (ex. when a chain was rejected) */
+    void UpdateEffectChain();
+
     /** Generates the Appropriate UI Events */
     void GenerateUIEvents();
 
@@ -59,6 +76,7 @@ class GuitarPedalUI {
     FullScreenItemMenu m_mainMenu;
     FullScreenItemMenu m_activeEffectSettingsMenu;
     FullScreenItemMenu m_globalSettingsMenu;
+    FullScreenItemMenu m_effectChainMenu;
     FullScreenItemMenu m_presetsMenu;
     UiEventQueue m_eventQueue;
 
@@ -68,6 +86,7 @@ class GuitarPedalUI {
 
     AbstractMenu::ItemConfig m_mainMenuItems[kNumMainMenuItems];
     AbstractMenu::ItemConfig m_globalSettingsMenuItems[kNumGlobalSettingsMenuItems];
+    AbstractMenu::ItemConfig m_effectChainMenuItems[kNumEffectChainMenuItems];
     AbstractMenu::ItemConfig m_presetsMenuItems[kNumPresetSettingsItems];
     int m_numActiveEffectSettingsItems;
     uint32_t m_activePresetSelected;
@@ -76,6 +95,8 @@ class GuitarPedalUI {
 
     const char **m_availableEffectNames;
     MappedStringListValue *m_availableEffectListMappedValues;
+    const char **m_effectChainSlotNames; // "Off" followed by the available effect names
+    MappedStringListValue *m_effectChainSlotMappedValues[EffectChainModule::kMaxSlots];
     MappedIntValue **m_activeEffectSettingIntValues;
     MappedIntValue m_activePresetSettingIntValue;
     MappedStringListValue **m_activeEffectSettingStringValues;
@@ -84,6 +105,7 @@ class GuitarPedalUI {
     MappedIntValue m_midiChannelSettingValue;
 
     bool m_displayingSaveSettingsNotification;
+    bool m_settingsSaveInProgress;
     float m_secondsSinceLastActiveEffectSettingsSave;
 };
 } // namespace bkshepherd
@@ -19,7 +19,7 @@ namespace daisysp_modified {
 
 template <typename T> class DelayLine {
   public:
-    DelayLine() : buffer_(nullptr), size_(0), write_ptr_(0), delay_(1), frac_(0.f) {}
+    DelayLine() : buffer_(nullptr), size_(0), write_ptr_(0), delay_(1), frac_(0.f), written_(0) {}
 
     void Init(T *buffer, size_t size) {
         buffer_ = buffer;
@@ -27,9 +27,9 @@ template <typename T> class DelayLine {
         Reset();
     }
 
+    // Constant time, the parts of the buffer that haven't been written since read back as silence (see At)
     void Reset() {
-        for (size_t i = 0; i < size_; ++i)
-            buffer_[i] = T(0);
+        written_ = 0;
         write_ptr_ = 0;
         delay_ = 1;
         frac_ = 0.f;
@@ -49,21 +49,32 @@ template <typename T> class DelayLine {
 
     void Write(const T sample) {
         buffer_[write_ptr_] = sample;
+        written_ = written_ < size_ ? written_ + 1 : size_;
         write_ptr_ = (write_ptr_ - 1 + size_) % size_;
     }
 
     T Read() const {
-        T a = buffer_[(write_ptr_ + delay_) % size_];
-        T b = buffer_[(write_ptr_ + delay_ + 1) % size_];
+        T a = At((write_ptr_ + delay_) % size_);
+        T b = At((write_ptr_ + delay_ + 1) % size_);
         return a + (b - a) * frac_;
     }
 
   private:
+    // The buffer is written downwards from index 0, so the written span is index 0 and the top written_ - 1 indices
+    T At(size_t index) const {
+        if (written_ >= size_ || (written_ > 0 && (index == 0 || index > size_ - written_))) {
+            return buffer_[index];
+        }
+
+        return T(0);
+    }
+
     T *buffer_;
     size_t size_;
     size_t write_ptr_;
     size_t delay_;
     float frac_;
+    size_t written_; // Samples written since the last Reset, the whole buffer is valid once it reaches size_
 };
 
 } // namespace daisysp_modified
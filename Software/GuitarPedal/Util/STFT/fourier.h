@@ -1,6 +1,7 @@
 // fourier.h
 #ifndef FOURIER
 
+#include "../block_trace.h"
 #include "wave.h"
 
 namespace soundmath {
@@ -50,6 +51,8 @@ template <typename T, size_t N> class Fourier {
                     reading[i] = true;
                     readpoints[i] = 0;
 
+                    bkshepherd::BlockTrace::MarkTask(bkshepherd::BlockTraceTask::Fft);
+
                     forward(i);  // FTs ith in to ith middle buffer
                     process(i);  // user-defined; ought to move info from ith middle to out buffer
                     backward(i); // IFTs ith out to ith in buffer
@@ -0,0 +1,117 @@
+#include "block_trace.h"
+#include "memory_placement.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace bkshepherd;
+
+// Written once per block, not per sample, so it doesn't need to take up DTCMRAM
+BlockTraceRecord DSP_SRAM_DATA BlockTrace::s_records[kCapacity];
+std::atomic<uint32_t> BlockTrace::s_blockCount{0};
+uint32_t BlockTrace::s_blockStartTicks = 0;
+uint16_t BlockTrace::s_blockTasks = 0;
+volatile uint16_t BlockTrace::s_backgroundTasks = 0;
+BlockTraceRecord BlockTrace::s_worstBlock = {0, 0, 0, nullptr, 0};
+volatile bool BlockTrace::s_resetRequested = false;
+
+namespace {
+
+// Names of the BlockTraceTask bits, in bit order
+const char *s_taskNames[BlockTraceTask::Count] = {"commands", "parameters", "switch", "quality", "fft", "idle", "storage", "overrun"};
+} // namespace
+
+void BlockTrace::BeginBlock() {
+    s_blockStartTicks = Profiler::Now();
+    s_blockTasks = s_backgroundTasks;
+}
+
+void BlockTrace::EndBlock(const char *effectName) {
+    const uint32_t durationTicks = Profiler::Now() - s_blockStartTicks;
+    const uint32_t block = s_blockCount.load(std::memory_order_relaxed);
+
+    if (durationTicks > Profiler::GetBlockBudgetTicks()) {
+        s_blockTasks |= BlockTraceTask::Overrun;
+    }
+
+    BlockTraceRecord &record = s_records[block & (kCapacity - 1)];
+    record.block = block;
+    record.startTicks = s_blockStartTicks;
+    record.durationTicks = durationTicks;
+    record.effectName = effectName;
+    record.tasks = s_blockTasks;
+
+    if (s_resetRequested) {
+        s_worstBlock.durationTicks = 0;
+        s_resetRequested = false;
+    }
+
+    if (durationTicks > s_worstBlock.durationTicks) {
+        s_worstBlock = record;
+    }
+
+    // Publish the record only once it's complete
+    s_blockCount.store(block + 1, std::memory_order_release);
+}
+
+void BlockTrace::SetBackgroundTask(uint16_t task, bool running) {
+    if (running) {
+        s_backgroundTasks = s_backgroundTasks | task;
+    } else {
+        s_backgroundTasks = s_backgroundTasks & ~task;
+    }
+}
+
+int BlockTrace::Read(uint32_t &firstBlock, BlockTraceRecord *records, int maxCount) {
+    const uint32_t end = GetBlockCount();
+
+    // Start at the oldest record still in the ring if the reader fell behind, unsigned differences handle wrapping
+    uint32_t first = firstBlock;
+
+    if (end - first > kCapacity) {
+        first = end - kCapacity;
+    }
+
+    const uint32_t count = end - first < static_cast<uint32_t>(maxCount) ? end - first : static_cast<uint32_t>(maxCount);
+
+    for (uint32_t i = 0; i < count; i++) {
+        records[i] = s_records[(first + i) & (kCapacity - 1)];
+    }
+
+    // The audio callback may have written over the oldest records while they were being copied, drop those. A record is
+    // only published once the callback is done with it, so the ones that are left are whole.
+    const uint32_t endAfterCopy = GetBlockCount();
+    uint32_t overwritten = endAfterCopy - first > kCapacity ? endAfterCopy - kCapacity - first : 0;
+    overwritten = overwritten < count ? overwritten : count;
+
+    if (overwritten > 0) {
+        memmove(records, records + overwritten, (count - overwritten) * sizeof(BlockTraceRecord));
+    }
+
+    firstBlock = first + count;
+    return static_cast<int>(count - overwritten);
+}
+
+void BlockTrace::FormatTasks(uint16_t tasks, char *buffer, size_t size) {
+    size_t length = 0;
+    buffer[0] = '\0';
+
+    for (int bit = 0; bit < BlockTraceTask::Count && length < size; bit++) {
+        if (tasks & (1 << bit)) {
+            length += snprintf(buffer + length, size - length, "%s%s", length > 0 ? "|" : "", s_taskNames[bit]);
+        }
+    }
+}
+
+void BlockTrace::FormatCsvRecord(const BlockTraceRecord &record, uint32_t startUs, char *buffer, size_t size) {
+    const uint32_t ticksPerUs = Profiler::GetTicksPerSecond() / 1000000;
+    const uint32_t durationNs = record.durationTicks % ticksPerUs * 1000 / ticksPerUs;
+    const uint32_t permille = Profiler::TicksToBudgetPermille(record.durationTicks);
+    const int overrun = (record.tasks & BlockTraceTask::Overrun) ? 1 : 0;
+    char tasks[96];
+    FormatTasks(record.tasks, tasks, sizeof(tasks));
+
+    snprintf(buffer, size, "%lu,%lu,%lu.%03lu,%lu.%lu,%s,%d,%s", (unsigned long)record.block, (unsigned long)startUs,
+             (unsigned long)(record.durationTicks / ticksPerUs), (unsigned long)durationNs, (unsigned long)(permille / 10),
+             (unsigned long)(permille % 10), record.effectName != nullptr ? record.effectName : "", overrun, tasks);
+}
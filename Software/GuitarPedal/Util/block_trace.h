@@ -0,0 +1,108 @@
+#pragma once
+#ifndef BLOCK_TRACE_H
+#define BLOCK_TRACE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file block_trace.h */
+
+namespace bkshepherd {
+
+/** Bits recording what ran during an audio block besides the effect's DSP, or what was running in the background */
+struct BlockTraceTask {
+    static constexpr uint16_t Commands = 1 << 0;      // Audio commands from the main loop were applied
+    static constexpr uint16_t Parameters = 1 << 1;    // Parameter changes were decoded or ParameterChanged was delivered
+    static constexpr uint16_t EffectSwitch = 1 << 2;  // The outgoing effect of an effect switch was processed too
+    static constexpr uint16_t QualityChange = 1 << 3; // The overrun governor changed the quality level of the effect
+    static constexpr uint16_t Fft = 1 << 4;           // A spectral effect transformed a frame
+    static constexpr uint16_t IdleSkip = 1 << 5;      // The effect wasn't processed, its input and tail were silent
+    static constexpr uint16_t Storage = 1 << 6;       // The main loop was writing the settings to the QSPI flash
+    static constexpr uint16_t Overrun = 1 << 7;       // The block took longer than its budget
+    static constexpr int Count = 8;
+};
+
+/** The timing of one audio block */
+struct BlockTraceRecord {
+    uint32_t block;         // Number of the block since startup
+    uint32_t startTicks;    // Profiler ticks at the start of the block
+    uint32_t durationTicks; // Profiler ticks the block took
+    const char *effectName; // The effect being processed, nullptr if there was none
+    uint16_t tasks;         // BlockTraceTask bits
+};
+
+/** Keeps the timing of the most recent audio blocks in a fixed size ring, to find the worst case blocks that cause
+ * crackles rather than the average load. The audio callback writes one record per block and the main loop (or an
+ * offline render) reads them, the ring is lock free with a single writer and a single reader: the writer never waits
+ * and a reader that falls behind simply skips the records that were overwritten.
+ */
+class BlockTrace {
+  public:
+    static constexpr uint32_t kCapacity = 256; // Records kept, a power of two
+
+    /** Starts the record of a block, call at the start of the audio callback */
+    static void BeginBlock();
+
+    /** Marks a task as having run during the current block, call from the audio callback
+     \param task a BlockTraceTask bit
+    */
+    static void MarkTask(uint16_t task) { s_blockTasks |= task; }
+
+    /** Finishes the record of the block and adds it to the ring, call at the end of the audio callback
+     \param effectName the effect that was processed, nullptr if there was none
+    */
+    static void EndBlock(const char *effectName);
+
+    /** Marks a main loop task as running, every block that starts while it runs records it
+     \param task a BlockTraceTask bit
+     \param running true when the task starts, false once it's done
+    */
+    static void SetBackgroundTask(uint16_t task, bool running);
+
+    /** Gets the number of blocks recorded since startup, the number of the next block */
+    static uint32_t GetBlockCount() { return s_blockCount.load(std::memory_order_acquire); }
+
+    /** Copies the records from a block on, oldest first. Blocks that were already overwritten are skipped.
+     \param firstBlock the number of the first block to copy, moved on past the last block copied
+     \param records where to copy the records to
+     \param maxCount the maximum number of records to copy
+     \return the number of records copied
+    */
+    static int Read(uint32_t &firstBlock, BlockTraceRecord *records, int maxCount);
+
+    /** Gets the longest block since startup or the last reset, it may be one block stale */
+    static BlockTraceRecord GetWorstBlock() { return s_worstBlock; }
+
+    /** Requests that the worst block is forgotten, applied by the next EndBlock */
+    static void RequestReset() { s_resetRequested = true; }
+
+    /** Formats the names of the tasks in a record separated by '|', ex. "parameters|fft"
+     \param tasks BlockTraceTask bits
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    static void FormatTasks(uint16_t tasks, char *buffer, size_t size);
+
+    /** Gets the header line for the CSV output of FormatCsvRecord */
+    static const char *GetCsvHeader() { return "block,start_us,duration_us,budget_percent,effect,overrun,tasks"; }
+
+    /** Formats a record as a CSV line (without the line break)
+     \param record The record to format
+     \param startUs the start of the block in microseconds, from whatever point the caller wants
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    static void FormatCsvRecord(const BlockTraceRecord &record, uint32_t startUs, char *buffer, size_t size);
+
+  private:
+    static BlockTraceRecord s_records[kCapacity];
+    static std::atomic<uint32_t> s_blockCount;
+    static uint32_t s_blockStartTicks;
+    static uint16_t s_blockTasks;
+    static volatile uint16_t s_backgroundTasks;
+    static BlockTraceRecord s_worstBlock;
+    static volatile bool s_resetRequested;
+};
+} // namespace bkshepherd
+#endif
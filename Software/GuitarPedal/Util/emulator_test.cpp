@@ -0,0 +1,79 @@
+#include "emulator_test.h"
+
+#if defined(EMULATOR_TEST)
+using namespace bkshepherd;
+
+uint32_t EmulatorTest::s_readFrame = 0;
+uint32_t EmulatorTest::s_writtenFrame = 0;
+uint32_t EmulatorTest::s_blockCount = 0;
+
+// The emulator script hooks these by name, they must stay out of line and must not be merged with each other
+extern "C" {
+__attribute__((noipa, used)) void EmulatorTestBlockBegin() { __asm__ volatile(""); }
+__attribute__((noipa, used)) void EmulatorTestBlockEnd() { __asm__ volatile(""); }
+__attribute__((noipa, used)) void EmulatorTestFinished() { __asm__ volatile(""); }
+}
+
+namespace {
+
+float *GetSamples(uint32_t offset) { return reinterpret_cast<float *>(EmulatorTestMailbox::kAddress + offset); }
+} // namespace
+
+bool EmulatorTest::IsPresent() { return GetMailbox().magic == EmulatorTestMailbox::kMagic; }
+
+int EmulatorTest::GetEffectID() { return static_cast<int>(GetMailbox().effectID); }
+
+uint32_t EmulatorTest::GetWarmupBlockCount() { return GetMailbox().warmupBlockCount; }
+
+bool EmulatorTest::ReadBlock(float *left, float *right, size_t size) {
+    const uint32_t inputFrames = GetMailbox().frameCount;
+    const uint32_t frameCount = inputFrames < EmulatorTestMailbox::kMaxFrames ? inputFrames : EmulatorTestMailbox::kMaxFrames;
+
+    if (s_readFrame >= frameCount) {
+        return false;
+    }
+
+    const float *input = GetSamples(EmulatorTestMailbox::kInputOffset) + 2 * s_readFrame;
+
+    for (size_t i = 0; i < size; i++) {
+        const bool hasInput = s_readFrame + i < frameCount;
+        left[i] = hasInput ? input[2 * i] : 0.0f;
+        right[i] = hasInput ? input[2 * i + 1] : 0.0f;
+    }
+
+    s_readFrame += size;
+    return true;
+}
+
+void EmulatorTest::BeginBlock() {
+    GetMailbox().block = s_blockCount;
+    EmulatorTestBlockBegin();
+}
+
+void EmulatorTest::EndBlock(const float *left, const float *right, size_t size) {
+    EmulatorTestBlockEnd();
+    s_blockCount++;
+
+    // Only the frames that had input are kept, the padding of the last block isn't
+    const uint32_t inputFrames = GetMailbox().frameCount;
+    const uint32_t frameCount = s_readFrame < inputFrames ? s_readFrame : inputFrames;
+    float *output = GetSamples(EmulatorTestMailbox::kOutputOffset) + 2 * s_writtenFrame;
+
+    for (size_t i = 0; i < size && s_writtenFrame + i < frameCount; i++) {
+        output[2 * i] = left[i];
+        output[2 * i + 1] = right[i];
+    }
+
+    s_writtenFrame = frameCount;
+}
+
+void EmulatorTest::Finish() {
+    GetMailbox().blockCount = s_blockCount;
+    EmulatorTestFinished();
+
+    // The script stops the emulation from the hook, keep the core busy in case it's run by hand
+    while (true) {
+        __asm__ volatile("");
+    }
+}
+#endif
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef EMULATOR_TEST_H
+#define EMULATOR_TEST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file emulator_test.h */
+
+namespace bkshepherd {
+
+/** The memory shared between the firmware and the emulator test script. It sits on the FMC's NOR / SRAM bank, which
+ * nothing is connected to on the Daisy Seed, so it only exists when ci/emulator/guitarpedal.repl maps memory there.
+ * ci/emulator_test.py mirrors the layout.
+ */
+struct EmulatorTestMailbox {
+    static constexpr uintptr_t kAddress = 0x60000000;
+    static constexpr uint32_t kMagic = 0x4C444550;      // "PEDL", written by the script once the input is loaded
+    static constexpr uint32_t kResultsOffset = 0x1000;  // Instructions of each measured block, a uint32_t per block
+    static constexpr uint32_t kInputOffset = 0x100000;  // Interleaved stereo float input
+    static constexpr uint32_t kOutputOffset = 0x800000; // Interleaved stereo float output
+    static constexpr uint32_t kMaxFrames = (kOutputOffset - kInputOffset) / (2 * sizeof(float));
+
+    uint32_t magic;
+    uint32_t effectID;         // The effect to run, in the order pedal-render --list shows them
+    uint32_t frameCount;       // Stereo frames of input
+    uint32_t warmupBlockCount; // Silent blocks run first so the effect selection and the bypass fade settle
+    uint32_t block;            // The block being measured, for the hooks
+    uint32_t blockCount;       // The number of blocks measured, set once the whole input has been processed
+    uint32_t hookScratch[2];   // The instruction count at the start of the block, kept by the hooks
+};
+
+/** Runs the audio callback on audio fed in by the Renode emulator instead of the codec, to measure the real firmware
+ * (arm-none-eabi codegen, memory placement, the callback's own overhead) without a Daisy attached. Renode doesn't model
+ * the STM32H7's SAI and its DMA, so the blocks are handed to the callback directly, the way the DMA interrupt does.
+ * The script hooks EmulatorTestBlockBegin / EmulatorTestBlockEnd to count the instructions of each block and collects
+ * the output once EmulatorTestFinished is reached.
+ *
+ * Built in with `make EMULATOR_TEST=1`, which defines EMULATOR_TEST. Don't flash that build, the mailbox doesn't exist
+ * on the pedal.
+ */
+class EmulatorTest {
+  public:
+    /** Checks if the emulator test script set up the mailbox */
+    static bool IsPresent();
+
+    /** Gets the effect the script asked for */
+    static int GetEffectID();
+
+    /** Gets the number of silent blocks to run before the input */
+    static uint32_t GetWarmupBlockCount();
+
+    /** Gets the next block of the input, the last block is padded with silence
+     \param left where to copy the left channel to
+     \param right where to copy the right channel to
+     \param size The number of samples in the block
+     \return false once the whole input has been read
+    */
+    static bool ReadBlock(float *left, float *right, size_t size);
+
+    /** Marks the start of the measured part of a block, call right before the audio callback */
+    static void BeginBlock();
+
+    /** Marks the end of the measured part of a block and stores its output
+     \param left the left channel the audio callback wrote
+     \param right the right channel the audio callback wrote
+     \param size The number of samples in the block
+    */
+    static void EndBlock(const float *left, const float *right, size_t size);
+
+    /** Tells the script that the input has been processed, never returns */
+    static void Finish();
+
+  private:
+    static volatile EmulatorTestMailbox &GetMailbox() {
+        return *reinterpret_cast<volatile EmulatorTestMailbox *>(EmulatorTestMailbox::kAddress);
+    }
+
+    static uint32_t s_readFrame;
+    static uint32_t s_writtenFrame;
+    static uint32_t s_blockCount;
+};
+} // namespace bkshepherd
+#endif
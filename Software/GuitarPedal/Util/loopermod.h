@@ -0,0 +1,175 @@
+#pragma once
+#ifndef LOOPERMOD_H
+#define LOOPERMOD_H
+
+#include <stddef.h>
+
+/** @file loopermod.h */
+
+namespace bkshepherd {
+
+/** Multimode audio looper with the interface of daisysp::Looper (Normal, One-time dub, Replace and Frippertronics
+ * modes, variable speed and reverse playback), except that Init doesn't clear the buffer. A loop only ever reads back
+ * what its first recording wrote, so nothing needs clearing, while clearing a multi second SDRAM buffer up front
+ * stalled the main loop for hundreds of ms every time the looper was given its buffers.
+ */
+class LooperMod {
+  public:
+    enum class Mode {
+        NORMAL,         // Overdubs are added to the loop until recording is stopped
+        ONETIME_DUB,    // Overdubs are added to the loop for one pass
+        REPLACE,        // Overdubs replace the loop
+        FRIPPERTRONICS, // Overdubs are added to the loop, which decays on every pass
+    };
+
+    /** Hands the looper its buffer and empties the loop
+     \param buffer The memory to record into, its contents don't matter
+     \param size The number of samples in the buffer, the longest possible loop
+    */
+    void Init(float *buffer, size_t size) {
+        m_buffer = buffer;
+        m_bufferSize = size;
+        m_mode = Mode::NORMAL;
+        m_increment = 1.0f;
+        m_reverse = false;
+        Clear();
+    }
+
+    /** Processes a sample, recording it and playing back the loop
+     \param input The sample to record
+     \return The loop's playback, silent while there is no loop
+    */
+    float Process(float input) {
+        if (m_state == State::Empty) {
+            return 0.0f;
+        }
+
+        if (m_state == State::RecordingFirst) {
+            m_buffer[m_recSize++] = input;
+
+            // The buffer is full, play back what was recorded
+            if (m_recSize >= m_bufferSize) {
+                StartPlaying();
+            }
+
+            return 0.0f;
+        }
+
+        // Read the loop between the two samples around the playback position
+        const size_t index = static_cast<size_t>(m_pos);
+        const size_t nextIndex = index + 1 < m_recSize ? index + 1 : 0;
+        const float fraction = m_pos - static_cast<float>(index);
+        const float sig = m_buffer[index] + (m_buffer[nextIndex] - m_buffer[index]) * fraction;
+
+        if (m_overdubbing) {
+            if (m_mode == Mode::REPLACE) {
+                m_buffer[index] = input;
+            } else if (m_mode == Mode::FRIPPERTRONICS) {
+                m_buffer[index] = sig * kFrippDecay + input;
+            } else {
+                m_buffer[index] = sig + input;
+            }
+        }
+
+        // Move on through the loop and wrap around its ends
+        bool wrapped = false;
+        m_pos += m_reverse ? -m_increment : m_increment;
+
+        if (m_pos >= static_cast<float>(m_recSize)) {
+            m_pos -= static_cast<float>(m_recSize);
+            wrapped = true;
+        } else if (m_pos < 0.0f) {
+            m_pos += static_cast<float>(m_recSize);
+            wrapped = true;
+        }
+
+        if (wrapped && m_mode == Mode::ONETIME_DUB) {
+            m_overdubbing = false;
+        }
+
+        return sig;
+    }
+
+    /** Starts the first recording, ends it and then toggles overdubbing */
+    void TrigRecord() {
+        if (m_state == State::Empty) {
+            m_pos = 0.0f;
+            m_recSize = 0;
+            m_state = State::RecordingFirst;
+        } else if (m_state == State::RecordingFirst) {
+            if (m_recSize > 0) {
+                StartPlaying();
+            } else {
+                m_state = State::Empty;
+            }
+        } else {
+            m_overdubbing = !m_overdubbing;
+        }
+    }
+
+    /** Empties the loop, the buffer is left as it is */
+    void Clear() {
+        m_state = State::Empty;
+        m_pos = 0.0f;
+        m_recSize = 0;
+        m_overdubbing = false;
+    }
+
+    /** Checks if the looper is recording the first take or overdubbing */
+    bool Recording() const { return m_state == State::RecordingFirst || m_overdubbing; }
+
+    /** Gets the playback position in samples */
+    float GetPos() const { return m_pos; }
+
+    /** Gets the length of the loop in samples, 0 while there is no loop */
+    size_t GetRecSize() const { return m_recSize; }
+
+    /** Sets the playback speed, 1.0 is the speed it was recorded at */
+    void SetIncrementSize(float increment) { m_increment = increment; }
+
+    /** Sets the playback direction */
+    void SetReverse(bool reverse) { m_reverse = reverse; }
+
+    /** Sets how overdubs are combined with the loop */
+    void SetMode(Mode mode) { m_mode = mode; }
+
+    /** Gets how overdubs are combined with the loop */
+    Mode GetMode() const { return m_mode; }
+
+  private:
+    enum class State {
+        Empty,          // There is no loop
+        RecordingFirst, // The first take is being recorded, it sets the length of the loop
+        Playing,        // The loop plays back, with or without an overdub
+    };
+
+    static constexpr float kFrippDecay = 0.7f; // Level of the loop on each pass in Frippertronics mode
+    static constexpr size_t kFadeSamples = 96; // Length of the fades at the ends of the first take
+
+    /** Ends the first take, fading its ends so the loop doesn't click where it wraps around */
+    void StartPlaying() {
+        if (m_recSize >= 2 * kFadeSamples) {
+            for (size_t i = 0; i < kFadeSamples; i++) {
+                const float gain = static_cast<float>(i) / static_cast<float>(kFadeSamples);
+                m_buffer[i] *= gain;
+                m_buffer[m_recSize - 1 - i] *= gain;
+            }
+        }
+
+        m_pos = 0.0f;
+        m_overdubbing = false;
+        m_state = State::Playing;
+    }
+
+    float *m_buffer = nullptr;   // The loop, only the first m_recSize samples are ever read
+    size_t m_bufferSize = 0;     // The number of samples in the buffer
+    size_t m_recSize = 0;        // The length of the loop in samples
+    float m_pos = 0.0f;          // The playback position in samples
+    float m_increment = 1.0f;    // Samples the playback position moves per sample
+    bool m_reverse = false;      // Plays the loop backwards
+    bool m_overdubbing = false;  // Records into the loop while it plays
+    State m_state = State::Empty;
+    Mode m_mode = Mode::NORMAL;
+};
+} // namespace bkshepherd
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef MEMORY_PLACEMENT_H
+#define MEMORY_PLACEMENT_H
+
+/** @file memory_placement.h */
+
+// Where things go in memory. The pedal is built as a BOOT_SRAM app, the bootloader copies the program into the 512KB
+// of AXI SRAM and runs it from there, so the memory map is:
+//
+//   DTCMRAM  128KB  .data, .bss and the stack. Zero wait states and never cached, the place for state that is touched
+//                   every sample (filter states, the GRU hidden state, small delay lines, lookup tables, block buffers).
+//   SRAM     512KB  The program. Behind the caches, fine for code and for data that isn't touched every sample.
+//   SDRAM     64MB  Large buffers (delay lines, reverbs, the SDRAM arena). Every cache miss costs tens of cycles, so
+//                   keep anything that is read per sample with poor locality out of it.
+//
+// The ITCM isn't used for hot code: the BOOT_SRAM linker script has no section that gets copied into it at startup,
+// and the program already runs from SRAM through the instruction cache. DSP_HOT_TEXT only groups hot code together.
+//
+// Run ci/check_memory.py on the linker map after a build to check the use of each region against its budget.
+
+#if defined(__arm__)
+/** Places per sample state in DTCMRAM. The section is not cleared at startup, so only use it for objects that are
+ * fully set up by their constructor or written before they are read (ex. block buffers), never for plain zero
+ * initialized variables.
+ */
+#define DSP_HOT_BSS __attribute__((section(".dtcmram_bss")))
+
+/** Marks a function that runs every sample or block, the compiler optimizes it harder and places it with the other
+ * hot code
+ */
+#define DSP_HOT_TEXT __attribute__((hot))
+
+/** Places data that isn't touched every sample in SRAM, to save DTCMRAM. It is loaded with the program, so it starts
+ * out zeroed like .bss.
+ */
+#define DSP_SRAM_DATA __attribute__((section(".text")))
+
+/** Places large buffers in SDRAM. The section is not cleared at startup. */
+#define DSP_SDRAM_BSS __attribute__((section(".sdram_bss")))
+#else
+// The host build (host/Makefile) has a single flat memory, everything stays where the compiler puts it
+#define DSP_HOT_BSS
+#define DSP_HOT_TEXT
+#define DSP_SRAM_DATA
+#define DSP_SDRAM_BSS
+#endif
+
+namespace bkshepherd {
+
+/** The memory region an effect module instance is placed in, see kMemoryRegion in BaseEffectModule */
+enum class MemoryRegion {
+    Dtcm,  // Per sample state kept in the object itself, the default
+    Sram,  // Modules that aren't audio rate (ex. a display), or that only hold pointers to their buffers
+    Sdram, // Modules with large buffers in the object itself
+};
+} // namespace bkshepherd
+#endif
@@ -0,0 +1,76 @@
+#include "overrun_governor.h"
+#include <stdint.h>
+
+using namespace bkshepherd;
+
+namespace {
+// Try a better tier again after 5 seconds of headroom, backing off up to a minute if it keeps overrunning
+constexpr uint32_t restoreDelaySecondsMin = 5;
+constexpr uint32_t restoreDelaySecondsMax = 60;
+} // namespace
+
+OverrunGovernor::OverrunGovernor()
+    : m_overrunThresholdTicks(0), m_headroomThresholdTicks(0), m_blocksPerSecond(1000), m_overrunHistory(0), m_holdOffBlocks(0),
+      m_headroomBlocks(0), m_restoreDelayBlocks(0), m_blocksSinceRestore(UINT32_MAX), m_overrunCount(0),
+      m_degradeCount(0) {}
+
+void OverrunGovernor::Init(uint32_t budgetTicks, uint32_t blocksPerSecond) {
+    // Leave a little margin under the deadline for the work done outside the measured section of the callback
+    m_overrunThresholdTicks = budgetTicks - budgetTicks / 20;
+    m_headroomThresholdTicks = budgetTicks - budgetTicks / 2;
+    m_blocksPerSecond = blocksPerSecond;
+    m_restoreDelayBlocks = restoreDelaySecondsMin * m_blocksPerSecond;
+    Restart();
+}
+
+void OverrunGovernor::Restart() {
+    m_overrunHistory = 0;
+    m_headroomBlocks = 0;
+    m_holdOffBlocks = m_blocksPerSecond / 4;
+}
+
+int OverrunGovernor::Update(uint32_t blockTicks, int qualityLevel, int qualityLevelCount) {
+    const bool overran = blockTicks > m_overrunThresholdTicks;
+
+    m_overrunHistory = (m_overrunHistory << 1) | (overran ? 1U : 0U);
+
+    if (m_blocksSinceRestore < UINT32_MAX) {
+        m_blocksSinceRestore++;
+    }
+
+    if (overran) {
+        m_overrunCount++;
+        m_headroomBlocks = 0;
+    } else if (blockTicks < m_headroomThresholdTicks) {
+        m_headroomBlocks++;
+    } else {
+        m_headroomBlocks = 0;
+    }
+
+    // Give the effect time to settle after a change before judging it again
+    if (m_holdOffBlocks > 0) {
+        m_holdOffBlocks--;
+        return 0;
+    }
+
+    // Only decide on changes the effect can make, a restore that can't happen must not count as a failed one later
+    if (__builtin_popcount(m_overrunHistory) >= kSustainedOverruns && qualityLevel + 1 < qualityLevelCount) {
+        m_degradeCount++;
+
+        // A drop soon after trying a better tier means that tier doesn't fit, wait longer before trying it again
+        if (m_blocksSinceRestore < 2 * m_blocksPerSecond && m_restoreDelayBlocks < restoreDelaySecondsMax * m_blocksPerSecond) {
+            m_restoreDelayBlocks *= 2;
+        }
+
+        Restart();
+        return 1;
+    }
+
+    if (m_headroomBlocks >= m_restoreDelayBlocks && qualityLevel > 0) {
+        m_blocksSinceRestore = 0;
+        Restart();
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef OVERRUN_GOVERNOR_H
+#define OVERRUN_GOVERNOR_H
+
+#include <stdint.h>
+
+/** @file overrun_governor.h */
+
+namespace bkshepherd {
+
+/** Watches how long each audio block takes against the block deadline and decides when the effect being processed
+ * should drop to a cheaper quality tier (sustained overruns) or try its next better tier again (sustained headroom).
+ * The governor only decides, the caller applies the change with BaseEffectModule::SetQualityLevel.
+ */
+class OverrunGovernor {
+  public:
+    OverrunGovernor();
+    ~OverrunGovernor() {}
+
+    /** Initializes the governor
+     \param budgetTicks the time available to process one audio block, in the same ticks passed to Update
+     \param blocksPerSecond the number of audio blocks processed per second, used for the hold off times
+    */
+    void Init(uint32_t budgetTicks, uint32_t blocksPerSecond);
+
+    /** Records the time taken by one audio block, call once per block from the audio callback
+     \param blockTicks the time the audio block took to process
+     \param qualityLevel the quality level the effect is at, 0 is the best
+     \param qualityLevelCount the number of quality levels the effect has
+     \return 1 to drop one quality level, -1 to try one better quality level again, 0 to leave the quality as is.
+     Only changes that keep the level within 0 and qualityLevelCount - 1 are returned.
+    */
+    int Update(uint32_t blockTicks, int qualityLevel, int qualityLevelCount);
+
+    /** Starts the decision making over, ex. when the effect being processed changes. The counters are kept. */
+    void Restart();
+
+    /** Gets the total number of blocks that overran the deadline */
+    uint32_t GetOverrunCount() const { return m_overrunCount; }
+
+    /** Gets the total number of times a quality drop was requested */
+    uint32_t GetDegradeCount() const { return m_degradeCount; }
+
+  private:
+    static constexpr int kSustainedOverruns = 4; // Overruns within the last 32 blocks that trigger a quality drop
+
+    uint32_t m_overrunThresholdTicks;  // Blocks longer than this count as an overrun
+    uint32_t m_headroomThresholdTicks; // Blocks shorter than this count as having headroom for a better tier
+    uint32_t m_blocksPerSecond;
+    uint32_t m_overrunHistory;         // One bit per block for the last 32 blocks, set if the block overran
+    uint32_t m_holdOffBlocks;          // Blocks left before another decision is made
+    uint32_t m_headroomBlocks;         // Consecutive blocks with headroom
+    uint32_t m_restoreDelayBlocks;     // Consecutive blocks with headroom needed to try a better tier again
+    uint32_t m_blocksSinceRestore;     // Blocks since a better tier was last tried
+    uint32_t m_overrunCount;
+    uint32_t m_degradeCount;
+};
+} // namespace bkshepherd
+#endif
@@ -0,0 +1,141 @@
+#include "preset_directory.h"
+#include <string.h>
+
+using namespace bkshepherd;
+
+void PresetDirectory::Clear() {
+    m_entries.clear();
+    m_effects.clear();
+    m_values.clear();
+    m_freeBlocks.clear();
+}
+
+int PresetDirectory::AddEffect(int paramCount) {
+    m_effects.push_back({paramCount, {}});
+    return static_cast<int>(m_effects.size()) - 1;
+}
+
+int PresetDirectory::AddPreset(int effectID) {
+    if (effectID < 0 || effectID >= GetEffectCount()) {
+        return -1;
+    }
+
+    Effect &effect = m_effects[effectID];
+    const uint32_t length = effect.paramCount;
+    const uint32_t offset = Allocate(length);
+    const int presetID = static_cast<int>(effect.entries.size());
+
+    memset(m_values.data() + offset, 0, length * sizeof(uint32_t));
+
+    effect.entries.push_back(static_cast<uint16_t>(m_entries.size()));
+    m_entries.push_back({static_cast<uint16_t>(effectID), static_cast<uint16_t>(presetID), offset, length});
+
+    return presetID;
+}
+
+void PresetDirectory::SetParameterCount(int effectID, int paramCount) {
+    if (effectID < 0 || effectID >= GetEffectCount() || m_effects[effectID].paramCount == paramCount) {
+        return;
+    }
+
+    Effect &effect = m_effects[effectID];
+    const uint32_t length = paramCount;
+
+    for (uint16_t entryIndex : effect.entries) {
+        const uint32_t offset = Allocate(length);
+        Entry &entry = m_entries[entryIndex];
+        const uint32_t keptLength = entry.length < length ? entry.length : length;
+
+        memcpy(m_values.data() + offset, m_values.data() + entry.offset, keptLength * sizeof(uint32_t));
+        memset(m_values.data() + offset + keptLength, 0, (length - keptLength) * sizeof(uint32_t));
+
+        Free(entry.offset, entry.length);
+        entry.offset = offset;
+        entry.length = length;
+    }
+
+    effect.paramCount = paramCount;
+}
+
+uint32_t *PresetDirectory::GetValues(int effectID, int presetID) {
+    return const_cast<uint32_t *>(static_cast<const PresetDirectory *>(this)->GetValues(effectID, presetID));
+}
+
+const uint32_t *PresetDirectory::GetValues(int effectID, int presetID) const {
+    if (presetID < 0 || presetID >= GetPresetCount(effectID)) {
+        return nullptr;
+    }
+
+    return m_values.data() + m_entries[m_effects[effectID].entries[presetID]].offset;
+}
+
+int PresetDirectory::GetPresetCount(int effectID) const {
+    if (effectID < 0 || effectID >= GetEffectCount()) {
+        return 0;
+    }
+
+    return static_cast<int>(m_effects[effectID].entries.size());
+}
+
+int PresetDirectory::GetParameterCount(int effectID) const {
+    if (effectID < 0 || effectID >= GetEffectCount()) {
+        return 0;
+    }
+
+    return m_effects[effectID].paramCount;
+}
+
+uint32_t PresetDirectory::Allocate(uint32_t length) {
+    for (size_t i = 0; i < m_freeBlocks.size(); i++) {
+        FreeBlock &block = m_freeBlocks[i];
+
+        if (block.length < length) {
+            continue;
+        }
+
+        const uint32_t offset = block.offset;
+        block.offset += length;
+        block.length -= length;
+
+        if (block.length == 0) {
+            m_freeBlocks.erase(m_freeBlocks.begin() + i);
+        }
+
+        return offset;
+    }
+
+    const uint32_t offset = static_cast<uint32_t>(m_values.size());
+    m_values.resize(m_values.size() + length);
+    return offset;
+}
+
+void PresetDirectory::Free(uint32_t offset, uint32_t length) {
+    if (length == 0) {
+        return;
+    }
+
+    size_t i = 0;
+    while (i < m_freeBlocks.size() && m_freeBlocks[i].offset < offset) {
+        i++;
+    }
+
+    m_freeBlocks.insert(m_freeBlocks.begin() + i, {offset, length});
+
+    // Merge with the free neighbours
+    if (i + 1 < m_freeBlocks.size() && m_freeBlocks[i].offset + m_freeBlocks[i].length == m_freeBlocks[i + 1].offset) {
+        m_freeBlocks[i].length += m_freeBlocks[i + 1].length;
+        m_freeBlocks.erase(m_freeBlocks.begin() + i + 1);
+    }
+
+    if (i > 0 && m_freeBlocks[i - 1].offset + m_freeBlocks[i - 1].length == m_freeBlocks[i].offset) {
+        m_freeBlocks[i - 1].length += m_freeBlocks[i].length;
+        m_freeBlocks.erase(m_freeBlocks.begin() + i);
+        i--;
+    }
+
+    // A free block at the end of the pool goes back to the pool
+    if (m_freeBlocks[i].offset + m_freeBlocks[i].length == m_values.size()) {
+        m_values.resize(m_freeBlocks[i].offset);
+        m_freeBlocks.erase(m_freeBlocks.begin() + i);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef PRESET_DIRECTORY_H
+#define PRESET_DIRECTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/** @file preset_directory.h */
+
+namespace bkshepherd {
+
+/** Stores the parameter values of the presets of every effect.
+ *
+ * The values of all presets share one pool of words. A directory entry per preset records where its values are in
+ * the pool, and each effect keeps the index of the entry of each of its presets, so finding the values of a preset is
+ * two table lookups. Adding a preset takes a block from the free list (or the end of the pool) instead of moving the
+ * presets after it, blocks that are given back are merged with their free neighbours.
+ */
+class PresetDirectory {
+  public:
+    struct Entry {
+        uint16_t effectID;
+        uint16_t presetID;
+        uint32_t offset; // Index of the first value of the preset in the pool
+        uint32_t length; // Number of values, the parameter count of the effect
+    };
+
+    /** Removes every effect and preset */
+    void Clear();
+
+    /** Adds an effect without any presets
+     \param paramCount the number of parameter values of each of its presets
+     \return the ID of the effect, effects are numbered in the order they are added
+    */
+    int AddEffect(int paramCount);
+
+    /** Adds a preset after the last one of an effect, its values start out as zero
+     \param effectID the effect to add the preset to
+     \return the ID of the preset, -1 if there is no such effect
+    */
+    int AddPreset(int effectID);
+
+    /** Changes the number of parameter values of every preset of an effect. Each preset moves to a block of the new
+     * size, the values that are kept are copied and new ones start out as zero.
+     \param effectID the effect to change
+     \param paramCount the new number of parameter values
+    */
+    void SetParameterCount(int effectID, int paramCount);
+
+    /** Gets the values of a preset. They move when a preset is added, so don't hold on to them across AddPreset.
+     \param effectID the effect the preset belongs to
+     \param presetID the preset
+     \return the parameter values of the preset, nullptr if there is no such preset
+    */
+    uint32_t *GetValues(int effectID, int presetID);
+    const uint32_t *GetValues(int effectID, int presetID) const;
+
+    int GetEffectCount() const { return static_cast<int>(m_effects.size()); }
+
+    /** Gets the number of presets of an effect, 0 if there is no such effect */
+    int GetPresetCount(int effectID) const;
+
+    /** Gets the number of parameter values of each preset of an effect, 0 if there is no such effect */
+    int GetParameterCount(int effectID) const;
+
+    int GetEntryCount() const { return static_cast<int>(m_entries.size()); }
+    const Entry &GetEntry(int index) const { return m_entries[index]; }
+
+  private:
+    struct Effect {
+        int paramCount;
+        std::vector<uint16_t> entries; // Index of the directory entry of each preset
+    };
+
+    struct FreeBlock {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    /** Takes a block of the pool, first fit from the free list or else from the end of the pool
+     \return the offset of the block
+    */
+    uint32_t Allocate(uint32_t length);
+
+    /** Gives a block back to the free list, merging it with its free neighbours */
+    void Free(uint32_t offset, uint32_t length);
+
+    std::vector<Entry> m_entries;
+    std::vector<Effect> m_effects;
+    std::vector<uint32_t> m_values;
+    std::vector<FreeBlock> m_freeBlocks; // Sorted by offset
+};
+} // namespace bkshepherd
+#endif
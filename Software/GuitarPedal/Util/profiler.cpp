@@ -0,0 +1,144 @@
+#include "profiler.h"
+#include <stdio.h>
+
+using namespace bkshepherd;
+
+ProfilerStage *Profiler::s_firstStage = nullptr;
+uint32_t Profiler::s_blockBudgetTicks = 0;
+volatile bool Profiler::s_resetRequested = false;
+
+ProfilerStage::ProfilerStage(const char *name) : m_name(name), m_startTicks(0), m_next(nullptr) {
+    Reset();
+    Profiler::Register(this);
+}
+
+ProfilerStage::~ProfilerStage() { Profiler::Unregister(this); }
+
+void ProfilerStage::CommitBlock() {
+    // Stages that didn't run this block (ex. an effect that isn't active) don't record anything
+    if (!m_blockActive) {
+        return;
+    }
+
+    const uint32_t ticks = m_blockTicks;
+    m_blockTicks = 0;
+    m_blockActive = false;
+
+    m_lastTicks = ticks;
+    m_totalTicks += ticks;
+    m_blockCount++;
+
+    if (ticks < m_minTicks) {
+        m_minTicks = ticks;
+    }
+
+    if (ticks > m_maxTicks) {
+        m_maxTicks = ticks;
+    }
+
+    // Bins are 12.5% of the block budget wide, the last bin collects anything that overran the budget
+    int bin = kHistogramBins - 1;
+    const uint32_t budget = Profiler::GetBlockBudgetTicks();
+
+    if (budget > 0 && ticks < budget) {
+        bin = static_cast<int>((static_cast<uint64_t>(ticks) * (kHistogramBins - 1)) / budget);
+    }
+
+    m_histogram[bin]++;
+}
+
+void ProfilerStage::Reset() {
+    m_blockTicks = 0;
+    m_blockActive = false;
+    m_lastTicks = 0;
+    m_minTicks = UINT32_MAX;
+    m_maxTicks = 0;
+    m_totalTicks = 0;
+    m_blockCount = 0;
+
+    for (int i = 0; i < kHistogramBins; i++) {
+        m_histogram[i] = 0;
+    }
+}
+
+void Profiler::Init(float sample_rate, size_t blockSize) {
+#if defined(__arm__)
+    // Enable the DWT cycle counter, the lock access register has to be unlocked on the Cortex-M7
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    s_blockBudgetTicks = static_cast<uint32_t>((static_cast<float>(GetTicksPerSecond()) * blockSize) / sample_rate);
+}
+
+uint32_t Profiler::GetTicksPerSecond() {
+#if defined(__arm__)
+    return SystemCoreClock;
+#else
+    return 1000000000;
+#endif
+}
+
+void Profiler::EndBlock() {
+    const bool reset = s_resetRequested;
+
+    for (ProfilerStage *stage = s_firstStage; stage != nullptr; stage = stage->m_next) {
+        if (reset) {
+            stage->Reset();
+        } else {
+            stage->CommitBlock();
+        }
+    }
+
+    if (reset) {
+        s_resetRequested = false;
+    }
+}
+
+uint32_t Profiler::TicksToBudgetPermille(uint32_t ticks) {
+    if (s_blockBudgetTicks == 0) {
+        return 0;
+    }
+
+    return static_cast<uint32_t>((static_cast<uint64_t>(ticks) * 1000) / s_blockBudgetTicks);
+}
+
+void Profiler::FormatStageSummary(const ProfilerStage &stage, char *buffer, size_t size) {
+    const uint32_t avg = TicksToBudgetPermille(stage.GetAvgTicks());
+    const uint32_t max = TicksToBudgetPermille(stage.GetMaxTicks());
+
+    snprintf(buffer, size, "%-8.8s%3lu.%lu %3lu.%lu", stage.GetName(), (unsigned long)(avg / 10), (unsigned long)(avg % 10),
+             (unsigned long)(max / 10), (unsigned long)(max % 10));
+}
+
+void Profiler::FormatStageDetail(const ProfilerStage &stage, char *buffer, size_t size) {
+    int length = snprintf(buffer, size, "%s: min %lu avg %lu max %lu ticks (%lu blocks) hist", stage.GetName(),
+                          (unsigned long)stage.GetMinTicks(), (unsigned long)stage.GetAvgTicks(), (unsigned long)stage.GetMaxTicks(),
+                          (unsigned long)stage.GetBlockCount());
+
+    for (int i = 0; i < ProfilerStage::kHistogramBins && length > 0 && static_cast<size_t>(length) < size; i++) {
+        length += snprintf(buffer + length, size - length, " %lu", (unsigned long)stage.GetHistogramBin(i));
+    }
+}
+
+void Profiler::Register(ProfilerStage *stage) {
+    // Stages are registered during startup before the audio callback is running, append to keep declaration order
+    ProfilerStage **link = &s_firstStage;
+
+    while (*link != nullptr) {
+        link = &(*link)->m_next;
+    }
+
+    *link = stage;
+}
+
+void Profiler::Unregister(ProfilerStage *stage) {
+    for (ProfilerStage **link = &s_firstStage; *link != nullptr; link = &(*link)->m_next) {
+        if (*link == stage) {
+            *link = stage->m_next;
+            return;
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#pragma once
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file profiler.h */
+
+namespace bkshepherd {
+
+/** A named section of the audio processing whose cost is tracked per audio block.
+ * Stages register themselves with the Profiler when constructed, so they can simply be declared as a static or a member
+ * of the effect that owns them. Begin / End may be called any number of times per block (ex. once per sample), the
+ * time spent is accumulated and recorded as one value when the Profiler ends the block.
+ */
+class ProfilerStage {
+  public:
+    static constexpr int kHistogramBins = 9; // 8 bins of 12.5% of the block budget plus one bin for overruns
+
+    /** Creates the stage and registers it with the Profiler
+     \param name The name shown on the debug display and serial log, keep it short (10 characters or less)
+    */
+    explicit ProfilerStage(const char *name);
+    ~ProfilerStage();
+
+    /** Marks the start of the section being measured */
+    inline void Begin();
+
+    /** Marks the end of the section being measured, adding the elapsed time to this block's total */
+    inline void End();
+
+    /** Records the time accumulated this block and starts the next block, called by Profiler::EndBlock */
+    void CommitBlock();
+
+    /** Clears the recorded statistics */
+    void Reset();
+
+    const char *GetName() const { return m_name; }
+    uint32_t GetMinTicks() const { return m_blockCount > 0 ? m_minTicks : 0; }
+    uint32_t GetMaxTicks() const { return m_maxTicks; }
+    uint32_t GetLastTicks() const { return m_lastTicks; }
+    uint32_t GetBlockTicks() const { return m_blockTicks; } // Time accumulated so far in the current block
+    uint32_t GetAvgTicks() const { return m_blockCount > 0 ? static_cast<uint32_t>(m_totalTicks / m_blockCount) : 0; }
+    uint32_t GetBlockCount() const { return m_blockCount; }
+    uint32_t GetHistogramBin(int bin) const { return m_histogram[bin]; }
+
+    ProfilerStage *GetNext() const { return m_next; }
+
+  private:
+    friend class Profiler;
+
+    const char *m_name;
+    uint32_t m_startTicks;
+    uint32_t m_blockTicks; // Time accumulated since the last CommitBlock
+    bool m_blockActive;    // True if the stage ran during the current block
+    uint32_t m_lastTicks;
+    uint32_t m_minTicks;
+    uint32_t m_maxTicks;
+    uint64_t m_totalTicks;
+    uint32_t m_blockCount;
+    uint32_t m_histogram[kHistogramBins];
+    ProfilerStage *m_next;
+};
+
+/** Measures the cost of ProfilerStages in ticks of a free running counter.
+ * On the Daisy this is the Cortex-M7 DWT cycle counter (one tick per CPU cycle), on the host it is std::chrono
+ * (one tick per nanosecond). Statistics are written from the audio callback and read from the main loop, reads are
+ * not synchronized so a value may be one block stale, which is fine for a debug readout.
+ */
+class Profiler {
+  public:
+    /** Starts the tick counter and sets the time budget used for the histogram and percentages
+     \param sample_rate The sample rate of the audio engine
+     \param blockSize The number of samples per audio block
+    */
+    static void Init(float sample_rate, size_t blockSize);
+
+    /** Gets the current value of the tick counter */
+    static inline uint32_t Now();
+
+    /** Gets the number of ticks per second of the tick counter */
+    static uint32_t GetTicksPerSecond();
+
+    /** Gets the number of ticks available to process one audio block in real time */
+    static uint32_t GetBlockBudgetTicks() { return s_blockBudgetTicks; }
+
+    /** Records all stages for the block that just finished, call once at the end of every audio callback */
+    static void EndBlock();
+
+    /** Requests that all stages clear their statistics, applied by the next EndBlock */
+    static void RequestReset() { s_resetRequested = true; }
+
+    /** Gets the first registered stage, use ProfilerStage::GetNext to walk the rest */
+    static ProfilerStage *GetFirstStage() { return s_firstStage; }
+
+    /** Converts ticks to tenths of a percent of the block budget, ex. 125 is 12.5% */
+    static uint32_t TicksToBudgetPermille(uint32_t ticks);
+
+    /** Formats a one line summary of a stage: name, average and max as a percentage of the block budget
+     \param stage The stage to format
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    static void FormatStageSummary(const ProfilerStage &stage, char *buffer, size_t size);
+
+    /** Formats the full statistics for a stage, including the histogram, for the serial log
+     \param stage The stage to format
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    static void FormatStageDetail(const ProfilerStage &stage, char *buffer, size_t size);
+
+  private:
+    friend class ProfilerStage;
+
+    static void Register(ProfilerStage *stage);
+    static void Unregister(ProfilerStage *stage);
+
+    static ProfilerStage *s_firstStage;
+    static uint32_t s_blockBudgetTicks;
+    static volatile bool s_resetRequested;
+};
+
+/** Measures a ProfilerStage for the lifetime of the scope */
+class ProfileScope {
+  public:
+    explicit ProfileScope(ProfilerStage &stage) : m_stage(stage) { m_stage.Begin(); }
+    ~ProfileScope() { m_stage.End(); }
+
+  private:
+    ProfilerStage &m_stage;
+};
+} // namespace bkshepherd
+
+#if defined(__arm__)
+#include "daisy_seed.h"
+
+inline uint32_t bkshepherd::Profiler::Now() { return DWT->CYCCNT; }
+#else
+#include <chrono>
+
+inline uint32_t bkshepherd::Profiler::Now() {
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#endif
+
+inline void bkshepherd::ProfilerStage::Begin() { m_startTicks = Profiler::Now(); }
+
+inline void bkshepherd::ProfilerStage::End() {
+    // Unsigned subtraction handles the counter wrapping around
+    m_blockTicks += Profiler::Now() - m_startTicks;
+    m_blockActive = true;
+}
+
+#endif
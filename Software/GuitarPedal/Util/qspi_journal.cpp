@@ -0,0 +1,331 @@
+#include "qspi_journal.h"
+#include "rt_safety.h"
+#include <stddef.h>
+#include <string.h>
+
+using namespace bkshepherd;
+
+QspiJournal::QspiJournal(daisy::QSPIHandle &qspi)
+    : m_qspi(qspi), m_address(0), m_bankSize(0), m_tag(0), m_activeBank(-1), m_generation(0), m_writeOffset(0), m_erasedEnd(0),
+      m_needsCompaction(true), m_flushRequested(false), m_appendBuffer(m_staging), m_appendCapacity(kStagingSize), m_stagedBytes(0),
+      m_state(State::Idle), m_programBuffer(nullptr), m_programBank(0), m_programStart(0), m_programSize(0), m_programDone(0),
+      m_programErasedEnd(0), m_completionCallback(nullptr), m_completionContext(nullptr) {}
+
+void QspiJournal::Init(uint32_t address, uint32_t bankSize, uint32_t tag, uint8_t *programBuffer) {
+    m_address = address;
+    m_bankSize = bankSize;
+    m_tag = tag;
+    m_programBuffer = programBuffer;
+    m_stagedBytes = 0;
+    m_flushRequested = false;
+    m_state = State::Idle;
+
+    const uint32_t generation0 = ReadBankGeneration(0);
+    const uint32_t generation1 = ReadBankGeneration(1);
+
+    if (generation0 == 0 && generation1 == 0) {
+        // Nothing to append to until the first compaction writes a bank
+        m_activeBank = -1;
+        m_generation = 0;
+        m_writeOffset = m_bankSize;
+        m_erasedEnd = m_bankSize;
+        m_needsCompaction = true;
+        return;
+    }
+
+    m_activeBank = generation1 > generation0 ? 1 : 0;
+    m_generation = generation1 > generation0 ? generation1 : generation0;
+    m_needsCompaction = false;
+    m_writeOffset = ScanRecords(nullptr, nullptr, nullptr);
+
+    // The sector the records end in was erased when they reached it, the ones after it may still hold an older generation
+    m_erasedEnd = (m_writeOffset + kSectorSize - 1) & ~(kSectorSize - 1);
+}
+
+void QspiJournal::SetCompletionCallback(CompletionCallback callback, void *context) {
+    m_completionCallback = callback;
+    m_completionContext = context;
+}
+
+int QspiJournal::Replay(RecordCallback callback, void *context) {
+    int recordCount = 0;
+
+    if (m_activeBank >= 0) {
+        ScanRecords(callback, context, &recordCount);
+    }
+
+    return recordCount;
+}
+
+bool QspiJournal::Append(uint16_t type, const void *payload, uint16_t size) {
+    if (type == kErasedType || size > kMaxPayloadSize) {
+        return false;
+    }
+
+    const uint32_t recordSize = GetRecordSize(size);
+
+    if (m_stagedBytes + recordSize > m_appendCapacity) {
+        m_needsCompaction = true;
+        return false;
+    }
+
+    // The CRC is filled in by SealRecords once the bank the record goes to is known
+    const RecordHeader header = {type, size, 0};
+
+    uint8_t *record = m_appendBuffer + m_stagedBytes;
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + sizeof(header), payload, size);
+    memset(record + sizeof(header) + size, 0, recordSize - sizeof(header) - size);
+    m_stagedBytes += recordSize;
+
+    return true;
+}
+
+bool QspiJournal::Flush() {
+    m_flushRequested = true;
+
+    if (!IsBusy()) {
+        StartFlush();
+    }
+
+    return !m_needsCompaction;
+}
+
+bool QspiJournal::Compact(SnapshotCallback callback, void *context) {
+    if (IsBusy() || m_programBuffer == nullptr) {
+        return false;
+    }
+
+    // Append the snapshot straight into the program buffer
+    m_stagedBytes = 0;
+    m_flushRequested = false;
+    m_appendBuffer = m_programBuffer;
+    m_appendCapacity = GetBankCapacity();
+
+    const bool success = callback(*this, context);
+    m_programSize = m_stagedBytes;
+
+    m_appendBuffer = m_staging;
+    m_appendCapacity = kStagingSize;
+    m_stagedBytes = 0;
+
+    if (!success) {
+        return false;
+    }
+
+    m_programBank = m_activeBank == 0 ? 1 : 0;
+    m_programStart = sizeof(BankHeader);
+    m_programDone = 0;
+    m_programErasedEnd = 0;
+    SealRecords(m_programBuffer, m_programSize, m_generation + 1);
+    m_state = State::Compacting;
+
+    // Anything lost from here on is not in the snapshot and needs another compaction
+    m_needsCompaction = false;
+
+    return true;
+}
+
+void QspiJournal::Process(bool canErase) {
+    // Programming a page or erasing a sector stalls the QSPI bus for up to tens of milliseconds
+    RT_SAFETY_BLOCKING("QspiJournal::Process");
+
+    if (m_state == State::Idle) {
+        // Keep a sector of erased room after the records, so the next flush seldom has to wait for an erase
+        if (canErase && m_activeBank >= 0 && m_erasedEnd < m_bankSize && m_erasedEnd - m_writeOffset < kSectorSize) {
+            if (EraseSector(m_activeBank, m_erasedEnd)) {
+                m_erasedEnd += kSectorSize;
+            } else {
+                // Leave the sector behind, the next save moves the journal to the other bank
+                m_writeOffset = m_bankSize;
+                m_needsCompaction = true;
+            }
+        }
+        return;
+    }
+
+    const uint32_t offset = m_programStart + m_programDone;
+    bool success = true;
+
+    if ((m_programDone < m_programSize && offset >= m_programErasedEnd) || m_programErasedEnd == 0) {
+        // Erase the sector before programming into it, the header of a compaction goes into the first one
+        if (canErase) {
+            success = EraseSector(m_programBank, m_programErasedEnd);
+            m_programErasedEnd += kSectorSize;
+        }
+    } else if (m_programDone < m_programSize) {
+        // Program up to the end of the flash page
+        uint32_t size = kPageSize - offset % kPageSize;
+        size = size < m_programSize - m_programDone ? size : m_programSize - m_programDone;
+        size = size < m_programErasedEnd - offset ? size : m_programErasedEnd - offset;
+
+        success = m_qspi.Write(GetBankAddress(m_programBank) + offset, size, m_programBuffer + m_programDone) ==
+                  daisy::QSPIHandle::Result::OK;
+        m_programDone += size;
+    } else if (m_state == State::Flushing) {
+        m_writeOffset = offset;
+        m_erasedEnd = m_programErasedEnd;
+        FinishOperation();
+        return;
+    } else {
+        // The header goes in last, until then the previous bank is still the newest valid one
+        BankHeader header = {kBankMagic, m_generation + 1, m_tag, 0};
+        header.crc = Crc32(0xffffffff, &header, offsetof(BankHeader, crc)) ^ 0xffffffff;
+        success = m_qspi.Write(GetBankAddress(m_programBank), sizeof(header), reinterpret_cast<uint8_t *>(&header)) ==
+                  daisy::QSPIHandle::Result::OK;
+
+        if (success) {
+            m_activeBank = m_programBank;
+            m_generation++;
+            m_writeOffset = offset;
+            m_erasedEnd = m_programErasedEnd;
+            FinishOperation();
+            return;
+        }
+    }
+
+    if (!success) {
+        // A failed flush may have programmed part of the records, never append after it. A failed compaction leaves
+        // the previous bank active.
+        if (m_state == State::Flushing) {
+            m_writeOffset = m_bankSize;
+        }
+
+        m_needsCompaction = true;
+        FinishOperation();
+    }
+}
+
+uint32_t QspiJournal::Crc32(uint32_t crc, const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+
+    for (size_t i = 0; i < size; i++) {
+        crc ^= bytes[i];
+
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & (0U - (crc & 1U)));
+        }
+    }
+
+    return crc;
+}
+
+uint32_t QspiJournal::GetRecordCrc(uint32_t generation, const RecordHeader &header, const void *payload) {
+    uint32_t crc = Crc32(0xffffffff, &generation, sizeof(generation));
+    crc = Crc32(crc, &header, offsetof(RecordHeader, crc));
+    return Crc32(crc, payload, header.size) ^ 0xffffffff;
+}
+
+void QspiJournal::SealRecords(uint8_t *records, size_t size, uint32_t generation) {
+    size_t offset = 0;
+
+    while (offset < size) {
+        RecordHeader header;
+        memcpy(&header, records + offset, sizeof(header));
+
+        header.crc = GetRecordCrc(generation, header, records + offset + sizeof(header));
+        memcpy(records + offset, &header, sizeof(header));
+
+        offset += GetRecordSize(header.size);
+    }
+}
+
+const uint8_t *QspiJournal::GetBankData(int bank) const { return static_cast<const uint8_t *>(m_qspi.GetData(GetBankAddress(bank))); }
+
+uint32_t QspiJournal::ReadBankGeneration(int bank) const {
+    BankHeader header;
+    memcpy(&header, GetBankData(bank), sizeof(header));
+
+    if (header.magic != kBankMagic || header.tag != m_tag || header.generation == 0 ||
+        header.crc != (Crc32(0xffffffff, &header, offsetof(BankHeader, crc)) ^ 0xffffffff)) {
+        return 0;
+    }
+
+    return header.generation;
+}
+
+uint32_t QspiJournal::ScanRecords(RecordCallback callback, void *context, int *recordCount) {
+    const uint8_t *bank = GetBankData(m_activeBank);
+    uint32_t offset = sizeof(BankHeader);
+
+    while (offset + sizeof(RecordHeader) <= m_bankSize) {
+        RecordHeader header;
+        memcpy(&header, bank + offset, sizeof(header));
+
+        if (header.type == kErasedType) {
+            return offset;
+        }
+
+        const uint8_t *payload = bank + offset + sizeof(header);
+        const uint32_t recordSize = GetRecordSize(header.size);
+
+        if (header.size > kMaxPayloadSize || offset + recordSize > m_bankSize ||
+            header.crc != GetRecordCrc(m_generation, header, payload)) {
+            // A sector that hasn't been erased for this generation yet, the records end at its start
+            if (offset % kSectorSize == 0) {
+                return offset;
+            }
+
+            // A torn or damaged record, nothing can be appended after it so the next save writes a fresh bank
+            m_needsCompaction = true;
+            return m_bankSize;
+        }
+
+        if (callback != nullptr) {
+            callback(header.type, payload, header.size, context);
+            ++*recordCount;
+        }
+
+        offset += recordSize;
+    }
+
+    return offset;
+}
+
+bool QspiJournal::EraseSector(int bank, uint32_t offset) {
+    const uint32_t address = GetBankAddress(bank) + offset;
+    return m_qspi.Erase(address, address + kSectorSize) == daisy::QSPIHandle::Result::OK;
+}
+
+void QspiJournal::StartFlush() {
+    m_flushRequested = false;
+
+    if (m_stagedBytes == 0) {
+        FinishOperation();
+        return;
+    }
+
+    if (m_activeBank < 0 || m_writeOffset + m_stagedBytes > m_bankSize || m_programBuffer == nullptr) {
+        m_stagedBytes = 0;
+        m_needsCompaction = true;
+        FinishOperation();
+        return;
+    }
+
+    memcpy(m_programBuffer, m_staging, m_stagedBytes);
+    SealRecords(m_programBuffer, m_stagedBytes, m_generation);
+
+    m_programBank = m_activeBank;
+    m_programStart = m_writeOffset;
+    m_programSize = m_stagedBytes;
+    m_programDone = 0;
+    m_programErasedEnd = m_erasedEnd;
+    m_stagedBytes = 0;
+    m_state = State::Flushing;
+}
+
+void QspiJournal::FinishOperation() {
+    m_state = State::Idle;
+
+    // Records staged and flushed while this operation was being written go next
+    if (m_flushRequested && m_stagedBytes > 0) {
+        StartFlush();
+        return;
+    }
+
+    m_flushRequested = false;
+
+    if (m_completionCallback != nullptr) {
+        m_completionCallback(!m_needsCompaction, m_completionContext);
+    }
+}
@@ -0,0 +1,218 @@
+#pragma once
+#ifndef QSPI_JOURNAL_H
+#define QSPI_JOURNAL_H
+
+#include "daisy_seed.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file qspi_journal.h */
+
+namespace bkshepherd {
+
+/** An append only log of small CRC protected records in the QSPI flash.
+ *
+ * The journal region is split into two banks. Records are appended to the active bank, so saving a change only
+ * programs the few bytes of its record instead of erasing and rewriting a whole sector. Sectors are erased as the
+ * records reach them. When the active bank is full the journal is compacted: a snapshot of the current state is written
+ * into the other bank and only then its header is written, which makes it the active bank. A power loss while
+ * compacting leaves the old bank in use. Every sector of both banks is erased once per two compactions, which spreads
+ * the wear over the whole region.
+ *
+ * Records are staged in RAM by Append. Flush and Compact copy them (or the snapshot) into a program buffer and return
+ * right away, the flash is then written by Process one page program or one sector erase at a time, so the caller is
+ * never blocked for longer than a single flash operation. The completion callback is called once everything that was
+ * staged has been written.
+ *
+ * Replay hands the records of the active bank back in the order they were written, stopping at the first one that
+ * doesn't pass its CRC (ex. a torn write).
+ */
+class QspiJournal {
+  public:
+    static constexpr uint32_t kSectorSize = 4096;     // Erase size of the QSPI flash
+    static constexpr uint32_t kPageSize = 256;        // Largest program that doesn't wrap within a flash page
+    static constexpr size_t kStagingSize = 1024;      // Bytes of records that can be staged between flushes
+    static constexpr uint16_t kMaxPayloadSize = 1000; // Largest payload of a single record
+
+    /** Called by Replay for every valid record
+     \param type the type given to Append
+     \param payload the payload, read directly from the memory mapped flash
+     \param size the size of the payload in bytes
+     \param context the context given to Replay
+    */
+    typedef void (*RecordCallback)(uint16_t type, const uint8_t *payload, uint16_t size, void *context);
+
+    /** Called by Compact to Append a snapshot of the current state
+     \param journal the journal to Append the snapshot to
+     \param context the context given to Compact
+     \return false if the snapshot could not be written
+    */
+    typedef bool (*SnapshotCallback)(QspiJournal &journal, void *context);
+
+    /** Called when the journal has written everything that was staged
+     \param success false if some of the records were lost, the journal then needs to be compacted
+     \param context the context given to SetCompletionCallback
+    */
+    typedef void (*CompletionCallback)(bool success, void *context);
+
+    QspiJournal(daisy::QSPIHandle &qspi);
+
+    /** Finds the active bank of the journal and where the next record goes, call once at startup
+     \param address the offset of the journal region from the start of the flash, a multiple of kSectorSize
+     \param bankSize the size of each of the two banks in bytes, a multiple of kSectorSize
+     \param tag identifies the format of the records, a bank written with a different tag is ignored
+     \param programBuffer bankSize bytes the records are copied into while they are being written (ex. in SDRAM)
+    */
+    void Init(uint32_t address, uint32_t bankSize, uint32_t tag, uint8_t *programBuffer);
+
+    /** Sets the function called when everything that was staged has been written
+     \param callback the function to call, nullptr for none
+     \param context passed to the callback
+    */
+    void SetCompletionCallback(CompletionCallback callback, void *context);
+
+    /** Checks if the journal has an active bank with a matching tag */
+    bool HasActiveBank() const { return m_activeBank >= 0; }
+
+    /** Hands every valid record of the active bank to a callback, in the order they were written
+     \param callback the function called for each record
+     \param context passed to the callback
+     \return the number of records replayed
+    */
+    int Replay(RecordCallback callback, void *context);
+
+    /** Stages a record to be written by the next Flush
+     \param type the type of the record, 0xffff is reserved
+     \param payload the payload of the record
+     \param size the size of the payload in bytes, at most kMaxPayloadSize
+     \return false if the record could not be staged, the journal then needs to be compacted
+    */
+    bool Append(uint16_t type, const void *payload, uint16_t size);
+
+    /** Starts writing the staged records into the active bank, if the journal is busy they are written after the
+     * current operation. The completion callback is called right away when there is nothing to write.
+     \return false if they don't fit in the active bank, the journal then needs to be compacted
+    */
+    bool Flush();
+
+    /** Checks if a record was lost, if so the next save must Compact to write the whole state again */
+    bool NeedsCompaction() const { return m_needsCompaction; }
+
+    /** Makes the next save Compact, ex. after the whole state was replaced */
+    void RequestCompaction() { m_needsCompaction = true; }
+
+    /** Checks if a flush or compaction is being written */
+    bool IsBusy() const { return m_state != State::Idle; }
+
+    /** Takes a snapshot of the current state and starts writing it into the other bank, which becomes the active bank
+     * once the snapshot is written. Staged records are dropped, the snapshot has to include them.
+     \param callback the function that appends the snapshot
+     \param context passed to the callback
+     \return false if the journal is busy or the snapshot doesn't fit, the previous bank stays active
+    */
+    bool Compact(SnapshotCallback callback, void *context);
+
+    /** Does the next step of writing the journal: one page program or one sector erase. When the journal is idle it
+     * erases the sector after the records ahead of time, so appends seldom have to wait for an erase.
+     \param canErase false to hold off sector erases, which take tens of milliseconds (ex. while MIDI is busy)
+    */
+    void Process(bool canErase);
+
+    /** Gets the number of bytes a record with a payload of this size takes in a bank */
+    static uint32_t GetRecordSize(uint16_t size) { return sizeof(RecordHeader) + ((size + 3U) & ~3U); }
+
+    /** Gets the number of bytes of a bank available for a snapshot */
+    uint32_t GetBankCapacity() const { return m_bankSize - sizeof(BankHeader); }
+
+    uint32_t GetBankSize() const { return m_bankSize; }
+    uint32_t GetUsedBytes() const { return m_writeOffset; }
+    uint32_t GetGeneration() const { return m_generation; }
+
+  private:
+    enum class State {
+        Idle,
+        Flushing,   // Programming staged records into the active bank
+        Compacting, // Programming a snapshot into the other bank
+    };
+
+    struct BankHeader {
+        uint32_t magic;
+        uint32_t generation; // Incremented by every compaction, the newest valid bank is the active one
+        uint32_t tag;
+        uint32_t crc;
+    };
+
+    struct RecordHeader {
+        uint16_t type; // 0xffff for erased flash, the end of the records
+        uint16_t size; // Size of the payload in bytes, the record is padded to a multiple of 4 bytes
+        uint32_t crc;  // CRC of the bank generation, type, size and payload
+    };
+
+    static constexpr uint32_t kBankMagic = 0x4c4e524a; // "JRNL"
+    static constexpr uint16_t kErasedType = 0xffff;
+
+    static uint32_t Crc32(uint32_t crc, const void *data, size_t size);
+
+    /** Computes the CRC of a record, seeded with the generation so records left in a sector by an older generation
+     * of the bank are never mistaken for new ones
+    */
+    static uint32_t GetRecordCrc(uint32_t generation, const RecordHeader &header, const void *payload);
+
+    /** Fills in the CRCs of the records in a buffer for the generation of the bank they are written to */
+    static void SealRecords(uint8_t *records, size_t size, uint32_t generation);
+
+    uint32_t GetBankAddress(int bank) const { return m_address + bank * m_bankSize; }
+    const uint8_t *GetBankData(int bank) const;
+
+    /** Checks the header of a bank
+     \return the generation of the bank, 0 if the bank isn't valid
+    */
+    uint32_t ReadBankGeneration(int bank) const;
+
+    /** Walks the records of the active bank, handing them to the callback if there is one
+     \return the offset after the last valid record
+    */
+    uint32_t ScanRecords(RecordCallback callback, void *context, int *recordCount);
+
+    /** Erases the sector of a bank at an offset
+     \return false if the erase failed
+    */
+    bool EraseSector(int bank, uint32_t offset);
+
+    /** Copies the staged records into the program buffer and starts writing them */
+    void StartFlush();
+
+    /** Finishes the current operation, then starts the next flush or calls the completion callback */
+    void FinishOperation();
+
+    daisy::QSPIHandle &m_qspi;
+    uint32_t m_address;
+    uint32_t m_bankSize;
+    uint32_t m_tag;
+
+    int m_activeBank; // -1 until a bank has been written
+    uint32_t m_generation;
+    uint32_t m_writeOffset; // Offset of the next record in the active bank
+    uint32_t m_erasedEnd;   // Offset up to which the active bank is erased or already written
+    bool m_needsCompaction;
+    bool m_flushRequested;
+
+    uint8_t m_staging[kStagingSize];
+    uint8_t *m_appendBuffer; // The staging buffer, the program buffer while a snapshot is appended
+    size_t m_appendCapacity;
+    size_t m_stagedBytes; // Bytes appended to the append buffer
+
+    // The operation being written from the program buffer
+    State m_state;
+    uint8_t *m_programBuffer;
+    int m_programBank;
+    uint32_t m_programStart;     // Offset in the bank of the first byte of the program buffer
+    uint32_t m_programSize;      // Bytes of the program buffer to write
+    uint32_t m_programDone;      // Bytes of the program buffer written so far
+    uint32_t m_programErasedEnd; // Offset up to which the program bank is erased or already written
+
+    CompletionCallback m_completionCallback;
+    void *m_completionContext;
+};
+} // namespace bkshepherd
+#endif
@@ -0,0 +1,184 @@
+#include "rt_safety.h"
+
+#if defined(RT_SAFETY_CHECK)
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__arm__)
+#include "daisy_seed.h"
+#else
+#include <execinfo.h>
+#include <pthread.h>
+#endif
+
+using namespace bkshepherd;
+
+volatile bool RtSafety::s_inAudio = false;
+const char *volatile RtSafety::s_context = "";
+volatile uint32_t RtSafety::s_violationCount = 0;
+
+// The real functions behind the ones wrapped by the linker (-Wl,--wrap=malloc etc, see the Makefiles)
+extern "C" {
+void *__real_malloc(size_t size);
+void __real_free(void *memory);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *memory, size_t size);
+}
+
+namespace {
+
+const char *s_firstFunction = nullptr;
+const char *s_firstContext = nullptr;
+const void *s_firstCaller = nullptr;
+
+#if !defined(__arm__)
+constexpr int kMaxReportedCallers = 256;
+constexpr int kMaxBacktraceFrames = 32;
+
+const void *s_reportedCallers[kMaxReportedCallers];
+int s_reportedCallerCount = 0;
+bool s_reporting = false; // Printing a report allocates too, that isn't reported again
+#endif
+
+void *Allocate(size_t size) {
+    void *memory = __real_malloc(size > 0 ? size : 1);
+
+    if (memory == nullptr) {
+#if defined(__cpp_exceptions)
+        throw std::bad_alloc();
+#else
+        abort();
+#endif
+    }
+
+    return memory;
+}
+} // namespace
+
+void RtSafety::Report(const char *function, const void *caller) {
+#if !defined(__arm__)
+    if (s_reporting) {
+        return;
+    }
+#endif
+
+    s_violationCount = s_violationCount + 1;
+
+    if (s_firstFunction == nullptr) {
+        s_firstFunction = function;
+        s_firstContext = s_context;
+        s_firstCaller = caller;
+    }
+
+#if defined(__arm__)
+    // Stop right at the offending call when a debugger is attached
+    if (CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk) {
+        __BKPT(0);
+    }
+#else
+    // A per sample allocation would flood the output, each call site is printed once
+    for (int i = 0; i < s_reportedCallerCount; i++) {
+        if (s_reportedCallers[i] == caller) {
+            return;
+        }
+    }
+
+    if (s_reportedCallerCount < kMaxReportedCallers) {
+        s_reportedCallers[s_reportedCallerCount++] = caller;
+    }
+
+    s_reporting = true;
+
+    void *frames[kMaxBacktraceFrames];
+    const int frameCount = backtrace(frames, kMaxBacktraceFrames);
+
+    // Skip the frame of Report itself, addr2line -Cfe <binary> <address> resolves the frames of static functions
+    fprintf(stderr, "RT safety: %s in %s from %p\n", function, s_context, caller);
+    backtrace_symbols_fd(frames + 1, frameCount - 1, fileno(stderr));
+
+    s_reporting = false;
+#endif
+}
+
+void RtSafety::FormatSummary(char *buffer, size_t size) {
+    if (s_firstFunction == nullptr) {
+        snprintf(buffer, size, "No RT safety violations");
+        return;
+    }
+
+    snprintf(buffer, size, "%lu RT safety violations, first %s in %s from %p", (unsigned long)s_violationCount, s_firstFunction,
+             s_firstContext, s_firstCaller);
+}
+
+extern "C" {
+void *__wrap_malloc(size_t size) {
+    RtSafety::Check("malloc", __builtin_return_address(0));
+    return __real_malloc(size);
+}
+
+void __wrap_free(void *memory) {
+    if (memory != nullptr) {
+        RtSafety::Check("free", __builtin_return_address(0));
+    }
+
+    __real_free(memory);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    RtSafety::Check("calloc", __builtin_return_address(0));
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *memory, size_t size) {
+    RtSafety::Check("realloc", __builtin_return_address(0));
+    return __real_realloc(memory, size);
+}
+
+#if defined(__arm__)
+void __real_HAL_Delay(uint32_t delay);
+
+void __wrap_HAL_Delay(uint32_t delay) {
+    RtSafety::Check("HAL_Delay", __builtin_return_address(0));
+    __real_HAL_Delay(delay);
+}
+#else
+int __real_pthread_mutex_lock(pthread_mutex_t *mutex);
+
+int __wrap_pthread_mutex_lock(pthread_mutex_t *mutex) {
+    RtSafety::Check("pthread_mutex_lock", __builtin_return_address(0));
+    return __real_pthread_mutex_lock(mutex);
+}
+#endif
+}
+
+// The replaceable global allocation functions, the nothrow versions forward to these
+void *operator new(size_t size) {
+    RtSafety::Check("operator new", __builtin_return_address(0));
+    return Allocate(size);
+}
+
+void *operator new[](size_t size) {
+    RtSafety::Check("operator new[]", __builtin_return_address(0));
+    return Allocate(size);
+}
+
+void operator delete(void *memory) noexcept {
+    if (memory != nullptr) {
+        RtSafety::Check("operator delete", __builtin_return_address(0));
+    }
+
+    __real_free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    if (memory != nullptr) {
+        RtSafety::Check("operator delete[]", __builtin_return_address(0));
+    }
+
+    __real_free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept { operator delete(memory); }
+void operator delete[](void *memory, size_t) noexcept { operator delete[](memory); }
+#endif
@@ -0,0 +1,91 @@
+#pragma once
+#ifndef RT_SAFETY_H
+#define RT_SAFETY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file rt_safety.h */
+
+namespace bkshepherd {
+
+/** Debug checker for the real time safety of the audio path, built in with `make RT_SAFETY=1` (which defines
+ * RT_SAFETY_CHECK). While an RtSafetyScope is open every heap allocation (operator new / delete, malloc, calloc,
+ * realloc, free) and every blocking call (HAL_Delay on the Daisy, mutexes on the host and anything marked with
+ * RT_SAFETY_BLOCKING) is a violation. The allocator and HAL_Delay are intercepted with the linker's --wrap option, so
+ * calls made from inside libDaisy and the other libraries are caught as well.
+ *
+ * On the host the first violation from each call site is printed with the effect being processed and a backtrace, on
+ * the Daisy violations are counted, the first one is kept for the main loop to log and the core stops on a breakpoint
+ * if a debugger is attached. Without RT_SAFETY_CHECK the macros below compile to nothing.
+ */
+class RtSafety {
+  public:
+    /** Gets whether the audio path is running, ie. an RtSafetyScope is open */
+    static bool IsInAudio() { return s_inAudio; }
+
+    /** Records a violation if the audio path is running
+     \param function the name of the function called (ex. "malloc")
+     \param caller the address the function was called from
+    */
+    static void Check(const char *function, const void *caller) {
+        if (s_inAudio) {
+            Report(function, caller);
+        }
+    }
+
+    /** Gets the total number of violations since startup */
+    static uint32_t GetViolationCount() { return s_violationCount; }
+
+    /** Formats the violation count and the first violation for the log, ex. "3 RT safety violations, first malloc in
+     * Distortion from 0x2400a1b4"
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    static void FormatSummary(char *buffer, size_t size);
+
+  private:
+    friend class RtSafetyScope;
+
+    static void Report(const char *function, const void *caller);
+
+    static volatile bool s_inAudio;
+    static const char *volatile s_context;
+    static volatile uint32_t s_violationCount;
+};
+
+/** Marks the code run for the lifetime of the scope as part of the audio path. Scopes nest, an inner scope names the
+ * effect being processed and the outer scope's name is restored when it closes.
+ */
+class RtSafetyScope {
+  public:
+    explicit RtSafetyScope(const char *context) : m_wasInAudio(RtSafety::s_inAudio), m_previousContext(RtSafety::s_context) {
+        RtSafety::s_context = context;
+        RtSafety::s_inAudio = true;
+    }
+
+    ~RtSafetyScope() {
+        RtSafety::s_inAudio = m_wasInAudio;
+        RtSafety::s_context = m_previousContext;
+    }
+
+  private:
+    bool m_wasInAudio;
+    const char *m_previousContext;
+};
+} // namespace bkshepherd
+
+#if defined(RT_SAFETY_CHECK)
+#define RT_SAFETY_CONCAT_INNER(a, b) a##b
+#define RT_SAFETY_CONCAT(a, b) RT_SAFETY_CONCAT_INNER(a, b)
+
+/** Opens an RtSafetyScope until the end of the enclosing block, context names what is being processed */
+#define RT_SAFETY_SCOPE(context) bkshepherd::RtSafetyScope RT_SAFETY_CONCAT(rtSafetyScope, __LINE__)(context)
+/** Marks a call that blocks (ex. a flash erase), a violation if it's made from the audio path */
+#define RT_SAFETY_BLOCKING(function) bkshepherd::RtSafety::Check(function, __builtin_return_address(0))
+#else
+#define RT_SAFETY_SCOPE(context) ((void)0)
+#define RT_SAFETY_BLOCKING(function) ((void)0)
+#endif
+
+#endif
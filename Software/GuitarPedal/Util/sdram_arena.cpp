@@ -0,0 +1,150 @@
+#include "sdram_arena.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace bkshepherd;
+
+SdramArena::SdramArena() : m_memory(nullptr), m_size(0), m_usedBytes(0), m_peakUsedBytes(0), m_blockCount(0), m_ownerCount(0) {}
+
+void SdramArena::Init(void *memory, size_t size) {
+    // Trim the start and end so every block offset keeps the alignment
+    const uintptr_t start = (reinterpret_cast<uintptr_t>(memory) + kAlignment - 1) & ~(kAlignment - 1);
+    const size_t skipped = start - reinterpret_cast<uintptr_t>(memory);
+
+    m_memory = reinterpret_cast<uint8_t *>(start);
+    m_size = size > skipped ? (size - skipped) & ~(kAlignment - 1) : 0;
+    m_usedBytes = 0;
+    m_peakUsedBytes = 0;
+    m_ownerCount = 0;
+
+    m_blocks[0] = {0, m_size, kFreeBlock};
+    m_blockCount = 1;
+}
+
+void *SdramArena::Allocate(size_t size, const char *owner) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    const size_t alignedSize = (size + kAlignment - 1) & ~(kAlignment - 1);
+
+    for (int i = 0; i < m_blockCount; i++) {
+        Block &block = m_blocks[i];
+
+        if (block.owner != kFreeBlock || block.size < alignedSize) {
+            continue;
+        }
+
+        // Split off the rest of the block, when the table is full the whole block is handed out instead
+        if (block.size > alignedSize && m_blockCount < kMaxBlocks) {
+            InsertBlock(i + 1, {block.offset + alignedSize, block.size - alignedSize, kFreeBlock});
+            block.size = alignedSize;
+        }
+
+        block.owner = FindOwner(owner);
+
+        Owner &blockOwner = m_owners[block.owner];
+        blockOwner.bytes += block.size;
+
+        if (blockOwner.bytes > blockOwner.peakBytes) {
+            blockOwner.peakBytes = blockOwner.bytes;
+        }
+
+        m_usedBytes += block.size;
+
+        if (m_usedBytes > m_peakUsedBytes) {
+            m_peakUsedBytes = m_usedBytes;
+        }
+
+        return m_memory + block.offset;
+    }
+
+    return nullptr;
+}
+
+void SdramArena::Free(void *memory) {
+    if (memory == nullptr) {
+        return;
+    }
+
+    const size_t offset = static_cast<uint8_t *>(memory) - m_memory;
+
+    for (int i = 0; i < m_blockCount; i++) {
+        if (m_blocks[i].offset != offset || m_blocks[i].owner == kFreeBlock) {
+            continue;
+        }
+
+        m_owners[m_blocks[i].owner].bytes -= m_blocks[i].size;
+        m_usedBytes -= m_blocks[i].size;
+        m_blocks[i].owner = kFreeBlock;
+
+        // Merge with the free neighbours so large blocks can be handed out again
+        if (i + 1 < m_blockCount && m_blocks[i + 1].owner == kFreeBlock) {
+            m_blocks[i].size += m_blocks[i + 1].size;
+            RemoveBlock(i + 1);
+        }
+
+        if (i > 0 && m_blocks[i - 1].owner == kFreeBlock) {
+            m_blocks[i - 1].size += m_blocks[i].size;
+            RemoveBlock(i);
+        }
+
+        return;
+    }
+}
+
+size_t SdramArena::GetLargestFreeBlock() const {
+    size_t largest = 0;
+
+    for (int i = 0; i < m_blockCount; i++) {
+        if (m_blocks[i].owner == kFreeBlock && m_blocks[i].size > largest) {
+            largest = m_blocks[i].size;
+        }
+    }
+
+    return largest;
+}
+
+void SdramArena::FormatOwnerReport(int owner, char *buffer, size_t size) const {
+    snprintf(buffer, size, "Mem %s: %lu KB peak %lu KB", m_owners[owner].name, (unsigned long)(m_owners[owner].bytes / 1024),
+             (unsigned long)(m_owners[owner].peakBytes / 1024));
+}
+
+void SdramArena::FormatSummary(char *buffer, size_t size) const {
+    snprintf(buffer, size, "Mem total: %lu KB used %lu KB peak %lu KB largest free %lu KB", (unsigned long)(m_size / 1024),
+             (unsigned long)(m_usedBytes / 1024), (unsigned long)(m_peakUsedBytes / 1024),
+             (unsigned long)(GetLargestFreeBlock() / 1024));
+}
+
+int SdramArena::FindOwner(const char *name) {
+    for (int i = 0; i < m_ownerCount; i++) {
+        if (strcmp(m_owners[i].name, name) == 0) {
+            return i;
+        }
+    }
+
+    if (m_ownerCount == kMaxOwners) {
+        m_owners[kMaxOwners - 1].name = "Other";
+        return kMaxOwners - 1;
+    }
+
+    m_owners[m_ownerCount] = {name, 0, 0};
+    return m_ownerCount++;
+}
+
+void SdramArena::InsertBlock(int index, const Block &block) {
+    for (int i = m_blockCount; i > index; i--) {
+        m_blocks[i] = m_blocks[i - 1];
+    }
+
+    m_blocks[index] = block;
+    m_blockCount++;
+}
+
+void SdramArena::RemoveBlock(int index) {
+    for (int i = index; i < m_blockCount - 1; i++) {
+        m_blocks[i] = m_blocks[i + 1];
+    }
+
+    m_blockCount--;
+}
@@ -0,0 +1,135 @@
+#pragma once
+#ifndef SDRAM_ARENA_H
+#define SDRAM_ARENA_H
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file sdram_arena.h */
+
+namespace bkshepherd {
+
+/** Hands out blocks of one large region of memory (the SDRAM on the Daisy) to the Effects that are in use, so the
+ * memory of an Effect that isn't selected can be reused by the next one instead of every Effect reserving its own
+ * buffers at link time. Blocks are placed first fit and merged with their free neighbours when they are freed.
+ *
+ * The arena keeps the current and peak number of bytes held by each owner (the name of the Effect), for the memory
+ * report in the serial log. It is not synchronized, only call it from the main loop.
+ */
+class SdramArena {
+  public:
+    static constexpr size_t kAlignment = 32; // Alignment of every block, one cache line on the Cortex-M7
+    static constexpr int kMaxBlocks = 96;    // Maximum number of used and free blocks the arena is split into
+    static constexpr int kMaxOwners = 32;    // Maximum number of owners tracked by the memory report
+
+    SdramArena();
+
+    /** Sets the memory the arena hands out, call once at startup
+     \param memory the start of the memory
+     \param size the size of the memory in bytes
+    */
+    void Init(void *memory, size_t size);
+
+    /** Allocates a block of memory, the contents are not cleared
+     \param size the size of the block in bytes
+     \param owner the name the block is reported under, must stay valid for the lifetime of the arena
+     \return the block aligned to kAlignment, nullptr if there isn't a large enough free block
+    */
+    void *Allocate(size_t size, const char *owner);
+
+    /** Allocates an object in the arena with its default constructor. The object is never destroyed, Free only
+     * gives its memory back, so only use this for objects that don't own anything outside of the arena.
+     \param owner the name the object is reported under
+     \return the object, nullptr if there isn't a large enough free block
+    */
+    template <typename T> T *Create(const char *owner) {
+        static_assert(alignof(T) <= kAlignment, "The arena can't align this type");
+        void *memory = Allocate(sizeof(T), owner);
+        return memory != nullptr ? new (memory) T : nullptr;
+    }
+
+    /** Allocates an array of objects in the arena with their default constructors, see Create
+     \param count the number of objects
+     \param owner the name the objects are reported under
+     \return the first object, nullptr if there isn't a large enough free block
+    */
+    template <typename T> T *CreateArray(size_t count, const char *owner) {
+        static_assert(alignof(T) <= kAlignment, "The arena can't align this type");
+        T *objects = static_cast<T *>(Allocate(sizeof(T) * count, owner));
+
+        // Construct one by one, an array placement new may need more memory than the array itself
+        for (size_t i = 0; objects != nullptr && i < count; i++) {
+            new (&objects[i]) T;
+        }
+
+        return objects;
+    }
+
+    /** Gives a block back to the arena
+     \param memory a block returned by Allocate, Create or CreateArray, nullptr is ignored
+    */
+    void Free(void *memory);
+
+    size_t GetSize() const { return m_size; }
+    size_t GetUsedBytes() const { return m_usedBytes; }
+    size_t GetPeakUsedBytes() const { return m_peakUsedBytes; }
+
+    /** Gets the size of the largest block that can currently be allocated */
+    size_t GetLargestFreeBlock() const;
+
+    int GetOwnerCount() const { return m_ownerCount; }
+    const char *GetOwnerName(int owner) const { return m_owners[owner].name; }
+    size_t GetOwnerBytes(int owner) const { return m_owners[owner].bytes; }
+    size_t GetOwnerPeakBytes(int owner) const { return m_owners[owner].peakBytes; }
+
+    /** Formats one line of the memory report: the owner name and the KB it holds now and at its peak
+     \param owner the index of the owner, 0..GetOwnerCount() - 1
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    void FormatOwnerReport(int owner, char *buffer, size_t size) const;
+
+    /** Formats the arena totals for the memory report: used, peak and largest free block in KB
+     \param buffer The buffer to write into
+     \param size The size of buffer in bytes
+    */
+    void FormatSummary(char *buffer, size_t size) const;
+
+  private:
+    struct Block {
+        size_t offset; // Start of the block from the start of the arena
+        size_t size;   // Size of the block in bytes
+        int owner;     // Index of the owner, kFreeBlock if the block is free
+    };
+
+    struct Owner {
+        const char *name;
+        size_t bytes;     // Bytes currently held
+        size_t peakBytes; // Most bytes held at once
+    };
+
+    static constexpr int kFreeBlock = -1;
+
+    /** Finds the owner entry for a name, adding it if needed
+     \return the index of the owner, once the table is full new names share the last entry
+    */
+    int FindOwner(const char *name);
+
+    void InsertBlock(int index, const Block &block);
+    void RemoveBlock(int index);
+
+    uint8_t *m_memory;
+    size_t m_size;
+    size_t m_usedBytes;
+    size_t m_peakUsedBytes;
+
+    // Blocks sorted by offset, together they always cover the whole arena
+    Block m_blocks[kMaxBlocks];
+    int m_blockCount;
+
+    Owner m_owners[kMaxOwners];
+    int m_ownerCount;
+};
+} // namespace bkshepherd
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+
+namespace bkshepherd {
+
+/** Wait-free Single Producer / Single Consumer queue.
+ * One context (ex. the main loop) may only Push and one other context (ex. the audio callback) may only Pop.
+ * Neither side ever blocks or allocates, a full queue simply rejects the Push.
+ * \tparam T the type of item stored in the queue, copied in and out
+ * \tparam Capacity the number of slots in the queue, must be a power of two
+ */
+template <typename T, size_t Capacity> class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue Capacity must be a power of two");
+
+  public:
+    SpscQueue() : m_head(0), m_tail(0) {}
+    ~SpscQueue() {}
+
+    /** Adds an item to the queue, only call from the producer context
+     \param item the item to copy into the queue
+     \return true if the item was queued, false if the queue was full
+    */
+    bool Push(const T &item) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_head.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+
+        m_items[tail & (Capacity - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Removes the oldest item from the queue, only call from the consumer context
+     \param item the item that was removed from the queue
+     \return true if an item was removed, false if the queue was empty
+    */
+    bool Pop(T &item) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        item = m_items[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Returns true if the queue currently has no items, only a hint when called from the producer context */
+    bool IsEmpty() const { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+
+  private:
+    T m_items[Capacity];
+    std::atomic<size_t> m_head; // Next slot to Pop, only written by the consumer
+    std::atomic<size_t> m_tail; // Next slot to Push, only written by the producer
+};
+} // namespace bkshepherd
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef AUDIO_COMMANDS_H
+#define AUDIO_COMMANDS_H
+
+#include <stdint.h>
+
+/** The types of commands the control side (main loop) can send to the audio callback */
+enum class AudioCommandType : uint8_t {
+    SetActiveEffect,                   // Select effectID as the active effect, the chain is processed instead if it holds it
+    SetEffectChain,                    // Replace the effect chain with the slots packed in uintValue, effectID is the active effect
+    SetTempo,                          // Apply the tempo in uintValue (BPM) to the effect being processed
+    NoteOn,                            // Midi Note On, floatValue1 is the note number and floatValue2 is the velocity
+    NoteOff,                           // Midi Note Off, floatValue1 is the note number and floatValue2 is the velocity
+    SetEffectEnabled,                  // Enable (uintValue 1) or Bypass (uintValue 0) the effect being processed
+    AlternateFootswitchPressed,        // The Alternate Footswitch was pressed
+    AlternateFootswitchReleased,       // The Alternate Footswitch was released
+    AlternateFootswitchHeldFor1Second, // The Alternate Footswitch has been held for 1 second
+};
+
+/** A single command sent from the control side to the audio callback */
+struct AudioCommand {
+    AudioCommandType type;
+    int effectID;
+    uint32_t uintValue;
+    float floatValue1;
+    float floatValue2;
+};
+
+/** Posts a command to be applied at the start of the next audio block.
+ * Only call from the main loop, never from the audio callback.
+ \param command the command to post
+ \return true if the command was queued, false if the queue was full and the command should be retried later.
+*/
+bool PostAudioCommand(const AudioCommand &command);
+
+#endif
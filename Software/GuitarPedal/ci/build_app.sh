@@ -7,4 +7,9 @@ if [ $? -ne 0 ]; then
         echo "Failed to compile GuitarPedal firmware"
         exit 1
 fi
+python3 ./ci/check_memory.py build/guitarpedal.map
+if [ $? -ne 0 ]; then
+        echo "GuitarPedal firmware is over its memory budget"
+        exit 1
+fi
 echo "done."
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+# Checks the memory used in each region of a linker map against a budget, see Util/memory_placement.h for what goes
+# where. From /Software/GuitarPedal/ after a build:
+#   python3 ci/check_memory.py build/guitarpedal.map
+#   python3 ci/check_memory.py build/guitarpedal.map --budget DTCMRAM=80
+# Prints the use of each region and exits with 1 if a region is over its budget.
+
+import argparse
+import re
+import sys
+
+# Percent of each region that may be used, DTCMRAM also holds the stack
+DEFAULT_BUDGETS = {
+    "DTCMRAM": 90,
+    "SRAM": 95,
+    "SDRAM": 95,
+    "QSPIFLASH": 95,
+}
+DEFAULT_BUDGET = 95
+
+REGION_PATTERN = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+SECTION_PATTERN = re.compile(r"^(\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?)?\s*$")
+WRAPPED_PATTERN = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?\s*$")
+IGNORED_SECTIONS = (".debug", ".comment", ".ARM.attributes", ".stab")
+
+
+def parse_regions(lines):
+    """Reads the regions from the Memory Configuration table, in the order they are listed"""
+    regions = []
+    in_table = False
+
+    for line in lines:
+        if line.startswith("Memory Configuration"):
+            in_table = True
+        elif line.startswith("Linker script and memory map"):
+            break
+        elif in_table:
+            match = REGION_PATTERN.match(line)
+
+            if match and match.group(1) not in ("Name", "*default*"):
+                regions.append({"name": match.group(1), "origin": int(match.group(2), 16),
+                                "length": int(match.group(3), 16), "used": 0, "sections": []})
+
+    return regions
+
+
+def parse_sections(lines):
+    """Reads the output sections, yielding the name, address, size and load address (or None) of each"""
+    in_map = False
+    pending = None
+
+    for line in lines:
+        if line.startswith("Linker script and memory map"):
+            in_map = True
+            continue
+
+        if not in_map:
+            continue
+
+        # A long section name puts its address and size on the next line
+        if pending is not None:
+            match = WRAPPED_PATTERN.match(line)
+            if match:
+                yield pending, int(match.group(1), 16), int(match.group(2), 16), \
+                    int(match.group(3), 16) if match.group(3) else None
+            pending = None
+            continue
+
+        match = SECTION_PATTERN.match(line)
+        if not match:
+            continue
+
+        if match.group(2) is None:
+            pending = match.group(1)
+        else:
+            yield match.group(1), int(match.group(2), 16), int(match.group(3), 16), \
+                int(match.group(4), 16) if match.group(4) else None
+
+
+def find_region(regions, address):
+    for region in regions:
+        if region["origin"] <= address < region["origin"] + region["length"]:
+            return region
+    return None
+
+
+def parse_budgets(values):
+    budgets = dict(DEFAULT_BUDGETS)
+
+    for value in values:
+        name, _, percent = value.partition("=")
+        try:
+            budgets[name] = float(percent)
+        except ValueError:
+            sys.exit("Budget must be REGION=percent, got {}".format(value))
+
+    return budgets
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check the memory use of a linker map against per region budgets")
+    parser.add_argument("map", help="the linker map, ex. build/guitarpedal.map")
+    parser.add_argument("--budget", action="append", default=[], metavar="REGION=PERCENT",
+                        help="percent of a region that may be used, can be given more than once")
+    parser.add_argument("--sections", action="store_true", help="also list the sections in each region")
+    args = parser.parse_args()
+
+    with open(args.map) as map_file:
+        lines = map_file.read().splitlines()
+
+    regions = parse_regions(lines)
+    if not regions:
+        sys.exit("No Memory Configuration found in {}".format(args.map))
+
+    budgets = parse_budgets(args.budget)
+
+    for name, address, size, load_address in parse_sections(lines):
+        if size == 0 or name.startswith(IGNORED_SECTIONS):
+            continue
+
+        # Initialized data takes room where it runs and again for its load image (ex. .data in SRAM)
+        addresses = [address]
+        if load_address is not None and load_address != address:
+            addresses.append(load_address)
+
+        for section_address in addresses:
+            region = find_region(regions, section_address)
+            if region is not None:
+                region["used"] += size
+                region["sections"].append((name, size))
+
+    over_budget = False
+    print("{:<12} {:>10} {:>10} {:>7} {:>7}".format("Region", "Used", "Size", "Used%", "Budget"))
+
+    for region in regions:
+        percent = 100.0 * region["used"] / region["length"] if region["length"] else 0.0
+        budget = budgets.get(region["name"], DEFAULT_BUDGET)
+        status = ""
+
+        if percent > budget:
+            status = "  OVER BUDGET"
+            over_budget = True
+
+        print("{:<12} {:>10} {:>10} {:>6.1f}% {:>6.0f}%{}".format(region["name"], region["used"], region["length"], percent,
+                                                                 budget, status))
+
+        if args.sections:
+            for name, size in sorted(region["sections"], key=lambda section: -section[1]):
+                print("    {:<30} {:>10}".format(name, size))
+
+    if over_budget:
+        print("Memory use is over budget, see Util/memory_placement.h for moving things to another region")
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+# Runs the firmware in the Renode emulator (https://renode.io) and measures every call of the audio callback, see
+# Util/emulator_test.h. From /Software/GuitarPedal/ (make emulator-test does the build and the run in one go):
+#   make EMULATOR_TEST=1 BUILD_DIR=build/emulator-test
+#   python3 ci/emulator_test.py build/emulator-test/guitarpedal.elf --effect 2 --input in.wav --output out.wav
+#   python3 ci/emulator_test.py build/emulator-test/guitarpedal.elf --effect 2 --input in.wav --reference ref.wav
+# The effect is an index from host/build/pedal-render --list, the input is a 48kHz PCM WAV file (a couple of seconds of
+# plucked notes if none is given). Prints the instructions per block and exits with 1 if a block went over its budget,
+# the output has NaNs or infinities, or it's further from the reference (ex. rendered by pedal-render) than allowed.
+#
+# Renode counts instructions, it doesn't model the Cortex-M7's dual issue, caches or the SDRAM's wait states, so the
+# budget assumes one instruction per cycle. The counts are exact and repeatable, which makes them good for catching
+# regressions, but the profiler on the pedal has the final say on the real load.
+
+import argparse
+import math
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+import wave
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# The layout of EmulatorTestMailbox in Util/emulator_test.h
+MAILBOX_ADDRESS = 0x60000000
+MAILBOX_MAGIC = 0x4C444550
+EFFECT_ID_ADDRESS = MAILBOX_ADDRESS + 0x04
+FRAME_COUNT_ADDRESS = MAILBOX_ADDRESS + 0x08
+WARMUP_BLOCK_COUNT_ADDRESS = MAILBOX_ADDRESS + 0x0C
+BLOCK_ADDRESS = MAILBOX_ADDRESS + 0x10
+BLOCK_COUNT_ADDRESS = MAILBOX_ADDRESS + 0x14
+HOOK_SCRATCH_ADDRESS = MAILBOX_ADDRESS + 0x18
+RESULTS_ADDRESS = MAILBOX_ADDRESS + 0x1000
+INPUT_ADDRESS = MAILBOX_ADDRESS + 0x100000
+OUTPUT_ADDRESS = MAILBOX_ADDRESS + 0x800000
+MAX_FRAMES = (OUTPUT_ADDRESS - INPUT_ADDRESS) // 8
+
+# Run by Renode (IronPython 2.7) when the firmware reaches the marker functions. The hooks keep their state in the
+# mailbox, the results are written to a temporary file first so the script never reads half of them.
+BEGIN_HOOK = """
+count = long(self.ExecutedInstructions)
+sysbus.WriteDoubleWord({scratch:#x}, count & 0xFFFFFFFF)
+sysbus.WriteDoubleWord({scratch:#x} + 4, count >> 32)
+"""
+
+END_HOOK = """
+start = long(sysbus.ReadDoubleWord({scratch:#x})) | (long(sysbus.ReadDoubleWord({scratch:#x} + 4)) << 32)
+block = long(sysbus.ReadDoubleWord({block:#x}))
+sysbus.WriteDoubleWord({results:#x} + 4 * block, (long(self.ExecutedInstructions) - start) & 0xFFFFFFFF)
+"""
+
+FINISHED_HOOK = """
+import System
+frames = int(sysbus.ReadDoubleWord({frame_count:#x}))
+blocks = int(sysbus.ReadDoubleWord({block_count:#x}))
+System.IO.File.WriteAllBytes(r"{output}", sysbus.ReadBytes({output_address:#x}, frames * 8))
+System.IO.File.WriteAllBytes(r"{results}.tmp", sysbus.ReadBytes({results_address:#x}, blocks * 4))
+System.IO.File.Move(r"{results}.tmp", r"{results}")
+self.IsHalted = True
+"""
+
+RUN_SCRIPT = """
+$elf=@{elf}
+$platform=@{platform}
+include @{machine}
+
+sysbus LoadBinary @{input} {input_address:#x}
+sysbus WriteDoubleWord {effect_id_address:#x} {effect}
+sysbus WriteDoubleWord {frame_count_address:#x} {frames}
+sysbus WriteDoubleWord {warmup_address:#x} {warmup_blocks}
+sysbus WriteDoubleWord {mailbox_address:#x} {magic:#x}
+
+cpu AddHook `sysbus GetSymbolAddress "EmulatorTestBlockBegin"` \"\"\"{begin_hook}\"\"\"
+cpu AddHook `sysbus GetSymbolAddress "EmulatorTestBlockEnd"` \"\"\"{end_hook}\"\"\"
+cpu AddHook `sysbus GetSymbolAddress "EmulatorTestFinished"` \"\"\"{finished_hook}\"\"\"
+
+start
+"""
+
+
+def read_wav(path):
+    """Reads a PCM WAV file, returning the sample rate and a list of (left, right) frames"""
+    with wave.open(path, "rb") as wav_file:
+        channels = wav_file.getnchannels()
+        width = wav_file.getsampwidth()
+        sample_rate = wav_file.getframerate()
+        data = wav_file.readframes(wav_file.getnframes())
+
+    if width not in (2, 3, 4):
+        sys.exit("{} must be 16, 24 or 32 bit PCM".format(path))
+
+    scale = 1.0 / (1 << (8 * width - 1))
+    samples = []
+
+    for offset in range(0, len(data) - width + 1, width):
+        # Sign extend the little endian sample through the top bytes of a 32 bit word
+        value = struct.unpack("<i", b"\0" * (4 - width) + data[offset:offset + width])[0] >> (8 * (4 - width))
+        samples.append(value * scale)
+
+    # A mono input feeds both channels, the same as the pedal does
+    frames = []
+    for i in range(0, len(samples) - channels + 1, channels):
+        frames.append((samples[i], samples[i + 1] if channels >= 2 else samples[i]))
+
+    return sample_rate, frames
+
+
+def write_wav(path, sample_rate, frames):
+    """Writes (left, right) frames as a 24 bit stereo WAV file"""
+    data = bytearray()
+
+    for frame in frames:
+        for sample in frame:
+            sample = sample if math.isfinite(sample) else 0.0
+            value = int(round(max(-1.0, min(1.0, sample)) * 8388607.0))
+            data += struct.pack("<i", value)[:3]
+
+    with wave.open(path, "wb") as wav_file:
+        wav_file.setnchannels(2)
+        wav_file.setsampwidth(3)
+        wav_file.setframerate(sample_rate)
+        wav_file.writeframes(bytes(data))
+
+
+def make_plucks(sample_rate, seconds):
+    """Makes plucked sawtooth notes, a new note every half second, so the effects have something to work on"""
+    notes = [82.41, 110.0, 146.83, 196.0, 246.94, 329.63]
+    frames = []
+
+    for i in range(int(sample_rate * seconds)):
+        time_in_note = (i % (sample_rate // 2)) / sample_rate
+        frequency = notes[(i // (sample_rate // 2)) % len(notes)]
+        phase = (time_in_note * frequency) % 1.0
+        sample = 0.5 * (2.0 * phase - 1.0) * math.exp(-6.0 * time_in_note)
+        frames.append((sample, sample))
+
+    return frames
+
+
+def run_renode(args, frames, work_dir):
+    """Runs the firmware on the frames, returning the output frames and the instructions of each block"""
+    input_path = os.path.join(work_dir, "input.bin")
+    output_path = os.path.join(work_dir, "output.bin")
+    results_path = os.path.join(work_dir, "results.bin")
+    script_path = os.path.join(work_dir, "run.resc")
+    log_path = os.path.join(work_dir, "renode.log")
+
+    with open(input_path, "wb") as input_file:
+        input_file.write(struct.pack("<{}f".format(2 * len(frames)), *[sample for frame in frames for sample in frame]))
+
+    hook_addresses = {"scratch": HOOK_SCRATCH_ADDRESS, "block": BLOCK_ADDRESS, "results": RESULTS_ADDRESS}
+
+    with open(script_path, "w") as script_file:
+        script_file.write(RUN_SCRIPT.format(
+            elf=os.path.abspath(args.elf), platform=os.path.join(SCRIPT_DIR, "emulator", "guitarpedal.repl"),
+            machine=os.path.join(SCRIPT_DIR, "emulator", "guitarpedal.resc"), input=input_path,
+            input_address=INPUT_ADDRESS, effect_id_address=EFFECT_ID_ADDRESS, effect=args.effect,
+            frame_count_address=FRAME_COUNT_ADDRESS, frames=len(frames), warmup_address=WARMUP_BLOCK_COUNT_ADDRESS,
+            warmup_blocks=args.warmup_blocks, mailbox_address=MAILBOX_ADDRESS, magic=MAILBOX_MAGIC,
+            begin_hook=BEGIN_HOOK.format(**hook_addresses), end_hook=END_HOOK.format(**hook_addresses),
+            finished_hook=FINISHED_HOOK.format(frame_count=FRAME_COUNT_ADDRESS, block_count=BLOCK_COUNT_ADDRESS,
+                                               output=output_path, output_address=OUTPUT_ADDRESS, results=results_path,
+                                               results_address=RESULTS_ADDRESS)))
+
+    with open(log_path, "w") as log_file:
+        renode = subprocess.Popen([args.renode, "--disable-xwt", "--console", "--plain", "-e", "include @" + script_path],
+                                  stdin=subprocess.PIPE, stdout=log_file, stderr=subprocess.STDOUT)
+        deadline = time.monotonic() + args.timeout
+
+        while not os.path.exists(results_path) and renode.poll() is None and time.monotonic() < deadline:
+            time.sleep(0.5)
+
+        finished = os.path.exists(results_path)
+
+        # Renode keeps running once the core is halted, ask it to quit and make sure it does
+        if renode.poll() is None:
+            try:
+                renode.communicate(b"quit\n", timeout=10)
+            except subprocess.TimeoutExpired:
+                renode.kill()
+                renode.wait()
+
+    if not finished:
+        with open(log_path) as log_file:
+            sys.stderr.write(log_file.read()[-4000:])
+        sys.exit("The firmware didn't finish the test within {} s, the Renode log is above".format(args.timeout))
+
+    with open(output_path, "rb") as output_file:
+        output = output_file.read()
+    with open(results_path, "rb") as results_file:
+        results = results_file.read()
+
+    samples = struct.unpack("<{}f".format(len(output) // 4), output)
+    instructions = list(struct.unpack("<{}I".format(len(results) // 4), results))
+    return [(samples[i], samples[i + 1]) for i in range(0, len(samples) - 1, 2)], instructions
+
+
+def compare_with_reference(path, output):
+    """Gets the RMS of the difference between the output and a reference WAV file, in dB of full scale"""
+    _, reference = read_wav(path)
+    count = min(len(reference), len(output))
+
+    if count == 0:
+        sys.exit("{} has no audio".format(path))
+
+    total = 0.0
+    for i in range(count):
+        total += (output[i][0] - reference[i][0]) ** 2 + (output[i][1] - reference[i][1]) ** 2
+
+    rms = math.sqrt(total / (2 * count))
+    return 20.0 * math.log10(rms) if rms > 0.0 else -math.inf
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the firmware in Renode and measure the audio callback")
+    parser.add_argument("elf", help="the firmware built with EMULATOR_TEST=1, ex. build/emulator-test/guitarpedal.elf")
+    parser.add_argument("--effect", type=int, default=0, help="the effect to run, see pedal-render --list")
+    parser.add_argument("--input", help="48kHz PCM WAV file to process, plucked notes if not given")
+    parser.add_argument("--seconds", type=float, default=2.0, help="length of the plucked notes")
+    parser.add_argument("--output", help="write the output to a WAV file")
+    parser.add_argument("--csv", help="write the instructions of every block to a CSV file")
+    parser.add_argument("--reference", help="WAV file the output should match, ex. from pedal-render")
+    parser.add_argument("--max-difference-db", type=float, default=-60.0,
+                        help="largest RMS difference from the reference, in dB of full scale")
+    parser.add_argument("--max-budget-percent", type=float, default=100.0,
+                        help="most of the block budget any block may use")
+    parser.add_argument("--block-size", type=int, default=48, help="blockSize in guitar_pedal.cpp")
+    parser.add_argument("--sample-rate", type=int, default=48000, help="sample rate of the firmware")
+    parser.add_argument("--cpu-mhz", type=float, default=480.0, help="clock of the core")
+    parser.add_argument("--warmup-blocks", type=int, default=100,
+                        help="silent blocks before the input, for the effect switch and bypass fade")
+    parser.add_argument("--renode", default="renode", help="the Renode executable")
+    parser.add_argument("--timeout", type=float, default=900.0, help="seconds to wait for the emulation")
+    args = parser.parse_args()
+
+    if shutil.which(args.renode) is None:
+        sys.exit("Can't find {}, install Renode from https://renode.io or pass --renode".format(args.renode))
+
+    if args.input is not None:
+        sample_rate, frames = read_wav(args.input)
+
+        if sample_rate != args.sample_rate:
+            sys.exit("{} is {} Hz, the firmware runs at {} Hz".format(args.input, sample_rate, args.sample_rate))
+    else:
+        frames = make_plucks(args.sample_rate, args.seconds)
+
+    if not frames or len(frames) > MAX_FRAMES:
+        sys.exit("The input must have between 1 and {} frames".format(MAX_FRAMES))
+
+    work_dir = tempfile.mkdtemp(prefix="emulator-test-")
+
+    try:
+        output, instructions = run_renode(args, frames, work_dir)
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    if not instructions:
+        sys.exit("No blocks were measured")
+
+    budget = args.cpu_mhz * 1e6 * args.block_size / args.sample_rate
+    worst_block = max(range(len(instructions)), key=lambda block: instructions[block])
+    percentile = sorted(instructions)[min(len(instructions) - 1, int(0.99 * len(instructions)))]
+    mean = sum(instructions) / len(instructions)
+
+    print("Effect {}, {} blocks of {} samples, budget {:.0f} cycles per block".format(args.effect, len(instructions),
+                                                                                     args.block_size, budget))
+    print("Instructions per block: mean {:.0f} ({:.1f}%), 99th percentile {} ({:.1f}%), worst {} ({:.1f}%) in block {}"
+          .format(mean, 100.0 * mean / budget, percentile, 100.0 * percentile / budget, instructions[worst_block],
+                  100.0 * instructions[worst_block] / budget, worst_block))
+
+    if args.csv is not None:
+        with open(args.csv, "w") as csv_file:
+            csv_file.write("block,instructions,budget_percent\n")
+            for block, count in enumerate(instructions):
+                csv_file.write("{},{},{:.1f}\n".format(block, count, 100.0 * count / budget))
+
+    failed = False
+
+    if instructions[worst_block] > budget * args.max_budget_percent / 100.0:
+        print("Block {} is over {:.0f}% of its budget".format(worst_block, args.max_budget_percent))
+        failed = True
+
+    if any(not math.isfinite(sample) for frame in output for sample in frame):
+        print("The output has NaNs or infinities")
+        failed = True
+
+    if args.output is not None:
+        write_wav(args.output, args.sample_rate, output)
+
+    if args.reference is not None:
+        difference = compare_with_reference(args.reference, output)
+        print("Difference from {}: {:.1f} dBFS RMS".format(args.reference, difference))
+
+        if difference > args.max_difference_db:
+            print("The output is further from the reference than {:.1f} dBFS".format(args.max_difference_db))
+            failed = True
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -30,7 +30,7 @@ struct Wavenet_Layer
         conv.reset();
     }
 
-    void load_weights (std::vector<float>::iterator& weights)
+    void load_weights (const float*& weights)
     {
         conv.reset();
 
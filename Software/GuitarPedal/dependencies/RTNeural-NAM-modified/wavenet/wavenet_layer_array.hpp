@@ -70,7 +70,7 @@ struct Layer_Array
 #endif
     }
 
-    void load_weights (std::vector<float>::iterator& weights)
+    void load_weights (const float*& weights)
     {
         std::vector<std::vector<float>> rechannel_weights (channels, std::vector<float> (in_size));
         for (int i = 0; i < channels; i++)
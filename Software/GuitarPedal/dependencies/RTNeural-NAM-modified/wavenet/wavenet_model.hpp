@@ -2,6 +2,7 @@
 
 #include "arena.hpp"
 #include "wavenet_layer_array.hpp"
+#include <span>
 
 namespace wavenet
 {
@@ -74,10 +75,10 @@ struct Wavenet_Model
     }
     */
 
-    void load_weights (std::vector<float>& model_weights)
+    void load_weights (std::span<const float> model_weights)
     {
         //std::vector<float> model_weights = model_json.at ("weights");
-        auto weights_iterator = model_weights.begin();
+        const float* weights_iterator = model_weights.data();
         RTNeural::modelt_detail::forEachInTuple (
             [&weights_iterator] (auto& layer, size_t)
             {
@@ -89,7 +90,7 @@ struct Wavenet_Model
 
         // Make sure we use the all of the weights exactly
         int temp = model_weights.size();
-        assert (std::distance (model_weights.begin(), weights_iterator) == temp);
+        assert (std::distance (model_weights.data(), weights_iterator) == temp);
         //assert (std::distance (model_weights.begin(), weights_iterator) == model_weights.size());
     }
 
@@ -0,0 +1,22 @@
+# Effect Modules, in the order they appear on the pedal. Each name builds Effect-Modules/<name>_module.cpp plus the
+#  <name>_SOURCES it needs and adds the effect to loaded_effects.h. Modules that aren't listed aren't built at all, so
+#  their global attributes don't take up memory resources. Override the list for a lean single purpose image:
+# make clean && make -j8 EFFECTS="amp ir noise_gate tuner"
+# Included by the firmware Makefile and by the host build in host/Makefile, source paths are relative to GuitarPedal/
+EFFECTS ?= modulated_tremolo overdrive autopan chorus chopper reverb multi_delay metro tuner pitch_shifter compressor \
+looper geq peq noise_gate cloudseed amp delay tape_delay nam scifi polyoctave spectral_delay distortion granulardelay ir \
+drum phaser flanger crusher
+
+# Other modules: reverb_delay scope
+# Keyboard oriented modules: fm_keys midi_keys modal_keys pluckecho string_keys
+
+IMPULSE_RESPONSE_SOURCES = Effect-Modules/ImpulseResponse/ImpulseResponse.cpp Effect-Modules/ImpulseResponse/dsp.cpp
+amp_SOURCES = $(IMPULSE_RESPONSE_SOURCES)
+chopper_SOURCES = Effect-Modules/Chopper/chopper.cpp
+ir_SOURCES = $(IMPULSE_RESPONSE_SOURCES)
+
+# sort drops the sources shared by several modules
+EFFECT_SOURCES = $(sort $(foreach effect,$(EFFECTS),Effect-Modules/$(effect)_module.cpp $($(effect)_SOURCES)))
+
+# Tell loaded_effects.h which modules are built and in what order
+EFFECT_FLAGS = $(foreach effect,$(EFFECTS),-DEFFECT_$(effect)) '-DSELECTED_EFFECTS=$(foreach effect,$(EFFECTS),EFFECT($(effect)))'
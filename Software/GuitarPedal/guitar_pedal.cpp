@@ -1,3 +1,5 @@
+#include "Effect-Modules/effect_chain_module.h"
+#include "audio_commands.h"
 #include "daisysp.h"
 #include "guitar_pedal_storage.h"
 #include "loaded_effects.h"
@@ -5,6 +7,13 @@
 
 #include "UI/guitar_pedal_ui.h"
 #include "Util/audio_utilities.h"
+#include "Util/block_trace.h"
+#include "Util/emulator_test.h"
+#include "Util/overrun_governor.h"
+#include "Util/profiler.h"
+#include "Util/rt_safety.h"
+#include "Util/sdram_arena.h"
+#include "Util/spsc_queue.h"
 
 using namespace daisy;
 using namespace daisysp;
@@ -21,46 +30,80 @@ using namespace bkshepherd;
 
 // Store the hardware in SRAM to save DTCMRAM for the dynamic
 // variables and buffers, this saves a large amount of DTCMRAM
-#define TEXT_SECTION __attribute__((section(".text")))
 #if defined(VARIANT_TERRARIUM)
 #include "Hardware-Modules/guitar_pedal_terrarium.h"
 constexpr bool has_alternate_footswitch = true;
-GuitarPedalTerrarium TEXT_SECTION hardware;
+GuitarPedalTerrarium DSP_SRAM_DATA hardware;
 #elif defined(VARIANT_1590B)
 #include "Hardware-Modules/guitar_pedal_1590b.h"
 constexpr bool has_alternate_footswitch = false;
-GuitarPedal1590B TEXT_SECTION hardware;
+GuitarPedal1590B DSP_SRAM_DATA hardware;
 #elif defined(VARIANT_1590B_SMD)
 #include "Hardware-Modules/guitar_pedal_1590b-SMD.h"
 constexpr bool has_alternate_footswitch = false;
-GuitarPedal1590BSMD TEXT_SECTION hardware;
+GuitarPedal1590BSMD DSP_SRAM_DATA hardware;
 #elif defined(VARIANT_FUNBOX)
 #include "Hardware-Modules/guitar_pedal_funbox.h"
 constexpr bool has_alternate_footswitch = true;
-GuitarPedalFunbox TEXT_SECTION hardware;
+GuitarPedalFunbox DSP_SRAM_DATA hardware;
 #else
 #include "Hardware-Modules/guitar_pedal_125b.h"
 constexpr bool has_alternate_footswitch = true;
-GuitarPedal125B TEXT_SECTION hardware;
+GuitarPedal125B DSP_SRAM_DATA hardware;
 #endif
 
 // Persistant Storage
-PersistentStorage<Settings> storage(hardware.seed.qspi);
+SettingsStorage storage(hardware.seed.qspi);
 
 // Effect Related Variables
 int availableEffectsCount = 0;
 BaseEffectModule **availableEffects = nullptr;
+extern const uint32_t selectedEffectsHash = kSelectedEffectsHash; // Which effects are built in and their order
 int activeEffectID = 0;
 int prevActiveEffectID = 0;
 int tunerModuleIndex = -1;
 BaseEffectModule *activeEffect = nullptr;
+BaseEffectModule *audioEffect = nullptr; // The effect being processed, only changed by the audio callback
+bool activeEffectChangePending = false;  // The active effect changed but the audio callback has not been told yet
+
+// Effect Chain, processed instead of the active effect while the active effect is one of its slots. The chain module
+// is owned by the audio callback, the control side keeps its own copy of the slots it last sent.
+EffectChainModule effectChain;
+EffectChainModule::Slot appliedEffectChain[EffectChainModule::kMaxSlots];
+bool effectChainChangePending = false;         // The chain changed but the audio callback has not been told yet
+constexpr float effectChainMaxLoad = 0.85f;    // Share of the block budget a chain may use, the rest is for the callback itself
+constexpr int effectCalibrationBlocks = 8;     // Blocks measured for an effect that hasn't been processed yet
+constexpr int effectCalibrationMaxBlocks = 32; // Blocks run at most to get them, the audio callback interrupts some
+
+// SDRAM Arena, the memory the effects in use allocate their buffers from (the rest of the SDRAM holds the static tables
+// of CloudSeed and the tape modulator, and CloudSeed's delay line pool which it can never give back). Memory is handed
+// out and taken back by the main loop, only once the audio callback has settled on the last effect selection it was
+// sent so nothing is taken from an effect still fading out.
+#if defined(EFFECT_cloudseed)
+constexpr size_t sdramStaticPoolBytes = CloudSeedModule::kCustomPoolBytes;
+#else
+constexpr size_t sdramStaticPoolBytes = 0;
+#endif
+constexpr size_t sdramArenaSize = 60 * 1024 * 1024 - sdramStaticPoolBytes;
+uint8_t DSY_SDRAM_BSS sdramArenaMemory[sdramArenaSize];
+SdramArena sdramArena;
+uint32_t postedSelectionCount = 0;           // Effect selections sent to the audio callback, control side only
+uint32_t receivedSelectionCount = 0;         // Effect selections taken from the queue, audio callback only
+volatile uint32_t settledSelectionCount = 0; // Effect selections the audio callback has finished switching to
+int nextEffectToPrepare = 0;                 // The one time setup of the effects runs in the background after boot
 
 // UI Related Variables
 GuitarPedalUI guitarPedalUI;
 
 // Hardware Related Variables
 bool useDebugDisplay = false;
-bool effectOn = false;
+bool useProfilerDisplay = false; // Show the per stage cost of the audio callback instead of the UI
+bool useProfilerLog = false;     // Log the per stage cost of the audio callback over the serial port every second
+bool useTraceDisplay = false;    // Plot the duration of the most recent audio blocks instead of the UI
+uint32_t lastProfilerLogTime = 0;
+bool effectOn = false;          // Requested effect state, owned by the control task
+bool postedEffectOn = false;    // Last effect state sent to the audio callback
+bool audioEffectOn = false;     // Effect state the audio callback is processing with
 
 bool muteOn = false;
 float muteOffTransitionTimeInSeconds = 0.02f;
@@ -76,7 +119,13 @@ uint32_t lastTimeStampUS;
 float secondsSinceStartup = 0.0f;
 
 bool needToSaveSettingsForActiveEffect = false;
-uint32_t last_save_time; // Time we last set it
+uint32_t last_save_time;      // Time we last set it
+uint32_t lastMidiMessageTime; // Time the last MIDI message came in, the settings journal holds off erases while MIDI is busy
+
+// Midi Bank Select (CC 0) picks what a Program Change selects: in bank 0 the program is an effect, in bank n it is a
+// preset of effect n - 1
+constexpr uint8_t midiBankSelectCC = 0;
+int midiBank = 0;
 
 // Used to debounce quick switching to/from the tuner
 bool ignoreBypassSwitchUntilNextActuation = false;
@@ -95,6 +144,13 @@ bool *knobValueCacheChanged = nullptr;
 float *knobValueCache = nullptr;
 int *knobValueSamplesTilIdle = nullptr;
 
+// Control Rate Task Variables
+constexpr uint32_t controlRateHz = 1000;
+constexpr uint32_t controlPeriodUS = 1000000 / controlRateHz;
+uint32_t lastControlTimeStampUS;
+int bypassSwitchID = -1;    // Switch mapped to SpecialFunctionType::Bypass, resolved once at startup
+int alternateSwitchID = -1; // Switch mapped to SpecialFunctionType::Alternate, resolved once at startup
+
 // Switch Monitoring Variables
 float switchEnabledIdleTimeInSeconds = 2.0f;
 int switchEnabledIdleTimeInSamples;
@@ -104,9 +160,15 @@ int *switchEnabledSamplesTilIdle = nullptr;
 bool alternateHeldFor1SecondTriggered = false;
 
 // Tempo
-bool needToChangeTempo = false;
+volatile bool needToChangeTempo = false;
+volatile bool tempoAppliedToEffect = false;
 uint32_t globalTempoBPM = 0;
 
+// Control to Audio Command Queue, the per block budgets keep the worst case block cost bounded
+SpscQueue<AudioCommand, 32> audioCommandQueue;
+constexpr int maxAudioCommandsPerBlock = 8;
+constexpr int maxParameterChangesPerBlock = 4;
+
 bool isCrossFading = false;
 bool isCrossFadingForward = true; // True goes Source->Target, False goes Target->Source
 CrossFade crossFaderLeft, crossFaderRight;
@@ -114,28 +176,465 @@ float crossFaderTransitionTimeInSeconds = 0.1f;
 int crossFaderTransitionTimeInSamples;
 int samplesTilCrossFadingComplete;
 CpuLoadMeter cpuLoadMeter;
+ProfilerStage callbackProfile("Callback");
+ProfilerStage parametersProfile("Params");
+ProfilerStage effectProfile("Effect");
+ProfilerStage switchProfile("Switch");
+OverrunGovernor overrunGovernor;
+
+// Effect Switching, the outgoing effect is faded out while the incoming effect is faded in. When both effects fit in
+// the block budget together they run at the same time (Overlap), otherwise the outgoing effect fades out completely
+// before the incoming effect starts (FadeOut then FadeIn) so the CPU load stays bounded. An incoming effect that doesn't
+// have its SDRAM yet is held silent (Wait) until the main loop has handed it out.
+enum class EffectSwitchState {
+    None,
+    Overlap,
+    FadeOut,
+    Wait,
+    FadeIn,
+};
+
+EffectSwitchState effectSwitchState = EffectSwitchState::None;
+float effectSwitchTimeInSeconds = 0.05f;
+int effectSwitchTimeInSamples;
+int samplesTilEffectSwitchComplete;
+constexpr float effectSwitchMaxLoad = 0.8f; // Share of the block budget both effects may use together to Overlap
+CrossFade effectSwitchFaderLeft, effectSwitchFaderRight;
+BaseEffectModule *outgoingEffect = nullptr; // The effect being switched away from, only used by the audio callback
+AudioCommand pendingSelectionCommand;       // Effect selection received while another switch was still running
+bool selectionCommandPending = false;
+
+// Audio Block Related Variables
+// The block buffers are written before they are read in every block, so they can go in the uncleared DTCMRAM section
+constexpr size_t blockSize = 48;
+float DSP_HOT_BSS effectInputLeft[blockSize];
+float DSP_HOT_BSS effectInputRight[blockSize];
+float DSP_HOT_BSS effectOutputLeft[blockSize];
+float DSP_HOT_BSS effectOutputRight[blockSize];
+const float *const effectInput[2] = {effectInputLeft, effectInputRight};
+float *const effectOutput[2] = {effectOutputLeft, effectOutputRight};
+
+// Bypass Spillover, lets delay and reverb tails ring out after the effect is bypassed. Instead of crossfading the
+// output, the effect input is faded out while the dry signal is faded in. Only used for effects with a tail and when
+// the relay bypass isn't taking the DSP out of the signal path.
+constexpr bool useBypassSpillover = true;
+float spilloverInputGain = 0.0f;                      // Gain currently applied to the effect input, 0 while bypassed
+float DSP_HOT_BSS spilloverInputGainBlock[blockSize]; // Per sample effect input gain for the current block
+
+// Output of the outgoing effect while switching effects
+float DSP_HOT_BSS switchOutputLeft[blockSize];
+float DSP_HOT_BSS switchOutputRight[blockSize];
+float *const switchOutput[2] = {switchOutputLeft, switchOutputRight};
 
 void SetActiveEffect(int effectID);
 
-static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer out, size_t size) {
-    cpuLoadMeter.OnBlockStart();
+bool PostAudioCommand(const AudioCommand &command) { return audioCommandQueue.Push(command); }
 
-    // Process Audio
-    float inputLeft;
-    float inputRight;
+// Sends an effect selection (SetActiveEffect or SetEffectChain) to the audio callback, counting it so the main loop can
+// tell when the audio callback has settled on it
+static bool PostSelectionCommand(const AudioCommand &command) {
+    if (!PostAudioCommand(command)) {
+        return false;
+    }
 
-    // Default LEDs are off
-    float led1Brightness = 0.0f;
-    float led2Brightness = 0.0f;
+    postedSelectionCount++;
+    return true;
+}
+
+// Checks that every effect an effect processes has its SDRAM, runs in the audio callback
+static bool IsReadyToProcess(const BaseEffectModule *effect) {
+    for (int i = 0; i < effect->GetProcessedEffectCount(); i++) {
+        if (!effect->GetProcessedEffect(i)->HasResources()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Checks if the effect being processed should keep its tail ringing out when bypassed, runs in the audio callback
+static bool UsesBypassSpillover() {
+    if (!useBypassSpillover || audioEffect == nullptr || audioEffect->GetTailLengthInSeconds() <= 0.0f) {
+        return false;
+    }
+
+    // The relay takes the DSP out of the signal path so there is nothing to spill over
+    Settings &settings = storage.GetSettings();
+    return !(hardware.SupportsTrueBypass() && settings.globalRelayBypassEnabled);
+}
+
+// Starts the transition to a new effect state, runs in the audio callback
+static void SetAudioEffectEnabled(bool enabled) {
+    if (enabled == audioEffectOn) {
+        return;
+    }
 
+    audioEffectOn = enabled;
+
+    // Set the stats on the effect
+    if (audioEffect != nullptr) {
+        audioEffect->SetEnabled(audioEffectOn);
+    }
+
+    // The effect input fade handles the transition when the tail spills over, otherwise setup the crossfade
+    if (UsesBypassSpillover()) {
+        isCrossFading = false;
+        crossFaderLeft.SetPos(audioEffectOn ? 1.0f : 0.0f);
+        crossFaderRight.SetPos(audioEffectOn ? 1.0f : 0.0f);
+    } else {
+        isCrossFading = true;
+        samplesTilCrossFadingComplete = crossFaderTransitionTimeInSamples;
+        isCrossFadingForward = audioEffectOn;
+    }
+
+    // Start the timing sequence for the Hardware Mute and Relay Bypass.
+    Settings &settings = storage.GetSettings();
+
+    if (hardware.SupportsTrueBypass() && settings.globalRelayBypassEnabled) {
+        // Immediately Mute the Output using the Hardware Mute.
+        muteOn = true;
+
+        // Set the timing for when the bypass relay should trigger and when to unmute.
+        samplesTilMuteOff = muteOffTransitionTimeInSamples;
+        samplesTilBypassToggle = bypassToggleTransitionTimeInSamples;
+    }
+}
+
+// Stops processing an effect that has been switched away from, runs in the audio callback
+static void RetireEffect(BaseEffectModule *effect) {
+    // The effect stops without its tail ringing out, so its state is stale if it's switched back to
+    effect->SetEnabled(false);
+    effect->MarkIdle();
+
+    // A chain reconfigured while it was audible takes its new slots now that it is silent
+    if (effect == &effectChain) {
+        effectChain.ApplyPendingSlots();
+    }
+
+    // The effect being processed may share effects with the one that was retired (ex. a chain and one of its effects)
+    if (audioEffect != nullptr) {
+        audioEffect->SetEnabled(audioEffectOn);
+    }
+}
+
+// Checks if two effects process any of the same effects, runs in the audio callback
+static bool EffectsShareEffects(const BaseEffectModule *first, const BaseEffectModule *second) {
+    for (int i = 0; i < first->GetProcessedEffectCount(); i++) {
+        for (int j = 0; j < second->GetProcessedEffectCount(); j++) {
+            if (first->GetProcessedEffect(i) == second->GetProcessedEffect(j)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Starts switching the effect being processed, runs in the audio callback
+static void BeginEffectSwitch(BaseEffectModule *incomingEffect) {
+    // Reconfiguring the chain while it is being processed is a switch from the chain to itself
+    const bool reconfiguringChain = incomingEffect == &effectChain && effectChain.HasPendingSlots();
+
+    if (incomingEffect == audioEffect && !reconfiguringChain) {
+        return;
+    }
+
+    // An effect that is still waiting for its SDRAM has never been heard, so it is dropped without a fade
+    BaseEffectModule *previousEffect = audioEffect;
+    const bool previousAudible = previousEffect != nullptr && audioEffectOn && !previousEffect->IsIdle() &&
+                                 effectSwitchState != EffectSwitchState::Wait;
+    effectSwitchState = EffectSwitchState::None;
+
+    audioEffect = incomingEffect;
+    audioEffect->SetEnabled(audioEffectOn);
+    overrunGovernor.Restart();
+
+    if (previousAudible) {
+        // The outgoing effect is audible, transition between the two
+        outgoingEffect = previousEffect;
+        samplesTilEffectSwitchComplete = effectSwitchTimeInSamples;
+
+        // Only run both effects together when their measured cost fits, an effect that has never run is an unknown cost.
+        // An effect can't be processed twice in one block, so effects that share an effect always fade out first. The
+        // incoming effect also needs its SDRAM already, it is usually only handed out once the outgoing effect is done.
+        const uint32_t incomingCost = incomingEffect->GetProcessingCostTicks();
+        const uint32_t combinedCost = previousEffect->GetProcessingCostTicks() + incomingCost;
+        const bool overlapFits = incomingCost > 0 && combinedCost < effectSwitchMaxLoad * Profiler::GetBlockBudgetTicks() &&
+                                 !EffectsShareEffects(previousEffect, incomingEffect) && IsReadyToProcess(incomingEffect);
+
+        effectSwitchState = overlapFits ? EffectSwitchState::Overlap : EffectSwitchState::FadeOut;
+    } else if (previousEffect != nullptr) {
+        RetireEffect(previousEffect);
+    }
+
+    // A bypassed effect has no tail of its own yet, so don't let stale state spill over
+    if (!audioEffectOn) {
+        incomingEffect->MarkIdle();
+    }
+}
+
+// Switches the audio callback to the chain when the active effect is one of its slots, otherwise to the active effect
+// alone. Runs in the audio callback for the SetActiveEffect and SetEffectChain commands.
+static void SelectAudioEffect(const AudioCommand &command) {
+    // Only one switch runs at a time, the latest request is applied once the current one completes. A chain that is
+    // waiting keeps waiting, taking the latest active effect with it. A switch waiting for SDRAM is simply replaced.
+    if (effectSwitchState != EffectSwitchState::None && effectSwitchState != EffectSwitchState::Wait) {
+        if (selectionCommandPending && pendingSelectionCommand.type == AudioCommandType::SetEffectChain &&
+            command.type == AudioCommandType::SetActiveEffect) {
+            pendingSelectionCommand.effectID = command.effectID;
+        } else {
+            pendingSelectionCommand = command;
+        }
+
+        selectionCommandPending = true;
+        return;
+    }
+
+    BaseEffectModule *selectedEffect = availableEffects[command.effectID];
+    bool useChain = effectChain.ContainsEffect(selectedEffect);
+
+    if (command.type == AudioCommandType::SetEffectChain) {
+        EffectChainModule::Slot slots[EffectChainModule::kMaxSlots];
+        EffectChainModule::UnpackSlots(command.uintValue, slots);
+        useChain = false;
+
+        for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+            useChain = useChain || slots[i].effectID == command.effectID;
+        }
+
+        // The chain can only change while it is silent, so an audible chain swaps its slots once it has faded out
+        if (audioEffect == &effectChain || outgoingEffect == &effectChain) {
+            effectChain.SetPendingSlots(slots);
+        } else {
+            effectChain.SetSlots(slots);
+        }
+    }
+
+    BeginEffectSwitch(useChain ? &effectChain : selectedEffect);
+}
+
+// Blends the outgoing effect into the effect output while switching effects, runs in the audio callback
+static void ProcessEffectSwitch(size_t size) {
+    // Hold the output silent while the incoming effect waits for its SDRAM
+    if (effectSwitchState == EffectSwitchState::Wait) {
+        for (size_t i = 0; i < size; i++) {
+            effectOutputLeft[i] = 0.0f;
+            effectOutputRight[i] = 0.0f;
+        }
+
+        return;
+    }
+
+    if (effectSwitchState != EffectSwitchState::FadeIn) {
+        RT_SAFETY_SCOPE(outgoingEffect->GetName());
+        BlockTrace::MarkTask(BlockTraceTask::EffectSwitch);
+        switchProfile.Begin();
+        outgoingEffect->UpdateParameterSnapshot(size, maxParameterChangesPerBlock);
+
+        if (outgoingEffect->IsSuspended()) {
+            switchProfile.End();
+
+            for (size_t i = 0; i < size; i++) {
+                switchOutputLeft[i] = 0.0f;
+                switchOutputRight[i] = 0.0f;
+            }
+        } else {
+            outgoingEffect->ProcessBlock(effectInput, switchOutput, size);
+            switchProfile.End();
+
+            outgoingEffect->RecordProcessingCost(switchProfile.GetBlockTicks());
+        }
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        float switchFadeFactor = 1.0f;
+
+        if (samplesTilEffectSwitchComplete > 0) {
+            switchFadeFactor = 1.0f - (float)samplesTilEffectSwitchComplete / (float)effectSwitchTimeInSamples;
+            samplesTilEffectSwitchComplete -= 1;
+        }
+
+        effectSwitchFaderLeft.SetPos(switchFadeFactor);
+        effectSwitchFaderRight.SetPos(switchFadeFactor);
+
+        // The source is the outgoing effect (or silence) and the target is the incoming effect (or silence)
+        switch (effectSwitchState) {
+        case EffectSwitchState::Overlap:
+            effectOutputLeft[i] = effectSwitchFaderLeft.Process(switchOutputLeft[i], effectOutputLeft[i]);
+            effectOutputRight[i] = effectSwitchFaderRight.Process(switchOutputRight[i], effectOutputRight[i]);
+            break;
+        case EffectSwitchState::FadeOut:
+            effectOutputLeft[i] = effectSwitchFaderLeft.Process(switchOutputLeft[i], 0.0f);
+            effectOutputRight[i] = effectSwitchFaderRight.Process(switchOutputRight[i], 0.0f);
+            break;
+        case EffectSwitchState::FadeIn:
+            effectOutputLeft[i] = effectSwitchFaderLeft.Process(0.0f, effectOutputLeft[i]);
+            effectOutputRight[i] = effectSwitchFaderRight.Process(0.0f, effectOutputRight[i]);
+            break;
+        case EffectSwitchState::None:
+        case EffectSwitchState::Wait:
+            break;
+        }
+    }
+
+    if (samplesTilEffectSwitchComplete > 0) {
+        return;
+    }
+
+    if (effectSwitchState == EffectSwitchState::FadeOut) {
+        // The outgoing effect is silent now, the incoming effect starts with the next block
+        RetireEffect(outgoingEffect);
+        outgoingEffect = nullptr;
+        samplesTilEffectSwitchComplete = effectSwitchTimeInSamples;
+        effectSwitchState = EffectSwitchState::FadeIn;
+        return;
+    }
+
+    if (outgoingEffect != nullptr) {
+        RetireEffect(outgoingEffect);
+        outgoingEffect = nullptr;
+    }
+
+    effectSwitchState = EffectSwitchState::None;
+
+    if (selectionCommandPending) {
+        selectionCommandPending = false;
+        SelectAudioEffect(pendingSelectionCommand);
+    }
+}
+
+// Applies the commands posted by the main loop, called at the start of each audio block
+static void ProcessAudioCommands() {
+    AudioCommand command;
+
+    for (int i = 0; i < maxAudioCommandsPerBlock && audioCommandQueue.Pop(command); i++) {
+        BlockTrace::MarkTask(BlockTraceTask::Commands);
+
+        switch (command.type) {
+        case AudioCommandType::SetActiveEffect:
+        case AudioCommandType::SetEffectChain:
+            receivedSelectionCount++;
+            SelectAudioEffect(command);
+            break;
+        case AudioCommandType::SetEffectEnabled:
+            SetAudioEffectEnabled(command.uintValue != 0);
+            break;
+        case AudioCommandType::SetTempo:
+            if (audioEffect != nullptr) {
+                audioEffect->SetTempo(command.uintValue);
+                tempoAppliedToEffect = true;
+            }
+            break;
+        case AudioCommandType::NoteOn:
+            if (audioEffect != nullptr && IsReadyToProcess(audioEffect)) {
+                audioEffect->OnNoteOn(command.floatValue1, command.floatValue2);
+            }
+            break;
+        case AudioCommandType::NoteOff:
+            if (audioEffect != nullptr && IsReadyToProcess(audioEffect)) {
+                audioEffect->OnNoteOff(command.floatValue1, command.floatValue2);
+            }
+            break;
+        case AudioCommandType::AlternateFootswitchPressed:
+            if (audioEffect != nullptr && IsReadyToProcess(audioEffect)) {
+                audioEffect->AlternateFootswitchPressed();
+            }
+            break;
+        case AudioCommandType::AlternateFootswitchReleased:
+            if (audioEffect != nullptr && IsReadyToProcess(audioEffect)) {
+                audioEffect->AlternateFootswitchReleased();
+            }
+            break;
+        case AudioCommandType::AlternateFootswitchHeldFor1Second:
+            if (audioEffect != nullptr && IsReadyToProcess(audioEffect)) {
+                audioEffect->AlternateFootswitchHeldFor1Second();
+            }
+            break;
+        }
+    }
+}
+
+// Posts a footswitch event for the effect being processed by the audio callback
+static void PostFootswitchCommand(AudioCommandType type) {
+    AudioCommand command = {type, activeEffectID, 0, 0.0f, 0.0f};
+    PostAudioCommand(command);
+}
+
+// Trace page, plots the duration of the most recent audio blocks against the block budget, one column per block with
+// the newest on the right, and names the worst one of them with the tasks that ran in it
+static void DrawBlockTrace() {
+    static constexpr int kTraceColumns = 128;
+    static constexpr int kPlotTop = 10;
+    static constexpr int kPlotBottom = 63;
+    static constexpr uint32_t kPlotMaxPermille = 1500; // The top of the plot is 150% of the budget
+    static BlockTraceRecord DSP_SRAM_DATA records[kTraceColumns];
+
+    uint32_t firstBlock = BlockTrace::GetBlockCount() - kTraceColumns;
+    const int count = BlockTrace::Read(firstBlock, records, kTraceColumns);
+    const int plotHeight = kPlotBottom - kPlotTop;
+    int worst = -1;
+
+    hardware.display.Fill(false);
+
+    for (int i = 0; i < count; i++) {
+        const uint32_t permille = Profiler::TicksToBudgetPermille(records[i].durationTicks);
+        const uint32_t clipped = permille < kPlotMaxPermille ? permille : kPlotMaxPermille;
+        const int height = static_cast<int>(clipped * plotHeight / kPlotMaxPermille);
+        const int x = kTraceColumns - count + i;
+
+        hardware.display.DrawLine(x, kPlotBottom, x, kPlotBottom - height, true);
+
+        if (worst < 0 || records[i].durationTicks > records[worst].durationTicks) {
+            worst = i;
+        }
+    }
+
+    // Dotted line at 100% of the budget
+    const int budgetY = kPlotBottom - static_cast<int>(1000 * plotHeight / kPlotMaxPermille);
+
+    for (int x = 0; x < kTraceColumns; x += 4) {
+        hardware.display.DrawPixel(x, budgetY, true);
+    }
+
+    char strbuff[32] = "";
+
+    if (worst >= 0) {
+        char tasks[32];
+        const uint32_t permille = Profiler::TicksToBudgetPermille(records[worst].durationTicks);
+        BlockTrace::FormatTasks(records[worst].tasks & ~BlockTraceTask::Overrun, tasks, sizeof(tasks));
+        snprintf(strbuff, sizeof(strbuff), "%lu.%lu%% %s", (unsigned long)(permille / 10), (unsigned long)(permille % 10), tasks);
+    }
+
+    hardware.display.SetCursor(0, 0);
+    hardware.display.WriteString(strbuff, Font_6x8, true);
+    hardware.display.Update();
+}
+
+// The knobs are filtered once per control tick, but the main loop only gets to the control rate task every
+// controlPeriodUS or later, so the knob filter is kept in step with the actual time between ticks
+static void UpdateKnobFilterRate(uint32_t elapsedControlTimeUS) {
+    static uint32_t knobFilterPeriodUS = controlPeriodUS;
+
+    if (elapsedControlTimeUS == knobFilterPeriodUS) {
+        return;
+    }
+
+    knobFilterPeriodUS = elapsedControlTimeUS;
+    const float knobFilterRateHz = 1000000.0f / static_cast<float>(elapsedControlTimeUS);
+
+    for (int i = 0; i < hardware.GetKnobCount(); i++) {
+        hardware.knobs[i].SetSampleRate(knobFilterRateHz);
+    }
+}
+
+// Control rate task, scans the knobs and switches and turns them into parameter changes and audio commands.
+// This runs from the main loop at controlRateHz so the audio callback only has to do DSP work.
+static void ProcessControls(int size) {
     // Handle Inputs
     hardware.ProcessAnalogControls();
     hardware.ProcessDigitalControls();
     guitarPedalUI.GenerateUIEvents();
 
-    // Get a handle to the persitance storage settings
-    Settings &settings = storage.GetSettings();
-
     // Process the Pots
     float knobValueRaw;
 
@@ -184,10 +683,6 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
         }
     }
 
-    // Store the previous value of the effect bypass so that we can determine if
-    // we need to perform a toggle at the end of processing the switches
-    bool oldEffectOn = effectOn;
-
     // Process potential footswitch actions before the main switch processing loop
     if (has_alternate_footswitch) {
         // Handle the scenario where have 2 footswitches
@@ -195,9 +690,7 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
         // If both footswitches are down, save the parameters for this effect to
         // persistant storage If there is only one footswitch, it will do
         // parameter saving here when held instead of tuner quick switching later
-        if (hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Bypass)].TimeHeldMs() > 2000 &&
-            hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)].TimeHeldMs() >
-                2000 &&
+        if (hardware.switches[bypassSwitchID].TimeHeldMs() > 2000 && hardware.switches[alternateSwitchID].TimeHeldMs() > 2000 &&
             !guitarPedalUI.IsShowingSavingSettingsScreen() && !ignoreBypassSwitchUntilNextActuation) {
 
             needToSaveSettingsForActiveEffect = true;
@@ -206,8 +699,7 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
 
         // If bypass is held for 2 seconds and alternate footswitch is not
         // pressed (not trying to save) then perform an action
-        if (hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Bypass)].TimeHeldMs() > 2000 &&
-            !hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)].Pressed() &&
+        if (hardware.switches[bypassSwitchID].TimeHeldMs() > 2000 && !hardware.switches[alternateSwitchID].Pressed() &&
             !ignoreBypassSwitchUntilNextActuation) {
 
             // If we have a screen and there is a tuner module, we quick switch
@@ -222,7 +714,6 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
                     // inverse because the act of holding the switch caused the state to
                     // chnage due to the rising edge being detected
                     effectOn = !effectActiveBeforeQuickSwitch;
-                    activeEffect->SetEnabled(effectOn);
                 } else {
                     // Store if effect is on or not when quick switching
                     effectActiveBeforeQuickSwitch = effectOn;
@@ -230,7 +721,6 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
                     // Switch to tuner and force it to be enabled
                     SetActiveEffect(tunerModuleIndex);
                     effectOn = true;
-                    activeEffect->SetEnabled(effectOn);
                 }
                 ignoreBypassSwitchUntilNextActuation = true;
             } else {
@@ -249,7 +739,6 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
                 SetActiveEffect(newActiveEffectId);
 
                 effectOn = false;
-                activeEffect->SetEnabled(effectOn);
 
                 ignoreBypassSwitchUntilNextActuation = true;
             }
@@ -257,14 +746,12 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
 
         // Disable quick switching until the footswitch is released to prevent infinite switching
         // also prevents saving from toggling quick switch.
-        if (ignoreBypassSwitchUntilNextActuation &&
-            !hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Bypass)].Pressed()) {
+        if (ignoreBypassSwitchUntilNextActuation && !hardware.switches[bypassSwitchID].Pressed()) {
             ignoreBypassSwitchUntilNextActuation = false;
         }
     } else {
         // Handle the scenario where we only have 1 footswitch
-        if (hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Bypass)].TimeHeldMs() > 2000 &&
-            !guitarPedalUI.IsShowingSavingSettingsScreen()) {
+        if (hardware.switches[bypassSwitchID].TimeHeldMs() > 2000 && !guitarPedalUI.IsShowingSavingSettingsScreen()) {
             needToSaveSettingsForActiveEffect = true;
         }
     }
@@ -276,28 +763,26 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
         // If this is the bypass switch, check for a bypass transition already
         // in progress (isCrossFading), and toggle the effect if the switch is
         // pressed
-        if (!ignoreBypassSwitchUntilNextActuation && !isCrossFading &&
-            i == hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Bypass) && switchPressed) {
+        if (!ignoreBypassSwitchUntilNextActuation && !isCrossFading && i == bypassSwitchID && switchPressed) {
             effectOn = !effectOn;
         }
 
-        if (effectOn && switchPressed && i == hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)) {
-            activeEffect->AlternateFootswitchPressed();
+        if (effectOn && switchPressed && i == alternateSwitchID) {
+            PostFootswitchCommand(AudioCommandType::AlternateFootswitchPressed);
         }
 
         bool switchReleased = hardware.switches[i].FallingEdge();
-        if (switchReleased && i == hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)) {
+        if (switchReleased && i == alternateSwitchID) {
             alternateHeldFor1SecondTriggered = false;
         }
-        if (effectOn && switchReleased && i == hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)) {
-            activeEffect->AlternateFootswitchReleased();
+        if (effectOn && switchReleased && i == alternateSwitchID) {
+            PostFootswitchCommand(AudioCommandType::AlternateFootswitchReleased);
         }
 
         bool switchHeld = hardware.switches[i].TimeHeldMs() >= 1000.f;
-        if (effectOn && switchHeld && !alternateHeldFor1SecondTriggered &&
-            i == hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)) {
+        if (effectOn && switchHeld && !alternateHeldFor1SecondTriggered && i == alternateSwitchID) {
             alternateHeldFor1SecondTriggered = true;
-            activeEffect->AlternateFootswitchHeldFor1Second();
+            PostFootswitchCommand(AudioCommandType::AlternateFootswitchHeldFor1Second);
         }
 
         if (switchEnabledCache[i] == true) {
@@ -322,8 +807,7 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
                 switchDoubleEnabledCache[i] = true;
 
                 // Register as Tap Tempo if Switch ID matched preferred mapping for TapTempo
-                if (activeEffect->AlternateFootswitchForTempo() &&
-                    i == hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)) {
+                if (activeEffect->AlternateFootswitchForTempo() && i == alternateSwitchID) {
                     needToChangeTempo = true;
                     float timeBetweenPresses =
                         hardware.GetTimeForNumberOfSamples(switchEnabledIdleTimeInSamples - switchEnabledSamplesTilIdle[i]);
@@ -335,38 +819,122 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
         }
     }
 
-    // Handle updating the Hardware Bypass & Muting signals
-    if (hardware.SupportsTrueBypass() && settings.globalRelayBypassEnabled) {
-        hardware.SetAudioBypass(bypassOn);
-        hardware.SetAudioMute(muteOn);
+    // Hand any change in the effect state over to the audio callback, retrying next tick if the queue is full
+    if (effectOn != postedEffectOn) {
+        AudioCommand command = {AudioCommandType::SetEffectEnabled, activeEffectID, effectOn ? 1U : 0U, 0.0f, 0.0f};
+
+        if (PostAudioCommand(command)) {
+            postedEffectOn = effectOn;
+        }
+    }
+}
+
+// Processes one piece of the audio callback's block, at most blockSize samples which is what the effect buffers hold
+DSP_HOT_TEXT static void ProcessAudioBlock(const float *const *in, float *const *out, size_t size, float &led1Brightness,
+                                           float &led2Brightness) {
+    // Get a handle to the persitance storage settings
+    Settings &settings = storage.GetSettings();
+
+    // Handle Mono vs Stereo, splitting the Mono Input to Stereo (Only allowed if relay bypass non enabled)
+    const bool splitMonoInputToStereo = settings.globalSplitMonoInputToStereo && !settings.globalRelayBypassEnabled;
+
+    for (size_t i = 0; i < size; i++) {
+        effectInputLeft[i] = in[0][i];
+        effectInputRight[i] = splitMonoInputToStereo ? in[0][i] : in[1][i];
+    }
+
+    const bool spillover = UsesBypassSpillover();
+
+    if (spillover) {
+        // Fade the effect input towards the bypass state, the effect keeps running so its tail rings out
+        const float target = audioEffectOn ? 1.0f : 0.0f;
+        const float step = 1.0f / crossFaderTransitionTimeInSamples;
+
+        for (size_t i = 0; i < size; i++) {
+            if (spilloverInputGain < target) {
+                spilloverInputGain = fminf(spilloverInputGain + step, target);
+            } else if (spilloverInputGain > target) {
+                spilloverInputGain = fmaxf(spilloverInputGain - step, target);
+            }
+
+            spilloverInputGainBlock[i] = spilloverInputGain;
+            effectInputLeft[i] *= spilloverInputGain;
+            effectInputRight[i] *= spilloverInputGain;
+        }
     } else {
-        hardware.SetAudioBypass(false);
-        hardware.SetAudioMute(false);
+        spilloverInputGain = audioEffectOn ? 1.0f : 0.0f;
     }
 
-    // Handle Effect State being Toggled.
-    if (effectOn != oldEffectOn) {
-        // Set the stats on the effect
-        if (activeEffect != nullptr) {
-            activeEffect->SetEnabled(effectOn);
+    // The active effect waits (silent) until the main loop has handed it its SDRAM, then fades in
+    if (audioEffect != nullptr && effectSwitchState != EffectSwitchState::Overlap && effectSwitchState != EffectSwitchState::FadeOut) {
+        if (!IsReadyToProcess(audioEffect)) {
+            effectSwitchState = EffectSwitchState::Wait;
+        } else if (effectSwitchState == EffectSwitchState::Wait) {
+            effectSwitchState = EffectSwitchState::FadeIn;
+            samplesTilEffectSwitchComplete = effectSwitchTimeInSamples;
         }
+    }
 
-        // Setup the crossfade
-        isCrossFading = true;
-        samplesTilCrossFadingComplete = crossFaderTransitionTimeInSamples;
-        isCrossFadingForward = effectOn;
+    // Only calculate the active effect when it's needed, otherwise the effect output is just the input signal.
+    // While switching without overlap the incoming effect waits for the outgoing effect to fade out.
+    const bool waitingForSwitch = effectSwitchState == EffectSwitchState::FadeOut || effectSwitchState == EffectSwitchState::Wait;
+    bool runEffect = audioEffect != nullptr && !waitingForSwitch && (audioEffectOn || isCrossFading || spillover);
+
+    if (runEffect && audioEffect->IsIdle() && BaseEffectModule::IsBlockSilent(effectInput, size)) {
+        // The input and the tail are silent, skip the processing until the input comes back
+        runEffect = false;
+        audioEffect->AcceptSuspendRequest();
+        BlockTrace::MarkTask(BlockTraceTask::IdleSkip);
+    } else if (!runEffect && audioEffect != nullptr) {
+        // The effect isn't processed while bypassed, so whatever it is holding is stale by the time it comes back
+        audioEffect->MarkIdle();
+        audioEffect->AcceptSuspendRequest();
+    }
+
+    if (runEffect) {
+        RT_SAFETY_SCOPE(audioEffect->GetName());
 
-        // Start the timing sequence for the Hardware Mute and Relay Bypass.
-        if (hardware.SupportsTrueBypass() && settings.globalRelayBypassEnabled) {
-            // Immediately Mute the Output using the Hardware Mute.
-            muteOn = true;
+        // Decode any parameter changes once for the block, then apply the Active Effect to the whole block
+        parametersProfile.Begin();
+        audioEffect->UpdateParameterSnapshot(size, maxParameterChangesPerBlock);
+        parametersProfile.End();
 
-            // Set the timing for when the bypass relay should trigger and when to unmute.
-            samplesTilMuteOff = muteOffTransitionTimeInSamples;
-            samplesTilBypassToggle = bypassToggleTransitionTimeInSamples;
+        if (audioEffect->IsSuspended()) {
+            // The main loop is loading a Model / IR into the effect, stay silent until it's done
+            for (size_t i = 0; i < size; i++) {
+                effectOutputLeft[i] = 0.0f;
+                effectOutputRight[i] = 0.0f;
+            }
+        } else {
+            effectProfile.Begin();
+            audioEffect->ProcessBlock(effectInput, effectOutput, size);
+            effectProfile.End();
+
+            audioEffect->RecordProcessingCost(effectProfile.GetBlockTicks());
+
+            audioEffect->UpdateIdleState(effectInput, effectOutput, size);
+        }
+
+        // Update state of the LEDs
+        led1Brightness = audioEffect->GetBrightnessForLED(0);
+        led2Brightness = audioEffect->GetBrightnessForLED(1);
+    } else {
+        for (size_t i = 0; i < size; i++) {
+            effectOutputLeft[i] = effectInputLeft[i];
+            effectOutputRight[i] = effectInputRight[i];
         }
     }
 
+    // Blend in the outgoing effect while switching effects
+    if (effectSwitchState != EffectSwitchState::None) {
+        ProcessEffectSwitch(size);
+    }
+
+    // Let the main loop know once nothing it stopped using is being processed anymore
+    if (outgoingEffect == nullptr && !selectionCommandPending) {
+        settledSelectionCount = receivedSelectionCount;
+    }
+
     for (size_t i = 0; i < size; i++) {
         if (isCrossFading) {
             float crossFadeFactor = (float)samplesTilCrossFadingComplete / (float)crossFaderTransitionTimeInSamples;
@@ -398,50 +966,55 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
 
             // Toggle the bypass when it's time (needs to be timed to happen while things are muted, or you get an audio pop)
             if (samplesTilBypassToggle < 0) {
-                bypassOn = !effectOn;
+                bypassOn = !audioEffectOn;
             }
         }
 
-        // Handle Mono vs Stereo
-        inputLeft = in[0][i];
-        inputRight = in[1][i];
-
-        // Split the Mono Input to Stereo (Only allowed if relay bypass non enabled)
-        if (settings.globalSplitMonoInputToStereo && !settings.globalRelayBypassEnabled) {
-            inputRight = inputLeft;
+        if (spillover) {
+            // The effect output (including its tail) plus the share of the dry signal handed back by the input fade
+            const float dryGain = 1.0f - spilloverInputGainBlock[i];
+            out[0][i] = effectOutputLeft[i] + dryGain * in[0][i];
+            out[1][i] = effectOutputRight[i] + dryGain * (splitMonoInputToStereo ? in[0][i] : in[1][i]);
+        } else {
+            // Master Crossfader, the source is always the input signal and the target is the effect
+            out[0][i] = crossFaderLeft.Process(effectInputLeft[i], effectOutputLeft[i]);
+            out[1][i] = crossFaderRight.Process(effectInputRight[i], effectOutputRight[i]);
         }
+    }
+}
 
-        // Setup Master Crossfader. By default source & target is always the input signal
-        float crossFadeSourceLeft = inputLeft;
-        float crossFadeSourceRight = inputRight;
-        float crossFadeTargetLeft = inputLeft;
-        float crossFadeTargetRight = inputRight;
-        float effectOutputLeft = inputLeft;
-        float effectOutputRight = inputRight;
+DSP_HOT_TEXT static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer out, size_t size) {
+    RT_SAFETY_SCOPE("AudioCallback");
+    cpuLoadMeter.OnBlockStart();
+    callbackProfile.Begin();
+    BlockTrace::BeginBlock();
 
-        // Only calculate the active effect when it's needed
-        if (activeEffect != nullptr && (effectOn || isCrossFading)) {
-            // Apply the Active Effect
-            if (hardware.SupportsStereo()) {
-                activeEffect->ProcessStereo(inputLeft, inputRight);
-            } else {
-                activeEffect->ProcessMono(inputLeft);
-            }
+    // Apply any pending commands from the main loop before touching the effect
+    ProcessAudioCommands();
 
-            effectOutputLeft = activeEffect->GetAudioLeft();
-            effectOutputRight = activeEffect->GetAudioRight();
+    // Default LEDs are off
+    float led1Brightness = 0.0f;
+    float led2Brightness = 0.0f;
 
-            // Update state of the LEDs
-            led1Brightness = activeEffect->GetBrightnessForLED(0);
-            led2Brightness = activeEffect->GetBrightnessForLED(1);
-        }
+    // Get a handle to the persitance storage settings
+    Settings &settings = storage.GetSettings();
 
-        // Setup the crossfade target to be the effect
-        crossFadeTargetLeft = effectOutputLeft;
-        crossFadeTargetRight = effectOutputRight;
+    // Handle updating the Hardware Bypass & Muting signals
+    if (hardware.SupportsTrueBypass() && settings.globalRelayBypassEnabled) {
+        hardware.SetAudioBypass(bypassOn);
+        hardware.SetAudioMute(muteOn);
+    } else {
+        hardware.SetAudioBypass(false);
+        hardware.SetAudioMute(false);
+    }
+
+    // The effect buffers are sized for the configured block size, a larger block is processed in pieces
+    for (size_t offset = 0; offset < size; offset += blockSize) {
+        const size_t pieceSize = size - offset < blockSize ? size - offset : blockSize;
+        const float *const pieceIn[2] = {in[0] + offset, in[1] + offset};
+        float *const pieceOut[2] = {out[0] + offset, out[1] + offset};
 
-        out[0][i] = crossFaderLeft.Process(crossFadeSourceLeft, crossFadeTargetLeft);
-        out[1][i] = crossFaderRight.Process(crossFadeSourceRight, crossFadeTargetRight);
+        ProcessAudioBlock(pieceIn, pieceOut, pieceSize, led1Brightness, led2Brightness);
     }
 
     // Override LEDs if we are saving the current settings
@@ -455,6 +1028,20 @@ static void AudioCallback(AudioHandle::InputBuffer in, AudioHandle::OutputBuffer
     hardware.SetLed(1, led2Brightness);
     hardware.UpdateLeds();
 
+    callbackProfile.End();
+    Profiler::EndBlock();
+
+    // Drop the effect to a cheaper quality tier on sustained deadline overruns, and try to restore it once there is headroom
+    const int qualityLevel = audioEffect != nullptr ? audioEffect->GetQualityLevel() : 0;
+    const int qualityLevelCount = audioEffect != nullptr ? audioEffect->GetQualityLevelCount() : 1;
+    const int qualityChange = overrunGovernor.Update(callbackProfile.GetLastTicks(), qualityLevel, qualityLevelCount);
+
+    if (qualityChange != 0) {
+        audioEffect->SetQualityLevel(qualityLevel + qualityChange);
+        BlockTrace::MarkTask(BlockTraceTask::QualityChange);
+    }
+
+    BlockTrace::EndBlock(audioEffect != nullptr ? audioEffect->GetName() : nullptr);
     cpuLoadMeter.OnBlockEnd();
 }
 
@@ -466,9 +1053,12 @@ void SetActiveEffect(int effectID) {
         // Update the ID cache
         activeEffectID = effectID;
 
-        // Update the Active Effect directly.
+        // Update the Active Effect for the control side, the audio callback switches over at the start of its next block
         activeEffect = availableEffects[effectID];
 
+        AudioCommand command = {AudioCommandType::SetActiveEffect, effectID, 0, 0.0f, 0.0f};
+        activeEffectChangePending = !PostSelectionCommand(command);
+
         guitarPedalUI.UpdateActiveEffect(effectID);
 
         // Get a handle to the persitance storage settings
@@ -481,6 +1071,260 @@ void SetActiveEffect(int effectID) {
     }
 }
 
+// Switches to a stored preset of an effect, making the effect active if it isn't
+static void RecallPreset(int effectID, uint32_t presetID) {
+    if (effectID < 0 || effectID >= availableEffectsCount || presetID >= availableEffects[effectID]->GetPresetCount()) {
+        return;
+    }
+
+    // Load the preset before switching to the effect, so the audio callback starts processing it with the preset's values
+    availableEffects[effectID]->SetCurrentPreset(presetID);
+    LoadPresetFromPersistentStorage(effectID, presetID);
+
+    if (effectID != activeEffectID) {
+        SetActiveEffect(effectID);
+    }
+
+    guitarPedalUI.UpdateActivePreset();
+}
+
+// Checks if the audio callback may be processing an effect, going by what the control side last sent it. The chain is
+// only processed while the active effect is one of its slots.
+static bool IsEffectInUse(const BaseEffectModule *effect) {
+    bool chainInUse = false;
+    bool inChain = false;
+
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        const int effectID = appliedEffectChain[i].effectID;
+
+        if (effectID != EffectChainModule::kEmptySlot) {
+            chainInUse = chainInUse || availableEffects[effectID] == activeEffect;
+            inChain = inChain || availableEffects[effectID] == effect;
+        }
+    }
+
+    return chainInUse ? inChain : effect == activeEffect;
+}
+
+// Checks if the audio callback has switched to the last effect selection it was sent, from then on it only processes
+// the effects that are in use
+static bool IsAudioSelectionSettled() {
+    return !activeEffectChangePending && !effectChainChangePending && settledSelectionCount == postedSelectionCount;
+}
+
+// Fills a block of the note CalibrateEffectCost measures the effects on, a plucked A2 with decaying harmonics like the
+// pedal-bench test signal. Silence would let effects skip their work (gates, idle tails, pitch trackers without a
+// pitch), so the cost would be underestimated. The right channel is slightly delayed so stereo effects don't see
+// identical channels.
+static void GenerateCalibrationBlock(int block, float *left, float *right) {
+    const float sampleRate = hardware.AudioSampleRate();
+    const float rightDelay = 7.0f / sampleRate;
+
+    for (size_t i = 0; i < blockSize; i++) {
+        const float t = static_cast<float>(block * blockSize + i) / sampleRate;
+        const float tRight = t > rightDelay ? t - rightDelay : 0.0f;
+        float sampleLeft = 0.0f;
+        float sampleRight = 0.0f;
+
+        for (int harmonic = 1; harmonic <= 4; harmonic++) {
+            sampleLeft += sinf(TWOPI_F * 110.0f * harmonic * t) * expf(-t * 4.0f * harmonic) / harmonic;
+            sampleRight += sinf(TWOPI_F * 110.0f * harmonic * tRight) * expf(-tRight * 4.0f * harmonic) / harmonic;
+        }
+
+        left[i] = 0.4f * sampleLeft;
+        right[i] = 0.4f * sampleRight;
+    }
+}
+
+// Measures an effect that hasn't been processed yet by running it on the start of a plucked note. The audio callback
+// interrupts the main loop, so the blocks it ran during are thrown away and the slowest of the others is kept (the
+// attack tends to be the most expensive part). If every block was interrupted the fastest of them is kept, which
+// still includes an audio callback so it errs on the high side. Only call for effects the audio callback isn't
+// processing and that hold their SDRAM. Returns false if the effect couldn't get its SDRAM back afterwards.
+static bool CalibrateEffectCost(BaseEffectModule *effect) {
+    static float calibrationInputLeft[blockSize];
+    static float calibrationInputRight[blockSize];
+    static float calibrationOutputLeft[blockSize];
+    static float calibrationOutputRight[blockSize];
+    const float *const calibrationInput[2] = {calibrationInputLeft, calibrationInputRight};
+    float *const calibrationOutput[2] = {calibrationOutputLeft, calibrationOutputRight};
+
+    // The audio callback isn't processing the effect, so its Model / IR changes can be made straight away
+    effect->ProcessControlParameterChanges(false);
+
+    // Some effects skip their processing while bypassed
+    const bool wasEnabled = effect->IsEnabled();
+    effect->SetEnabled(true);
+
+    uint32_t slowestTicks = 0;
+    uint32_t fastestInterruptedTicks = UINT32_MAX;
+    int measuredBlocks = 0;
+
+    for (int i = 0; i < effectCalibrationMaxBlocks && measuredBlocks < effectCalibrationBlocks; i++) {
+        GenerateCalibrationBlock(i, calibrationInputLeft, calibrationInputRight);
+
+        const uint32_t audioBlockCount = BlockTrace::GetBlockCount();
+        const uint32_t startTicks = Profiler::Now();
+        effect->UpdateParameterSnapshot(blockSize, maxParameterChangesPerBlock);
+        effect->ProcessBlock(calibrationInput, calibrationOutput, blockSize);
+        const uint32_t ticks = Profiler::Now() - startTicks;
+
+        if (BlockTrace::GetBlockCount() != audioBlockCount) {
+            // The audio callback ran in the middle of the block
+            fastestInterruptedTicks = ticks < fastestInterruptedTicks ? ticks : fastestInterruptedTicks;
+        } else {
+            slowestTicks = ticks > slowestTicks ? ticks : slowestTicks;
+            measuredBlocks++;
+        }
+    }
+
+    effect->RecordProcessingCost(measuredBlocks > 0 ? slowestTicks : fastestInterruptedTicks);
+    effect->SetEnabled(wasEnabled);
+    effect->MarkIdle();
+
+    // The note is still ringing in the effect's delay lines and tanks, start them over so it isn't heard as a ghost tail
+    // once the chain runs the effect. Acquiring again clears the buffers and delivers every parameter again.
+    effect->ReleaseResources(sdramArena);
+    return effect->AcquireResources(sdramArena);
+}
+
+// Checks a chain before it is sent to the audio callback, rejecting chains that don't fit in the audio block deadline
+static bool IsEffectChainValid(const EffectChainModule::Slot *slots) {
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        if (slots[i].effectID == EffectChainModule::kEmptySlot) {
+            continue;
+        }
+
+        // An effect holds a single set of state, so it can only be in one slot
+        for (int j = 0; j < i; j++) {
+            if (slots[j].effectID == slots[i].effectID) {
+                return false;
+            }
+        }
+
+        BaseEffectModule *effect = availableEffects[slots[i].effectID];
+
+        if (!slots[i].bypassed && effect->GetProcessingCostTicks() == 0 && !IsEffectInUse(effect)) {
+            // The effect needs its SDRAM to run, which is given back by the main loop once the chain is applied (or not)
+            if (!IsAudioSelectionSettled() || !effect->AcquireResources(sdramArena)) {
+                return false;
+            }
+
+            if (!CalibrateEffectCost(effect)) {
+                return false;
+            }
+        }
+    }
+
+    return effectChain.EstimateCostTicks(slots) <= effectChainMaxLoad * Profiler::GetBlockBudgetTicks();
+}
+
+// Sends a chain to the audio callback and stores it in the settings, without checking it
+static void PostEffectChain(const EffectChainModule::Slot *slots) {
+    Settings &settings = storage.GetSettings();
+    int firstEffectID = EffectChainModule::kEmptySlot;
+    bool holdsActiveEffect = false;
+
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        appliedEffectChain[i] = slots[i];
+        settings.globalEffectChain[i] = slots[i].effectID;
+        settings.globalEffectChainSlotEnabled[i] = !slots[i].bypassed;
+
+        if (slots[i].effectID != EffectChainModule::kEmptySlot) {
+            firstEffectID = firstEffectID == EffectChainModule::kEmptySlot ? slots[i].effectID : firstEffectID;
+            holdsActiveEffect = holdsActiveEffect || slots[i].effectID == activeEffectID;
+        }
+    }
+
+    // The chain is only processed while the active effect is one of its slots, so select its first effect if needed
+    const int effectID = holdsActiveEffect || firstEffectID == EffectChainModule::kEmptySlot ? activeEffectID : firstEffectID;
+
+    AudioCommand command = {AudioCommandType::SetEffectChain, effectID, EffectChainModule::PackSlots(appliedEffectChain), 0.0f, 0.0f};
+    effectChainChangePending = !PostSelectionCommand(command);
+
+    if (effectID != activeEffectID) {
+        SetActiveEffect(effectID);
+    }
+}
+
+// Sends a new chain to the audio callback and stores it in the settings
+static bool ApplyEffectChain(const EffectChainModule::Slot *slots) {
+    if (!IsEffectChainValid(slots)) {
+        return false;
+    }
+
+    PostEffectChain(slots);
+    return true;
+}
+
+// Hands the SDRAM to the effects that are in use. Memory is only moved once the audio callback has settled on the last
+// selection, so it is never taken from an effect that is still fading out, and everything that is no longer in use is
+// given back first so the incoming effects get all of it.
+static void UpdateEffectResources() {
+    static const BaseEffectModule *failedEffect = nullptr;
+
+    if (!IsAudioSelectionSettled()) {
+        return;
+    }
+
+    for (int i = 0; i < availableEffectsCount; i++) {
+        if (availableEffects[i]->HasResources() && !IsEffectInUse(availableEffects[i])) {
+            availableEffects[i]->ReleaseResources(sdramArena);
+        }
+    }
+
+    for (int i = 0; i < availableEffectsCount; i++) {
+        BaseEffectModule *effect = availableEffects[i];
+
+        if (!IsEffectInUse(effect) || effect->AcquireResources(sdramArena)) {
+            continue;
+        }
+
+        // Everything else has been given back, so the chain doesn't fit in the SDRAM. Take the effect out of the chain,
+        // an effect on its own stays silent until another one is selected.
+        if (effect != failedEffect && useProfilerLog) {
+            hardware.seed.PrintLine("Not enough SDRAM for %s", effect->GetName());
+        }
+
+        failedEffect = effect;
+
+        EffectChainModule::Slot slots[EffectChainModule::kMaxSlots];
+        bool inChain = false;
+
+        for (int j = 0; j < EffectChainModule::kMaxSlots; j++) {
+            const bool failedSlot = appliedEffectChain[j].effectID == i;
+            slots[j] = failedSlot ? EffectChainModule::Slot{EffectChainModule::kEmptySlot, false} : appliedEffectChain[j];
+            inChain = inChain || failedSlot;
+        }
+
+        if (inChain) {
+            PostEffectChain(slots);
+
+            if (hardware.SupportsDisplay()) {
+                guitarPedalUI.UpdateEffectChain();
+            }
+        }
+
+        return;
+    }
+
+    failedEffect = nullptr;
+}
+
+// Delivers the parameter changes the effects handle on the main loop (loading Models and IRs), an effect the audio
+// callback may be processing is suspended first so it takes a few passes
+static void ProcessControlParameterChanges() {
+    const bool selectionSettled = IsAudioSelectionSettled();
+
+    for (int i = 0; i < availableEffectsCount; i++) {
+        BaseEffectModule *effect = availableEffects[i];
+        effect->ProcessControlParameterChanges(!selectionSettled || IsEffectInUse(effect));
+    }
+}
+
+// Called by the settings storage once everything saved so far is in the flash
+void SettingsSaved(bool success, void *context) { guitarPedalUI.SettingsSaved(); }
+
 // Typical Switch case for Message Type.
 void HandleMidiMessage(MidiEvent m) {
     if (!hardware.SupportsMidi()) {
@@ -523,21 +1367,22 @@ void HandleMidiMessage(MidiEvent m) {
 
     switch (m.type) {
     case NoteOn: {
-        if (activeEffect != NULL) {
-            NoteOnEvent p = m.AsNoteOn();
-            activeEffect->OnNoteOn(p.note, p.velocity);
-        }
+        NoteOnEvent p = m.AsNoteOn();
+        AudioCommand command = {AudioCommandType::NoteOn, activeEffectID, 0, (float)p.note, (float)p.velocity};
+        PostAudioCommand(command);
         break;
     }
     case NoteOff: {
-        if (activeEffect != NULL) {
-            NoteOnEvent p = m.AsNoteOn();
-            activeEffect->OnNoteOff(p.note, p.velocity);
-        }
+        NoteOnEvent p = m.AsNoteOn();
+        AudioCommand command = {AudioCommandType::NoteOff, activeEffectID, 0, (float)p.note, (float)p.velocity};
+        PostAudioCommand(command);
         break;
     }
     case ControlChange: {
-        if (activeEffect != nullptr) {
+        if (m.data[0] == midiBankSelectCC) {
+            // Takes effect with the next Program Change
+            midiBank = m.data[1];
+        } else if (activeEffect != nullptr) {
             ControlChangeEvent p = m.AsControlChange();
 
             // Notify the activeEffect to handle this midi cc / value
@@ -555,7 +1400,9 @@ void HandleMidiMessage(MidiEvent m) {
     case ProgramChange: {
         ProgramChangeEvent p = m.AsProgramChange();
 
-        if (p.program >= 0 && p.program < availableEffectsCount) {
+        if (midiBank > 0) {
+            RecallPreset(midiBank - 1, p.program);
+        } else if (p.program >= 0 && p.program < availableEffectsCount) {
             SetActiveEffect(p.program);
         }
         break;
@@ -565,8 +1412,44 @@ void HandleMidiMessage(MidiEvent m) {
     }
 }
 
+#if defined(EMULATOR_TEST)
+// Runs the firmware on audio from the emulator instead of the codec, see Util/emulator_test.h. The effect the test script
+// asked for is selected and switched on the way the controls would do it, then the audio callback processes the input a
+// block at a time with the main loop's SDRAM handling in between. Never returns.
+static void RunEmulatorTest() {
+    static float inputLeft[blockSize];
+    static float inputRight[blockSize];
+    static float outputLeft[blockSize];
+    static float outputRight[blockSize];
+    const float *const in[2] = {inputLeft, inputRight};
+    float *out[2] = {outputLeft, outputRight};
+
+    SetActiveEffect(EmulatorTest::GetEffectID());
+    effectOn = true;
+
+    AudioCommand command = {AudioCommandType::SetEffectEnabled, activeEffectID, 1U, 0.0f, 0.0f};
+    postedEffectOn = PostAudioCommand(command);
+
+    // Let the effect switch and the bypass fade finish on silence, they aren't measured
+    for (uint32_t i = 0; i < EmulatorTest::GetWarmupBlockCount(); i++) {
+        AudioCallback(in, out, blockSize);
+        UpdateEffectResources();
+        ProcessControlParameterChanges();
+    }
+
+    while (EmulatorTest::ReadBlock(inputLeft, inputRight, blockSize)) {
+        EmulatorTest::BeginBlock();
+        AudioCallback(in, out, blockSize);
+        EmulatorTest::EndBlock(outputLeft, outputRight, blockSize);
+        UpdateEffectResources();
+        ProcessControlParameterChanges();
+    }
+
+    EmulatorTest::Finish();
+}
+#endif
+
 int main(void) {
-    const size_t blockSize = 48;
     const bool boost = true; // true enables cpu boost (480Mhz instead of 400Mhz)
 
     hardware.Init(blockSize, boost);
@@ -575,17 +1458,22 @@ int main(void) {
 
     // Setup CPU logging of the audio callback
     cpuLoadMeter.Init(sample_rate, blockSize);
+    Profiler::Init(sample_rate, blockSize);
+    overrunGovernor.Init(Profiler::GetBlockBudgetTicks(), static_cast<uint32_t>(hardware.AudioCallbackRate()));
 
     // Set the number of samples to use for the crossfade based on the hardware sample rate
     muteOffTransitionTimeInSamples = hardware.GetNumberOfSamplesForTime(muteOffTransitionTimeInSeconds);
     bypassToggleTransitionTimeInSamples = hardware.GetNumberOfSamplesForTime(bypassToggleTransitionTimeInSeconds);
     crossFaderTransitionTimeInSamples = hardware.GetNumberOfSamplesForTime(crossFaderTransitionTimeInSeconds);
+    effectSwitchTimeInSamples = hardware.GetNumberOfSamplesForTime(effectSwitchTimeInSeconds);
 
-    // Init the Effects Modules
+    // Init the Effects Modules, only their parameters are set up here, the heavy setup waits until they are used
+    const uint32_t effectsInitStartUS = System::GetUs();
     load_effects(availableEffectsCount, availableEffects);
 
     for (int i = 0; i < availableEffectsCount; i++) {
         availableEffects[i]->Init(sample_rate);
+        availableEffects[i]->SetStereoProcessing(hardware.SupportsStereo());
 
         if (std::string(availableEffects[i]->GetName()) == std::string("Tuner")) {
             // Store the index for the tuner module so that we can quickswitch
@@ -594,6 +1482,8 @@ int main(void) {
         }
     }
 
+    const uint32_t effectsInitTimeUS = System::GetUs() - effectsInitStartUS;
+
     // Initalize Persistance Storage
     InitPersistantStorage();
 
@@ -602,16 +1492,33 @@ int main(void) {
     // Load all the effect specific settings
     LoadEffectSettingsFromPersistantStorage();
 
+    // Restore the effect chain, it was checked against the audio block deadline when it was configured
+    effectChain.Init(sample_rate);
+    effectChain.SetAvailableEffects(availableEffects, availableEffectsCount, maxParameterChangesPerBlock);
+
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        appliedEffectChain[i] = {settings.globalEffectChain[i], !settings.globalEffectChainSlotEnabled[i]};
+    }
+
+    effectChain.SetSlots(appliedEffectChain);
+
+    for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+        appliedEffectChain[i] = effectChain.GetSlot(i);
+    }
+
     // Set the active effect
     activeEffect = availableEffects[settings.globalActiveEffectID];
     activeEffectID = settings.globalActiveEffectID;
-    activeEffect->SetEnabled(effectOn);
+    audioEffect = effectChain.ContainsEffect(activeEffect) ? &effectChain : activeEffect;
+    audioEffect->SetEnabled(effectOn);
 
     // Init the Menu UI System
     if (hardware.SupportsDisplay()) {
         guitarPedalUI.Init();
     }
 
+    storage.SetSaveCallback(&SettingsSaved, nullptr);
+
     // Set up midi if supported.
     if (hardware.SupportsMidi()) {
         hardware.midi.StartReceive();
@@ -646,15 +1553,52 @@ int main(void) {
     crossFaderLeft.SetPos(0.0f);
     crossFaderRight.SetPos(0.0f);
 
+    // Setup the effect switch faders, constant power since the two effects aren't correlated
+    effectSwitchFaderLeft.Init(CROSSFADE_CPOW);
+    effectSwitchFaderRight.Init(CROSSFADE_CPOW);
+
+    // Resolve the switches used for special functions once instead of on every control tick
+    bypassSwitchID = hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Bypass);
+    alternateSwitchID = hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate);
+
+    // The knobs are filtered by the control rate task now, not once per audio block. This is the nominal rate,
+    // UpdateKnobFilterRate follows the actual one.
+    for (int i = 0; i < hardware.GetKnobCount(); i++) {
+        hardware.knobs[i].SetSampleRate(controlRateHz);
+    }
+
+    // Hand the SDRAM to the effects the audio callback starts with
+    const uint32_t resourcesStartUS = System::GetUs();
+    sdramArena.Init(sdramArenaMemory, sizeof(sdramArenaMemory));
+    UpdateEffectResources();
+    const uint32_t resourcesTimeUS = System::GetUs() - resourcesStartUS;
+
     // start callback
     hardware.StartAdc();
+
+#if defined(EMULATOR_TEST)
+    if (EmulatorTest::IsPresent()) {
+        RunEmulatorTest();
+    }
+#endif
+
     hardware.StartAudio(AudioCallback);
 
+    // Time since the system clock started, the hardware setup before it isn't included
+    const uint32_t bootToAudioTimeUS = System::GetUs();
+
     // Set initial time stamp
     lastTimeStampUS = System::GetUs();
+    lastControlTimeStampUS = lastTimeStampUS;
 
     // Setup Debug Logging
     // hardware.seed.StartLog();
+    if (useProfilerLog) {
+        hardware.seed.StartLog();
+        hardware.seed.PrintLine("Boot to audio: %lu ms (effects init %lu ms, resources %lu ms)",
+                                (unsigned long)(bootToAudioTimeUS / 1000), (unsigned long)(effectsInitTimeUS / 1000),
+                                (unsigned long)(resourcesTimeUS / 1000));
+    }
 
     while (1) {
         // Handle Clock Time
@@ -686,18 +1630,56 @@ int main(void) {
             }
         }
 
+        // Run the control rate task, catching up on the elapsed time if the loop was held up (ex. by a display update)
+        if (currentTimeStampUS - lastControlTimeStampUS >= controlPeriodUS) {
+            const uint32_t elapsedControlTimeUS = currentTimeStampUS - lastControlTimeStampUS;
+            lastControlTimeStampUS = currentTimeStampUS;
+            UpdateKnobFilterRate(elapsedControlTimeUS);
+            ProcessControls(hardware.GetNumberOfSamplesForTime(elapsedControlTimeUS / 1000000.0f));
+        }
+
+        // Retry telling the audio callback about an effect change if the command queue was full
+        if (activeEffectChangePending) {
+            AudioCommand command = {AudioCommandType::SetActiveEffect, activeEffectID, 0, 0.0f, 0.0f};
+            activeEffectChangePending = !PostSelectionCommand(command);
+        }
+
+        if (effectChainChangePending) {
+            const uint32_t packedSlots = EffectChainModule::PackSlots(appliedEffectChain);
+            AudioCommand command = {AudioCommandType::SetEffectChain, activeEffectID, packedSlots, 0.0f, 0.0f};
+            effectChainChangePending = !PostSelectionCommand(command);
+        }
+
+        // Move the SDRAM over to the effects that are now in use
+        UpdateEffectResources();
+
+        // Load the Models / IRs that were selected since the last pass
+        ProcessControlParameterChanges();
+
+        // Run the one time setup of the other effects ahead of time, one per pass so the controls stay responsive
+        if (nextEffectToPrepare < availableEffectsCount) {
+            availableEffects[nextEffectToPrepare++]->PrepareResources();
+        }
+
         // Handle Global Tempo Changes
         if (needToChangeTempo) {
-            activeEffect->SetTempo(globalTempoBPM);
-            needToChangeTempo = false;
+            AudioCommand command = {AudioCommandType::SetTempo, activeEffectID, globalTempoBPM, 0.0f, 0.0f};
+
+            // Keep the request around if the queue is full and try again next time through the loop
+            if (PostAudioCommand(command)) {
+                needToChangeTempo = false;
+            }
+        }
+
+        if (tempoAppliedToEffect) {
+            tempoAppliedToEffect = false;
 
             // Update the effect parameters on the menu system to reflect any changes
             guitarPedalUI.UpdateActiveEffectParameterValues();
         }
 
         // If alt footswitch held AND encoder turned, iterate to next/previous effect, also throttle the changes
-        if (hardware.SupportsEncoder() && has_alternate_footswitch &&
-            hardware.switches[hardware.GetPreferredSwitchIDForSpecialFunctionType(SpecialFunctionType::Alternate)].Pressed() &&
+        if (hardware.SupportsEncoder() && has_alternate_footswitch && hardware.switches[alternateSwitchID].Pressed() &&
             System::GetNow() - last_effect_change_time >= 10) {
             const int encoderIncrement = hardware.encoders[0].Increment();
             if (encoderIncrement != 0) {
@@ -722,6 +1704,25 @@ int main(void) {
             if (activeEffect != selectedEffect) {
                 SetActiveEffect(menuEffectID);
             }
+
+            // Handle a change to the Effect Chain from the Menu System, a chain that is rejected is put back the way it was
+            EffectChainModule::Slot menuEffectChain[EffectChainModule::kMaxSlots];
+            bool effectChainChanged = false;
+
+            for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+                menuEffectChain[i] = {guitarPedalUI.GetEffectChainSlotFromSettingsMenu(i), !settings.globalEffectChainSlotEnabled[i]};
+                effectChainChanged = effectChainChanged || menuEffectChain[i].effectID != appliedEffectChain[i].effectID ||
+                                     menuEffectChain[i].bypassed != appliedEffectChain[i].bypassed;
+            }
+
+            if (effectChainChanged && !ApplyEffectChain(menuEffectChain)) {
+                for (int i = 0; i < EffectChainModule::kMaxSlots; i++) {
+                    settings.globalEffectChain[i] = appliedEffectChain[i].effectID;
+                    settings.globalEffectChainSlotEnabled[i] = !appliedEffectChain[i].bypassed;
+                }
+
+                guitarPedalUI.UpdateEffectChain();
+            }
         }
 
         // Set the latest cpu load to the effect
@@ -729,12 +1730,35 @@ int main(void) {
 
         // Handle Display
         if (hardware.SupportsDisplay()) {
-            if (useDebugDisplay) {
+            if (useProfilerDisplay) {
+                // Profiler page shows the average and max cost of each stage as a % of the audio block budget
+                char strbuff[32];
+                hardware.display.Fill(false);
+                hardware.display.SetCursor(0, 0);
+                hardware.display.WriteString("Stage     Avg%  Max%", Font_6x8, true);
+
+                int y = 10;
+                for (ProfilerStage *stage = Profiler::GetFirstStage(); stage != nullptr && y <= 55; stage = stage->GetNext()) {
+                    // Skip the stages of effects that haven't been run
+                    if (stage->GetBlockCount() == 0) {
+                        continue;
+                    }
+
+                    Profiler::FormatStageSummary(*stage, strbuff, sizeof(strbuff));
+                    hardware.display.SetCursor(0, y);
+                    hardware.display.WriteString(strbuff, Font_6x8, true);
+                    y += 9;
+                }
+                hardware.display.Update();
+            } else if (useTraceDisplay) {
+                DrawBlockTrace();
+            } else if (useDebugDisplay) {
                 // Debug Display hijacks the display to simply output text
                 char strbuff[128];
                 hardware.display.Fill(false);
                 hardware.display.SetCursor(0, 0);
-                hardware.display.WriteString("Debug:", Font_7x10, true);
+                sprintf(strbuff, "Ovr %lu Q %d", (unsigned long)overrunGovernor.GetOverrunCount(), activeEffect->GetQualityLevel());
+                hardware.display.WriteString(strbuff, Font_7x10, true);
                 hardware.display.SetCursor(0, 15);
                 sprintf(strbuff, "tap: %d", switchEnabledCache[1]);
                 hardware.display.WriteString(strbuff, Font_7x10, true);
@@ -751,12 +1775,48 @@ int main(void) {
             }
         }
 
+        // Log the profiler statistics
+        if (useProfilerLog && System::GetNow() - lastProfilerLogTime >= 1000) {
+            char strbuff[128];
+
+            for (ProfilerStage *stage = Profiler::GetFirstStage(); stage != nullptr; stage = stage->GetNext()) {
+                if (stage->GetBlockCount() > 0) {
+                    Profiler::FormatStageDetail(*stage, strbuff, sizeof(strbuff));
+                    hardware.seed.PrintLine("%s", strbuff);
+                }
+            }
+
+            sdramArena.FormatSummary(strbuff, sizeof(strbuff));
+            hardware.seed.PrintLine("%s", strbuff);
+
+            // The worst block of the last second, with what else ran in it
+            const BlockTraceRecord worstBlock = BlockTrace::GetWorstBlock();
+            BlockTrace::RequestReset();
+            const uint64_t worstBlockStartUs =
+                static_cast<uint64_t>(worstBlock.block) * blockSize * 1000000 / static_cast<uint32_t>(sample_rate);
+            BlockTrace::FormatCsvRecord(worstBlock, static_cast<uint32_t>(worstBlockStartUs), strbuff, sizeof(strbuff));
+            hardware.seed.PrintLine("Worst block: %s", strbuff);
+
+#if defined(RT_SAFETY_CHECK)
+            RtSafety::FormatSummary(strbuff, sizeof(strbuff));
+            hardware.seed.PrintLine("%s", strbuff);
+#endif
+
+            for (int i = 0; i < sdramArena.GetOwnerCount(); i++) {
+                sdramArena.FormatOwnerReport(i, strbuff, sizeof(strbuff));
+                hardware.seed.PrintLine("%s", strbuff);
+            }
+
+            lastProfilerLogTime = System::GetNow();
+        }
+
         // Handle MIDI Events
         if (hardware.SupportsMidi() && settings.globalMidiEnabled) {
             hardware.midi.Listen();
 
             while (hardware.midi.HasEvents()) {
                 HandleMidiMessage(hardware.midi.PopEvent());
+                lastMidiMessageTime = System::GetNow();
             }
         }
 
@@ -771,5 +1831,12 @@ int main(void) {
             last_save_time = System::GetNow();
             needToSaveSettingsForActiveEffect = false;
         }
+
+        // Write the next page of a save (or erase the next sector) so the loop is never held up by a whole save. The audio
+        // blocks that run meanwhile are marked in the trace, the flash keeps the QSPI bus busy.
+        const bool saving = storage.IsSaving();
+        BlockTrace::SetBackgroundTask(BlockTraceTask::Storage, saving);
+        storage.Process(System::GetNow() - lastMidiMessageTime >= SETTINGS_ERASE_QUIET_TIME);
+        BlockTrace::SetBackgroundTask(BlockTraceTask::Storage, false);
     }
 }
@@ -1,11 +1,13 @@
 #include "guitar_pedal_storage.h"
 #include "Effect-Modules/base_effect_module.h"
+#include "Effect-Modules/effect_chain_module.h"
 
 using namespace bkshepherd;
 
-extern PersistentStorage<Settings> storage;
+extern SettingsStorage storage;
 extern int availableEffectsCount;
 extern BaseEffectModule **availableEffects;
+extern const uint32_t selectedEffectsHash;
 extern int activeEffectID;
 extern BaseEffectModule *activeEffect;
 
@@ -13,6 +15,11 @@ extern BaseEffectModule *activeEffect;
 static constexpr uint32_t offset_basis = 2166136261u;
 static constexpr uint32_t FNV_prime = 16777619u;
 
+// The journal copies a save here while it is written to the flash, up to a whole snapshot
+static uint8_t DSY_SDRAM_BSS settingsJournalBuffer[SETTINGS_JOURNAL_BANK_SIZE];
+
+static_assert(SETTINGS_EFFECT_CHAIN_SLOT_COUNT == EffectChainModule::kMaxSlots, "The stored chain must match the chain slots");
+
 static inline uint32_t HashLayoutValue(uint32_t hash, uint32_t value) {
     // One FNV-1a round: xor in the new value, then multiply by FNV prime.
     return (hash ^ value) * FNV_prime;
@@ -20,18 +27,11 @@ static inline uint32_t HashLayoutValue(uint32_t hash, uint32_t value) {
 
 static uint32_t ComputeCurrentEffectsLayoutHash() {
     // Build a compact fingerprint of the *current* effect layout.
-    // If effect list/order/param types change, this hash changes too.
-    uint32_t hash = offset_basis;
+    // The effect list and order are hashed at compile time, if they or the param types change, this hash changes too.
+    uint32_t hash = HashLayoutValue(offset_basis, selectedEffectsHash);
     hash = HashLayoutValue(hash, static_cast<uint32_t>(availableEffectsCount));
 
     for (int effectID = 0; effectID < availableEffectsCount; effectID++) {
-        const char *effectName = availableEffects[effectID]->GetName();
-        while (*effectName != '\0') {
-            hash = HashLayoutValue(hash, static_cast<uint32_t>(static_cast<unsigned char>(*effectName)));
-            ++effectName;
-        }
-        hash = HashLayoutValue(hash, 0xffU);
-
         const uint32_t paramCount = static_cast<uint32_t>(availableEffects[effectID]->GetParameterCount());
         hash = HashLayoutValue(hash, paramCount);
 
@@ -43,20 +43,20 @@ static uint32_t ComputeCurrentEffectsLayoutHash() {
     return hash;
 }
 
-uint32_t GetDefaultTotalIdxOfGlobalSettingsBlock() {
-    uint32_t tempSize = 0;
-
-    for (int effectID = 0; effectID < availableEffectsCount; effectID++) {
-        int paramCount = availableEffects[effectID]->GetParameterCount();
-        // Reserve 2 words for Num of Presets and Num of Parameters
-        tempSize += 2 + paramCount;
+// Gets a parameter value as it is stored in the settings, floats are stored as their bits
+static uint32_t GetStoredParameterValue(int effectID, int paramID) {
+    if (availableEffects[effectID]->GetParameterType(paramID) == ParameterValueType::Float) {
+        uint32_t tmp;
+        float f = availableEffects[effectID]->GetParameterAsFloat(paramID);
+        std::memcpy(&tmp, &f, sizeof(float));
+        return tmp;
     }
-    return tempSize;
+
+    return availableEffects[effectID]->GetParameterRaw(paramID);
 }
+
 void InitPersistantStorage() {
     Settings defaultSettings;
-    defaultSettings.fileFormatVersion = SETTINGS_FILE_FORMAT_VERSION;
-    defaultSettings.globalEffectsLayoutHash = ComputeCurrentEffectsLayoutHash();
     defaultSettings.globalActiveEffectID = 0;
     defaultSettings.globalMidiEnabled = true;
     defaultSettings.globalMidiChannel = 1;
@@ -64,252 +64,128 @@ void InitPersistantStorage() {
     defaultSettings.globalRelayBypassEnabled = false;
     defaultSettings.globalSplitMonoInputToStereo = true;
 
-    // All Effect Params in the settings should be zero'd
-    for (int i = 0; i < SETTINGS_ABSOLUTE_MAX_PARAM_COUNT; i++) {
-        defaultSettings.globalEffectsSettings[i] = 0;
+    // The chain starts out empty
+    for (int i = 0; i < SETTINGS_EFFECT_CHAIN_SLOT_COUNT; i++) {
+        defaultSettings.globalEffectChain[i] = EffectChainModule::kEmptySlot;
+        defaultSettings.globalEffectChainSlotEnabled[i] = true;
     }
 
-    uint32_t globalEffectsSettingMemIdx = 0U;
-    defaultSettings.globalEffectsSettings[globalEffectsSettingMemIdx] = GetDefaultTotalIdxOfGlobalSettingsBlock();
-    ++globalEffectsSettingMemIdx;
+    // One preset per effect with the effect specific default settings
+    PresetDirectory defaultPresets;
 
-    // Override any defaults with effect specific default settings
     for (int effectID = 0; effectID < availableEffectsCount; effectID++) {
-        int paramCount = availableEffects[effectID]->GetParameterCount();
-        // Change first word of each effect such that this is total number of presets
-        // Default value: 1
-        defaultSettings.globalEffectsSettings[globalEffectsSettingMemIdx] = 1U;
-        ++globalEffectsSettingMemIdx;
-
-        // Next word is going to be the number of parameters
-        defaultSettings.globalEffectsSettings[globalEffectsSettingMemIdx] = paramCount;
-        ++globalEffectsSettingMemIdx;
+        const int paramCount = availableEffects[effectID]->GetParameterCount();
+        defaultPresets.AddEffect(paramCount);
+        defaultPresets.AddPreset(effectID);
 
+        uint32_t *values = defaultPresets.GetValues(effectID, 0);
         for (int paramID = 0; paramID < paramCount; paramID++) {
-            // Floats are handled special (stored into the u_int32_t bytes)
-            if (availableEffects[effectID]->GetParameterType(paramID) == ParameterValueType::Float) {
-                uint32_t tmp;
-                float f = availableEffects[effectID]->GetParameterAsFloat(paramID);
-                std::memcpy(&tmp, &f, sizeof(float));
-                defaultSettings.globalEffectsSettings[globalEffectsSettingMemIdx] = tmp;
-            } else {
-                defaultSettings.globalEffectsSettings[globalEffectsSettingMemIdx] =
-                    availableEffects[effectID]->GetParameterRaw(paramID);
-            }
-
-            ++globalEffectsSettingMemIdx;
+            values[paramID] = GetStoredParameterValue(effectID, paramID);
         }
     }
 
-    storage.Init(defaultSettings);
+    // Saved settings are only replayed if they match the current storage schema/layout.
+    const uint32_t tag = HashLayoutValue(ComputeCurrentEffectsLayoutHash(), SETTINGS_FILE_FORMAT_VERSION);
+    storage.Init(defaultSettings, defaultPresets, tag);
 
     Settings &settings = storage.GetSettings();
 
-    // Reset defaults if persisted data does not match the current storage schema/layout.
-    if (settings.fileFormatVersion != SETTINGS_FILE_FORMAT_VERSION ||
-        settings.globalEffectsLayoutHash != defaultSettings.globalEffectsLayoutHash) {
-        storage.RestoreDefaults();
-    }
-
     // Make sure the settings active effect is within the proper range.
     if (settings.globalActiveEffectID < 0 || settings.globalActiveEffectID >= availableEffectsCount) {
         settings.globalActiveEffectID = 0;
     }
-}
-
-uint32_t ShiftSettingsToMatchCurrentParameters(uint32_t prev_params, uint32_t curr_params, uint32_t effectID, uint32_t presetsCount,
-                                               uint32_t shiftStartIdx, uint32_t currentMaxIdx) {
-    uint32_t newMaxIdx = currentMaxIdx;
-    Settings &settings = storage.GetSettings();
-
-    newMaxIdx += presetsCount * (curr_params - prev_params);
-    if (newMaxIdx <= SETTINGS_ABSOLUTE_MAX_PARAM_COUNT) {
-        if (curr_params > prev_params) {
-            uint32_t diff = newMaxIdx - currentMaxIdx;
-            for (uint32_t i = newMaxIdx; i >= shiftStartIdx; --i) {
-                settings.globalEffectsSettings[i] = settings.globalEffectsSettings[i - diff];
-            }
-        } else {
-            uint32_t diff = currentMaxIdx - newMaxIdx;
-            for (uint32_t i = shiftStartIdx; i < newMaxIdx; ++i) {
-                settings.globalEffectsSettings[i] = settings.globalEffectsSettings[i + diff];
-            }
-            // Clear words up until the last maximum
-            for (uint32_t i = newMaxIdx; i <= currentMaxIdx; ++i) {
-                settings.globalEffectsSettings[i] = 0;
-            }
-        }
-    } else {
-        newMaxIdx = ERR_VALUE_MAX;
-    }
-
-    return newMaxIdx;
-}
 
-uint32_t ShiftSettingsToAddNewPreset(int effectID, uint32_t params, uint32_t shiftStartIdx, uint32_t currentMaxIdx) {
-    uint32_t newMaxIdx = currentMaxIdx;
-    Settings &settings = storage.GetSettings();
-
-    newMaxIdx += params;
-    if (newMaxIdx <= SETTINGS_ABSOLUTE_MAX_PARAM_COUNT) {
-        uint32_t diff = newMaxIdx - currentMaxIdx;
-        for (uint32_t i = newMaxIdx; i >= shiftStartIdx; --i) {
-            settings.globalEffectsSettings[i] = settings.globalEffectsSettings[i - diff];
+    // Make sure the effect chain only refers to effects that exist
+    for (int i = 0; i < SETTINGS_EFFECT_CHAIN_SLOT_COUNT; i++) {
+        if (settings.globalEffectChain[i] < 0 || settings.globalEffectChain[i] >= availableEffectsCount) {
+            settings.globalEffectChain[i] = EffectChainModule::kEmptySlot;
         }
-        for (uint32_t i = effectID + 1; i < (uint32_t)availableEffectsCount; ++i) {
-            uint32_t tmp = availableEffects[i]->GetSettingsArrayStartIdx() + diff;
-            availableEffects[i]->SetSettingsArrayStartIdx(tmp);
-        }
-    } else {
-        newMaxIdx = ERR_VALUE_MAX;
     }
-
-    return newMaxIdx;
 }
 
 void LoadPresetFromPersistentStorage(uint32_t effectID, uint32_t presetID) {
-    uint32_t presetCount = availableEffects[effectID]->GetPresetCount();
-    // Get a handle to the persitance storage settings
-    Settings &settings = storage.GetSettings();
-    if (effectID >= 0 && effectID < (uint32_t)availableEffectsCount && presetID < presetCount) {
-        int paramCount = availableEffects[effectID]->GetParameterCount();
-        uint32_t startIdx;
-
-        startIdx = availableEffects[effectID]->GetSettingsArrayStartIdx() + 2 + (paramCount * presetID);
+    if (effectID >= (uint32_t)availableEffectsCount) {
+        return;
+    }
 
-        for (int paramID = 0; paramID < paramCount; paramID++) {
-            if (availableEffects[effectID]->GetParameterType(paramID) == ParameterValueType::Float) {
-                uint32_t tmp = settings.globalEffectsSettings[startIdx + paramID];
-                float f;
-                std::memcpy(&f, &tmp, sizeof(float));
-                availableEffects[effectID]->SetParameterAsFloat(paramID, f);
-            } else {
-                availableEffects[effectID]->SetParameterRaw(paramID, settings.globalEffectsSettings[startIdx + paramID]);
-            }
-        }
+    // The presets are kept in RAM in the same format as the raw parameter values, so the whole preset is handed to the
+    // effect in one go and the audio callback applies it in a single block
+    const uint32_t *values = storage.GetPresets().GetValues(effectID, presetID);
+    if (values != nullptr) {
+        availableEffects[effectID]->SetParametersRaw(values, availableEffects[effectID]->GetParameterCount());
     }
 }
 
 void LoadEffectSettingsFromPersistantStorage() {
-    uint32_t globalEffectsSettingMemIdx = 0U;
-    Settings &settings = storage.GetSettings();
-    uint32_t globalEffectsMaxIdx = settings.globalEffectsSettings[globalEffectsSettingMemIdx];
-    ++globalEffectsSettingMemIdx;
+    PresetDirectory &presets = storage.GetPresets();
+
     // Load Preset 0 of each Effect Parameters, based on values from Persistant Storage
     for (int effectID = 0; effectID < availableEffectsCount; effectID++) {
-        uint32_t presetsCount = settings.globalEffectsSettings[globalEffectsSettingMemIdx];
-        availableEffects[effectID]->SetSettingsArrayStartIdx(globalEffectsSettingMemIdx);
-        ++globalEffectsSettingMemIdx;
-        uint32_t paramCount = availableEffects[effectID]->GetParameterCount();
-        uint32_t prevParamCount = settings.globalEffectsSettings[globalEffectsSettingMemIdx];
-        ++globalEffectsSettingMemIdx;
-        // If the two variables are the same, there's no problem, just load value from the global settings copy
-        if (paramCount == prevParamCount) {
-            for (uint32_t paramID = 0; paramID < paramCount; paramID++) {
-                uint32_t value = settings.globalEffectsSettings[globalEffectsSettingMemIdx];
-                if (availableEffects[effectID]->GetParameterType(paramID) == ParameterValueType::Float) {
-                    float tmp;
-                    std::memcpy(&tmp, &value, sizeof(float));
-                    availableEffects[effectID]->SetParameterAsFloat(paramID, tmp);
-                } else {
-                    availableEffects[effectID]->SetParameterRaw(paramID, value);
-                }
-
-                ++globalEffectsSettingMemIdx;
-            }
-        }
-        // If we have added a new parameter since the last time settings were stored, we read values from persitent memory (but assume
-        // that a new param was added to the end) This way we preserve all other effects and don't get into a scenario where we
-        // accidentally use a large value as the number of presets.
-        else if (prevParamCount < paramCount) {
-            for (uint32_t paramID = 0; paramID < prevParamCount; paramID++) {
-                uint32_t value = settings.globalEffectsSettings[globalEffectsSettingMemIdx];
-                if (availableEffects[effectID]->GetParameterType(paramID) == ParameterValueType::Float) {
-                    float tmp;
-                    std::memcpy(&tmp, &value, sizeof(float));
-                    availableEffects[effectID]->SetParameterAsFloat(paramID, tmp);
-                } else {
-                    availableEffects[effectID]->SetParameterRaw(paramID, value);
-                }
-                ++globalEffectsSettingMemIdx;
-            }
-            // Shift the array and then add the new values
-            globalEffectsMaxIdx = ShiftSettingsToMatchCurrentParameters(prevParamCount, paramCount, effectID, presetsCount,
-                                                                        globalEffectsSettingMemIdx, globalEffectsMaxIdx);
-            for (uint32_t paramID = prevParamCount; paramID < paramCount; paramID++) {
-                uint32_t value = availableEffects[effectID]->GetParameterRaw(paramID);
-                settings.globalEffectsSettings[globalEffectsSettingMemIdx] = value;
-                ++globalEffectsSettingMemIdx;
-            }
-        }
-        // Else, if we have removed a parameter since the last time settings were stored, read all the relevant parameters, (again
-        // assume that these were correct in the first place) Then shift the effects after this one back by the appropriate amount of
-        // words
-        else {
-            for (uint32_t paramID = 0; paramID < paramCount; paramID++) {
-                uint32_t value = settings.globalEffectsSettings[globalEffectsSettingMemIdx];
-                availableEffects[effectID]->SetParameterRaw(paramID, value);
-                ++globalEffectsSettingMemIdx;
-            }
-            globalEffectsMaxIdx = ShiftSettingsToMatchCurrentParameters(prevParamCount, paramCount, effectID, presetsCount,
-                                                                        globalEffectsSettingMemIdx, globalEffectsMaxIdx);
-        }
-        availableEffects[effectID]->SetPresetCount(presetsCount);
-        /* Assume preset 0 for now */
+        // If the effect gained or lost parameters, the new ones start out as zero and the removed ones are dropped
+        presets.SetParameterCount(effectID, availableEffects[effectID]->GetParameterCount());
+
+        availableEffects[effectID]->SetPresetCount(presets.GetPresetCount(effectID));
+        LoadPresetFromPersistentStorage(effectID, 0U);
         availableEffects[effectID]->SetCurrentPreset(0U);
-        globalEffectsSettingMemIdx += paramCount * (presetsCount - 1U);
     }
 }
 
 void SaveEffectSettingsToPersitantStorageForEffectID(int effectID, uint32_t presetID) {
-    bool canWriteNewPreset = true;
-    Settings &settings = storage.GetSettings();
-    uint32_t globalEffectsMaxIdx = settings.globalEffectsSettings[0U];
-
     // Save Effect Parameters to Persistant Storage based on values from the specified active effect
-    if (effectID >= 0 && effectID < availableEffectsCount) {
-        int paramCount = availableEffects[effectID]->GetParameterCount();
-        uint32_t presetCount = availableEffects[effectID]->GetPresetCount();
-        uint32_t startIdx;
-
-        startIdx = availableEffects[effectID]->GetSettingsArrayStartIdx() + 2 + (paramCount * presetID);
-
-        if (presetID >= presetCount) {
-            // Ignore whatever presetID was given and just increment by 1
-            startIdx = availableEffects[effectID]->GetSettingsArrayStartIdx() + 2 + (paramCount * presetCount);
-            globalEffectsMaxIdx = ShiftSettingsToAddNewPreset(effectID, paramCount, startIdx, globalEffectsMaxIdx);
-            if (globalEffectsMaxIdx == ERR_VALUE_MAX) {
-                // TODO: Log some error message, for now don't do anything and prevent the adding the new preset
-                canWriteNewPreset = false;
-            } else {
-                presetCount += 1;
-                availableEffects[effectID]->SetPresetCount(presetCount);
-            }
+    if (effectID < 0 || effectID >= availableEffectsCount) {
+        return;
+    }
+
+    PresetDirectory &presets = storage.GetPresets();
+    int paramCount = availableEffects[effectID]->GetParameterCount();
+    bool isNewPreset = false;
+
+    if (presetID >= (uint32_t)presets.GetPresetCount(effectID)) {
+        // Ignore whatever presetID was given and just add one after the last preset. The only limit on the number of
+        // presets is the size of a snapshot in the journal.
+        if (!storage.HasRoomForPreset(paramCount)) {
+            // TODO: Log some error message, for now don't do anything and prevent the adding the new preset
+            return;
         }
 
-        if (canWriteNewPreset) {
-            for (int paramID = 0; paramID < paramCount; paramID++) {
-                if (availableEffects[effectID]->GetParameterType(paramID) == ParameterValueType::Float) {
-                    uint32_t tmp;
-                    float f = availableEffects[effectID]->GetParameterAsFloat(paramID);
-                    std::memcpy(&tmp, &f, sizeof(float));
-                    SetSettingsParameterValueForEffect(effectID, paramID, tmp, startIdx);
-                } else {
-                    SetSettingsParameterValueForEffect(effectID, paramID, availableEffects[effectID]->GetParameterRaw(paramID),
-                                                       startIdx);
-                }
-            }
-            // Set the new maximum
-            settings.globalEffectsSettings[0U] = globalEffectsMaxIdx;
-            // Set the index to number of Presets for this effect
-            startIdx = availableEffects[effectID]->GetSettingsArrayStartIdx();
-            settings.globalEffectsSettings[startIdx] = presetCount;
+        presetID = presets.AddPreset(effectID);
+        isNewPreset = true;
+        availableEffects[effectID]->SetPresetCount(presets.GetPresetCount(effectID));
+    }
+
+    const uint32_t *values = presets.GetValues(effectID, presetID);
+
+    // Only the parameters that changed are journaled, one record each or the whole preset if that is smaller
+    int changedCount = 0;
+    for (int paramID = 0; paramID < paramCount; paramID++) {
+        if (values[paramID] != GetStoredParameterValue(effectID, paramID)) {
+            ++changedCount;
+        }
+    }
+
+    const bool logWholePreset = isNewPreset || storage.IsPresetSmallerThanParameters(paramCount, changedCount);
+
+    for (int paramID = 0; paramID < paramCount; paramID++) {
+        const uint32_t value = GetStoredParameterValue(effectID, paramID);
+
+        if (!isNewPreset && values[paramID] == value) {
+            continue;
+        }
+
+        SetSettingsParameterValueForEffect(effectID, paramID, value, presetID);
+
+        if (!logWholePreset) {
+            storage.LogParameter(effectID, presetID, paramID, value);
         }
     }
+
+    if (logWholePreset && (isNewPreset || changedCount > 0)) {
+        storage.LogPreset(effectID, presetID);
+    }
 }
 
 // Helpful Function for setting a parameter value for an effect from the Persistant Storage
-void SetSettingsParameterValueForEffect(int effectID, int paramID, uint32_t paramValue, uint32_t startIdx) {
+void SetSettingsParameterValueForEffect(int effectID, int paramID, uint32_t paramValue, uint32_t presetID) {
     // Make sure the effect and param id are within valid ranges for the settings.
     if (effectID < 0 || effectID > availableEffectsCount - 1 || paramID < 0) {
         return;
@@ -319,8 +195,160 @@ void SetSettingsParameterValueForEffect(int effectID, int paramID, uint32_t para
     }
 
     // Get a handle to the persitance storage settings
-    Settings &settings = storage.GetSettings();
-    settings.globalEffectsSettings[startIdx + paramID] = paramValue;
+    uint32_t *values = storage.GetPresets().GetValues(effectID, presetID);
+    if (values != nullptr) {
+        values[paramID] = paramValue;
+    }
+}
+
+void FactoryReset(void *context) {
+    storage.RestoreDefaults();
+
+    // The effects have to match the restored layout again before their settings are saved
+    LoadEffectSettingsFromPersistantStorage();
+}
+
+SettingsStorage::SettingsStorage(daisy::QSPIHandle &qspi) : m_journal(qspi) {}
+
+void SettingsStorage::Init(const Settings &defaults, const PresetDirectory &defaultPresets, uint32_t tag) {
+    m_defaultSettings = defaults;
+    m_defaultPresets = defaultPresets;
+    m_settings = defaults;
+    m_presets = defaultPresets;
+
+    m_journal.Init(SETTINGS_JOURNAL_ADDRESS, SETTINGS_JOURNAL_BANK_SIZE, tag, settingsJournalBuffer);
+    m_journal.Replay(&ReplayRecord, this);
+
+    m_savedSettings = m_settings;
+}
+
+void SettingsStorage::LogParameter(int effectID, uint32_t presetID, int paramID, uint32_t value) {
+    const ParameterRecordData record = {static_cast<uint16_t>(effectID), static_cast<uint16_t>(presetID),
+                                        static_cast<uint16_t>(paramID), 0, value};
+    m_journal.Append(ParameterRecord, &record, sizeof(record));
+}
+
+void SettingsStorage::LogPreset(int effectID, uint32_t presetID) { AppendPreset(effectID, presetID); }
+
+bool SettingsStorage::IsPresetSmallerThanParameters(int paramCount, int changedCount) const {
+    return QspiJournal::GetRecordSize(sizeof(PresetRecordHeader) + paramCount * sizeof(uint32_t)) <=
+           changedCount * QspiJournal::GetRecordSize(sizeof(ParameterRecordData));
+}
+
+bool SettingsStorage::HasRoomForPreset(uint32_t paramCount) const {
+    if (paramCount > kMaxPresetParams) {
+        return false;
+    }
+
+    const uint32_t size = GetSnapshotSize() + QspiJournal::GetRecordSize(sizeof(PresetRecordHeader) + paramCount * sizeof(uint32_t));
+    return size <= m_journal.GetBankCapacity() / 4 * 3;
+}
+
+void SettingsStorage::SetSaveCallback(QspiJournal::CompletionCallback callback, void *context) {
+    m_journal.SetCompletionCallback(callback, context);
+}
+
+void SettingsStorage::Save() {
+    if (m_settings != m_savedSettings) {
+        m_journal.Append(GlobalsRecord, &m_settings, sizeof(m_settings));
+        m_savedSettings = m_settings;
+    }
+
+    // The snapshot holds everything in RAM, so it also covers the records that didn't fit. While the journal is busy
+    // the records are flushed after the current operation and the compaction waits for the next Save.
+    if (m_journal.NeedsCompaction() && !m_journal.IsBusy() && m_journal.Compact(&WriteSnapshot, this)) {
+        return;
+    }
+
+    m_journal.Flush();
+}
+
+void SettingsStorage::Process(bool canErase) { m_journal.Process(canErase); }
+
+void SettingsStorage::RestoreDefaults() {
+    m_settings = m_defaultSettings;
+    m_savedSettings = m_defaultSettings;
+    m_presets = m_defaultPresets;
+
+    m_journal.RequestCompaction();
+}
+
+void SettingsStorage::ReplayRecord(uint16_t type, const uint8_t *payload, uint16_t size, void *context) {
+    SettingsStorage &storage = *static_cast<SettingsStorage *>(context);
+    PresetDirectory &presets = storage.m_presets;
+
+    if (type == GlobalsRecord && size == sizeof(Settings)) {
+        std::memcpy(&storage.m_settings, payload, sizeof(Settings));
+    } else if (type == PresetRecord && size >= sizeof(PresetRecordHeader)) {
+        PresetRecordHeader header;
+        std::memcpy(&header, payload, sizeof(header));
+
+        const int presetCount = presets.GetPresetCount(header.effectID);
+        const int paramCount = presets.GetParameterCount(header.effectID);
+        if (header.effectID >= presets.GetEffectCount() || header.paramCount != paramCount ||
+            size != sizeof(header) + paramCount * sizeof(uint32_t) || header.presetID > presetCount) {
+            return;
+        }
+
+        // A record for the preset after the last one adds it
+        if (header.presetID == presetCount) {
+            presets.AddPreset(header.effectID);
+        }
+
+        std::memcpy(presets.GetValues(header.effectID, header.presetID), payload + sizeof(header), paramCount * sizeof(uint32_t));
+    } else if (type == ParameterRecord && size == sizeof(ParameterRecordData)) {
+        ParameterRecordData record;
+        std::memcpy(&record, payload, sizeof(record));
+
+        uint32_t *values = presets.GetValues(record.effectID, record.presetID);
+        if (values == nullptr || record.paramID >= presets.GetParameterCount(record.effectID)) {
+            return;
+        }
+
+        values[record.paramID] = record.value;
+    }
+}
+
+bool SettingsStorage::WriteSnapshot(QspiJournal &journal, void *context) {
+    SettingsStorage &storage = *static_cast<SettingsStorage *>(context);
+
+    if (!journal.Append(GlobalsRecord, &storage.m_settings, sizeof(Settings))) {
+        return false;
+    }
+
+    for (int effectID = 0; effectID < storage.m_presets.GetEffectCount(); effectID++) {
+        for (int presetID = 0; presetID < storage.m_presets.GetPresetCount(effectID); presetID++) {
+            if (!storage.AppendPreset(effectID, presetID)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool SettingsStorage::AppendPreset(int effectID, uint32_t presetID) {
+    const uint32_t *values = m_presets.GetValues(effectID, presetID);
+    const uint32_t paramCount = m_presets.GetParameterCount(effectID);
+
+    if (values == nullptr || paramCount > kMaxPresetParams) {
+        return false;
+    }
+
+    const PresetRecordHeader header = {static_cast<uint16_t>(effectID), static_cast<uint16_t>(presetID),
+                                       static_cast<uint16_t>(paramCount), 0};
+    std::memcpy(m_recordBuffer, &header, sizeof(header));
+    std::memcpy(m_recordBuffer + sizeof(header), values, paramCount * sizeof(uint32_t));
+
+    return m_journal.Append(PresetRecord, m_recordBuffer, sizeof(header) + paramCount * sizeof(uint32_t));
 }
 
-void FactoryReset(void *context) { storage.RestoreDefaults(); }
+uint32_t SettingsStorage::GetSnapshotSize() const {
+    uint32_t size = QspiJournal::GetRecordSize(sizeof(Settings));
+
+    for (int i = 0; i < m_presets.GetEntryCount(); i++) {
+        size += QspiJournal::GetRecordSize(sizeof(PresetRecordHeader) + m_presets.GetEntry(i).length * sizeof(uint32_t));
+    }
+
+    return size;
+}
@@ -2,20 +2,27 @@
 #ifndef GUITAR_PEDAL_STORAGE_H
 #define GUITAR_PEDAL_STORAGE_H
 
+#include "Util/preset_directory.h"
+#include "Util/qspi_journal.h"
+
 // Persistent Storage Settings
-#define SETTINGS_FILE_FORMAT_VERSION 9
+#define SETTINGS_FILE_FORMAT_VERSION 11
+
+// The settings journal sits in the QSPI flash below the program, which is loaded from 0x40000 (APP_TYPE = BOOT_SRAM).
+// It is split into two 64KB banks, a snapshot of the settings has to stay under 3/4 of a bank so there is always
+// room left for the changes saved after it.
+#define SETTINGS_JOURNAL_ADDRESS 0x00000
+#define SETTINGS_JOURNAL_BANK_SIZE 0x10000
 
-// Arbitrarily limiting this to 4KB of stored presets since this sits in DTCMRAM which is limited to 128KB.
-// TODO: In the future it would be better if this worked with the QSPI directly instead of using
-// the PersistentStorage class as an abstraction since that only lets you store a fixed struct size.
-// then it would be possible to not have to pre-allocate a fixed size in DTCMRAM for the preset save data.
-#define SETTINGS_ABSOLUTE_MAX_PARAM_COUNT 1024
-#define ERR_VALUE_MAX 0xffffffff
+// Sector erases of the journal wait until no MIDI message came in for this long (ms), so they don't hold up a Program
+// Change in the middle of a song
+#define SETTINGS_ERASE_QUIET_TIME 500
+
+// Number of slots in the effect chain, matches EffectChainModule::kMaxSlots
+#define SETTINGS_EFFECT_CHAIN_SLOT_COUNT 4
 
 // Save System Variables
 struct Settings {
-    int fileFormatVersion;
-    uint32_t globalEffectsLayoutHash;
     int globalActiveEffectID;
     bool globalMidiEnabled;
     bool globalMidiThrough;
@@ -23,23 +30,22 @@ struct Settings {
     bool globalRelayBypassEnabled;
     bool globalSplitMonoInputToStereo;
 
-    // Set aside a block of memory for individual effect params.
-    // Please note this MUST be a fixed amount of memory in the struct and cannot be a pointer to dynamic memory!
-    // If you try to use a pointer it will only save the pointer address to QSPI storage and not any of the contents
-    // of that dynamic memory.  This is a limitation of the way the PersistantStorage helper class works.
-    uint32_t globalEffectsSettings[SETTINGS_ABSOLUTE_MAX_PARAM_COUNT];
+    // The effect chain in processing order, -1 for an empty slot. The chain is processed while the active effect is
+    // one of its effects.
+    int globalEffectChain[SETTINGS_EFFECT_CHAIN_SLOT_COUNT];
+    bool globalEffectChainSlotEnabled[SETTINGS_EFFECT_CHAIN_SLOT_COUNT];
 
     bool operator==(const Settings &rhs) {
-        if (fileFormatVersion != rhs.fileFormatVersion || globalEffectsLayoutHash != rhs.globalEffectsLayoutHash ||
-            globalActiveEffectID != rhs.globalActiveEffectID ||
-            globalMidiEnabled != rhs.globalMidiEnabled || globalMidiThrough != rhs.globalMidiThrough ||
-            globalMidiChannel != rhs.globalMidiChannel || globalRelayBypassEnabled != rhs.globalRelayBypassEnabled ||
+        if (globalActiveEffectID != rhs.globalActiveEffectID || globalMidiEnabled != rhs.globalMidiEnabled ||
+            globalMidiThrough != rhs.globalMidiThrough || globalMidiChannel != rhs.globalMidiChannel ||
+            globalRelayBypassEnabled != rhs.globalRelayBypassEnabled ||
             globalSplitMonoInputToStereo != rhs.globalSplitMonoInputToStereo) {
             return false;
         }
 
-        for (uint32_t i = 0; i < SETTINGS_ABSOLUTE_MAX_PARAM_COUNT; i++) {
-            if (globalEffectsSettings[i] != rhs.globalEffectsSettings[i]) {
+        for (uint32_t i = 0; i < SETTINGS_EFFECT_CHAIN_SLOT_COUNT; i++) {
+            if (globalEffectChain[i] != rhs.globalEffectChain[i] ||
+                globalEffectChainSlotEnabled[i] != rhs.globalEffectChainSlotEnabled[i]) {
                 return false;
             }
         }
@@ -50,10 +56,124 @@ struct Settings {
     bool operator!=(const Settings &rhs) { return !operator==(rhs); }
 };
 
+/** The persisted settings: the global Settings and the parameters of every effect preset.
+ *
+ * Both are kept in RAM, the changes saved to them are appended to a QspiJournal as small records (the global Settings,
+ * a whole preset or a single parameter value) and the journal is replayed on startup to rebuild them. The effect
+ * parameters are kept in a PresetDirectory, so a preset is found or added without moving the others.
+ */
+class SettingsStorage {
+  public:
+    SettingsStorage(daisy::QSPIHandle &qspi);
+
+    /** Rebuilds the settings from the journal, call once at startup
+     \param defaults the global settings used when nothing was saved
+     \param defaultPresets the effect presets used when nothing was saved, one per effect
+     \param tag fingerprint of the settings format and the effects, saved settings with a different tag are ignored
+    */
+    void Init(const Settings &defaults, const bkshepherd::PresetDirectory &defaultPresets, uint32_t tag);
+
+    Settings &GetSettings() { return m_settings; }
+
+    /** Gets the parameters of every effect preset, changes are only saved once they are logged with LogParameter or
+     * LogPreset */
+    bkshepherd::PresetDirectory &GetPresets() { return m_presets; }
+
+    /** Logs the change of one parameter value, to be written by the next Save
+     \param effectID the effect the parameter belongs to
+     \param presetID the preset that changed
+     \param paramID the parameter that changed
+     \param value the new value of the parameter
+    */
+    void LogParameter(int effectID, uint32_t presetID, int paramID, uint32_t value);
+
+    /** Logs all the parameter values of a preset, to be written by the next Save. Logging the preset after the last
+     * one of the effect adds it.
+     \param effectID the effect the preset belongs to
+     \param presetID the preset that changed
+    */
+    void LogPreset(int effectID, uint32_t presetID);
+
+    /** Checks if logging a whole preset takes less room in the journal than logging the parameters that changed
+     \param paramCount the number of parameters of the effect
+     \param changedCount the number of parameters that changed
+    */
+    bool IsPresetSmallerThanParameters(int paramCount, int changedCount) const;
+
+    /** Checks if the settings still fit in a snapshot of the journal with one more preset
+     \param paramCount the number of parameters of the preset
+    */
+    bool HasRoomForPreset(uint32_t paramCount) const;
+
+    /** Sets the function called once everything saved so far is in the flash
+     \param callback the function to call, its first parameter is false if the save failed
+     \param context passed to the callback
+    */
+    void SetSaveCallback(bkshepherd::QspiJournal::CompletionCallback callback, void *context);
+
+    /** Starts writing the changes logged since the last Save, and the global Settings if they changed, to the journal.
+     * The journal is compacted when its active bank is full. The flash is written by Process, so this returns right
+     * away. */
+    void Save();
+
+    /** Writes the next step of a save to the flash, call every pass of the main loop
+     \param canErase false to hold off sector erases, which stall the caller for tens of milliseconds
+    */
+    void Process(bool canErase);
+
+    /** Checks if a save is still being written to the flash */
+    bool IsSaving() const { return m_journal.IsBusy(); }
+
+    /** Restores the default settings, they are written to the journal as a new snapshot by the next Save */
+    void RestoreDefaults();
+
+  private:
+    enum RecordType : uint16_t {
+        GlobalsRecord = 1, // The Settings struct
+        PresetRecord,      // A PresetRecordHeader followed by the parameter values
+        ParameterRecord,   // A ParameterRecordData
+    };
+
+    struct PresetRecordHeader {
+        uint16_t effectID;
+        uint16_t presetID;
+        uint16_t paramCount;
+        uint16_t reserved;
+    };
+
+    struct ParameterRecordData {
+        uint16_t effectID;
+        uint16_t presetID;
+        uint16_t paramID;
+        uint16_t reserved;
+        uint32_t value;
+    };
+
+    static constexpr uint32_t kMaxPresetParams =
+        (bkshepherd::QspiJournal::kMaxPayloadSize - sizeof(PresetRecordHeader)) / sizeof(uint32_t);
+
+    static void ReplayRecord(uint16_t type, const uint8_t *payload, uint16_t size, void *context);
+    static bool WriteSnapshot(bkshepherd::QspiJournal &journal, void *context);
+
+    /** Appends the record of a whole preset to the journal */
+    bool AppendPreset(int effectID, uint32_t presetID);
+
+    /** Gets the number of bytes a snapshot of the settings takes in the journal */
+    uint32_t GetSnapshotSize() const;
+
+    bkshepherd::QspiJournal m_journal;
+    Settings m_settings;
+    Settings m_savedSettings; // The global Settings as last written to the journal
+    Settings m_defaultSettings;
+    bkshepherd::PresetDirectory m_presets;
+    bkshepherd::PresetDirectory m_defaultPresets;
+    uint8_t m_recordBuffer[bkshepherd::QspiJournal::kMaxPayloadSize];
+};
+
 void InitPersistantStorage();
 void LoadEffectSettingsFromPersistantStorage();
 void SaveEffectSettingsToPersitantStorageForEffectID(int effectID, uint32_t presetID);
-void SetSettingsParameterValueForEffect(int effectID, int paramID, uint32_t paramValue, uint32_t startIdx);
+void SetSettingsParameterValueForEffect(int effectID, int paramID, uint32_t paramValue, uint32_t presetID);
 void LoadPresetFromPersistentStorage(uint32_t effectID, uint32_t presetID);
 void FactoryReset(void *context);
 
@@ -0,0 +1,214 @@
+#include "effect_host.h"
+#include "../loaded_effects.h"
+#include "../Util/block_trace.h"
+#include "../Util/profiler.h"
+#include "../Util/rt_safety.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+
+using namespace bkshepherd;
+
+namespace {
+
+// Parses a whole string as an integer
+bool ParseInt(const char *text, long &value) {
+    char *end;
+    value = strtol(text, &end, 10);
+    return end != text && *end == '\0';
+}
+
+// Parses a whole string as a float
+bool ParseFloat(const char *text, float &value) {
+    char *end;
+    value = strtof(text, &end);
+    return end != text && *end == '\0';
+}
+} // namespace
+
+EffectHost::EffectHost() : m_sampleRate(48000.0f), m_effectCount(0), m_effects(nullptr), m_activeEffect(nullptr) {}
+
+void EffectHost::Init(float sampleRate) {
+    m_sampleRate = sampleRate;
+    m_arenaMemory.resize(kArenaSize);
+    m_arena.Init(m_arenaMemory.data(), m_arenaMemory.size());
+    Profiler::Init(sampleRate, kBlockSize);
+
+    load_effects(m_effectCount, m_effects);
+
+    for (int i = 0; i < m_effectCount; i++) {
+        m_effects[i]->Init(sampleRate);
+    }
+}
+
+int EffectHost::FindEffect(const char *nameOrIndex) const {
+    long index;
+
+    if (ParseInt(nameOrIndex, index)) {
+        return index >= 0 && index < m_effectCount ? static_cast<int>(index) : -1;
+    }
+
+    for (int i = 0; i < m_effectCount; i++) {
+        if (strcasecmp(m_effects[i]->GetName(), nameOrIndex) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool EffectHost::SetActiveEffect(int effectID, bool stereo) {
+    if (m_activeEffect != nullptr) {
+        m_activeEffect->SetEnabled(false);
+        m_activeEffect->ReleaseResources(m_arena);
+        m_activeEffect = nullptr;
+    }
+
+    BaseEffectModule *effect = m_effects[effectID];
+    effect->SetStereoProcessing(stereo);
+    effect->PrepareResources();
+
+    if (!effect->AcquireResources(m_arena)) {
+        return false;
+    }
+
+    effect->SetEnabled(true);
+    m_activeEffect = effect;
+    return true;
+}
+
+void EffectHost::ProcessBlock(const float *const *in, float *const *out, size_t size) {
+    RT_SAFETY_SCOPE(m_activeEffect->GetName());
+    BlockTrace::BeginBlock();
+
+    // The host processes the Effect on this thread, so the main loop changes are made straight away
+    m_activeEffect->ProcessControlParameterChanges(false);
+    m_activeEffect->UpdateParameterSnapshot(size, kMaxParameterChangesPerBlock);
+    m_activeEffect->ProcessBlock(in, out, size);
+    BlockTrace::EndBlock(m_activeEffect->GetName());
+    Profiler::EndBlock();
+
+    daisy::System::AdvanceUs(static_cast<uint64_t>(size * 1000000.0 / m_sampleRate));
+}
+
+int EffectHost::FindParameter(const BaseEffectModule *effect, const char *nameOrIndex) {
+    long index;
+
+    if (ParseInt(nameOrIndex, index)) {
+        return index >= 0 && index < effect->GetParameterCount() ? static_cast<int>(index) : -1;
+    }
+
+    for (int i = 0; i < effect->GetParameterCount(); i++) {
+        if (strcasecmp(effect->GetParameterName(i), nameOrIndex) == 0) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool EffectHost::SetParameterFromText(BaseEffectModule *effect, int parameterID, const char *text) {
+    long integer;
+    float number;
+
+    switch (effect->GetParameterType(parameterID)) {
+    case ParameterValueType::Float: {
+        const size_t length = strlen(text);
+
+        if (length > 1 && text[length - 1] == '%') {
+            // A percentage of the range, following the curve of the parameter like a knob does
+            char percent[32];
+            snprintf(percent, sizeof(percent), "%.*s", static_cast<int>(length - 1), text);
+
+            if (!ParseFloat(percent, number)) {
+                return false;
+            }
+
+            effect->SetParameterAsMagnitude(parameterID, number / 100.0f);
+            return true;
+        }
+
+        if (!ParseFloat(text, number)) {
+            return false;
+        }
+
+        effect->SetParameterAsFloat(parameterID, number);
+        return true;
+    }
+
+    case ParameterValueType::Binned: {
+        const char **binNames = effect->GetParameterBinNames(parameterID);
+        const int binCount = effect->GetParameterBinCount(parameterID);
+
+        if (ParseInt(text, integer)) {
+            if (integer < 1 || integer > binCount) {
+                return false;
+            }
+
+            effect->SetParameterAsBinnedValue(parameterID, static_cast<int>(integer));
+            return true;
+        }
+
+        for (int bin = 0; binNames != nullptr && bin < binCount; bin++) {
+            if (strcasecmp(binNames[bin], text) == 0) {
+                effect->SetParameterAsBinnedValue(parameterID, bin + 1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    case ParameterValueType::Bool:
+        if (strcasecmp(text, "on") == 0 || strcasecmp(text, "true") == 0 || strcmp(text, "1") == 0) {
+            effect->SetParameterAsBool(parameterID, true);
+            return true;
+        }
+
+        if (strcasecmp(text, "off") == 0 || strcasecmp(text, "false") == 0 || strcmp(text, "0") == 0) {
+            effect->SetParameterAsBool(parameterID, false);
+            return true;
+        }
+
+        return false;
+
+    case ParameterValueType::Raw:
+        if (!ParseInt(text, integer) || integer < 0) {
+            return false;
+        }
+
+        effect->SetParameterRaw(parameterID, static_cast<uint32_t>(integer));
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void EffectHost::FormatParameterValue(const BaseEffectModule *effect, int parameterID, char *buffer, size_t size) {
+    switch (effect->GetParameterType(parameterID)) {
+    case ParameterValueType::Float:
+        snprintf(buffer, size, "%g", effect->GetParameterAsFloat(parameterID));
+        break;
+
+    case ParameterValueType::Binned: {
+        const char **binNames = effect->GetParameterBinNames(parameterID);
+        const int bin = effect->GetParameterAsBinnedValue(parameterID);
+
+        if (binNames != nullptr) {
+            snprintf(buffer, size, "%s", binNames[bin - 1]);
+        } else {
+            snprintf(buffer, size, "%d", bin);
+        }
+        break;
+    }
+
+    case ParameterValueType::Bool:
+        snprintf(buffer, size, "%s", effect->GetParameterAsBool(parameterID) ? "on" : "off");
+        break;
+
+    default:
+        snprintf(buffer, size, "%lu", static_cast<unsigned long>(effect->GetParameterRaw(parameterID)));
+        break;
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+#ifndef EFFECT_HOST_H
+#define EFFECT_HOST_H
+
+#include "../Effect-Modules/base_effect_module.h"
+#include "../Util/sdram_arena.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/** @file effect_host.h */
+
+namespace bkshepherd {
+
+/** Runs the effect modules on the host the same way the audio callback runs them on the pedal: the parameter snapshot
+ * is updated at the start of every block, then the block is processed, and the simulated clock moves on by the length
+ * of the block.
+ */
+class EffectHost {
+  public:
+    static constexpr size_t kBlockSize = 48;                  // Samples per block, the same as the pedal
+    static constexpr int kMaxParameterChangesPerBlock = 4;    // The same budget as the pedal
+    static constexpr size_t kArenaSize = 60 * 1024 * 1024;    // The same as the SDRAM arena of the pedal
+
+    EffectHost();
+
+    /** Loads the effects selected by the EFFECTS list and initializes them
+     \param sampleRate the sample rate to run the effects at
+    */
+    void Init(float sampleRate);
+
+    int GetEffectCount() const { return m_effectCount; }
+    BaseEffectModule *GetEffect(int effectID) const { return m_effects[effectID]; }
+
+    /** Finds an effect by its name (ignoring case) or its index
+     \return the ID of the effect, -1 if there is no such effect
+    */
+    int FindEffect(const char *nameOrIndex) const;
+
+    /** Sets an effect up to be processed: prepares it, acquires its SDRAM and enables it. Only one effect is active
+     * at a time, the previous one gives its SDRAM back.
+     \param effectID the effect to process
+     \param stereo true to process in stereo
+     \return false if the effect couldn't get the SDRAM it needs
+    */
+    bool SetActiveEffect(int effectID, bool stereo);
+
+    BaseEffectModule *GetActiveEffect() const { return m_activeEffect; }
+
+    /** Processes one block with the active effect
+     \param in the input channels (left and right)
+     \param out the output channels (left and right)
+     \param size the number of samples, at most kBlockSize
+    */
+    void ProcessBlock(const float *const *in, float *const *out, size_t size);
+
+    /** Finds a parameter of an effect by its name (ignoring case) or its index
+     \return the ID of the parameter, -1 if there is no such parameter
+    */
+    static int FindParameter(const BaseEffectModule *effect, const char *nameOrIndex);
+
+    /** Sets a parameter from text: a value in the units of a Float parameter or a percentage of its range (ex. 50%),
+     * a bin number or name of a Binned parameter, on/off/true/false/1/0 for a Bool parameter, an integer for a Raw one
+     \return false if the text isn't a valid value for the parameter
+    */
+    static bool SetParameterFromText(BaseEffectModule *effect, int parameterID, const char *text);
+
+    /** Formats a parameter value as text that SetParameterFromText accepts
+     \param buffer the buffer to write into
+     \param size the size of buffer in bytes
+    */
+    static void FormatParameterValue(const BaseEffectModule *effect, int parameterID, char *buffer, size_t size);
+
+  private:
+    float m_sampleRate;
+    int m_effectCount;
+    BaseEffectModule **m_effects;
+    BaseEffectModule *m_activeEffect;
+    std::vector<uint8_t> m_arenaMemory;
+    SdramArena m_arena;
+};
+} // namespace bkshepherd
+#endif
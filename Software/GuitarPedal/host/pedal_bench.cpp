@@ -0,0 +1,365 @@
+// pedal-bench: measures how fast the effect modules process audio on the host, for every setting that changes what they
+// compute, and compares the results with a baseline to catch changes that made an effect slower.
+//
+//   pedal-bench
+//   pedal-bench --effect NAM --effect "Tape Delay"
+//   pedal-bench --baseline bench_baseline.csv --max-regression 10
+//   pedal-bench --write-baseline bench_baseline.csv
+//
+// Every effect is run with its default settings, then once for each value of each Binned and Bool parameter (the
+// models, presets, modes and on/off switches such as oversampling) with the other parameters at their defaults. Each
+// case renders the same synthetic guitar signal a few times and keeps the fastest run, the one least disturbed by the
+// rest of the machine.
+//
+// The Cortex-M7 cycles are an estimate that scales the host time by --m7-cycles-per-ns, they are only as good as that
+// factor. Calibrate it for your machine by dividing the cycles per sample an effect takes on the pedal (from the
+// profiler's serial log) by its ns/sample here. Host timings also only compare with a baseline from the same machine.
+
+#include "effect_host.h"
+#include "../Util/rt_safety.h"
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace bkshepherd;
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr double kM7ClockHz = 480e6;
+constexpr double kM7CyclesPerSampleBudget = kM7ClockHz / kSampleRate; // 10000 cycles per sample in real time
+constexpr double kDefaultM7CyclesPerNs = 20.0;                         // A rough starting point for a recent desktop CPU
+
+// One setting of an effect to measure
+struct BenchCase {
+    std::string name; // "default" or "parameter=value", the key in the baseline
+    int parameterID;  // The parameter changed from its default, -1 for none
+    std::string value;
+};
+
+void PrintUsage() {
+    fprintf(stderr, "Usage: pedal-bench [options]\n"
+                    "Options:\n"
+                    "  --effect <name or index>      only measure this effect, may be given more than once\n"
+                    "  --seconds <seconds>           length of the test signal rendered for each case (default 2)\n"
+                    "  --repeat <count>              renders per case, the fastest one counts (default 3)\n"
+                    "  --mono                        process in mono instead of stereo\n"
+                    "  --m7-cycles-per-ns <factor>   Cortex-M7 cycles per host nanosecond (default %g)\n"
+                    "  --baseline <file>             compare with a baseline, fail on regressions and on cases it doesn't have\n"
+                    "  --max-regression <percent>    slow down allowed against the baseline (default 10)\n"
+                    "  --write-baseline <file>       write the results as the new baseline\n",
+            kDefaultM7CyclesPerNs);
+}
+
+// A guitar-like test signal: a plucked note with decaying harmonics every half second, cycling through a few pitches,
+// over a little noise so gates and pitch detectors see a realistic noise floor. The right channel is the left one
+// slightly delayed so stereo effects don't see identical channels.
+void GenerateInput(size_t frames, std::vector<float> &left, std::vector<float> &right) {
+    static const float pitches[] = {82.4f, 110.0f, 146.8f, 196.0f, 246.9f, 329.6f};
+    const size_t noteFrames = static_cast<size_t>(kSampleRate / 2);
+    const size_t rightDelay = 7;
+    uint32_t noise = 22222;
+
+    left.resize(frames);
+    right.resize(frames);
+
+    for (size_t i = 0; i < frames; i++) {
+        const size_t note = i / noteFrames;
+        const float t = static_cast<float>(i % noteFrames) / static_cast<float>(kSampleRate);
+        const float phase = 2.0f * static_cast<float>(M_PI) * pitches[note % 6] * t;
+        float sample = 0.0f;
+
+        for (int harmonic = 1; harmonic <= 4; harmonic++) {
+            sample += sinf(phase * harmonic) * expf(-t * 4.0f * harmonic) / harmonic;
+        }
+
+        noise ^= noise << 13;
+        noise ^= noise >> 17;
+        noise ^= noise << 5;
+
+        left[i] = 0.4f * sample + 0.001f * (static_cast<float>(noise) / 4294967296.0f - 0.5f);
+    }
+
+    for (size_t i = 0; i < frames; i++) {
+        right[i] = i >= rightDelay ? left[i - rightDelay] : 0.0f;
+    }
+}
+
+// The defaults plus one case per value of each Binned and Bool parameter, skipping the values that are the default
+void BuildCases(const BaseEffectModule *effect, std::vector<BenchCase> &cases) {
+    char defaultValue[64];
+
+    cases.push_back({"default", -1, ""});
+
+    for (int parameterID = 0; parameterID < effect->GetParameterCount(); parameterID++) {
+        const ParameterValueType type = effect->GetParameterType(parameterID);
+
+        if (type != ParameterValueType::Bool && type != ParameterValueType::Binned) {
+            continue;
+        }
+
+        EffectHost::FormatParameterValue(effect, parameterID, defaultValue, sizeof(defaultValue));
+
+        const char **binNames = effect->GetParameterBinNames(parameterID);
+        const int valueCount = type == ParameterValueType::Bool ? 2 : effect->GetParameterBinCount(parameterID);
+
+        for (int i = 0; i < valueCount; i++) {
+            std::string value;
+            std::string label;
+
+            if (type == ParameterValueType::Bool) {
+                value = label = i == 0 ? "off" : "on";
+            } else {
+                value = std::to_string(i + 1);
+                label = binNames != nullptr ? binNames[i] : value;
+            }
+
+            if (label != defaultValue) {
+                cases.push_back({std::string(effect->GetParameterName(parameterID)) + "=" + label, parameterID, value});
+            }
+        }
+    }
+}
+
+/** Renders the input through one case of an effect
+ \return the fastest time in nanoseconds per sample, negative if the case couldn't be set up
+*/
+double RunCase(EffectHost &host, int effectID, const std::vector<uint32_t> &defaults, const BenchCase &benchCase, bool stereo,
+               const std::vector<float> &left, const std::vector<float> &right, int repeat) {
+    BaseEffectModule *effect = host.GetEffect(effectID);
+    float outputLeft[EffectHost::kBlockSize];
+    float outputRight[EffectHost::kBlockSize];
+    float *const out[2] = {outputLeft, outputRight};
+    double best = -1.0;
+
+    for (int run = 0; run < repeat; run++) {
+        // Start every run from the same settings and freshly acquired buffers
+        effect->SetParametersRaw(defaults.data(), static_cast<int>(defaults.size()));
+
+        if (benchCase.parameterID >= 0 && !EffectHost::SetParameterFromText(effect, benchCase.parameterID, benchCase.value.c_str())) {
+            return -1.0;
+        }
+
+        if (!host.SetActiveEffect(effectID, stereo)) {
+            return -1.0;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t frame = 0; frame < left.size(); frame += EffectHost::kBlockSize) {
+            const size_t size = std::min(EffectHost::kBlockSize, left.size() - frame);
+            const float *const in[2] = {left.data() + frame, right.data() + frame};
+            host.ProcessBlock(in, out, size);
+        }
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const double nsPerSample = seconds * 1e9 / static_cast<double>(left.size());
+
+        if (best < 0.0 || nsPerSample < best) {
+            best = nsPerSample;
+        }
+    }
+
+    return best;
+}
+
+// Reads "effect,case,ns_per_sample" lines, the case may itself contain commas
+bool ReadBaseline(const char *path, std::map<std::string, double> &baseline) {
+    FILE *file = fopen(path, "r");
+
+    if (file == nullptr) {
+        fprintf(stderr, "Can't open %s\n", path);
+        return false;
+    }
+
+    char line[512];
+
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        std::string text(line);
+
+        while (!text.empty() && (text.back() == '\n' || text.back() == '\r')) {
+            text.pop_back();
+        }
+
+        const size_t last = text.rfind(',');
+
+        if (text.empty() || text[0] == '#' || last == std::string::npos || text.compare(0, 7, "effect,") == 0) {
+            continue;
+        }
+
+        baseline[text.substr(0, last)] = atof(text.c_str() + last + 1);
+    }
+
+    fclose(file);
+    return true;
+}
+
+bool WriteBaseline(const char *path, const std::vector<std::pair<std::string, double>> &results) {
+    FILE *file = fopen(path, "w");
+
+    if (file == nullptr) {
+        return false;
+    }
+
+    fprintf(file, "# pedal-bench results in ns per sample, only comparable with runs on the machine that wrote them.\n"
+                  "# Regenerate with: make bench-baseline\n"
+                  "effect,case,ns_per_sample\n");
+
+    for (const auto &result : results) {
+        fprintf(file, "%s,%.2f\n", result.first.c_str(), result.second);
+    }
+
+    return fclose(file) == 0;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    std::vector<const char *> effectNames;
+    const char *baselinePath = nullptr;
+    const char *writeBaselinePath = nullptr;
+    double seconds = 2.0;
+    int repeat = 3;
+    bool stereo = true;
+    double m7CyclesPerNs = kDefaultM7CyclesPerNs;
+    double maxRegression = 10.0;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--mono") == 0) {
+            stereo = false;
+        } else if (strcmp(argv[i], "--effect") == 0 && hasValue) {
+            effectNames.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--seconds") == 0 && hasValue) {
+            seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--repeat") == 0 && hasValue) {
+            repeat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--m7-cycles-per-ns") == 0 && hasValue) {
+            m7CyclesPerNs = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--max-regression") == 0 && hasValue) {
+            maxRegression = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--write-baseline") == 0 && hasValue) {
+            writeBaselinePath = argv[++i];
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    if (seconds <= 0.0 || repeat < 1 || m7CyclesPerNs <= 0.0) {
+        PrintUsage();
+        return 2;
+    }
+
+    std::map<std::string, double> baseline;
+
+    if (baselinePath != nullptr && !ReadBaseline(baselinePath, baseline)) {
+        return 1;
+    }
+
+    EffectHost host;
+    host.Init(static_cast<float>(kSampleRate));
+
+    std::vector<int> effectIDs;
+
+    for (const char *name : effectNames) {
+        const int effectID = host.FindEffect(name);
+
+        if (effectID < 0) {
+            fprintf(stderr, "No effect named %s, see pedal-render --list\n", name);
+            return 1;
+        }
+
+        effectIDs.push_back(effectID);
+    }
+
+    for (int effectID = 0; effectNames.empty() && effectID < host.GetEffectCount(); effectID++) {
+        effectIDs.push_back(effectID);
+    }
+
+    std::vector<float> left;
+    std::vector<float> right;
+    GenerateInput(static_cast<size_t>(seconds * kSampleRate), left, right);
+
+    printf("%-16s %-28s %10s %12s %8s %9s\n", "Effect", "Case", "ns/sample", "M7 cyc/smp", "budget", "baseline");
+
+    std::vector<std::pair<std::string, double>> results;
+    int regressions = 0;
+    int missing = 0;
+    int failures = 0;
+
+    for (const int effectID : effectIDs) {
+        BaseEffectModule *effect = host.GetEffect(effectID);
+        std::vector<uint32_t> defaults(effect->GetParameterCount());
+        std::vector<BenchCase> cases;
+
+        for (int i = 0; i < effect->GetParameterCount(); i++) {
+            defaults[i] = effect->GetParameterRaw(i);
+        }
+
+        BuildCases(effect, cases);
+
+        for (const BenchCase &benchCase : cases) {
+            const double nsPerSample = RunCase(host, effectID, defaults, benchCase, stereo, left, right, repeat);
+
+            if (nsPerSample < 0.0) {
+                printf("%-16s %-28s couldn't be set up\n", effect->GetName(), benchCase.name.c_str());
+                failures++;
+                continue;
+            }
+
+            const double m7Cycles = nsPerSample * m7CyclesPerNs;
+            const std::string key = std::string(effect->GetName()) + "," + benchCase.name;
+            results.push_back({key, nsPerSample});
+
+            printf("%-16s %-28s %10.1f %12.0f %7.1f%%", effect->GetName(), benchCase.name.c_str(), nsPerSample, m7Cycles,
+                   100.0 * m7Cycles / kM7CyclesPerSampleBudget);
+
+            const auto previous = baseline.find(key);
+
+            // A case the baseline doesn't have can't be checked, so it fails the comparison rather than passing silently
+            if (previous == baseline.end() || previous->second <= 0.0) {
+                printf(" %9s\n", baselinePath != nullptr ? "MISSING" : "");
+                missing += baselinePath != nullptr ? 1 : 0;
+                continue;
+            }
+
+            const double change = 100.0 * (nsPerSample - previous->second) / previous->second;
+            const bool regressed = change > maxRegression;
+            regressions += regressed ? 1 : 0;
+
+            printf(" %+8.1f%%%s\n", change, regressed ? "  REGRESSED" : "");
+        }
+    }
+
+    if (writeBaselinePath != nullptr && !WriteBaseline(writeBaselinePath, results)) {
+        fprintf(stderr, "Can't write %s\n", writeBaselinePath);
+        return 1;
+    }
+
+#if defined(RT_SAFETY_CHECK)
+    // Built with RT_SAFETY=1 (make rt-check), the violations were printed as they happened
+    char summary[128];
+    RtSafety::FormatSummary(summary, sizeof(summary));
+    printf("%s\n", summary);
+    failures += RtSafety::GetViolationCount() > 0 ? 1 : 0;
+#endif
+
+    if (baselinePath != nullptr) {
+        printf("%d of %zu cases are more than %g%% slower than %s\n", regressions, results.size(), maxRegression, baselinePath);
+
+        if (missing > 0) {
+            printf("%d cases are missing from %s, record it again with make bench-baseline\n", missing, baselinePath);
+        }
+    }
+
+    return regressions > 0 || missing > 0 || failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,371 @@
+// pedal-render: streams a WAV file through one of the effect modules on the host, faster than real time.
+//
+//   pedal-render --list
+//   pedal-render --effect "Tape Delay" --preset preset.txt --automation automation.txt in.wav out.wav
+//
+// A preset file sets parameters before the render starts, one "parameter = value" per line. An automation file changes
+// them during the render, one "seconds parameter = value" per line, applied at the start of the first block at or after
+// that time. Parameters are given by name or index, values as described at EffectHost::SetParameterFromText. Lines
+// starting with # are comments.
+//
+// --trace writes the timing of every block to a CSV file (the same columns as the pedal's worst block log, see
+// BlockTrace), to find which blocks come close to the budget and what else ran in them, ex. a parameter change or an FFT
+// frame.
+
+#include "effect_host.h"
+#include "wav_file.h"
+#include "../Util/block_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace bkshepherd;
+
+namespace {
+
+struct ParameterChange {
+    double time; // Seconds from the start of the render
+    int parameterID;
+    std::string value;
+};
+
+void PrintUsage() {
+    fprintf(stderr, "Usage: pedal-render --list\n"
+                    "       pedal-render --effect <name or index> [options] <in.wav> <out.wav>\n"
+                    "Options:\n"
+                    "  --preset <file>      set parameters before the render, \"parameter = value\" per line\n"
+                    "  --set <param=value>  set one parameter before the render, may be given more than once\n"
+                    "  --automation <file>  change parameters during the render, \"seconds parameter = value\" per line\n"
+                    "  --stereo             process in stereo even if the input is mono\n"
+                    "  --tail <seconds>     keep rendering silence after the input ends\n"
+                    "  --tempo <bpm>        set the tempo of the effect\n"
+                    "  --trace <file.csv>   write the timing of every block to a CSV file\n");
+}
+
+std::string Trim(const std::string &text) {
+    size_t start = 0;
+    size_t end = text.size();
+
+    while (start < end && isspace(static_cast<unsigned char>(text[start]))) {
+        start++;
+    }
+
+    while (end > start && isspace(static_cast<unsigned char>(text[end - 1]))) {
+        end--;
+    }
+
+    return text.substr(start, end - start);
+}
+
+// Splits "parameter = value" and finds the parameter
+bool ParseAssignment(const BaseEffectModule *effect, const std::string &text, ParameterChange &change) {
+    const size_t equals = text.find('=');
+
+    if (equals == std::string::npos) {
+        return false;
+    }
+
+    change.parameterID = EffectHost::FindParameter(effect, Trim(text.substr(0, equals)).c_str());
+    change.value = Trim(text.substr(equals + 1));
+    return change.parameterID >= 0 && !change.value.empty();
+}
+
+// Reads a preset (timed is false) or automation (timed is true) file
+bool ReadParameterFile(const char *path, const BaseEffectModule *effect, bool timed, std::vector<ParameterChange> &changes) {
+    FILE *file = fopen(path, "r");
+
+    if (file == nullptr) {
+        fprintf(stderr, "Can't open %s\n", path);
+        return false;
+    }
+
+    char line[512];
+    int lineNumber = 0;
+    bool success = true;
+
+    while (success && fgets(line, sizeof(line), file) != nullptr) {
+        lineNumber++;
+        std::string text = Trim(line);
+
+        if (text.empty() || text[0] == '#') {
+            continue;
+        }
+
+        ParameterChange change = {0.0, -1, ""};
+
+        if (timed) {
+            char *end;
+            change.time = strtod(text.c_str(), &end);
+
+            if (end == text.c_str() || change.time < 0.0) {
+                success = false;
+                break;
+            }
+
+            text = text.substr(end - text.c_str());
+        }
+
+        success = ParseAssignment(effect, text, change);
+        changes.push_back(change);
+    }
+
+    fclose(file);
+
+    if (!success) {
+        fprintf(stderr, "%s:%d: expected \"%sparameter = value\" with a parameter of the effect\n", path, lineNumber,
+                timed ? "seconds " : "");
+    }
+
+    return success;
+}
+
+bool ApplyChange(BaseEffectModule *effect, const ParameterChange &change) {
+    if (!EffectHost::SetParameterFromText(effect, change.parameterID, change.value.c_str())) {
+        fprintf(stderr, "\"%s\" is not a valid value for %s\n", change.value.c_str(), effect->GetParameterName(change.parameterID));
+        return false;
+    }
+
+    return true;
+}
+
+void ListEffects(EffectHost &host) {
+    static const char *typeNames[] = {"raw", "float", "bool", "binned", "unknown"};
+    char value[64];
+
+    for (int effectID = 0; effectID < host.GetEffectCount(); effectID++) {
+        BaseEffectModule *effect = host.GetEffect(effectID);
+        printf("%d: %s\n", effectID, effect->GetName());
+
+        for (int i = 0; i < effect->GetParameterCount(); i++) {
+            EffectHost::FormatParameterValue(effect, i, value, sizeof(value));
+            printf("    %d: %-24s %-6s default %s", i, effect->GetParameterName(i), typeNames[effect->GetParameterType(i)], value);
+
+            if (effect->GetParameterType(i) == ParameterValueType::Float) {
+                printf(" range %d..%d", effect->GetParameterMin(i), effect->GetParameterMax(i));
+            } else if (effect->GetParameterType(i) == ParameterValueType::Binned) {
+                printf(" bins 1..%d", effect->GetParameterBinCount(i));
+            }
+
+            printf("\n");
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *effectName = nullptr;
+    const char *presetPath = nullptr;
+    const char *automationPath = nullptr;
+    const char *inputPath = nullptr;
+    const char *outputPath = nullptr;
+    const char *tracePath = nullptr;
+    std::vector<const char *> assignments;
+    bool list = false;
+    bool forceStereo = false;
+    double tailSeconds = 0.0;
+    long tempo = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--list") == 0) {
+            list = true;
+        } else if (strcmp(argv[i], "--stereo") == 0) {
+            forceStereo = true;
+        } else if (strcmp(argv[i], "--effect") == 0 && hasValue) {
+            effectName = argv[++i];
+        } else if (strcmp(argv[i], "--preset") == 0 && hasValue) {
+            presetPath = argv[++i];
+        } else if (strcmp(argv[i], "--set") == 0 && hasValue) {
+            assignments.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--automation") == 0 && hasValue) {
+            automationPath = argv[++i];
+        } else if (strcmp(argv[i], "--tail") == 0 && hasValue) {
+            tailSeconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--tempo") == 0 && hasValue) {
+            tempo = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && hasValue) {
+            tracePath = argv[++i];
+        } else if (argv[i][0] != '-' && inputPath == nullptr) {
+            inputPath = argv[i];
+        } else if (argv[i][0] != '-' && outputPath == nullptr) {
+            outputPath = argv[i];
+        } else {
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    if (list) {
+        EffectHost host;
+        host.Init(48000.0f);
+        ListEffects(host);
+        return 0;
+    }
+
+    if (effectName == nullptr || inputPath == nullptr || outputPath == nullptr) {
+        PrintUsage();
+        return 2;
+    }
+
+    WavData input;
+    std::string error;
+
+    if (!ReadWavFile(inputPath, input, error)) {
+        fprintf(stderr, "Can't read %s: %s\n", inputPath, error.c_str());
+        return 1;
+    }
+
+    EffectHost host;
+    host.Init(static_cast<float>(input.sampleRate));
+
+    const int effectID = host.FindEffect(effectName);
+
+    if (effectID < 0) {
+        fprintf(stderr, "No effect named %s, see --list\n", effectName);
+        return 1;
+    }
+
+    BaseEffectModule *effect = host.GetEffect(effectID);
+
+    // The preset and --set values go in before the first block, like a preset recalled before the effect is switched on
+    std::vector<ParameterChange> presetChanges;
+    std::vector<ParameterChange> automation;
+
+    if (presetPath != nullptr && !ReadParameterFile(presetPath, effect, false, presetChanges)) {
+        return 1;
+    }
+
+    for (const char *assignment : assignments) {
+        ParameterChange change = {0.0, -1, ""};
+
+        if (!ParseAssignment(effect, assignment, change)) {
+            fprintf(stderr, "Expected --set \"parameter=value\" with a parameter of %s, got %s\n", effect->GetName(), assignment);
+            return 1;
+        }
+
+        presetChanges.push_back(change);
+    }
+
+    if (automationPath != nullptr && !ReadParameterFile(automationPath, effect, true, automation)) {
+        return 1;
+    }
+
+    std::stable_sort(automation.begin(), automation.end(),
+                     [](const ParameterChange &a, const ParameterChange &b) { return a.time < b.time; });
+
+    for (const ParameterChange &change : presetChanges) {
+        if (!ApplyChange(effect, change)) {
+            return 1;
+        }
+    }
+
+    const bool stereo = forceStereo || input.channels >= 2;
+
+    if (!host.SetActiveEffect(effectID, stereo)) {
+        fprintf(stderr, "%s couldn't get the SDRAM it needs\n", effect->GetName());
+        return 1;
+    }
+
+    if (tempo > 0) {
+        effect->SetTempo(static_cast<uint32_t>(tempo));
+    }
+
+    FILE *traceFile = nullptr;
+
+    if (tracePath != nullptr) {
+        traceFile = fopen(tracePath, "w");
+
+        if (traceFile == nullptr) {
+            fprintf(stderr, "Can't write %s\n", tracePath);
+            return 1;
+        }
+
+        fprintf(traceFile, "%s\n", BlockTrace::GetCsvHeader());
+    }
+
+    // Render the input plus the tail, a block at a time
+    const size_t inputFrames = input.GetFrameCount();
+    const size_t totalFrames = inputFrames + static_cast<size_t>(tailSeconds * input.sampleRate);
+
+    WavData output;
+    output.sampleRate = input.sampleRate;
+    output.channels = stereo ? 2 : 1;
+    output.samples.resize(totalFrames * output.channels);
+
+    float inputLeft[EffectHost::kBlockSize];
+    float inputRight[EffectHost::kBlockSize];
+    float outputLeft[EffectHost::kBlockSize];
+    float outputRight[EffectHost::kBlockSize];
+    const float *const in[2] = {inputLeft, inputRight};
+    float *const out[2] = {outputLeft, outputRight};
+
+    BlockTraceRecord traceRecord;
+    uint32_t nextTraceBlock = BlockTrace::GetBlockCount();
+    size_t nextChange = 0;
+    double processingSeconds = 0.0;
+    double worstBlockSeconds = 0.0;
+
+    for (size_t frame = 0; frame < totalFrames; frame += EffectHost::kBlockSize) {
+        const size_t size = std::min(EffectHost::kBlockSize, totalFrames - frame);
+        const double blockTime = static_cast<double>(frame) / input.sampleRate;
+
+        for (; nextChange < automation.size() && automation[nextChange].time <= blockTime; nextChange++) {
+            if (!ApplyChange(effect, automation[nextChange])) {
+                return 1;
+            }
+        }
+
+        // A mono input feeds both channels, the same as the pedal does
+        for (size_t i = 0; i < size; i++) {
+            const size_t inputFrame = frame + i;
+            const bool hasInput = inputFrame < inputFrames;
+            inputLeft[i] = hasInput ? input.samples[inputFrame * input.channels] : 0.0f;
+            inputRight[i] = hasInput ? input.samples[inputFrame * input.channels + (input.channels >= 2 ? 1 : 0)] : 0.0f;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        host.ProcessBlock(in, out, size);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        processingSeconds += seconds;
+        worstBlockSeconds = std::max(worstBlockSeconds, seconds);
+
+        if (traceFile != nullptr && BlockTrace::Read(nextTraceBlock, &traceRecord, 1) == 1) {
+            char line[192];
+            BlockTrace::FormatCsvRecord(traceRecord, static_cast<uint32_t>(blockTime * 1000000.0), line, sizeof(line));
+            fprintf(traceFile, "%s\n", line);
+        }
+
+        for (size_t i = 0; i < size; i++) {
+            output.samples[(frame + i) * output.channels] = outputLeft[i];
+
+            if (stereo) {
+                output.samples[(frame + i) * output.channels + 1] = outputRight[i];
+            }
+        }
+    }
+
+    if (traceFile != nullptr) {
+        fclose(traceFile);
+    }
+
+    if (!WriteWavFile(outputPath, output)) {
+        fprintf(stderr, "Can't write %s\n", outputPath);
+        return 1;
+    }
+
+    const double audioSeconds = static_cast<double>(totalFrames) / input.sampleRate;
+    const double blockSeconds = static_cast<double>(EffectHost::kBlockSize) / input.sampleRate;
+
+    fprintf(stderr, "%s: %.2f s of audio in %.3f s (%.1fx real time), %.1f ns/sample, worst block %.1f%% of its budget\n",
+            effect->GetName(), audioSeconds, processingSeconds, processingSeconds > 0.0 ? audioSeconds / processingSeconds : 0.0,
+            totalFrames > 0 ? processingSeconds * 1e9 / totalFrames : 0.0, 100.0 * worstBlockSeconds / blockSeconds);
+
+    return 0;
+}
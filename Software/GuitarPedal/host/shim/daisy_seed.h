@@ -0,0 +1,149 @@
+#pragma once
+#ifndef HOST_DAISY_SEED_H
+#define HOST_DAISY_SEED_H
+
+#include "Util/rt_safety.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** @file daisy_seed.h */
+
+// Stands in for libDaisy in the host build (host/Makefile), with only the parts of it the effect modules use. The clock
+// is simulated: it only moves when the host program advances it, so an offline render sees the time pass as if it was
+// running in real time on the pedal, however fast it actually runs.
+
+#ifndef DSY_SDRAM_BSS
+#define DSY_SDRAM_BSS
+#endif
+
+// Formatting of floats without %f, the same as the libDaisy logger macros
+#define FLT_FMT(_n) "%c%d.%0" #_n "d"
+#define FLT_VAR(_n, _x) ((_x) < 0 ? '-' : ' '), (int)fabsf(_x), (int)((fabsf(_x) - (int)fabsf(_x)) * powf(10, (_n)))
+#define FLT_VAR3(_x) FLT_VAR(3, _x)
+
+namespace daisy {
+
+class System {
+  public:
+    /** Gets the simulated time in milliseconds */
+    static uint32_t GetNow() { return static_cast<uint32_t>(s_nowUs / 1000); }
+
+    /** Gets the simulated time in microseconds */
+    static uint32_t GetUs() { return static_cast<uint32_t>(s_nowUs); }
+
+    /** Advances the simulated time instead of waiting, it would block on the pedal so it's checked like a blocking call */
+    static void Delay(uint32_t delay_ms) {
+        RT_SAFETY_BLOCKING("System::Delay");
+        s_nowUs += static_cast<uint64_t>(delay_ms) * 1000;
+    }
+
+    /** Advances the simulated time, called by the host program as it processes audio (host only)
+     \param us the number of microseconds to move the time forward by
+    */
+    static void AdvanceUs(uint64_t us) { s_nowUs += us; }
+
+  private:
+    static inline uint64_t s_nowUs = 0;
+};
+
+struct FontDef {
+    uint8_t FontWidth;
+    uint8_t FontHeight;
+    const uint16_t *data;
+};
+
+inline constexpr FontDef Font_6x8 = {6, 8, nullptr};
+inline constexpr FontDef Font_7x10 = {7, 10, nullptr};
+inline constexpr FontDef Font_11x18 = {11, 18, nullptr};
+inline constexpr FontDef Font_16x26 = {16, 26, nullptr};
+
+enum class Alignment {
+    centered,
+    topLeft,
+    topCentered,
+    topRight,
+    bottomLeft,
+    bottomCentered,
+    bottomRight,
+    centeredLeft,
+    centeredRight,
+};
+
+/** The libDaisy Rectangle, with the methods the effect modules draw with */
+class Rectangle {
+  public:
+    Rectangle() : m_x(0), m_y(0), m_width(0), m_height(0) {}
+    Rectangle(int16_t width, int16_t height) : m_x(0), m_y(0), m_width(width), m_height(height) {}
+    Rectangle(int16_t x, int16_t y, int16_t width, int16_t height) : m_x(x), m_y(y), m_width(width), m_height(height) {}
+
+    int16_t GetX() const { return m_x; }
+    int16_t GetY() const { return m_y; }
+    int16_t GetWidth() const { return m_width; }
+    int16_t GetHeight() const { return m_height; }
+    int16_t GetLeft() const { return m_x; }
+    int16_t GetTop() const { return m_y; }
+    int16_t GetRight() const { return m_x + m_width; }
+    int16_t GetBottom() const { return m_y + m_height; }
+    bool IsEmpty() const { return m_width <= 0 || m_height <= 0; }
+
+    Rectangle Reduced(int16_t x, int16_t y) const { return Rectangle(m_x + x, m_y + y, m_width - 2 * x, m_height - 2 * y); }
+    Rectangle Translated(int16_t x, int16_t y) const { return Rectangle(m_x + x, m_y + y, m_width, m_height); }
+
+    Rectangle WithSizeKeepingCenter(int16_t width, int16_t height) const {
+        return Rectangle(m_x + (m_width - width) / 2, m_y + (m_height - height) / 2, width, height);
+    }
+
+    Rectangle RemoveFromTop(int16_t height) {
+        const int16_t removedHeight = height < m_height ? height : m_height;
+        m_y += removedHeight;
+        m_height -= removedHeight;
+        return Rectangle(m_x, m_y - removedHeight, m_width, removedHeight);
+    }
+
+    Rectangle RemoveFromBottom(int16_t height) {
+        const int16_t removedHeight = height < m_height ? height : m_height;
+        m_height -= removedHeight;
+        return Rectangle(m_x, m_y + m_height, m_width, removedHeight);
+    }
+
+    Rectangle RemoveFromLeft(int16_t width) {
+        const int16_t removedWidth = width < m_width ? width : m_width;
+        m_x += removedWidth;
+        m_width -= removedWidth;
+        return Rectangle(m_x - removedWidth, m_y, removedWidth, m_height);
+    }
+
+    Rectangle RemoveFromRight(int16_t width) {
+        const int16_t removedWidth = width < m_width ? width : m_width;
+        m_width -= removedWidth;
+        return Rectangle(m_x + m_width, m_y, removedWidth, m_height);
+    }
+
+  private:
+    int16_t m_x;
+    int16_t m_y;
+    int16_t m_width;
+    int16_t m_height;
+};
+
+/** A display that draws nothing, the host build never shows the effect UIs */
+class OneBitGraphicsDisplay {
+  public:
+    uint16_t Width() const { return 128; }
+    uint16_t Height() const { return 64; }
+    void Fill(bool on) {}
+    void DrawPixel(uint_fast8_t x, uint_fast8_t y, bool on) {}
+    void DrawLine(uint_fast8_t x1, uint_fast8_t y1, uint_fast8_t x2, uint_fast8_t y2, bool on) {}
+    void DrawRect(uint_fast8_t x1, uint_fast8_t y1, uint_fast8_t x2, uint_fast8_t y2, bool on, bool fill = false) {}
+    void DrawRect(const Rectangle &rect, bool on, bool fill = false) {}
+    void DrawCircle(uint_fast8_t x, uint_fast8_t y, uint_fast8_t radius, bool on) {}
+    void SetCursor(uint16_t x, uint16_t y) {}
+    char WriteChar(char ch, FontDef font, bool on) { return ch; }
+    char WriteString(const char *str, FontDef font, bool on) { return 0; }
+    Rectangle WriteStringAligned(const char *str, const FontDef &font, Rectangle boundingBox, Alignment alignment, bool on) {
+        return boundingBox;
+    }
+};
+} // namespace daisy
+#endif
@@ -0,0 +1,165 @@
+#include "wav_file.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace bkshepherd;
+
+namespace {
+
+constexpr uint16_t kFormatPcm = 1;
+constexpr uint16_t kFormatFloat = 3;
+constexpr uint16_t kFormatExtensible = 0xfffe;
+
+uint16_t ReadUint16(const uint8_t *data) { return static_cast<uint16_t>(data[0] | (data[1] << 8)); }
+
+uint32_t ReadUint32(const uint8_t *data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) |
+           (static_cast<uint32_t>(data[3]) << 24);
+}
+
+void WriteUint16(FILE *file, uint16_t value) {
+    const uint8_t bytes[2] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8)};
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+void WriteUint32(FILE *file, uint32_t value) {
+    const uint8_t bytes[4] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value >> 16),
+                              static_cast<uint8_t>(value >> 24)};
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+// Converts one sample of the data chunk to a float in -1..1
+float DecodeSample(const uint8_t *data, uint16_t format, uint16_t bitsPerSample) {
+    if (format == kFormatFloat) {
+        float value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    switch (bitsPerSample) {
+    case 16:
+        return static_cast<int16_t>(ReadUint16(data)) / 32768.0f;
+    case 24: {
+        // Put the 24 bits at the top of an int32 so the sign is kept
+        const uint32_t value = (static_cast<uint32_t>(data[0]) << 8) | (static_cast<uint32_t>(data[1]) << 16) |
+                               (static_cast<uint32_t>(data[2]) << 24);
+        return static_cast<int32_t>(value) / 2147483648.0f;
+    }
+    default:
+        return static_cast<int32_t>(ReadUint32(data)) / 2147483648.0f;
+    }
+}
+} // namespace
+
+bool bkshepherd::ReadWavFile(const char *path, WavData &wav, std::string &error) {
+    FILE *file = fopen(path, "rb");
+
+    if (file == nullptr) {
+        error = "can't open the file";
+        return false;
+    }
+
+    std::vector<uint8_t> contents;
+    uint8_t buffer[65536];
+    size_t bytesRead;
+
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        contents.insert(contents.end(), buffer, buffer + bytesRead);
+    }
+
+    fclose(file);
+
+    if (contents.size() < 12 || memcmp(contents.data(), "RIFF", 4) != 0 || memcmp(contents.data() + 8, "WAVE", 4) != 0) {
+        error = "not a WAV file";
+        return false;
+    }
+
+    uint16_t format = 0;
+    uint16_t channels = 0;
+    uint32_t sampleRate = 0;
+    uint16_t bitsPerSample = 0;
+    const uint8_t *sampleData = nullptr;
+    size_t sampleDataSize = 0;
+
+    // Walk the chunks, they are padded to an even size
+    for (size_t offset = 12; offset + 8 <= contents.size();) {
+        const uint8_t *chunk = contents.data() + offset;
+        size_t chunkSize = ReadUint32(chunk + 4);
+        const size_t available = contents.size() - offset - 8;
+        chunkSize = chunkSize < available ? chunkSize : available;
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16) {
+            format = ReadUint16(chunk + 8);
+            channels = ReadUint16(chunk + 10);
+            sampleRate = ReadUint32(chunk + 12);
+            bitsPerSample = ReadUint16(chunk + 22);
+
+            // The real format of an extensible file is in the first 2 bytes of its sub format GUID
+            if (format == kFormatExtensible && chunkSize >= 26) {
+                format = ReadUint16(chunk + 32);
+            }
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            sampleData = chunk + 8;
+            sampleDataSize = chunkSize;
+        }
+
+        offset += 8 + chunkSize + (chunkSize & 1);
+    }
+
+    const bool supported = (format == kFormatPcm && (bitsPerSample == 16 || bitsPerSample == 24 || bitsPerSample == 32)) ||
+                           (format == kFormatFloat && bitsPerSample == 32);
+
+    if (!supported || channels == 0 || sampleRate == 0) {
+        error = "only 16, 24 and 32 bit PCM and 32 bit float WAV files are supported";
+        return false;
+    }
+
+    if (sampleData == nullptr) {
+        error = "no data chunk";
+        return false;
+    }
+
+    const size_t bytesPerSample = bitsPerSample / 8;
+    const size_t sampleCount = sampleDataSize / bytesPerSample / channels * channels;
+
+    wav.sampleRate = sampleRate;
+    wav.channels = channels;
+    wav.samples.resize(sampleCount);
+
+    for (size_t i = 0; i < sampleCount; i++) {
+        wav.samples[i] = DecodeSample(sampleData + i * bytesPerSample, format, bitsPerSample);
+    }
+
+    return true;
+}
+
+bool bkshepherd::WriteWavFile(const char *path, const WavData &wav) {
+    FILE *file = fopen(path, "wb");
+
+    if (file == nullptr) {
+        return false;
+    }
+
+    const uint32_t dataSize = static_cast<uint32_t>(wav.samples.size() * sizeof(float));
+
+    fwrite("RIFF", 1, 4, file);
+    WriteUint32(file, 36 + dataSize);
+    fwrite("WAVE", 1, 4, file);
+
+    fwrite("fmt ", 1, 4, file);
+    WriteUint32(file, 16);
+    WriteUint16(file, kFormatFloat);
+    WriteUint16(file, static_cast<uint16_t>(wav.channels));
+    WriteUint32(file, wav.sampleRate);
+    WriteUint32(file, wav.sampleRate * wav.channels * sizeof(float));
+    WriteUint16(file, static_cast<uint16_t>(wav.channels * sizeof(float)));
+    WriteUint16(file, 32);
+
+    fwrite("data", 1, 4, file);
+    WriteUint32(file, dataSize);
+
+    // WAV is little endian, the same as every host this is built on
+    const bool success = fwrite(wav.samples.data(), sizeof(float), wav.samples.size(), file) == wav.samples.size();
+
+    return fclose(file) == 0 && success;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#ifndef WAV_FILE_H
+#define WAV_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/** @file wav_file.h */
+
+namespace bkshepherd {
+
+/** Audio read from or written to a WAV file, as interleaved floats */
+struct WavData {
+    uint32_t sampleRate = 48000;
+    int channels = 1;
+    std::vector<float> samples; // channels samples per frame
+
+    size_t GetFrameCount() const { return channels > 0 ? samples.size() / channels : 0; }
+};
+
+/** Reads a WAV file, 16, 24 or 32 bit PCM or 32 bit float, any number of channels
+ \param path the file to read
+ \param wav filled with the audio of the file
+ \param error set to the reason if the file can't be read
+ \return true if the file was read
+*/
+bool ReadWavFile(const char *path, WavData &wav, std::string &error);
+
+/** Writes a 32 bit float WAV file
+ \param path the file to write
+ \param wav the audio to write
+ \return true if the file was written
+*/
+bool WriteWavFile(const char *path, const WavData &wav);
+} // namespace bkshepherd
+#endif
@@ -1,95 +1,249 @@
-// Edit the contents of this file to populate the available effects that you
-// want to use
+// The effects that are available are picked by the EFFECTS list in effects.mk, the Makefile builds their sources and passes
+// the list on to this file. Edit that list to change the effects (and their order), ex. to only build 1 or 2 of them.
 
 #ifndef LOADED_EFFECTS_H
 #define LOADED_EFFECTS_H
 #pragma once
 
 #include "Effect-Modules/base_effect_module.h"
+#include <new>
+#include <stdint.h>
+#include <string.h>
 
-// Include all effect modules
+// SELECTED_EFFECTS is EFFECT(name) for each name in the EFFECTS list, in order, and EFFECT_name is defined for each of them
+#ifndef SELECTED_EFFECTS
+#error "SELECTED_EFFECTS is set by the Makefile from the EFFECTS list in effects.mk"
+#endif
+
+// Every effect module that can be selected, by its name in the EFFECTS list
+// The keyboard modules (fm_keys, midi_keys, modal_keys, pluckecho, string_keys) require a MIDI keyboard
+#ifdef EFFECT_amp
 #include "Effect-Modules/amp_module.h"
+#define EFFECT_CLASS_amp AmpModule
+#endif
+#ifdef EFFECT_autopan
 #include "Effect-Modules/autopan_module.h"
+#define EFFECT_CLASS_autopan AutoPanModule
+#endif
+#ifdef EFFECT_chopper
 #include "Effect-Modules/chopper_module.h"
+#define EFFECT_CLASS_chopper ChopperModule
+#endif
+#ifdef EFFECT_chorus
 #include "Effect-Modules/chorus_module.h"
+#define EFFECT_CLASS_chorus ChorusModule
+#endif
+#ifdef EFFECT_cloudseed
 #include "Effect-Modules/cloudseed_module.h" // Takes up significant SDRAM (about 30%)
+#define EFFECT_CLASS_cloudseed CloudSeedModule
+#endif
+#ifdef EFFECT_compressor
 #include "Effect-Modules/compressor_module.h"
+#define EFFECT_CLASS_compressor CompressorModule
+#endif
+#ifdef EFFECT_crusher
 #include "Effect-Modules/crusher_module.h"
+#define EFFECT_CLASS_crusher CrusherModule
+#endif
+#ifdef EFFECT_delay
 #include "Effect-Modules/delay_module.h"
+#define EFFECT_CLASS_delay DelayModule
+#endif
+#ifdef EFFECT_distortion
 #include "Effect-Modules/distortion_module.h"
+#define EFFECT_CLASS_distortion DistortionModule
+#endif
+#ifdef EFFECT_drum
 #include "Effect-Modules/drum_module.h"
+#define EFFECT_CLASS_drum DrumModule
+#endif
+#ifdef EFFECT_flanger
 #include "Effect-Modules/flanger_module.h"
+#define EFFECT_CLASS_flanger FlangerModule
+#endif
+#ifdef EFFECT_fm_keys
+#include "Effect-Modules/fm_keys_module.h"
+#define EFFECT_CLASS_fm_keys FmKeysModule
+#endif
+#ifdef EFFECT_geq
 #include "Effect-Modules/geq_module.h"
+#define EFFECT_CLASS_geq GraphicEQModule
+#endif
+#ifdef EFFECT_granulardelay
 #include "Effect-Modules/granulardelay_module.h"
+#define EFFECT_CLASS_granulardelay GranularDelayModule
+#endif
+#ifdef EFFECT_ir
 #include "Effect-Modules/ir_module.h"
+#define EFFECT_CLASS_ir IrModule
+#endif
+#ifdef EFFECT_looper
 #include "Effect-Modules/looper_module.h"
+#define EFFECT_CLASS_looper LooperModule
+#endif
+#ifdef EFFECT_metro
 #include "Effect-Modules/metro_module.h"
+#define EFFECT_CLASS_metro MetroModule
+#endif
+#ifdef EFFECT_midi_keys
+#include "Effect-Modules/midi_keys_module.h"
+#define EFFECT_CLASS_midi_keys MidiKeysModule
+#endif
+#ifdef EFFECT_modal_keys
+#include "Effect-Modules/modal_keys_module.h"
+#define EFFECT_CLASS_modal_keys ModalKeysModule
+#endif
+#ifdef EFFECT_modulated_tremolo
 #include "Effect-Modules/modulated_tremolo_module.h"
+#define EFFECT_CLASS_modulated_tremolo ModulatedTremoloModule
+#endif
+#ifdef EFFECT_multi_delay
 #include "Effect-Modules/multi_delay_module.h"
+#define EFFECT_CLASS_multi_delay MultiDelayModule
+#endif
+#ifdef EFFECT_nam
 #include "Effect-Modules/nam_module.h"
+#define EFFECT_CLASS_nam NamModule
+#endif
+#ifdef EFFECT_noise_gate
 #include "Effect-Modules/noise_gate_module.h"
+#define EFFECT_CLASS_noise_gate NoiseGateModule
+#endif
+#ifdef EFFECT_overdrive
 #include "Effect-Modules/overdrive_module.h"
+#define EFFECT_CLASS_overdrive OverdriveModule
+#endif
+#ifdef EFFECT_peq
 #include "Effect-Modules/peq_module.h"
+#define EFFECT_CLASS_peq ParametricEQModule
+#endif
+#ifdef EFFECT_phaser
 #include "Effect-Modules/phaser_module.h"
+#define EFFECT_CLASS_phaser PhaserModule
+#endif
+#ifdef EFFECT_pitch_shifter
 #include "Effect-Modules/pitch_shifter_module.h"
+#define EFFECT_CLASS_pitch_shifter PitchShifterModule
+#endif
+#ifdef EFFECT_pluckecho
+#include "Effect-Modules/pluckecho_module.h"
+#define EFFECT_CLASS_pluckecho PluckEchoModule
+#endif
+#ifdef EFFECT_polyoctave
 #include "Effect-Modules/polyoctave_module.h"
+#define EFFECT_CLASS_polyoctave PolyOctaveModule
+#endif
+#ifdef EFFECT_reverb
 #include "Effect-Modules/reverb_module.h"
+#define EFFECT_CLASS_reverb ReverbModule
+#endif
+#ifdef EFFECT_reverb_delay
+#include "Effect-Modules/reverb_delay_module.h"
+#define EFFECT_CLASS_reverb_delay ReverbDelayModule
+#endif
+#ifdef EFFECT_scifi
 #include "Effect-Modules/scifi_module.h"
+#define EFFECT_CLASS_scifi SciFiModule
+#endif
+#ifdef EFFECT_scope
+#include "Effect-Modules/scope_module.h"
+#define EFFECT_CLASS_scope ScopeModule
+#endif
+#ifdef EFFECT_spectral_delay
 #include "Effect-Modules/spectral_delay_module.h"
+#define EFFECT_CLASS_spectral_delay SpectralDelayModule
+#endif
+#ifdef EFFECT_string_keys
+#include "Effect-Modules/string_keys_module.h"
+#define EFFECT_CLASS_string_keys StringKeysModule
+#endif
+#ifdef EFFECT_tape_delay
 #include "Effect-Modules/tape_delay_module.h"
+#define EFFECT_CLASS_tape_delay TapeDelayModule
+#endif
+#ifdef EFFECT_tuner
 #include "Effect-Modules/tuner_module.h"
-
-// Keyboard modules
-// #include "Effect-Modules/fm_keys_module.h"
-// #include "Effect-Modules/midi_keys_module.h"
-// #include "Effect-Modules/modal_keys_module.h"
-// #include "Effect-Modules/pluckecho_module.h"
-// #include "Effect-Modules/string_keys_module.h"
+#define EFFECT_CLASS_tuner TunerModule
+#endif
 
 namespace bkshepherd {
 
+// The names of the selected effects in order, one per line
+#define EFFECT(name) #name "\n"
+constexpr char kSelectedEffectNames[] = SELECTED_EFFECTS;
+#undef EFFECT
+
+/** Computes the 32-bit FNV-1a hash of a string at compile time
+ \param text the string to hash
+ \return the hash of the characters of the string
+*/
+constexpr uint32_t HashEffectNames(const char *text) {
+    uint32_t hash = 2166136261u;
+
+    for (; *text != '\0'; ++text) {
+        hash = (hash ^ static_cast<unsigned char>(*text)) * 16777619u;
+    }
+
+    return hash;
+}
+
+// Fingerprint of which effects are built and their order, the settings storage layout hash starts from it
+constexpr uint32_t kSelectedEffectsHash = HashEffectNames(kSelectedEffectNames);
+
+// Each effect instance is placed in the memory region its class asks for with kMemoryRegion. The instances of each
+// region are packed one after the other into a buffer in that region, sized here for the selected effects.
+constexpr size_t kEffectAlignment = 16;
+
+/** Gets the bytes an effect takes in a memory region
+ \param region the memory region
+ \return the aligned size of the effect if it is placed in the region, otherwise 0
+*/
+template <typename Effect> constexpr size_t GetEffectBytes(MemoryRegion region) {
+    static_assert(alignof(Effect) <= kEffectAlignment, "Effect is aligned more strictly than its memory region buffer");
+    return Effect::kMemoryRegion == region ? (sizeof(Effect) + kEffectAlignment - 1) & ~(kEffectAlignment - 1) : 0;
+}
+
+#define EFFECT(name) +GetEffectBytes<EFFECT_CLASS_##name>(MemoryRegion::Dtcm)
+constexpr size_t kDtcmEffectBytes = 0 SELECTED_EFFECTS;
+#undef EFFECT
+
+#define EFFECT(name) +GetEffectBytes<EFFECT_CLASS_##name>(MemoryRegion::Sram)
+constexpr size_t kSramEffectBytes = 0 SELECTED_EFFECTS;
+#undef EFFECT
+
+#define EFFECT(name) +GetEffectBytes<EFFECT_CLASS_##name>(MemoryRegion::Sdram)
+constexpr size_t kSdramEffectBytes = 0 SELECTED_EFFECTS;
+#undef EFFECT
+
+/** Constructs an effect in the next free bytes of the buffer of its memory region
+ \param regionMemory the buffer of each memory region, indexed by MemoryRegion
+ \param regionUsedBytes the bytes used in each buffer so far, advanced past the effect
+ \return the effect
+*/
+template <typename Effect> BaseEffectModule *CreateEffect(uint8_t *const *regionMemory, size_t *regionUsedBytes) {
+    const int region = static_cast<int>(Effect::kMemoryRegion);
+    uint8_t *memory = regionMemory[region] + regionUsedBytes[region];
+    regionUsedBytes[region] += GetEffectBytes<Effect>(Effect::kMemoryRegion);
+
+    // Only .bss is cleared at startup, start every effect out zeroed as if it was a static
+    memset(memory, 0, sizeof(Effect));
+    return new (memory) Effect();
+}
+
 void load_effects(int &availableEffectsCount, BaseEffectModule **&availableEffects) {
-    // clang-format off
-    static BaseEffectModule* effectList[] = {
-        new ModulatedTremoloModule(),
-        new OverdriveModule(),
-        new AutoPanModule(),
-        new ChorusModule(),
-        new ChopperModule(),
-        new ReverbModule(),
-        new MultiDelayModule(),
-        new MetroModule(),
-        new TunerModule(),
-        new PitchShifterModule(),
-        new CompressorModule(),
-        new LooperModule(),
-        new GraphicEQModule(),
-        new ParametricEQModule(),
-        new NoiseGateModule(),
-        new CloudSeedModule(),
-        new AmpModule(),
-        new DelayModule(),
-        new TapeDelayModule(),
-        new NamModule(),
-        new SciFiModule(),
-        new PolyOctaveModule(),
-        new SpectralDelayModule(),
-        new DistortionModule(),
-        new GranularDelayModule(), 
-        new IrModule(),
-        new DrumModule(),  // This module can be used with MIDI keyboard as a drum machine
-        new PhaserModule(),
-        new FlangerModule(),
-        new CrusherModule(),
-
-        // The following require a MIDI keyboard
-        // new MidiKeysModule(),
-        // new PluckEchoModule(),
-        // new StringKeysModule(),
-        // new ModalKeysModule(),
-        // new FmKeysModule(),
-    };
-    // clang-format on
+    // The buffers always have at least one byte, even if no effect is placed in their region
+    alignas(kEffectAlignment) static uint8_t DSP_HOT_BSS dtcmEffectMemory[kDtcmEffectBytes > 0 ? kDtcmEffectBytes : 1];
+    alignas(kEffectAlignment) static uint8_t DSP_SRAM_DATA sramEffectMemory[kSramEffectBytes > 0 ? kSramEffectBytes : 1];
+    alignas(kEffectAlignment) static uint8_t DSP_SDRAM_BSS sdramEffectMemory[kSdramEffectBytes > 0 ? kSdramEffectBytes : 1];
+
+    uint8_t *const regionMemory[] = {dtcmEffectMemory, sramEffectMemory, sdramEffectMemory};
+    size_t regionUsedBytes[] = {0, 0, 0};
+
+    // The effects are constructed here on the first call rather than at static initialization because the effects read
+    // their parameter meta data from other translation units
+#define EFFECT(name) CreateEffect<EFFECT_CLASS_##name>(regionMemory, regionUsedBytes),
+    static BaseEffectModule *effectList[] = {SELECTED_EFFECTS};
+#undef EFFECT
 
     availableEffectsCount = sizeof(effectList) / sizeof(effectList[0]);
     availableEffects = effectList;